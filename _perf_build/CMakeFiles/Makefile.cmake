@@ -0,0 +1,429 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bench/micro/CMakeLists.txt"
+  "/root/repo/bench/rwlock/CMakeLists.txt"
+  "/root/repo/bench/tiered/CMakeLists.txt"
+  "/root/repo/bench/wt2853_perf/CMakeLists.txt"
+  "/root/repo/bench/wtperf/CMakeLists.txt"
+  "/root/repo/cmake/configs/auto.cmake"
+  "/root/repo/cmake/configs/base.cmake"
+  "/root/repo/cmake/configs/compile_test/pthread_cond_monotonic_test.c"
+  "/root/repo/cmake/configs/modes.cmake"
+  "/root/repo/cmake/configs/version.cmake"
+  "/root/repo/cmake/configs/wiredtiger_config.h.in"
+  "/root/repo/cmake/configs/x86/linux/config.cmake"
+  "/root/repo/cmake/define_libwiredtiger.cmake"
+  "/root/repo/cmake/helpers.cmake"
+  "/root/repo/cmake/install/install.cmake"
+  "/root/repo/cmake/install/wiredtiger.pc.in"
+  "/root/repo/cmake/strict/gcc_strict.cmake"
+  "/root/repo/cmake/strict/gxx_strict.cmake"
+  "/root/repo/cmake/strict/strict_flags_helpers.cmake"
+  "/root/repo/cmake/third_party/aws_sdk.cmake"
+  "/root/repo/cmake/third_party/gcp_sdk.cmake"
+  "/root/repo/cmake/third_party/gperftools.cmake"
+  "/root/repo/cmake/third_party/lazyfs.cmake"
+  "/root/repo/cmake/third_party/lz4.cmake"
+  "/root/repo/cmake/third_party/memkind.cmake"
+  "/root/repo/cmake/third_party/snappy.cmake"
+  "/root/repo/cmake/third_party/sodium.cmake"
+  "/root/repo/cmake/third_party/zlib.cmake"
+  "/root/repo/cmake/third_party/zstd.cmake"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/examples/c/CMakeLists.txt"
+  "/root/repo/ext/CMakeLists.txt"
+  "/root/repo/ext/collators/reverse/CMakeLists.txt"
+  "/root/repo/ext/collators/revint/CMakeLists.txt"
+  "/root/repo/ext/compressors/lz4/CMakeLists.txt"
+  "/root/repo/ext/compressors/nop/CMakeLists.txt"
+  "/root/repo/ext/compressors/snappy/CMakeLists.txt"
+  "/root/repo/ext/compressors/zlib/CMakeLists.txt"
+  "/root/repo/ext/compressors/zstd/CMakeLists.txt"
+  "/root/repo/ext/encryptors/nop/CMakeLists.txt"
+  "/root/repo/ext/encryptors/rotn/CMakeLists.txt"
+  "/root/repo/ext/encryptors/sodium/CMakeLists.txt"
+  "/root/repo/ext/extractors/csv/CMakeLists.txt"
+  "/root/repo/ext/storage_sources/dir_store/CMakeLists.txt"
+  "/root/repo/ext/test/fail_fs/CMakeLists.txt"
+  "/root/repo/src/include/wiredtiger.in"
+  "/root/repo/src/utilities/CMakeLists.txt"
+  "/root/repo/test/CMakeLists.txt"
+  "/root/repo/test/bloom/CMakeLists.txt"
+  "/root/repo/test/checkpoint/CMakeLists.txt"
+  "/root/repo/test/cppsuite/CMakeLists.txt"
+  "/root/repo/test/csuite/CMakeLists.txt"
+  "/root/repo/test/ctest_helpers.cmake"
+  "/root/repo/test/cursor_order/CMakeLists.txt"
+  "/root/repo/test/fops/CMakeLists.txt"
+  "/root/repo/test/format/CMakeLists.txt"
+  "/root/repo/test/huge/CMakeLists.txt"
+  "/root/repo/test/manydbs/CMakeLists.txt"
+  "/root/repo/test/packing/CMakeLists.txt"
+  "/root/repo/test/readonly/CMakeLists.txt"
+  "/root/repo/test/salvage/CMakeLists.txt"
+  "/root/repo/test/simulator/CMakeLists.txt"
+  "/root/repo/test/simulator/timestamp/CMakeLists.txt"
+  "/root/repo/test/simulator/timestamp/call_log_manager/CMakeLists.txt"
+  "/root/repo/test/simulator/timestamp/simulator_interface/CMakeLists.txt"
+  "/root/repo/test/syscall/CMakeLists.txt"
+  "/root/repo/test/thread/CMakeLists.txt"
+  "/root/repo/test/utility/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeASMCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeASMInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCCompilerABI.c"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompiler.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXCompilerABI.cpp"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCompilerIdDetection.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineASMCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompileFeatures.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerABI.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineCompilerId.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDetermineSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitIncludeInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseLibraryArchitecture.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystem.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestASMCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCXXCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeTestCompilerCommon.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeUnixFindMake.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckSymbolExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckTypeSize.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ADSP-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMCC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/ARMClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/AppleClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Borland-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Bruce-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Clang-DetermineCompilerInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Comeau-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Compaq-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Cray-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Embarcadero-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Fujitsu-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/FujitsuClang-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GHS-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-ASM.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-FindBinUtils.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/HP-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IAR-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-C-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMCPP-CXX-DetermineVersionInternal.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IBMClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Intel-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/IntelLLVM-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/LCC-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/MSVC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVHPC-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/NVIDIA-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/OpenWatcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PGI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/PathScale-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SCO-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SDCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/SunPro-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TI-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Tasking-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/TinyCC-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/VisualAge-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/Watcom-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XL-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/XLClang-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-C-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/zOS-CXX-DetermineCompiler.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/FeatureTesting.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-Determine-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/TestBigEndian.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeASMCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "include/wiredtiger.h"
+  "config/wiredtiger_config.h"
+  "wiredtiger.pc"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/compressors/lz4/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/compressors/snappy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/compressors/zlib/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/compressors/zstd/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/compressors/nop/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/collators/reverse/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/collators/revint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/encryptors/nop/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/extractors/csv/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/encryptors/rotn/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/encryptors/sodium/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/storage_sources/dir_store/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "ext/test/fail_fs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/utilities/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/wtperf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/tiered/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/wt2853_perf/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/rwlock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "bench/micro/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/c/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/utility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/bloom/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/checkpoint/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/cursor_order/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/fops/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/huge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/manydbs/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/csuite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/packing/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/format/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/readonly/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/salvage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/syscall/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/thread/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/cppsuite/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/simulator/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/simulator/timestamp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/simulator/timestamp/call_log_manager/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "test/simulator/timestamp/simulator_interface/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/wt_objs.dir/DependInfo.cmake"
+  "CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  "ext/compressors/zlib/CMakeFiles/wiredtiger_zlib.dir/DependInfo.cmake"
+  "ext/compressors/nop/CMakeFiles/wiredtiger_nop_compress.dir/DependInfo.cmake"
+  "ext/collators/reverse/CMakeFiles/wiredtiger_reverse_collator.dir/DependInfo.cmake"
+  "ext/collators/revint/CMakeFiles/wiredtiger_revint_collator.dir/DependInfo.cmake"
+  "ext/encryptors/nop/CMakeFiles/wiredtiger_nop_encrypt.dir/DependInfo.cmake"
+  "ext/extractors/csv/CMakeFiles/wiredtiger_csv_extractor.dir/DependInfo.cmake"
+  "ext/encryptors/rotn/CMakeFiles/wiredtiger_rotn.dir/DependInfo.cmake"
+  "ext/storage_sources/dir_store/CMakeFiles/wiredtiger_dir_store.dir/DependInfo.cmake"
+  "ext/test/fail_fs/CMakeFiles/wiredtiger_fail_fs.dir/DependInfo.cmake"
+  "src/utilities/CMakeFiles/wt.dir/DependInfo.cmake"
+  "bench/wtperf/CMakeFiles/wtperf.dir/DependInfo.cmake"
+  "bench/wtperf/CMakeFiles/create_dir_test_wtperf_small_lsm.dir/DependInfo.cmake"
+  "bench/tiered/CMakeFiles/test_push_pull.dir/DependInfo.cmake"
+  "bench/wt2853_perf/CMakeFiles/test_wt2853_perf.dir/DependInfo.cmake"
+  "bench/rwlock/CMakeFiles/bench_rwlock.dir/DependInfo.cmake"
+  "bench/micro/CMakeFiles/bench_micro.dir/DependInfo.cmake"
+  "examples/CMakeFiles/sym_wt_examples.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_access.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_all.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_backup.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_backup_block.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_call_center.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_col_store.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_config_parse.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_cursor.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_data_source.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_encrypt.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_event_handler.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_extending.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_extractor.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_file_system.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_hello.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_log.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_pack.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_process.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_schema.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_smoke.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_stat.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_thread.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_tiered.dir/DependInfo.cmake"
+  "examples/c/CMakeFiles/ex_verbose.dir/DependInfo.cmake"
+  "test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "test/bloom/CMakeFiles/test_bloom.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/test_checkpoint.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/copy_file_test_checkpoint_recovery-test.sh.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_4_mixed.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_8_mixed.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_4_mixed_sweep.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_4_mixed_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_4_runs_sweep.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_4_runs_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_fixed.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_fixed_named.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_fixed_prepare.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_fixed_named_prepare.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_fixed_stress_sweep_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_fixed_sweep_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_column.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_column_named.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_column_prepare.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_column_named_prepare.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_column_stress_sweep_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_column_sweep_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_row.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_row_named.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_row_prepare.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_row_named_prepare.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_row_stress_sweep_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_row_sweep_timestamps.dir/DependInfo.cmake"
+  "test/checkpoint/CMakeFiles/create_dir_test_checkpoint_6_lsm.dir/DependInfo.cmake"
+  "test/cursor_order/CMakeFiles/test_cursor_order.dir/DependInfo.cmake"
+  "test/cursor_order/CMakeFiles/create_dir_test_cursor_order_row.dir/DependInfo.cmake"
+  "test/cursor_order/CMakeFiles/create_dir_test_cursor_order_var.dir/DependInfo.cmake"
+  "test/cursor_order/CMakeFiles/create_dir_test_cursor_order_fix.dir/DependInfo.cmake"
+  "test/fops/CMakeFiles/test_fops.dir/DependInfo.cmake"
+  "test/huge/CMakeFiles/test_huge.dir/DependInfo.cmake"
+  "test/huge/CMakeFiles/create_dir_test_huge_small.dir/DependInfo.cmake"
+  "test/manydbs/CMakeFiles/test_manydbs.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt10461_skip_list_stress.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_wt10461_skip_list_stress_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_incr_backup.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_incr_backup_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_random_abort.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_random_abort_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_random_directio.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_random_directio_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_rwlock.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_rwlock_time_shift_test.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_rwlock_scalable.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_schema_abort.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_schema_abort_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_scope.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_tiered_abort.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_tiered_abort_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_timestamp_abort.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_timestamp_abort_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_truncated_log.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_truncated_log_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt1965_col_efficiency.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2403_lsm_workload.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2246_col_append.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2323_join_visibility.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2535_insert_race.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_wt2535_insert_race_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2447_join_main_table.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/create_dir_test_wt2447_join_main_table_row.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/create_dir_test_wt2447_join_main_table_col.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2695_checksum.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2592_join_schema.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2719_reconfig.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2834_join_bloom_fix.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2909_checkpoint_integrity.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_wt2909_checkpoint_integrity_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt2999_join_extractor.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt3120_filesys.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt3135_search_near_collator.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt3184_dup_index_collator.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt3338_partial_update.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt3363_checkpoint_op_races.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt3874_pad_byte_collator.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt4105_large_doc_small_upd.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_wt4105_large_doc_small_upd_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt4117_checksum.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt4156_metadata_salvage.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt4333_handle_locks.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt4699_json.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt4803_history_store_abort.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt4891_meta_ckptlist_get_alloc.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt6185_modify_ts.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_wt6185_modify_ts_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt6616_checkpoint_oldest_ts.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/copy_file_test_wt6616_checkpoint_oldest_ts_smoke.sh.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt7989_compact_checkpoint.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt8057_compact_stress.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt8246_compact_rts_data_correctness.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt8659_reconstruct_database_from_logs.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt8963_insert_stress.dir/DependInfo.cmake"
+  "test/csuite/CMakeFiles/test_wt9937_parse_opts.dir/DependInfo.cmake"
+  "test/packing/CMakeFiles/test_packing.dir/DependInfo.cmake"
+  "test/packing/CMakeFiles/test_intpack.dir/DependInfo.cmake"
+  "test/format/CMakeFiles/test_format.dir/DependInfo.cmake"
+  "test/format/CMakeFiles/copy_file_test_format_CONFIG.stress.dir/DependInfo.cmake"
+  "test/format/CMakeFiles/copy_file_test_format_format.sh.dir/DependInfo.cmake"
+  "test/format/CMakeFiles/copy_file_test_format_smoke.sh.dir/DependInfo.cmake"
+  "test/readonly/CMakeFiles/test_readonly.dir/DependInfo.cmake"
+  "test/readonly/CMakeFiles/copy_file_test_readonly_smoke.sh.dir/DependInfo.cmake"
+  "test/salvage/CMakeFiles/test_salvage.dir/DependInfo.cmake"
+  "test/syscall/CMakeFiles/test_wt2336_base.dir/DependInfo.cmake"
+  "test/syscall/CMakeFiles/copy_file_test_wt2336_base_syscall.py.dir/DependInfo.cmake"
+  "test/syscall/CMakeFiles/sync_dir_test_wt2336_base_wt2336_base.dir/DependInfo.cmake"
+  "test/thread/CMakeFiles/test_thread.dir/DependInfo.cmake"
+  "test/thread/CMakeFiles/copy_file_test_thread_smoke.sh.dir/DependInfo.cmake"
+  "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/DependInfo.cmake"
+  "test/cppsuite/CMakeFiles/run.dir/DependInfo.cmake"
+  "test/cppsuite/CMakeFiles/sync_dir_run_baselines.dir/DependInfo.cmake"
+  "test/cppsuite/CMakeFiles/sync_dir_run_configs.dir/DependInfo.cmake"
+  "test/cppsuite/CMakeFiles/csuite_style_example_test.dir/DependInfo.cmake"
+  "test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/DependInfo.cmake"
+  "test/simulator/timestamp/call_log_manager/CMakeFiles/call_log_manager.dir/DependInfo.cmake"
+  "test/simulator/timestamp/simulator_interface/CMakeFiles/simulator_interface.dir/DependInfo.cmake"
+  )
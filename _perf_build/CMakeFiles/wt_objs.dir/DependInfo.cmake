@@ -0,0 +1,227 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/block/block_addr.c" "CMakeFiles/wt_objs.dir/src/block/block_addr.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_addr.c.o.d"
+  "/root/repo/src/block/block_ckpt.c" "CMakeFiles/wt_objs.dir/src/block/block_ckpt.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_ckpt.c.o.d"
+  "/root/repo/src/block/block_ckpt_scan.c" "CMakeFiles/wt_objs.dir/src/block/block_ckpt_scan.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_ckpt_scan.c.o.d"
+  "/root/repo/src/block/block_compact.c" "CMakeFiles/wt_objs.dir/src/block/block_compact.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_compact.c.o.d"
+  "/root/repo/src/block/block_ext.c" "CMakeFiles/wt_objs.dir/src/block/block_ext.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_ext.c.o.d"
+  "/root/repo/src/block/block_open.c" "CMakeFiles/wt_objs.dir/src/block/block_open.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_open.c.o.d"
+  "/root/repo/src/block/block_read.c" "CMakeFiles/wt_objs.dir/src/block/block_read.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_read.c.o.d"
+  "/root/repo/src/block/block_session.c" "CMakeFiles/wt_objs.dir/src/block/block_session.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_session.c.o.d"
+  "/root/repo/src/block/block_slvg.c" "CMakeFiles/wt_objs.dir/src/block/block_slvg.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_slvg.c.o.d"
+  "/root/repo/src/block/block_vrfy.c" "CMakeFiles/wt_objs.dir/src/block/block_vrfy.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_vrfy.c.o.d"
+  "/root/repo/src/block/block_write.c" "CMakeFiles/wt_objs.dir/src/block/block_write.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block/block_write.c.o.d"
+  "/root/repo/src/block_cache/block_cache.c" "CMakeFiles/wt_objs.dir/src/block_cache/block_cache.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block_cache/block_cache.c.o.d"
+  "/root/repo/src/block_cache/block_io.c" "CMakeFiles/wt_objs.dir/src/block_cache/block_io.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block_cache/block_io.c.o.d"
+  "/root/repo/src/block_cache/block_map.c" "CMakeFiles/wt_objs.dir/src/block_cache/block_map.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block_cache/block_map.c.o.d"
+  "/root/repo/src/block_cache/block_mgr.c" "CMakeFiles/wt_objs.dir/src/block_cache/block_mgr.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block_cache/block_mgr.c.o.d"
+  "/root/repo/src/block_cache/block_tier.c" "CMakeFiles/wt_objs.dir/src/block_cache/block_tier.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/block_cache/block_tier.c.o.d"
+  "/root/repo/src/bloom/bloom.c" "CMakeFiles/wt_objs.dir/src/bloom/bloom.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/bloom/bloom.c.o.d"
+  "/root/repo/src/btree/bt_compact.c" "CMakeFiles/wt_objs.dir/src/btree/bt_compact.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_compact.c.o.d"
+  "/root/repo/src/btree/bt_curnext.c" "CMakeFiles/wt_objs.dir/src/btree/bt_curnext.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_curnext.c.o.d"
+  "/root/repo/src/btree/bt_curprev.c" "CMakeFiles/wt_objs.dir/src/btree/bt_curprev.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_curprev.c.o.d"
+  "/root/repo/src/btree/bt_cursor.c" "CMakeFiles/wt_objs.dir/src/btree/bt_cursor.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_cursor.c.o.d"
+  "/root/repo/src/btree/bt_debug.c" "CMakeFiles/wt_objs.dir/src/btree/bt_debug.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_debug.c.o.d"
+  "/root/repo/src/btree/bt_delete.c" "CMakeFiles/wt_objs.dir/src/btree/bt_delete.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_delete.c.o.d"
+  "/root/repo/src/btree/bt_discard.c" "CMakeFiles/wt_objs.dir/src/btree/bt_discard.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_discard.c.o.d"
+  "/root/repo/src/btree/bt_handle.c" "CMakeFiles/wt_objs.dir/src/btree/bt_handle.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_handle.c.o.d"
+  "/root/repo/src/btree/bt_huffman.c" "CMakeFiles/wt_objs.dir/src/btree/bt_huffman.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_huffman.c.o.d"
+  "/root/repo/src/btree/bt_import.c" "CMakeFiles/wt_objs.dir/src/btree/bt_import.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_import.c.o.d"
+  "/root/repo/src/btree/bt_misc.c" "CMakeFiles/wt_objs.dir/src/btree/bt_misc.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_misc.c.o.d"
+  "/root/repo/src/btree/bt_ovfl.c" "CMakeFiles/wt_objs.dir/src/btree/bt_ovfl.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_ovfl.c.o.d"
+  "/root/repo/src/btree/bt_page.c" "CMakeFiles/wt_objs.dir/src/btree/bt_page.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_page.c.o.d"
+  "/root/repo/src/btree/bt_random.c" "CMakeFiles/wt_objs.dir/src/btree/bt_random.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_random.c.o.d"
+  "/root/repo/src/btree/bt_read.c" "CMakeFiles/wt_objs.dir/src/btree/bt_read.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_read.c.o.d"
+  "/root/repo/src/btree/bt_ret.c" "CMakeFiles/wt_objs.dir/src/btree/bt_ret.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_ret.c.o.d"
+  "/root/repo/src/btree/bt_slvg.c" "CMakeFiles/wt_objs.dir/src/btree/bt_slvg.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_slvg.c.o.d"
+  "/root/repo/src/btree/bt_split.c" "CMakeFiles/wt_objs.dir/src/btree/bt_split.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_split.c.o.d"
+  "/root/repo/src/btree/bt_stat.c" "CMakeFiles/wt_objs.dir/src/btree/bt_stat.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_stat.c.o.d"
+  "/root/repo/src/btree/bt_sync.c" "CMakeFiles/wt_objs.dir/src/btree/bt_sync.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_sync.c.o.d"
+  "/root/repo/src/btree/bt_ttl.c" "CMakeFiles/wt_objs.dir/src/btree/bt_ttl.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_ttl.c.o.d"
+  "/root/repo/src/btree/bt_upgrade.c" "CMakeFiles/wt_objs.dir/src/btree/bt_upgrade.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_upgrade.c.o.d"
+  "/root/repo/src/btree/bt_vrfy.c" "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy.c.o.d"
+  "/root/repo/src/btree/bt_vrfy_dsk.c" "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy_dsk.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy_dsk.c.o.d"
+  "/root/repo/src/btree/bt_walk.c" "CMakeFiles/wt_objs.dir/src/btree/bt_walk.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/bt_walk.c.o.d"
+  "/root/repo/src/btree/col_modify.c" "CMakeFiles/wt_objs.dir/src/btree/col_modify.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/col_modify.c.o.d"
+  "/root/repo/src/btree/col_srch.c" "CMakeFiles/wt_objs.dir/src/btree/col_srch.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/col_srch.c.o.d"
+  "/root/repo/src/btree/row_key.c" "CMakeFiles/wt_objs.dir/src/btree/row_key.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/row_key.c.o.d"
+  "/root/repo/src/btree/row_modify.c" "CMakeFiles/wt_objs.dir/src/btree/row_modify.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/row_modify.c.o.d"
+  "/root/repo/src/btree/row_srch.c" "CMakeFiles/wt_objs.dir/src/btree/row_srch.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/btree/row_srch.c.o.d"
+  "/root/repo/src/call_log/call_log.c" "CMakeFiles/wt_objs.dir/src/call_log/call_log.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/call_log/call_log.c.o.d"
+  "/root/repo/src/checksum/software/checksum.c" "CMakeFiles/wt_objs.dir/src/checksum/software/checksum.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/checksum/software/checksum.c.o.d"
+  "/root/repo/src/checksum/x86/crc32-x86-alt.c" "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86-alt.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86-alt.c.o.d"
+  "/root/repo/src/checksum/x86/crc32-x86.c" "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86.c.o.d"
+  "/root/repo/src/config/config.c" "CMakeFiles/wt_objs.dir/src/config/config.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/config/config.c.o.d"
+  "/root/repo/src/config/config_api.c" "CMakeFiles/wt_objs.dir/src/config/config_api.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/config/config_api.c.o.d"
+  "/root/repo/src/config/config_check.c" "CMakeFiles/wt_objs.dir/src/config/config_check.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/config/config_check.c.o.d"
+  "/root/repo/src/config/config_collapse.c" "CMakeFiles/wt_objs.dir/src/config/config_collapse.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/config/config_collapse.c.o.d"
+  "/root/repo/src/config/config_def.c" "CMakeFiles/wt_objs.dir/src/config/config_def.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/config/config_def.c.o.d"
+  "/root/repo/src/config/config_ext.c" "CMakeFiles/wt_objs.dir/src/config/config_ext.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/config/config_ext.c.o.d"
+  "/root/repo/src/config/test_config.c" "CMakeFiles/wt_objs.dir/src/config/test_config.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/config/test_config.c.o.d"
+  "/root/repo/src/conn/api_calc_modify.c" "CMakeFiles/wt_objs.dir/src/conn/api_calc_modify.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/api_calc_modify.c.o.d"
+  "/root/repo/src/conn/api_strerror.c" "CMakeFiles/wt_objs.dir/src/conn/api_strerror.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/api_strerror.c.o.d"
+  "/root/repo/src/conn/api_version.c" "CMakeFiles/wt_objs.dir/src/conn/api_version.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/api_version.c.o.d"
+  "/root/repo/src/conn/conn_api.c" "CMakeFiles/wt_objs.dir/src/conn/conn_api.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_api.c.o.d"
+  "/root/repo/src/conn/conn_cache.c" "CMakeFiles/wt_objs.dir/src/conn/conn_cache.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_cache.c.o.d"
+  "/root/repo/src/conn/conn_cache_pool.c" "CMakeFiles/wt_objs.dir/src/conn/conn_cache_pool.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_cache_pool.c.o.d"
+  "/root/repo/src/conn/conn_capacity.c" "CMakeFiles/wt_objs.dir/src/conn/conn_capacity.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_capacity.c.o.d"
+  "/root/repo/src/conn/conn_ckpt.c" "CMakeFiles/wt_objs.dir/src/conn/conn_ckpt.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_ckpt.c.o.d"
+  "/root/repo/src/conn/conn_compact.c" "CMakeFiles/wt_objs.dir/src/conn/conn_compact.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_compact.c.o.d"
+  "/root/repo/src/conn/conn_dhandle.c" "CMakeFiles/wt_objs.dir/src/conn/conn_dhandle.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_dhandle.c.o.d"
+  "/root/repo/src/conn/conn_handle.c" "CMakeFiles/wt_objs.dir/src/conn/conn_handle.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_handle.c.o.d"
+  "/root/repo/src/conn/conn_log.c" "CMakeFiles/wt_objs.dir/src/conn/conn_log.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_log.c.o.d"
+  "/root/repo/src/conn/conn_open.c" "CMakeFiles/wt_objs.dir/src/conn/conn_open.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_open.c.o.d"
+  "/root/repo/src/conn/conn_reconfig.c" "CMakeFiles/wt_objs.dir/src/conn/conn_reconfig.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_reconfig.c.o.d"
+  "/root/repo/src/conn/conn_stat.c" "CMakeFiles/wt_objs.dir/src/conn/conn_stat.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_stat.c.o.d"
+  "/root/repo/src/conn/conn_sweep.c" "CMakeFiles/wt_objs.dir/src/conn/conn_sweep.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_sweep.c.o.d"
+  "/root/repo/src/conn/conn_tiered.c" "CMakeFiles/wt_objs.dir/src/conn/conn_tiered.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/conn/conn_tiered.c.o.d"
+  "/root/repo/src/cursor/cur_backup.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_backup.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_backup.c.o.d"
+  "/root/repo/src/cursor/cur_backup_incr.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_backup_incr.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_backup_incr.c.o.d"
+  "/root/repo/src/cursor/cur_batch.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_batch.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_batch.c.o.d"
+  "/root/repo/src/cursor/cur_bulk.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_bulk.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_bulk.c.o.d"
+  "/root/repo/src/cursor/cur_config.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_config.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_config.c.o.d"
+  "/root/repo/src/cursor/cur_ds.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_ds.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_ds.c.o.d"
+  "/root/repo/src/cursor/cur_dump.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_dump.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_dump.c.o.d"
+  "/root/repo/src/cursor/cur_file.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_file.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_file.c.o.d"
+  "/root/repo/src/cursor/cur_hs.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_hs.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_hs.c.o.d"
+  "/root/repo/src/cursor/cur_index.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_index.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_index.c.o.d"
+  "/root/repo/src/cursor/cur_join.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_join.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_join.c.o.d"
+  "/root/repo/src/cursor/cur_json.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_json.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_json.c.o.d"
+  "/root/repo/src/cursor/cur_log.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_log.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_log.c.o.d"
+  "/root/repo/src/cursor/cur_metadata.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_metadata.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_metadata.c.o.d"
+  "/root/repo/src/cursor/cur_stat.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_stat.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_stat.c.o.d"
+  "/root/repo/src/cursor/cur_std.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_std.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_std.c.o.d"
+  "/root/repo/src/cursor/cur_table.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_table.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_table.c.o.d"
+  "/root/repo/src/cursor/cur_version.c" "CMakeFiles/wt_objs.dir/src/cursor/cur_version.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/cursor/cur_version.c.o.d"
+  "/root/repo/src/evict/evict_file.c" "CMakeFiles/wt_objs.dir/src/evict/evict_file.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/evict/evict_file.c.o.d"
+  "/root/repo/src/evict/evict_lru.c" "CMakeFiles/wt_objs.dir/src/evict/evict_lru.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/evict/evict_lru.c.o.d"
+  "/root/repo/src/evict/evict_page.c" "CMakeFiles/wt_objs.dir/src/evict/evict_page.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/evict/evict_page.c.o.d"
+  "/root/repo/src/evict/evict_stat.c" "CMakeFiles/wt_objs.dir/src/evict/evict_stat.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/evict/evict_stat.c.o.d"
+  "/root/repo/src/history/hs_conn.c" "CMakeFiles/wt_objs.dir/src/history/hs_conn.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/history/hs_conn.c.o.d"
+  "/root/repo/src/history/hs_cursor.c" "CMakeFiles/wt_objs.dir/src/history/hs_cursor.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/history/hs_cursor.c.o.d"
+  "/root/repo/src/history/hs_rec.c" "CMakeFiles/wt_objs.dir/src/history/hs_rec.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/history/hs_rec.c.o.d"
+  "/root/repo/src/log/log.c" "CMakeFiles/wt_objs.dir/src/log/log.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/log/log.c.o.d"
+  "/root/repo/src/log/log_auto.c" "CMakeFiles/wt_objs.dir/src/log/log_auto.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/log/log_auto.c.o.d"
+  "/root/repo/src/log/log_slot.c" "CMakeFiles/wt_objs.dir/src/log/log_slot.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/log/log_slot.c.o.d"
+  "/root/repo/src/log/log_sys.c" "CMakeFiles/wt_objs.dir/src/log/log_sys.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/log/log_sys.c.o.d"
+  "/root/repo/src/lsm/lsm_cursor.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor.c.o.d"
+  "/root/repo/src/lsm/lsm_cursor_bulk.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor_bulk.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor_bulk.c.o.d"
+  "/root/repo/src/lsm/lsm_manager.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_manager.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_manager.c.o.d"
+  "/root/repo/src/lsm/lsm_merge.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_merge.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_merge.c.o.d"
+  "/root/repo/src/lsm/lsm_meta.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_meta.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_meta.c.o.d"
+  "/root/repo/src/lsm/lsm_stat.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_stat.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_stat.c.o.d"
+  "/root/repo/src/lsm/lsm_tree.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_tree.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_tree.c.o.d"
+  "/root/repo/src/lsm/lsm_work_unit.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_work_unit.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_work_unit.c.o.d"
+  "/root/repo/src/lsm/lsm_worker.c" "CMakeFiles/wt_objs.dir/src/lsm/lsm_worker.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/lsm/lsm_worker.c.o.d"
+  "/root/repo/src/meta/meta_apply.c" "CMakeFiles/wt_objs.dir/src/meta/meta_apply.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/meta/meta_apply.c.o.d"
+  "/root/repo/src/meta/meta_ckpt.c" "CMakeFiles/wt_objs.dir/src/meta/meta_ckpt.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/meta/meta_ckpt.c.o.d"
+  "/root/repo/src/meta/meta_ext.c" "CMakeFiles/wt_objs.dir/src/meta/meta_ext.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/meta/meta_ext.c.o.d"
+  "/root/repo/src/meta/meta_table.c" "CMakeFiles/wt_objs.dir/src/meta/meta_table.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/meta/meta_table.c.o.d"
+  "/root/repo/src/meta/meta_track.c" "CMakeFiles/wt_objs.dir/src/meta/meta_track.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/meta/meta_track.c.o.d"
+  "/root/repo/src/meta/meta_turtle.c" "CMakeFiles/wt_objs.dir/src/meta/meta_turtle.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/meta/meta_turtle.c.o.d"
+  "/root/repo/src/optrack/capture.c" "CMakeFiles/wt_objs.dir/src/optrack/capture.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/optrack/capture.c.o.d"
+  "/root/repo/src/optrack/event_trace.c" "CMakeFiles/wt_objs.dir/src/optrack/event_trace.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/optrack/event_trace.c.o.d"
+  "/root/repo/src/optrack/optrack.c" "CMakeFiles/wt_objs.dir/src/optrack/optrack.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/optrack/optrack.c.o.d"
+  "/root/repo/src/os_common/filename.c" "CMakeFiles/wt_objs.dir/src/os_common/filename.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/filename.c.o.d"
+  "/root/repo/src/os_common/os_abort.c" "CMakeFiles/wt_objs.dir/src/os_common/os_abort.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_abort.c.o.d"
+  "/root/repo/src/os_common/os_alloc.c" "CMakeFiles/wt_objs.dir/src/os_common/os_alloc.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_alloc.c.o.d"
+  "/root/repo/src/os_common/os_errno.c" "CMakeFiles/wt_objs.dir/src/os_common/os_errno.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_errno.c.o.d"
+  "/root/repo/src/os_common/os_fhandle.c" "CMakeFiles/wt_objs.dir/src/os_common/os_fhandle.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_fhandle.c.o.d"
+  "/root/repo/src/os_common/os_fs_inmemory.c" "CMakeFiles/wt_objs.dir/src/os_common/os_fs_inmemory.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_fs_inmemory.c.o.d"
+  "/root/repo/src/os_common/os_fstream.c" "CMakeFiles/wt_objs.dir/src/os_common/os_fstream.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_fstream.c.o.d"
+  "/root/repo/src/os_common/os_fstream_stdio.c" "CMakeFiles/wt_objs.dir/src/os_common/os_fstream_stdio.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_fstream_stdio.c.o.d"
+  "/root/repo/src/os_common/os_getopt.c" "CMakeFiles/wt_objs.dir/src/os_common/os_getopt.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_getopt.c.o.d"
+  "/root/repo/src/os_common/os_strtouq.c" "CMakeFiles/wt_objs.dir/src/os_common/os_strtouq.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_common/os_strtouq.c.o.d"
+  "/root/repo/src/os_posix/os_dir.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_dir.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_dir.c.o.d"
+  "/root/repo/src/os_posix/os_dlopen.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_dlopen.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_dlopen.c.o.d"
+  "/root/repo/src/os_posix/os_fallocate.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_fallocate.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_fallocate.c.o.d"
+  "/root/repo/src/os_posix/os_fs.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_fs.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_fs.c.o.d"
+  "/root/repo/src/os_posix/os_getenv.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_getenv.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_getenv.c.o.d"
+  "/root/repo/src/os_posix/os_map.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_map.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_map.c.o.d"
+  "/root/repo/src/os_posix/os_mtx_cond.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_mtx_cond.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_mtx_cond.c.o.d"
+  "/root/repo/src/os_posix/os_once.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_once.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_once.c.o.d"
+  "/root/repo/src/os_posix/os_pagesize.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_pagesize.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_pagesize.c.o.d"
+  "/root/repo/src/os_posix/os_path.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_path.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_path.c.o.d"
+  "/root/repo/src/os_posix/os_priv.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_priv.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_priv.c.o.d"
+  "/root/repo/src/os_posix/os_setvbuf.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_setvbuf.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_setvbuf.c.o.d"
+  "/root/repo/src/os_posix/os_sleep.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_sleep.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_sleep.c.o.d"
+  "/root/repo/src/os_posix/os_snprintf.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_snprintf.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_snprintf.c.o.d"
+  "/root/repo/src/os_posix/os_thread.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_thread.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_thread.c.o.d"
+  "/root/repo/src/os_posix/os_time.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_time.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_time.c.o.d"
+  "/root/repo/src/os_posix/os_yield.c" "CMakeFiles/wt_objs.dir/src/os_posix/os_yield.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/os_posix/os_yield.c.o.d"
+  "/root/repo/src/packing/pack_api.c" "CMakeFiles/wt_objs.dir/src/packing/pack_api.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/packing/pack_api.c.o.d"
+  "/root/repo/src/packing/pack_impl.c" "CMakeFiles/wt_objs.dir/src/packing/pack_impl.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/packing/pack_impl.c.o.d"
+  "/root/repo/src/packing/pack_stream.c" "CMakeFiles/wt_objs.dir/src/packing/pack_stream.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/packing/pack_stream.c.o.d"
+  "/root/repo/src/reconcile/rec_child.c" "CMakeFiles/wt_objs.dir/src/reconcile/rec_child.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/reconcile/rec_child.c.o.d"
+  "/root/repo/src/reconcile/rec_col.c" "CMakeFiles/wt_objs.dir/src/reconcile/rec_col.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/reconcile/rec_col.c.o.d"
+  "/root/repo/src/reconcile/rec_dictionary.c" "CMakeFiles/wt_objs.dir/src/reconcile/rec_dictionary.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/reconcile/rec_dictionary.c.o.d"
+  "/root/repo/src/reconcile/rec_row.c" "CMakeFiles/wt_objs.dir/src/reconcile/rec_row.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/reconcile/rec_row.c.o.d"
+  "/root/repo/src/reconcile/rec_track.c" "CMakeFiles/wt_objs.dir/src/reconcile/rec_track.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/reconcile/rec_track.c.o.d"
+  "/root/repo/src/reconcile/rec_visibility.c" "CMakeFiles/wt_objs.dir/src/reconcile/rec_visibility.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/reconcile/rec_visibility.c.o.d"
+  "/root/repo/src/reconcile/rec_write.c" "CMakeFiles/wt_objs.dir/src/reconcile/rec_write.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/reconcile/rec_write.c.o.d"
+  "/root/repo/src/rollback_to_stable/rts.c" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts.c.o.d"
+  "/root/repo/src/rollback_to_stable/rts_api.c" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_api.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_api.c.o.d"
+  "/root/repo/src/rollback_to_stable/rts_btree.c" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree.c.o.d"
+  "/root/repo/src/rollback_to_stable/rts_btree_walk.c" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree_walk.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree_walk.c.o.d"
+  "/root/repo/src/rollback_to_stable/rts_history.c" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_history.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_history.c.o.d"
+  "/root/repo/src/rollback_to_stable/rts_visibility.c" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_visibility.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_visibility.c.o.d"
+  "/root/repo/src/schema/schema_alter.c" "CMakeFiles/wt_objs.dir/src/schema/schema_alter.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_alter.c.o.d"
+  "/root/repo/src/schema/schema_create.c" "CMakeFiles/wt_objs.dir/src/schema/schema_create.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_create.c.o.d"
+  "/root/repo/src/schema/schema_drop.c" "CMakeFiles/wt_objs.dir/src/schema/schema_drop.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_drop.c.o.d"
+  "/root/repo/src/schema/schema_list.c" "CMakeFiles/wt_objs.dir/src/schema/schema_list.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_list.c.o.d"
+  "/root/repo/src/schema/schema_open.c" "CMakeFiles/wt_objs.dir/src/schema/schema_open.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_open.c.o.d"
+  "/root/repo/src/schema/schema_plan.c" "CMakeFiles/wt_objs.dir/src/schema/schema_plan.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_plan.c.o.d"
+  "/root/repo/src/schema/schema_project.c" "CMakeFiles/wt_objs.dir/src/schema/schema_project.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_project.c.o.d"
+  "/root/repo/src/schema/schema_rename.c" "CMakeFiles/wt_objs.dir/src/schema/schema_rename.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_rename.c.o.d"
+  "/root/repo/src/schema/schema_stat.c" "CMakeFiles/wt_objs.dir/src/schema/schema_stat.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_stat.c.o.d"
+  "/root/repo/src/schema/schema_truncate.c" "CMakeFiles/wt_objs.dir/src/schema/schema_truncate.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_truncate.c.o.d"
+  "/root/repo/src/schema/schema_util.c" "CMakeFiles/wt_objs.dir/src/schema/schema_util.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_util.c.o.d"
+  "/root/repo/src/schema/schema_worker.c" "CMakeFiles/wt_objs.dir/src/schema/schema_worker.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/schema/schema_worker.c.o.d"
+  "/root/repo/src/session/session_api.c" "CMakeFiles/wt_objs.dir/src/session/session_api.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/session/session_api.c.o.d"
+  "/root/repo/src/session/session_compact.c" "CMakeFiles/wt_objs.dir/src/session/session_compact.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/session/session_compact.c.o.d"
+  "/root/repo/src/session/session_dhandle.c" "CMakeFiles/wt_objs.dir/src/session/session_dhandle.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/session/session_dhandle.c.o.d"
+  "/root/repo/src/support/cond_auto.c" "CMakeFiles/wt_objs.dir/src/support/cond_auto.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/cond_auto.c.o.d"
+  "/root/repo/src/support/crypto.c" "CMakeFiles/wt_objs.dir/src/support/crypto.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/crypto.c.o.d"
+  "/root/repo/src/support/err.c" "CMakeFiles/wt_objs.dir/src/support/err.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/err.c.o.d"
+  "/root/repo/src/support/generation.c" "CMakeFiles/wt_objs.dir/src/support/generation.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/generation.c.o.d"
+  "/root/repo/src/support/global.c" "CMakeFiles/wt_objs.dir/src/support/global.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/global.c.o.d"
+  "/root/repo/src/support/hash_city.c" "CMakeFiles/wt_objs.dir/src/support/hash_city.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/hash_city.c.o.d"
+  "/root/repo/src/support/hash_fnv.c" "CMakeFiles/wt_objs.dir/src/support/hash_fnv.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/hash_fnv.c.o.d"
+  "/root/repo/src/support/hazard.c" "CMakeFiles/wt_objs.dir/src/support/hazard.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/hazard.c.o.d"
+  "/root/repo/src/support/hex.c" "CMakeFiles/wt_objs.dir/src/support/hex.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/hex.c.o.d"
+  "/root/repo/src/support/huffman.c" "CMakeFiles/wt_objs.dir/src/support/huffman.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/huffman.c.o.d"
+  "/root/repo/src/support/latency.c" "CMakeFiles/wt_objs.dir/src/support/latency.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/latency.c.o.d"
+  "/root/repo/src/support/lock_ext.c" "CMakeFiles/wt_objs.dir/src/support/lock_ext.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/lock_ext.c.o.d"
+  "/root/repo/src/support/modify.c" "CMakeFiles/wt_objs.dir/src/support/modify.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/modify.c.o.d"
+  "/root/repo/src/support/mtx_rw.c" "CMakeFiles/wt_objs.dir/src/support/mtx_rw.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/mtx_rw.c.o.d"
+  "/root/repo/src/support/pow.c" "CMakeFiles/wt_objs.dir/src/support/pow.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/pow.c.o.d"
+  "/root/repo/src/support/rand.c" "CMakeFiles/wt_objs.dir/src/support/rand.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/rand.c.o.d"
+  "/root/repo/src/support/scratch.c" "CMakeFiles/wt_objs.dir/src/support/scratch.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/scratch.c.o.d"
+  "/root/repo/src/support/stat.c" "CMakeFiles/wt_objs.dir/src/support/stat.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/stat.c.o.d"
+  "/root/repo/src/support/thread_group.c" "CMakeFiles/wt_objs.dir/src/support/thread_group.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/thread_group.c.o.d"
+  "/root/repo/src/support/timestamp.c" "CMakeFiles/wt_objs.dir/src/support/timestamp.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/timestamp.c.o.d"
+  "/root/repo/src/support/update_vector.c" "CMakeFiles/wt_objs.dir/src/support/update_vector.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/support/update_vector.c.o.d"
+  "/root/repo/src/tiered/tiered_config.c" "CMakeFiles/wt_objs.dir/src/tiered/tiered_config.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/tiered/tiered_config.c.o.d"
+  "/root/repo/src/tiered/tiered_handle.c" "CMakeFiles/wt_objs.dir/src/tiered/tiered_handle.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/tiered/tiered_handle.c.o.d"
+  "/root/repo/src/tiered/tiered_work.c" "CMakeFiles/wt_objs.dir/src/tiered/tiered_work.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/tiered/tiered_work.c.o.d"
+  "/root/repo/src/txn/txn.c" "CMakeFiles/wt_objs.dir/src/txn/txn.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/txn/txn.c.o.d"
+  "/root/repo/src/txn/txn_ckpt.c" "CMakeFiles/wt_objs.dir/src/txn/txn_ckpt.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/txn/txn_ckpt.c.o.d"
+  "/root/repo/src/txn/txn_log.c" "CMakeFiles/wt_objs.dir/src/txn/txn_log.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/txn/txn_log.c.o.d"
+  "/root/repo/src/txn/txn_recover.c" "CMakeFiles/wt_objs.dir/src/txn/txn_recover.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/txn/txn_recover.c.o.d"
+  "/root/repo/src/txn/txn_timestamp.c" "CMakeFiles/wt_objs.dir/src/txn/txn_timestamp.c.o" "gcc" "CMakeFiles/wt_objs.dir/src/txn/txn_timestamp.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,425 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wt_objs.dir/src/block/block_addr.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_addr.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_ckpt.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_ckpt.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_ckpt_scan.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_ckpt_scan.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_compact.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_compact.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_ext.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_ext.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_open.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_open.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_read.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_read.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_session.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_session.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_slvg.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_slvg.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_vrfy.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_vrfy.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block/block_write.c.o"
+  "CMakeFiles/wt_objs.dir/src/block/block_write.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_cache.c.o"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_cache.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_io.c.o"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_io.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_map.c.o"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_map.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_mgr.c.o"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_mgr.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_tier.c.o"
+  "CMakeFiles/wt_objs.dir/src/block_cache/block_tier.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/bloom/bloom.c.o"
+  "CMakeFiles/wt_objs.dir/src/bloom/bloom.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_compact.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_compact.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_curnext.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_curnext.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_curprev.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_curprev.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_cursor.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_cursor.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_debug.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_debug.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_delete.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_delete.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_discard.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_discard.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_handle.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_handle.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_huffman.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_huffman.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_import.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_import.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_misc.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_misc.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_ovfl.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_ovfl.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_page.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_page.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_random.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_random.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_read.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_read.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_ret.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_ret.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_slvg.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_slvg.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_split.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_split.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_stat.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_stat.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_sync.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_sync.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_ttl.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_ttl.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_upgrade.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_upgrade.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy_dsk.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_vrfy_dsk.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_walk.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/bt_walk.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/col_modify.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/col_modify.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/col_srch.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/col_srch.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/row_key.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/row_key.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/row_modify.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/row_modify.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/btree/row_srch.c.o"
+  "CMakeFiles/wt_objs.dir/src/btree/row_srch.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/call_log/call_log.c.o"
+  "CMakeFiles/wt_objs.dir/src/call_log/call_log.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/checksum/software/checksum.c.o"
+  "CMakeFiles/wt_objs.dir/src/checksum/software/checksum.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86-alt.c.o"
+  "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86-alt.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86.c.o"
+  "CMakeFiles/wt_objs.dir/src/checksum/x86/crc32-x86.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/config/config.c.o"
+  "CMakeFiles/wt_objs.dir/src/config/config.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/config/config_api.c.o"
+  "CMakeFiles/wt_objs.dir/src/config/config_api.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/config/config_check.c.o"
+  "CMakeFiles/wt_objs.dir/src/config/config_check.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/config/config_collapse.c.o"
+  "CMakeFiles/wt_objs.dir/src/config/config_collapse.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/config/config_def.c.o"
+  "CMakeFiles/wt_objs.dir/src/config/config_def.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/config/config_ext.c.o"
+  "CMakeFiles/wt_objs.dir/src/config/config_ext.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/config/test_config.c.o"
+  "CMakeFiles/wt_objs.dir/src/config/test_config.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/api_calc_modify.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/api_calc_modify.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/api_strerror.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/api_strerror.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/api_version.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/api_version.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_api.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_api.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_cache.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_cache.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_cache_pool.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_cache_pool.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_capacity.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_capacity.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_ckpt.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_ckpt.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_compact.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_compact.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_dhandle.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_dhandle.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_handle.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_handle.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_log.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_log.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_open.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_open.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_reconfig.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_reconfig.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_stat.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_stat.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_sweep.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_sweep.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_tiered.c.o"
+  "CMakeFiles/wt_objs.dir/src/conn/conn_tiered.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_backup.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_backup.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_backup_incr.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_backup_incr.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_batch.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_batch.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_bulk.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_bulk.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_config.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_config.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_ds.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_ds.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_dump.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_dump.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_file.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_file.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_hs.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_hs.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_index.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_index.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_join.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_join.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_json.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_json.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_log.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_log.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_metadata.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_metadata.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_stat.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_stat.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_std.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_std.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_table.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_table.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_version.c.o"
+  "CMakeFiles/wt_objs.dir/src/cursor/cur_version.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_file.c.o"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_file.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_lru.c.o"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_lru.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_page.c.o"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_page.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_stat.c.o"
+  "CMakeFiles/wt_objs.dir/src/evict/evict_stat.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/history/hs_conn.c.o"
+  "CMakeFiles/wt_objs.dir/src/history/hs_conn.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/history/hs_cursor.c.o"
+  "CMakeFiles/wt_objs.dir/src/history/hs_cursor.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/history/hs_rec.c.o"
+  "CMakeFiles/wt_objs.dir/src/history/hs_rec.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/log/log.c.o"
+  "CMakeFiles/wt_objs.dir/src/log/log.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/log/log_auto.c.o"
+  "CMakeFiles/wt_objs.dir/src/log/log_auto.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/log/log_slot.c.o"
+  "CMakeFiles/wt_objs.dir/src/log/log_slot.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/log/log_sys.c.o"
+  "CMakeFiles/wt_objs.dir/src/log/log_sys.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor_bulk.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_cursor_bulk.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_manager.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_manager.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_merge.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_merge.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_meta.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_meta.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_stat.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_stat.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_tree.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_tree.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_work_unit.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_work_unit.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_worker.c.o"
+  "CMakeFiles/wt_objs.dir/src/lsm/lsm_worker.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_apply.c.o"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_apply.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_ckpt.c.o"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_ckpt.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_ext.c.o"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_ext.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_table.c.o"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_table.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_track.c.o"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_track.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_turtle.c.o"
+  "CMakeFiles/wt_objs.dir/src/meta/meta_turtle.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/optrack/capture.c.o"
+  "CMakeFiles/wt_objs.dir/src/optrack/capture.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/optrack/event_trace.c.o"
+  "CMakeFiles/wt_objs.dir/src/optrack/event_trace.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/optrack/optrack.c.o"
+  "CMakeFiles/wt_objs.dir/src/optrack/optrack.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/filename.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/filename.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_abort.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_abort.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_alloc.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_alloc.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_errno.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_errno.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fhandle.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fhandle.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fs_inmemory.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fs_inmemory.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fstream.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fstream.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fstream_stdio.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_fstream_stdio.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_getopt.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_getopt.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_strtouq.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_common/os_strtouq.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_dir.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_dir.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_dlopen.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_dlopen.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_fallocate.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_fallocate.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_fs.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_fs.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_getenv.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_getenv.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_map.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_map.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_mtx_cond.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_mtx_cond.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_once.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_once.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_pagesize.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_pagesize.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_path.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_path.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_priv.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_priv.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_setvbuf.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_setvbuf.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_sleep.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_sleep.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_snprintf.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_snprintf.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_thread.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_thread.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_time.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_time.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_yield.c.o"
+  "CMakeFiles/wt_objs.dir/src/os_posix/os_yield.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/packing/pack_api.c.o"
+  "CMakeFiles/wt_objs.dir/src/packing/pack_api.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/packing/pack_impl.c.o"
+  "CMakeFiles/wt_objs.dir/src/packing/pack_impl.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/packing/pack_stream.c.o"
+  "CMakeFiles/wt_objs.dir/src/packing/pack_stream.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_child.c.o"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_child.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_col.c.o"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_col.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_dictionary.c.o"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_dictionary.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_row.c.o"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_row.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_track.c.o"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_track.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_visibility.c.o"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_visibility.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_write.c.o"
+  "CMakeFiles/wt_objs.dir/src/reconcile/rec_write.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts.c.o"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_api.c.o"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_api.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree.c.o"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree_walk.c.o"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_btree_walk.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_history.c.o"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_history.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_visibility.c.o"
+  "CMakeFiles/wt_objs.dir/src/rollback_to_stable/rts_visibility.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_alter.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_alter.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_create.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_create.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_drop.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_drop.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_list.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_list.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_open.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_open.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_plan.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_plan.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_project.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_project.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_rename.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_rename.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_stat.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_stat.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_truncate.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_truncate.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_util.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_util.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_worker.c.o"
+  "CMakeFiles/wt_objs.dir/src/schema/schema_worker.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/session/session_api.c.o"
+  "CMakeFiles/wt_objs.dir/src/session/session_api.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/session/session_compact.c.o"
+  "CMakeFiles/wt_objs.dir/src/session/session_compact.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/session/session_dhandle.c.o"
+  "CMakeFiles/wt_objs.dir/src/session/session_dhandle.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/cond_auto.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/cond_auto.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/crypto.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/crypto.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/err.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/err.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/generation.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/generation.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/global.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/global.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/hash_city.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/hash_city.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/hash_fnv.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/hash_fnv.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/hazard.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/hazard.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/hex.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/hex.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/huffman.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/huffman.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/latency.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/latency.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/lock_ext.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/lock_ext.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/modify.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/modify.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/mtx_rw.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/mtx_rw.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/pow.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/pow.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/rand.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/rand.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/scratch.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/scratch.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/stat.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/stat.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/thread_group.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/thread_group.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/timestamp.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/timestamp.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/support/update_vector.c.o"
+  "CMakeFiles/wt_objs.dir/src/support/update_vector.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/tiered/tiered_config.c.o"
+  "CMakeFiles/wt_objs.dir/src/tiered/tiered_config.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/tiered/tiered_handle.c.o"
+  "CMakeFiles/wt_objs.dir/src/tiered/tiered_handle.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/tiered/tiered_work.c.o"
+  "CMakeFiles/wt_objs.dir/src/tiered/tiered_work.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/txn/txn.c.o"
+  "CMakeFiles/wt_objs.dir/src/txn/txn.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_ckpt.c.o"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_ckpt.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_log.c.o"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_log.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_recover.c.o"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_recover.c.o.d"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_timestamp.c.o"
+  "CMakeFiles/wt_objs.dir/src/txn/txn_timestamp.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wt_objs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_perf_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("ext")
+subdirs("src/utilities")
+subdirs("bench/wtperf")
+subdirs("bench/tiered")
+subdirs("bench/wt2853_perf")
+subdirs("bench/rwlock")
+subdirs("bench/micro")
+subdirs("examples")
+subdirs("test")
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/micro/bench_btree.c" "bench/micro/CMakeFiles/bench_micro.dir/bench_btree.c.o" "gcc" "bench/micro/CMakeFiles/bench_micro.dir/bench_btree.c.o.d"
+  "/root/repo/bench/micro/bench_support.c" "bench/micro/CMakeFiles/bench_micro.dir/bench_support.c.o" "gcc" "bench/micro/CMakeFiles/bench_micro.dir/bench_support.c.o.d"
+  "/root/repo/bench/micro/bench_txn.c" "bench/micro/CMakeFiles/bench_micro.dir/bench_txn.c.o" "gcc" "bench/micro/CMakeFiles/bench_micro.dir/bench_txn.c.o.d"
+  "/root/repo/bench/micro/main.c" "bench/micro/CMakeFiles/bench_micro.dir/main.c.o" "gcc" "bench/micro/CMakeFiles/bench_micro.dir/main.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_micro.dir/bench_btree.c.o"
+  "CMakeFiles/bench_micro.dir/bench_btree.c.o.d"
+  "CMakeFiles/bench_micro.dir/bench_support.c.o"
+  "CMakeFiles/bench_micro.dir/bench_support.c.o.d"
+  "CMakeFiles/bench_micro.dir/bench_txn.c.o"
+  "CMakeFiles/bench_micro.dir/bench_txn.c.o.d"
+  "CMakeFiles/bench_micro.dir/main.c.o"
+  "CMakeFiles/bench_micro.dir/main.c.o.d"
+  "bench_micro"
+  "bench_micro.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench_micro.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
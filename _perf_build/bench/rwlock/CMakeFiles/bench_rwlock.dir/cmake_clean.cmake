@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bench_rwlock.dir/main.c.o"
+  "CMakeFiles/bench_rwlock.dir/main.c.o.d"
+  "bench_rwlock"
+  "bench_rwlock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/bench_rwlock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/tiered/push_pull.c" "bench/tiered/CMakeFiles/test_push_pull.dir/push_pull.c.o" "gcc" "bench/tiered/CMakeFiles/test_push_pull.dir/push_pull.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_push_pull.dir/push_pull.c.o"
+  "CMakeFiles/test_push_pull.dir/push_pull.c.o.d"
+  "test_push_pull"
+  "test_push_pull.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_push_pull.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2853_perf.dir/main.c.o"
+  "CMakeFiles/test_wt2853_perf.dir/main.c.o.d"
+  "test_wt2853_perf"
+  "test_wt2853_perf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2853_perf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
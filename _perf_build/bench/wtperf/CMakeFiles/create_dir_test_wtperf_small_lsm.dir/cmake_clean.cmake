@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_dir_test_wtperf_small_lsm"
+  "test_wtperf_small_lsm_test_dir"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/create_dir_test_wtperf_small_lsm.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
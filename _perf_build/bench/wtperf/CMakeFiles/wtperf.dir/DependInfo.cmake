@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/bench/wtperf/idle_table_cycle.c" "bench/wtperf/CMakeFiles/wtperf.dir/idle_table_cycle.c.o" "gcc" "bench/wtperf/CMakeFiles/wtperf.dir/idle_table_cycle.c.o.d"
+  "/root/repo/bench/wtperf/track.c" "bench/wtperf/CMakeFiles/wtperf.dir/track.c.o" "gcc" "bench/wtperf/CMakeFiles/wtperf.dir/track.c.o.d"
+  "/root/repo/bench/wtperf/wtperf.c" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf.c.o" "gcc" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf.c.o.d"
+  "/root/repo/bench/wtperf/wtperf_config.c" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_config.c.o" "gcc" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_config.c.o.d"
+  "/root/repo/bench/wtperf/wtperf_misc.c" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_misc.c.o" "gcc" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_misc.c.o.d"
+  "/root/repo/bench/wtperf/wtperf_throttle.c" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_throttle.c.o" "gcc" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_throttle.c.o.d"
+  "/root/repo/bench/wtperf/wtperf_truncate.c" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_truncate.c.o" "gcc" "bench/wtperf/CMakeFiles/wtperf.dir/wtperf_truncate.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
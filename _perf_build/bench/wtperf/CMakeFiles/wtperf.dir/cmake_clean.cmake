@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wtperf.dir/idle_table_cycle.c.o"
+  "CMakeFiles/wtperf.dir/idle_table_cycle.c.o.d"
+  "CMakeFiles/wtperf.dir/track.c.o"
+  "CMakeFiles/wtperf.dir/track.c.o.d"
+  "CMakeFiles/wtperf.dir/wtperf.c.o"
+  "CMakeFiles/wtperf.dir/wtperf.c.o.d"
+  "CMakeFiles/wtperf.dir/wtperf_config.c.o"
+  "CMakeFiles/wtperf.dir/wtperf_config.c.o.d"
+  "CMakeFiles/wtperf.dir/wtperf_misc.c.o"
+  "CMakeFiles/wtperf.dir/wtperf_misc.c.o.d"
+  "CMakeFiles/wtperf.dir/wtperf_throttle.c.o"
+  "CMakeFiles/wtperf.dir/wtperf_throttle.c.o.d"
+  "CMakeFiles/wtperf.dir/wtperf_truncate.c.o"
+  "CMakeFiles/wtperf.dir/wtperf_truncate.c.o.d"
+  "wtperf"
+  "wtperf.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wtperf.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/bench/wtperf
+# Build directory: /root/repo/_perf_build/bench/wtperf
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_wtperf_small_lsm "/root/repo/_perf_build/bench/wtperf/wtperf" "-O" "/root/repo/bench/wtperf/runners/small-lsm.wtperf" "-o" "run_time=20")
+set_tests_properties(test_wtperf_small_lsm PROPERTIES  LABELS "check;wtperf" WORKING_DIRECTORY "/root/repo/_perf_build/bench/wtperf/test_wtperf_small_lsm_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/bench/wtperf/CMakeLists.txt;38;define_test_variants;/root/repo/bench/wtperf/CMakeLists.txt;0;")
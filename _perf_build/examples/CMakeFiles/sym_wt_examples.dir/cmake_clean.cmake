@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sym_wt_examples"
+  "wt"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/sym_wt_examples.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
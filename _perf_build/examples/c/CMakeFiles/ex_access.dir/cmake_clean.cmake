@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_access.dir/ex_access.c.o"
+  "CMakeFiles/ex_access.dir/ex_access.c.o.d"
+  "ex_access/ex_access"
+  "ex_access/ex_access.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_access.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
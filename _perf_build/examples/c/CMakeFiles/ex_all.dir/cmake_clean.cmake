@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_all.dir/ex_all.c.o"
+  "CMakeFiles/ex_all.dir/ex_all.c.o.d"
+  "ex_all/ex_all"
+  "ex_all/ex_all.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_all.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_backup.dir/ex_backup.c.o"
+  "CMakeFiles/ex_backup.dir/ex_backup.c.o.d"
+  "ex_backup/ex_backup"
+  "ex_backup/ex_backup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_backup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
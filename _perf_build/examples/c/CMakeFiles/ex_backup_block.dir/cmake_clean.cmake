@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_backup_block.dir/ex_backup_block.c.o"
+  "CMakeFiles/ex_backup_block.dir/ex_backup_block.c.o.d"
+  "ex_backup_block/ex_backup_block"
+  "ex_backup_block/ex_backup_block.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_backup_block.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_call_center.dir/ex_call_center.c.o"
+  "CMakeFiles/ex_call_center.dir/ex_call_center.c.o.d"
+  "ex_call_center/ex_call_center"
+  "ex_call_center/ex_call_center.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_call_center.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_col_store.dir/ex_col_store.c.o"
+  "CMakeFiles/ex_col_store.dir/ex_col_store.c.o.d"
+  "ex_col_store/ex_col_store"
+  "ex_col_store/ex_col_store.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_col_store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
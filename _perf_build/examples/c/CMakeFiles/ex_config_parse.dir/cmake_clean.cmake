@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_config_parse.dir/ex_config_parse.c.o"
+  "CMakeFiles/ex_config_parse.dir/ex_config_parse.c.o.d"
+  "ex_config_parse/ex_config_parse"
+  "ex_config_parse/ex_config_parse.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_config_parse.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_cursor.dir/ex_cursor.c.o"
+  "CMakeFiles/ex_cursor.dir/ex_cursor.c.o.d"
+  "ex_cursor/ex_cursor"
+  "ex_cursor/ex_cursor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_cursor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
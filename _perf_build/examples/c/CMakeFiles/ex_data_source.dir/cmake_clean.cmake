@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_data_source.dir/ex_data_source.c.o"
+  "CMakeFiles/ex_data_source.dir/ex_data_source.c.o.d"
+  "ex_data_source/ex_data_source"
+  "ex_data_source/ex_data_source.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_data_source.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_encrypt.dir/ex_encrypt.c.o"
+  "CMakeFiles/ex_encrypt.dir/ex_encrypt.c.o.d"
+  "ex_encrypt/ex_encrypt"
+  "ex_encrypt/ex_encrypt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_encrypt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
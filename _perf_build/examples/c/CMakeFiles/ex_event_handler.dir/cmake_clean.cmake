@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_event_handler.dir/ex_event_handler.c.o"
+  "CMakeFiles/ex_event_handler.dir/ex_event_handler.c.o.d"
+  "ex_event_handler/ex_event_handler"
+  "ex_event_handler/ex_event_handler.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_event_handler.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_extending.dir/ex_extending.c.o"
+  "CMakeFiles/ex_extending.dir/ex_extending.c.o.d"
+  "ex_extending/ex_extending"
+  "ex_extending/ex_extending.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_extending.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
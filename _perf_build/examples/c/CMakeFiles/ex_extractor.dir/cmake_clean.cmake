@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_extractor.dir/ex_extractor.c.o"
+  "CMakeFiles/ex_extractor.dir/ex_extractor.c.o.d"
+  "ex_extractor/ex_extractor"
+  "ex_extractor/ex_extractor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_extractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_file_system.dir/ex_file_system.c.o"
+  "CMakeFiles/ex_file_system.dir/ex_file_system.c.o.d"
+  "ex_file_system/ex_file_system"
+  "ex_file_system/ex_file_system.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_file_system.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
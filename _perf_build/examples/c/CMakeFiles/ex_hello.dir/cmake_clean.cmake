@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_hello.dir/ex_hello.c.o"
+  "CMakeFiles/ex_hello.dir/ex_hello.c.o.d"
+  "ex_hello/ex_hello"
+  "ex_hello/ex_hello.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_hello.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
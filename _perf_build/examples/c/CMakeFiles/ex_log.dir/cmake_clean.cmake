@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_log.dir/ex_log.c.o"
+  "CMakeFiles/ex_log.dir/ex_log.c.o.d"
+  "ex_log/ex_log"
+  "ex_log/ex_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
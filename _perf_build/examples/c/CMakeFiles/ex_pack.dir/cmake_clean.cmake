@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_pack.dir/ex_pack.c.o"
+  "CMakeFiles/ex_pack.dir/ex_pack.c.o.d"
+  "ex_pack/ex_pack"
+  "ex_pack/ex_pack.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_pack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
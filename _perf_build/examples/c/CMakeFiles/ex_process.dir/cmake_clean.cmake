@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_process.dir/ex_process.c.o"
+  "CMakeFiles/ex_process.dir/ex_process.c.o.d"
+  "ex_process/ex_process"
+  "ex_process/ex_process.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_process.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_schema.dir/ex_schema.c.o"
+  "CMakeFiles/ex_schema.dir/ex_schema.c.o.d"
+  "ex_schema/ex_schema"
+  "ex_schema/ex_schema.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_schema.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_smoke.dir/ex_smoke.c.o"
+  "CMakeFiles/ex_smoke.dir/ex_smoke.c.o.d"
+  "ex_smoke/ex_smoke"
+  "ex_smoke/ex_smoke.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_smoke.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_stat.dir/ex_stat.c.o"
+  "CMakeFiles/ex_stat.dir/ex_stat.c.o.d"
+  "ex_stat/ex_stat"
+  "ex_stat/ex_stat.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_stat.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_thread.dir/ex_thread.c.o"
+  "CMakeFiles/ex_thread.dir/ex_thread.c.o.d"
+  "ex_thread/ex_thread"
+  "ex_thread/ex_thread.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_thread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
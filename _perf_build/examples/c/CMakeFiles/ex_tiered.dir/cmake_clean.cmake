@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_tiered.dir/ex_tiered.c.o"
+  "CMakeFiles/ex_tiered.dir/ex_tiered.c.o.d"
+  "ex_tiered/ex_tiered"
+  "ex_tiered/ex_tiered.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_tiered.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ex_verbose.dir/ex_verbose.c.o"
+  "CMakeFiles/ex_verbose.dir/ex_verbose.c.o.d"
+  "ex_verbose/ex_verbose"
+  "ex_verbose/ex_verbose.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/ex_verbose.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
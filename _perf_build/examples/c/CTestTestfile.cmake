@@ -0,0 +1,54 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/examples/c
+# Build directory: /root/repo/_perf_build/examples/c
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ex_access "/root/repo/_perf_build/examples/c/ex_access/ex_access" "-h" "/root/repo/_perf_build/examples/c/ex_access/WT_HOME")
+set_tests_properties(ex_access PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_access" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;5;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_all "/root/repo/_perf_build/examples/c/ex_all/ex_all" "-h" "/root/repo/_perf_build/examples/c/ex_all/WT_HOME")
+set_tests_properties(ex_all PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_all" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;12;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_backup "/root/repo/_perf_build/examples/c/ex_backup/ex_backup" "-h" "/root/repo/_perf_build/examples/c/ex_backup/WT_HOME")
+set_tests_properties(ex_backup PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_backup" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;19;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_backup_block "/root/repo/_perf_build/examples/c/ex_backup_block/ex_backup_block" "-h" "/root/repo/_perf_build/examples/c/ex_backup_block/WT_HOME")
+set_tests_properties(ex_backup_block PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_backup_block" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;27;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_call_center "/root/repo/_perf_build/examples/c/ex_call_center/ex_call_center" "-h" "/root/repo/_perf_build/examples/c/ex_call_center/WT_HOME")
+set_tests_properties(ex_call_center PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_call_center" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;35;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_col_store "/root/repo/_perf_build/examples/c/ex_col_store/ex_col_store" "-h" "/root/repo/_perf_build/examples/c/ex_col_store/WT_HOME")
+set_tests_properties(ex_col_store PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_col_store" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;42;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_config_parse "/root/repo/_perf_build/examples/c/ex_config_parse/ex_config_parse" "-h" "/root/repo/_perf_build/examples/c/ex_config_parse/WT_HOME")
+set_tests_properties(ex_config_parse PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_config_parse" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;49;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_cursor "/root/repo/_perf_build/examples/c/ex_cursor/ex_cursor" "-h" "/root/repo/_perf_build/examples/c/ex_cursor/WT_HOME")
+set_tests_properties(ex_cursor PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_cursor" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;56;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_data_source "/root/repo/_perf_build/examples/c/ex_data_source/ex_data_source" "-h" "/root/repo/_perf_build/examples/c/ex_data_source/WT_HOME")
+set_tests_properties(ex_data_source PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_data_source" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;63;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_encrypt "/root/repo/_perf_build/examples/c/ex_encrypt/ex_encrypt" "-h" "/root/repo/_perf_build/examples/c/ex_encrypt/WT_HOME")
+set_tests_properties(ex_encrypt PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_encrypt" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;70;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_event_handler "/root/repo/_perf_build/examples/c/ex_event_handler/ex_event_handler" "-h" "/root/repo/_perf_build/examples/c/ex_event_handler/WT_HOME")
+set_tests_properties(ex_event_handler PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_event_handler" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;77;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_extending "/root/repo/_perf_build/examples/c/ex_extending/ex_extending" "-h" "/root/repo/_perf_build/examples/c/ex_extending/WT_HOME")
+set_tests_properties(ex_extending PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_extending" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;83;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_extractor "/root/repo/_perf_build/examples/c/ex_extractor/ex_extractor" "-h" "/root/repo/_perf_build/examples/c/ex_extractor/WT_HOME")
+set_tests_properties(ex_extractor PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_extractor" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;90;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_file_system "/root/repo/_perf_build/examples/c/ex_file_system/ex_file_system" "-h" "/root/repo/_perf_build/examples/c/ex_file_system/WT_HOME")
+set_tests_properties(ex_file_system PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_file_system" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;97;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_hello "/root/repo/_perf_build/examples/c/ex_hello/ex_hello" "-h" "/root/repo/_perf_build/examples/c/ex_hello/WT_HOME")
+set_tests_properties(ex_hello PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_hello" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;104;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_log "/root/repo/_perf_build/examples/c/ex_log/ex_log" "-h" "/root/repo/_perf_build/examples/c/ex_log/WT_HOME")
+set_tests_properties(ex_log PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_log" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;111;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_pack "/root/repo/_perf_build/examples/c/ex_pack/ex_pack" "-h" "/root/repo/_perf_build/examples/c/ex_pack/WT_HOME")
+set_tests_properties(ex_pack PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_pack" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;119;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_process "/root/repo/_perf_build/examples/c/ex_process/ex_process" "-h" "/root/repo/_perf_build/examples/c/ex_process/WT_HOME")
+set_tests_properties(ex_process PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_process" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;126;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_schema "/root/repo/_perf_build/examples/c/ex_schema/ex_schema" "-h" "/root/repo/_perf_build/examples/c/ex_schema/WT_HOME")
+set_tests_properties(ex_schema PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_schema" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;133;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_smoke "/root/repo/_perf_build/examples/c/ex_smoke/ex_smoke" "-h" "/root/repo/_perf_build/examples/c/ex_smoke/WT_HOME")
+set_tests_properties(ex_smoke PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_smoke" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;140;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_stat "/root/repo/_perf_build/examples/c/ex_stat/ex_stat" "-h" "/root/repo/_perf_build/examples/c/ex_stat/WT_HOME")
+set_tests_properties(ex_stat PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_stat" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;148;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_thread "/root/repo/_perf_build/examples/c/ex_thread/ex_thread" "-h" "/root/repo/_perf_build/examples/c/ex_thread/WT_HOME")
+set_tests_properties(ex_thread PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_thread" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;155;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_tiered "/root/repo/_perf_build/examples/c/ex_tiered/ex_tiered" "-h" "/root/repo/_perf_build/examples/c/ex_tiered/WT_HOME")
+set_tests_properties(ex_tiered PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_tiered" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;162;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
+add_test(ex_verbose "/root/repo/_perf_build/examples/c/ex_verbose/ex_verbose" "-h" "/root/repo/_perf_build/examples/c/ex_verbose/WT_HOME")
+set_tests_properties(ex_verbose PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/examples/c/ex_verbose" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/examples/c/CMakeLists.txt;169;define_c_test;/root/repo/examples/c/CMakeLists.txt;0;")
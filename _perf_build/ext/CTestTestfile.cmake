@@ -0,0 +1,19 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ext
+# Build directory: /root/repo/_perf_build/ext
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("compressors/lz4")
+subdirs("compressors/snappy")
+subdirs("compressors/zlib")
+subdirs("compressors/zstd")
+subdirs("compressors/nop")
+subdirs("collators/reverse")
+subdirs("collators/revint")
+subdirs("encryptors/nop")
+subdirs("extractors/csv")
+subdirs("encryptors/rotn")
+subdirs("encryptors/sodium")
+subdirs("storage_sources/dir_store")
+subdirs("test/fail_fs")
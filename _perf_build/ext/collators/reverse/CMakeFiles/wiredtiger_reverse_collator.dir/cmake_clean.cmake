@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_reverse_collator.dir/reverse_collator.c.o"
+  "CMakeFiles/wiredtiger_reverse_collator.dir/reverse_collator.c.o.d"
+  "libwiredtiger_reverse_collator.pdb"
+  "libwiredtiger_reverse_collator.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_reverse_collator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
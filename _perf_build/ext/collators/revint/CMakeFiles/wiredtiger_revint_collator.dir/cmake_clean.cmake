@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_revint_collator.dir/revint_collator.c.o"
+  "CMakeFiles/wiredtiger_revint_collator.dir/revint_collator.c.o.d"
+  "libwiredtiger_revint_collator.pdb"
+  "libwiredtiger_revint_collator.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_revint_collator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_nop_compress.dir/nop_compress.c.o"
+  "CMakeFiles/wiredtiger_nop_compress.dir/nop_compress.c.o.d"
+  "libwiredtiger_nop_compress.pdb"
+  "libwiredtiger_nop_compress.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_nop_compress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ext/compressors/nop
+# Build directory: /root/repo/_perf_build/ext/compressors/nop
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
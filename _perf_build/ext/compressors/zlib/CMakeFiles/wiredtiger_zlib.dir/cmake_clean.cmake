@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_zlib.dir/zlib_compress.c.o"
+  "CMakeFiles/wiredtiger_zlib.dir/zlib_compress.c.o.d"
+  "libwiredtiger_zlib.pdb"
+  "libwiredtiger_zlib.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_zlib.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
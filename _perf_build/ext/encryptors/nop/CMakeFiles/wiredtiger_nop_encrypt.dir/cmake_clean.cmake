@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_nop_encrypt.dir/nop_encrypt.c.o"
+  "CMakeFiles/wiredtiger_nop_encrypt.dir/nop_encrypt.c.o.d"
+  "libwiredtiger_nop_encrypt.pdb"
+  "libwiredtiger_nop_encrypt.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_nop_encrypt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_rotn.dir/rotn_encrypt.c.o"
+  "CMakeFiles/wiredtiger_rotn.dir/rotn_encrypt.c.o.d"
+  "libwiredtiger_rotn.pdb"
+  "libwiredtiger_rotn.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_rotn.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_csv_extractor.dir/csv_extractor.c.o"
+  "CMakeFiles/wiredtiger_csv_extractor.dir/csv_extractor.c.o.d"
+  "libwiredtiger_csv_extractor.pdb"
+  "libwiredtiger_csv_extractor.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_csv_extractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
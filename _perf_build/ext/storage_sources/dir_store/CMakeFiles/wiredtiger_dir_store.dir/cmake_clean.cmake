@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_dir_store.dir/dir_store.c.o"
+  "CMakeFiles/wiredtiger_dir_store.dir/dir_store.c.o.d"
+  "libwiredtiger_dir_store.pdb"
+  "libwiredtiger_dir_store.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_dir_store.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/ext/storage_sources/dir_store
+# Build directory: /root/repo/_perf_build/ext/storage_sources/dir_store
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
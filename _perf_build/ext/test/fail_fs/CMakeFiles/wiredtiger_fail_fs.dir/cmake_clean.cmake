@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wiredtiger_fail_fs.dir/fail_fs.c.o"
+  "CMakeFiles/wiredtiger_fail_fs.dir/fail_fs.c.o.d"
+  "libwiredtiger_fail_fs.pdb"
+  "libwiredtiger_fail_fs.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wiredtiger_fail_fs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,43 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/utilities/util_alter.c" "src/utilities/CMakeFiles/wt.dir/util_alter.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_alter.c.o.d"
+  "/root/repo/src/utilities/util_backup.c" "src/utilities/CMakeFiles/wt.dir/util_backup.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_backup.c.o.d"
+  "/root/repo/src/utilities/util_compact.c" "src/utilities/CMakeFiles/wt.dir/util_compact.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_compact.c.o.d"
+  "/root/repo/src/utilities/util_cpyright.c" "src/utilities/CMakeFiles/wt.dir/util_cpyright.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_cpyright.c.o.d"
+  "/root/repo/src/utilities/util_create.c" "src/utilities/CMakeFiles/wt.dir/util_create.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_create.c.o.d"
+  "/root/repo/src/utilities/util_downgrade.c" "src/utilities/CMakeFiles/wt.dir/util_downgrade.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_downgrade.c.o.d"
+  "/root/repo/src/utilities/util_drop.c" "src/utilities/CMakeFiles/wt.dir/util_drop.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_drop.c.o.d"
+  "/root/repo/src/utilities/util_dump.c" "src/utilities/CMakeFiles/wt.dir/util_dump.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_dump.c.o.d"
+  "/root/repo/src/utilities/util_list.c" "src/utilities/CMakeFiles/wt.dir/util_list.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_list.c.o.d"
+  "/root/repo/src/utilities/util_load.c" "src/utilities/CMakeFiles/wt.dir/util_load.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_load.c.o.d"
+  "/root/repo/src/utilities/util_load_json.c" "src/utilities/CMakeFiles/wt.dir/util_load_json.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_load_json.c.o.d"
+  "/root/repo/src/utilities/util_loadtext.c" "src/utilities/CMakeFiles/wt.dir/util_loadtext.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_loadtext.c.o.d"
+  "/root/repo/src/utilities/util_main.c" "src/utilities/CMakeFiles/wt.dir/util_main.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_main.c.o.d"
+  "/root/repo/src/utilities/util_misc.c" "src/utilities/CMakeFiles/wt.dir/util_misc.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_misc.c.o.d"
+  "/root/repo/src/utilities/util_printlog.c" "src/utilities/CMakeFiles/wt.dir/util_printlog.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_printlog.c.o.d"
+  "/root/repo/src/utilities/util_read.c" "src/utilities/CMakeFiles/wt.dir/util_read.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_read.c.o.d"
+  "/root/repo/src/utilities/util_rename.c" "src/utilities/CMakeFiles/wt.dir/util_rename.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_rename.c.o.d"
+  "/root/repo/src/utilities/util_salvage.c" "src/utilities/CMakeFiles/wt.dir/util_salvage.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_salvage.c.o.d"
+  "/root/repo/src/utilities/util_stat.c" "src/utilities/CMakeFiles/wt.dir/util_stat.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_stat.c.o.d"
+  "/root/repo/src/utilities/util_truncate.c" "src/utilities/CMakeFiles/wt.dir/util_truncate.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_truncate.c.o.d"
+  "/root/repo/src/utilities/util_upgrade.c" "src/utilities/CMakeFiles/wt.dir/util_upgrade.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_upgrade.c.o.d"
+  "/root/repo/src/utilities/util_verbose.c" "src/utilities/CMakeFiles/wt.dir/util_verbose.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_verbose.c.o.d"
+  "/root/repo/src/utilities/util_verify.c" "src/utilities/CMakeFiles/wt.dir/util_verify.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_verify.c.o.d"
+  "/root/repo/src/utilities/util_write.c" "src/utilities/CMakeFiles/wt.dir/util_write.c.o" "gcc" "src/utilities/CMakeFiles/wt.dir/util_write.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,57 @@
+file(REMOVE_RECURSE
+  "../../wt"
+  "../../wt.pdb"
+  "CMakeFiles/wt.dir/util_alter.c.o"
+  "CMakeFiles/wt.dir/util_alter.c.o.d"
+  "CMakeFiles/wt.dir/util_backup.c.o"
+  "CMakeFiles/wt.dir/util_backup.c.o.d"
+  "CMakeFiles/wt.dir/util_compact.c.o"
+  "CMakeFiles/wt.dir/util_compact.c.o.d"
+  "CMakeFiles/wt.dir/util_cpyright.c.o"
+  "CMakeFiles/wt.dir/util_cpyright.c.o.d"
+  "CMakeFiles/wt.dir/util_create.c.o"
+  "CMakeFiles/wt.dir/util_create.c.o.d"
+  "CMakeFiles/wt.dir/util_downgrade.c.o"
+  "CMakeFiles/wt.dir/util_downgrade.c.o.d"
+  "CMakeFiles/wt.dir/util_drop.c.o"
+  "CMakeFiles/wt.dir/util_drop.c.o.d"
+  "CMakeFiles/wt.dir/util_dump.c.o"
+  "CMakeFiles/wt.dir/util_dump.c.o.d"
+  "CMakeFiles/wt.dir/util_list.c.o"
+  "CMakeFiles/wt.dir/util_list.c.o.d"
+  "CMakeFiles/wt.dir/util_load.c.o"
+  "CMakeFiles/wt.dir/util_load.c.o.d"
+  "CMakeFiles/wt.dir/util_load_json.c.o"
+  "CMakeFiles/wt.dir/util_load_json.c.o.d"
+  "CMakeFiles/wt.dir/util_loadtext.c.o"
+  "CMakeFiles/wt.dir/util_loadtext.c.o.d"
+  "CMakeFiles/wt.dir/util_main.c.o"
+  "CMakeFiles/wt.dir/util_main.c.o.d"
+  "CMakeFiles/wt.dir/util_misc.c.o"
+  "CMakeFiles/wt.dir/util_misc.c.o.d"
+  "CMakeFiles/wt.dir/util_printlog.c.o"
+  "CMakeFiles/wt.dir/util_printlog.c.o.d"
+  "CMakeFiles/wt.dir/util_read.c.o"
+  "CMakeFiles/wt.dir/util_read.c.o.d"
+  "CMakeFiles/wt.dir/util_rename.c.o"
+  "CMakeFiles/wt.dir/util_rename.c.o.d"
+  "CMakeFiles/wt.dir/util_salvage.c.o"
+  "CMakeFiles/wt.dir/util_salvage.c.o.d"
+  "CMakeFiles/wt.dir/util_stat.c.o"
+  "CMakeFiles/wt.dir/util_stat.c.o.d"
+  "CMakeFiles/wt.dir/util_truncate.c.o"
+  "CMakeFiles/wt.dir/util_truncate.c.o.d"
+  "CMakeFiles/wt.dir/util_upgrade.c.o"
+  "CMakeFiles/wt.dir/util_upgrade.c.o.d"
+  "CMakeFiles/wt.dir/util_verbose.c.o"
+  "CMakeFiles/wt.dir/util_verbose.c.o.d"
+  "CMakeFiles/wt.dir/util_verify.c.o"
+  "CMakeFiles/wt.dir/util_verify.c.o.d"
+  "CMakeFiles/wt.dir/util_write.c.o"
+  "CMakeFiles/wt.dir/util_write.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/wt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
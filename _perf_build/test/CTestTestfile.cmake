@@ -0,0 +1,22 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test
+# Build directory: /root/repo/_perf_build/test
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("utility")
+subdirs("bloom")
+subdirs("checkpoint")
+subdirs("cursor_order")
+subdirs("fops")
+subdirs("huge")
+subdirs("manydbs")
+subdirs("csuite")
+subdirs("packing")
+subdirs("format")
+subdirs("readonly")
+subdirs("salvage")
+subdirs("syscall")
+subdirs("thread")
+subdirs("cppsuite")
+subdirs("simulator")
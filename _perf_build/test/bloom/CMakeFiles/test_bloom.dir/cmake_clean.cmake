@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_bloom.dir/test_bloom.c.o"
+  "CMakeFiles/test_bloom.dir/test_bloom.c.o.d"
+  "test_bloom"
+  "test_bloom.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_bloom.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
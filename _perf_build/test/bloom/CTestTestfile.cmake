@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/bloom
+# Build directory: /root/repo/_perf_build/test/bloom
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_bloom "/root/repo/_perf_build/test/bloom/test_bloom")
+set_tests_properties(test_bloom PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/bloom/CMakeLists.txt;7;add_test;/root/repo/test/bloom/CMakeLists.txt;0;")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_dir_test_checkpoint_6_column_named"
+  "test_checkpoint_6_column_named_test_dir"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/create_dir_test_checkpoint_6_column_named.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_dir_test_checkpoint_6_column_prepare"
+  "test_checkpoint_6_column_prepare_test_dir"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/create_dir_test_checkpoint_6_column_prepare.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
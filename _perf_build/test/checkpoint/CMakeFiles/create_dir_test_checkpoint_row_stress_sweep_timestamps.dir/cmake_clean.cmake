@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_dir_test_checkpoint_row_stress_sweep_timestamps"
+  "test_checkpoint_row_stress_sweep_timestamps_test_dir"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/create_dir_test_checkpoint_row_stress_sweep_timestamps.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/checkpoint/checkpointer.c" "test/checkpoint/CMakeFiles/test_checkpoint.dir/checkpointer.c.o" "gcc" "test/checkpoint/CMakeFiles/test_checkpoint.dir/checkpointer.c.o.d"
+  "/root/repo/test/checkpoint/test_checkpoint.c" "test/checkpoint/CMakeFiles/test_checkpoint.dir/test_checkpoint.c.o" "gcc" "test/checkpoint/CMakeFiles/test_checkpoint.dir/test_checkpoint.c.o.d"
+  "/root/repo/test/checkpoint/workers.c" "test/checkpoint/CMakeFiles/test_checkpoint.dir/workers.c.o" "gcc" "test/checkpoint/CMakeFiles/test_checkpoint.dir/workers.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
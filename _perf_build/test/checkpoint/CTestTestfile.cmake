@@ -0,0 +1,56 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/checkpoint
+# Build directory: /root/repo/_perf_build/test/checkpoint
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_checkpoint_4_mixed "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "m" "-T" "4")
+set_tests_properties(test_checkpoint_4_mixed PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_4_mixed_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_8_mixed "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "m" "-T" "8")
+set_tests_properties(test_checkpoint_8_mixed PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_8_mixed_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_4_mixed_sweep "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "m" "-T" "4" "-W" "3" "-r" "2" "-n" "100000" "-k" "100000" "-s" "1")
+set_tests_properties(test_checkpoint_4_mixed_sweep PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_4_mixed_sweep_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_4_mixed_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "m" "-T" "4" "-W" "3" "-r" "2" "-x" "-n" "100000" "-k" "100000")
+set_tests_properties(test_checkpoint_4_mixed_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_4_mixed_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_4_runs_sweep "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "m" "-T" "4" "-W" "3" "-r" "20" "-n" "1000" "-s" "1")
+set_tests_properties(test_checkpoint_4_runs_sweep PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_4_runs_sweep_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_4_runs_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "m" "-T" "4" "-W" "3" "-r" "20" "-x" "-n" "1000")
+set_tests_properties(test_checkpoint_4_runs_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_4_runs_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_fixed "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "f" "-T" "6")
+set_tests_properties(test_checkpoint_6_fixed PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_fixed_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_fixed_named "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "f" "-T" "6" "-c" "TeSt")
+set_tests_properties(test_checkpoint_6_fixed_named PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_fixed_named_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_fixed_prepare "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "f" "-T" "6" "-p")
+set_tests_properties(test_checkpoint_6_fixed_prepare PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_fixed_prepare_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_fixed_named_prepare "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "f" "-T" "6" "-c" "TeSt" "-p")
+set_tests_properties(test_checkpoint_6_fixed_named_prepare PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_fixed_named_prepare_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_fixed_stress_sweep_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "f" "-W" "3" "-r" "2" "-s" "1" "-x" "-n" "100000" "-k" "100000" "-D")
+set_tests_properties(test_checkpoint_fixed_stress_sweep_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_fixed_stress_sweep_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_fixed_sweep_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "f" "-W" "3" "-r" "2" "-s" "1" "-x" "-n" "100000" "-k" "100000")
+set_tests_properties(test_checkpoint_fixed_sweep_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_fixed_sweep_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_column "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "c" "-T" "6")
+set_tests_properties(test_checkpoint_6_column PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_column_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_column_named "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "c" "-T" "6" "-c" "TeSt")
+set_tests_properties(test_checkpoint_6_column_named PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_column_named_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_column_prepare "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "c" "-T" "6" "-p")
+set_tests_properties(test_checkpoint_6_column_prepare PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_column_prepare_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_column_named_prepare "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "c" "-T" "6" "-c" "TeSt" "-p")
+set_tests_properties(test_checkpoint_6_column_named_prepare PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_column_named_prepare_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_column_stress_sweep_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "c" "-W" "3" "-r" "2" "-s" "1" "-x" "-n" "100000" "-k" "100000" "-D")
+set_tests_properties(test_checkpoint_column_stress_sweep_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_column_stress_sweep_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_column_sweep_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "c" "-W" "3" "-r" "2" "-s" "1" "-x" "-n" "100000" "-k" "100000")
+set_tests_properties(test_checkpoint_column_sweep_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_column_sweep_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_row "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "r" "-T" "6")
+set_tests_properties(test_checkpoint_6_row PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_row_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_row_named "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "r" "-T" "6" "-c" "TeSt")
+set_tests_properties(test_checkpoint_6_row_named PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_row_named_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_row_prepare "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "r" "-T" "6" "-p")
+set_tests_properties(test_checkpoint_6_row_prepare PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_row_prepare_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_row_named_prepare "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "r" "-T" "6" "-c" "TeSt" "-p")
+set_tests_properties(test_checkpoint_6_row_named_prepare PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_row_named_prepare_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_row_stress_sweep_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "r" "-W" "3" "-r" "2" "-s" "1" "-x" "-n" "100000" "-k" "100000" "-D")
+set_tests_properties(test_checkpoint_row_stress_sweep_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_row_stress_sweep_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_row_sweep_timestamps "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "r" "-W" "3" "-r" "2" "-s" "1" "-x" "-n" "100000" "-k" "100000")
+set_tests_properties(test_checkpoint_row_sweep_timestamps PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_row_sweep_timestamps_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
+add_test(test_checkpoint_6_lsm "/root/repo/_perf_build/test/checkpoint/test_checkpoint" "-t" "l" "-T" "6")
+set_tests_properties(test_checkpoint_6_lsm PROPERTIES  LABELS "check;test_checkpoint" WORKING_DIRECTORY "/root/repo/_perf_build/test/checkpoint/test_checkpoint_6_lsm_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/checkpoint/CMakeLists.txt;12;define_test_variants;/root/repo/test/checkpoint/CMakeLists.txt;0;")
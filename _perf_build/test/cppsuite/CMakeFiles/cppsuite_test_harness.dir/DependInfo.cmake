@@ -0,0 +1,51 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/cppsuite/src/bound/bound.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/bound/bound.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/bound/bound.cpp.o.d"
+  "/root/repo/test/cppsuite/src/bound/bound_set.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/bound/bound_set.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/bound/bound_set.cpp.o.d"
+  "/root/repo/test/cppsuite/src/common/constants.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/constants.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/constants.cpp.o.d"
+  "/root/repo/test/cppsuite/src/common/logger.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/logger.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/logger.cpp.o.d"
+  "/root/repo/test/cppsuite/src/common/random_generator.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/random_generator.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/random_generator.cpp.o.d"
+  "/root/repo/test/cppsuite/src/common/thread_manager.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/thread_manager.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/common/thread_manager.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/component.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/component.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/component.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/metrics_monitor.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_monitor.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_monitor.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/metrics_writer.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_writer.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_writer.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/operation_tracker.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/operation_tracker.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/operation_tracker.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/perf_monitor.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/perf_monitor.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/perf_monitor.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/statistics/cache_limit.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/cache_limit.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/cache_limit.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/statistics/database_size.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/database_size.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/database_size.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/statistics/statistics.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/statistics.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/statistics.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/timestamp_manager.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/timestamp_manager.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/timestamp_manager.cpp.o.d"
+  "/root/repo/test/cppsuite/src/component/workload_manager.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/workload_manager.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/component/workload_manager.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/collection.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/collection.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/collection.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/configuration.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/configuration.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/configuration.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/database.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/database.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/database.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/database_operation.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/database_operation.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/database_operation.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/operation_configuration.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/operation_configuration.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/operation_configuration.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/test.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/test.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/test.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/thread_worker.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/thread_worker.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/thread_worker.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/transaction.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/transaction.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/transaction.cpp.o.d"
+  "/root/repo/test/cppsuite/src/main/validator.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/validator.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/main/validator.cpp.o.d"
+  "/root/repo/test/cppsuite/src/storage/connection_manager.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/storage/connection_manager.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/storage/connection_manager.cpp.o.d"
+  "/root/repo/test/cppsuite/src/storage/scoped_cursor.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_cursor.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_cursor.cpp.o.d"
+  "/root/repo/test/cppsuite/src/storage/scoped_session.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_session.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_session.cpp.o.d"
+  "/root/repo/test/cppsuite/src/util/barrier.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/util/barrier.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/util/barrier.cpp.o.d"
+  "/root/repo/test/cppsuite/src/util/execution_timer.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/util/execution_timer.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/util/execution_timer.cpp.o.d"
+  "/root/repo/test/cppsuite/src/util/latency_histogram.cpp" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/util/latency_histogram.cpp.o" "gcc" "test/cppsuite/CMakeFiles/cppsuite_test_harness.dir/src/util/latency_histogram.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
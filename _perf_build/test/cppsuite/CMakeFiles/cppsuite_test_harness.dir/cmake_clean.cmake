@@ -0,0 +1,71 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cppsuite_test_harness.dir/src/bound/bound.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/bound/bound.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/bound/bound_set.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/bound/bound_set.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/constants.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/constants.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/logger.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/logger.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/random_generator.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/random_generator.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/thread_manager.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/common/thread_manager.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/component.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/component.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_monitor.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_monitor.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_writer.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/metrics_writer.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/operation_tracker.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/operation_tracker.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/perf_monitor.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/perf_monitor.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/cache_limit.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/cache_limit.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/database_size.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/database_size.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/statistics.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/statistics/statistics.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/timestamp_manager.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/timestamp_manager.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/workload_manager.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/component/workload_manager.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/collection.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/collection.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/configuration.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/configuration.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/database.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/database.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/database_operation.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/database_operation.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/operation_configuration.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/operation_configuration.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/test.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/test.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/thread_worker.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/thread_worker.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/transaction.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/transaction.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/validator.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/main/validator.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/storage/connection_manager.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/storage/connection_manager.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_cursor.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_cursor.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_session.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/storage/scoped_session.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/util/barrier.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/util/barrier.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/util/execution_timer.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/util/execution_timer.cpp.o.d"
+  "CMakeFiles/cppsuite_test_harness.dir/src/util/latency_histogram.cpp.o"
+  "CMakeFiles/cppsuite_test_harness.dir/src/util/latency_histogram.cpp.o.d"
+  "libcppsuite_test_harness.a"
+  "libcppsuite_test_harness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cppsuite_test_harness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
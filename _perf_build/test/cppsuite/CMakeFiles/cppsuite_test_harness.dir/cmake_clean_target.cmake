@@ -0,0 +1,3 @@
+file(REMOVE_RECURSE
+  "libcppsuite_test_harness.a"
+)
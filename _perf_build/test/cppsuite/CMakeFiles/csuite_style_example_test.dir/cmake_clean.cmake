@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/csuite_style_example_test.dir/tests/csuite_style_example_test.cpp.o"
+  "CMakeFiles/csuite_style_example_test.dir/tests/csuite_style_example_test.cpp.o.d"
+  "csuite_style_example_test"
+  "csuite_style_example_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csuite_style_example_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
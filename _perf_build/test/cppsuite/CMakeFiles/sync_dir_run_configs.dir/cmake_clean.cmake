@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sync_dir_run_configs"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/sync_dir_run_configs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/cppsuite
+# Build directory: /root/repo/_perf_build/test/cppsuite
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(cppsuite "/root/repo/_perf_build/test/cppsuite/run")
+set_tests_properties(cppsuite PROPERTIES  LABELS "check;cppsuite" _BACKTRACE_TRIPLES "/root/repo/test/cppsuite/CMakeLists.txt;64;add_test;/root/repo/test/cppsuite/CMakeLists.txt;0;")
+add_test(csuite_style_example "/root/repo/_perf_build/test/cppsuite/csuite_style_example_test")
+set_tests_properties(csuite_style_example PROPERTIES  LABELS "check;cppsuite" _BACKTRACE_TRIPLES "/root/repo/test/cppsuite/CMakeLists.txt;66;add_test;/root/repo/test/cppsuite/CMakeLists.txt;0;")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_random_directio_smoke.sh"
+  "random_directio/smoke.sh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_random_directio_smoke.sh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
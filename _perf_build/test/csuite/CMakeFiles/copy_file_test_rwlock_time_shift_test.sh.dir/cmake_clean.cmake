@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_rwlock_time_shift_test.sh"
+  "rwlock/time_shift_test.sh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_rwlock_time_shift_test.sh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_schema_abort_smoke.sh"
+  "schema_abort/smoke.sh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_schema_abort_smoke.sh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
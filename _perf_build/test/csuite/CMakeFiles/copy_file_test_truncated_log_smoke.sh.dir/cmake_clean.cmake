@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_truncated_log_smoke.sh"
+  "truncated_log/smoke.sh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_truncated_log_smoke.sh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
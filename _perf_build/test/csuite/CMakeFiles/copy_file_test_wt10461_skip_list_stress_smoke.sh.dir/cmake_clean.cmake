@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_wt10461_skip_list_stress_smoke.sh"
+  "wt10461_skip_list_stress/smoke.sh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_wt10461_skip_list_stress_smoke.sh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
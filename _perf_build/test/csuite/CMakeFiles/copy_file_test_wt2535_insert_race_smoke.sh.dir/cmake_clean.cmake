@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_wt2535_insert_race_smoke.sh"
+  "wt2535_insert_race/smoke.sh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_wt2535_insert_race_smoke.sh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_wt6616_checkpoint_oldest_ts_smoke.sh"
+  "wt6616_checkpoint_oldest_ts/smoke.sh"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_wt6616_checkpoint_oldest_ts_smoke.sh.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
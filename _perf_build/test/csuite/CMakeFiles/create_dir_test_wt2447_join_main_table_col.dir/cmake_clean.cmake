@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_dir_test_wt2447_join_main_table_col"
+  "test_wt2447_join_main_table_col_test_dir"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/create_dir_test_wt2447_join_main_table_col.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_incr_backup.dir/incr_backup/main.c.o"
+  "CMakeFiles/test_incr_backup.dir/incr_backup/main.c.o.d"
+  "incr_backup/test_incr_backup"
+  "incr_backup/test_incr_backup.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_incr_backup.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
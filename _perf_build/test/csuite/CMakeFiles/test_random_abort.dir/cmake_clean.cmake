@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_random_abort.dir/random_abort/main.c.o"
+  "CMakeFiles/test_random_abort.dir/random_abort/main.c.o.d"
+  "random_abort/test_random_abort"
+  "random_abort/test_random_abort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_random_abort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_random_directio.dir/random_directio/main.c.o"
+  "CMakeFiles/test_random_directio.dir/random_directio/main.c.o.d"
+  "CMakeFiles/test_random_directio.dir/random_directio/util.c.o"
+  "CMakeFiles/test_random_directio.dir/random_directio/util.c.o.d"
+  "random_directio/test_random_directio"
+  "random_directio/test_random_directio.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_random_directio.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
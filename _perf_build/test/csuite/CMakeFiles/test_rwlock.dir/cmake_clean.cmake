@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_rwlock.dir/rwlock/main.c.o"
+  "CMakeFiles/test_rwlock.dir/rwlock/main.c.o.d"
+  "rwlock/test_rwlock"
+  "rwlock/test_rwlock.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_rwlock.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_rwlock_scalable.dir/rwlock/main.c.o"
+  "CMakeFiles/test_rwlock_scalable.dir/rwlock/main.c.o.d"
+  "rwlock_scalable/test_rwlock_scalable"
+  "rwlock_scalable/test_rwlock_scalable.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_rwlock_scalable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_schema_abort.dir/schema_abort/main.c.o"
+  "CMakeFiles/test_schema_abort.dir/schema_abort/main.c.o.d"
+  "schema_abort/test_schema_abort"
+  "schema_abort/test_schema_abort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_schema_abort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
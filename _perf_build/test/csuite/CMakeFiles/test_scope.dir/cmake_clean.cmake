@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_scope.dir/scope/main.c.o"
+  "CMakeFiles/test_scope.dir/scope/main.c.o.d"
+  "scope/test_scope"
+  "scope/test_scope.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_scope.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
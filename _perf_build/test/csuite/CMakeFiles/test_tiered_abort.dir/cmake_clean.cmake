@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_tiered_abort.dir/tiered_abort/main.c.o"
+  "CMakeFiles/test_tiered_abort.dir/tiered_abort/main.c.o.d"
+  "tiered_abort/test_tiered_abort"
+  "tiered_abort/test_tiered_abort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_tiered_abort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
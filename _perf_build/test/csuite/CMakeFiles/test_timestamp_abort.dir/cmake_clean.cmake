@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_timestamp_abort.dir/timestamp_abort/main.c.o"
+  "CMakeFiles/test_timestamp_abort.dir/timestamp_abort/main.c.o.d"
+  "timestamp_abort/test_timestamp_abort"
+  "timestamp_abort/test_timestamp_abort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_timestamp_abort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_truncated_log.dir/truncated_log/main.c.o"
+  "CMakeFiles/test_truncated_log.dir/truncated_log/main.c.o.d"
+  "truncated_log/test_truncated_log"
+  "truncated_log/test_truncated_log.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_truncated_log.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
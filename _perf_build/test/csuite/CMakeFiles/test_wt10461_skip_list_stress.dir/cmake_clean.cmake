@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt10461_skip_list_stress.dir/wt10461_skip_list_stress/main.c.o"
+  "CMakeFiles/test_wt10461_skip_list_stress.dir/wt10461_skip_list_stress/main.c.o.d"
+  "wt10461_skip_list_stress/test_wt10461_skip_list_stress"
+  "wt10461_skip_list_stress/test_wt10461_skip_list_stress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt10461_skip_list_stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt1965_col_efficiency.dir/wt1965_col_efficiency/main.c.o"
+  "CMakeFiles/test_wt1965_col_efficiency.dir/wt1965_col_efficiency/main.c.o.d"
+  "wt1965_col_efficiency/test_wt1965_col_efficiency"
+  "wt1965_col_efficiency/test_wt1965_col_efficiency.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt1965_col_efficiency.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
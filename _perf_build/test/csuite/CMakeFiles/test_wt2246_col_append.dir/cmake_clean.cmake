@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2246_col_append.dir/wt2246_col_append/main.c.o"
+  "CMakeFiles/test_wt2246_col_append.dir/wt2246_col_append/main.c.o.d"
+  "wt2246_col_append/test_wt2246_col_append"
+  "wt2246_col_append/test_wt2246_col_append.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2246_col_append.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
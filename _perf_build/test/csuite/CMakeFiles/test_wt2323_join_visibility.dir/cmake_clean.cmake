@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2323_join_visibility.dir/wt2323_join_visibility/main.c.o"
+  "CMakeFiles/test_wt2323_join_visibility.dir/wt2323_join_visibility/main.c.o.d"
+  "wt2323_join_visibility/test_wt2323_join_visibility"
+  "wt2323_join_visibility/test_wt2323_join_visibility.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2323_join_visibility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2403_lsm_workload.dir/wt2403_lsm_workload/main.c.o"
+  "CMakeFiles/test_wt2403_lsm_workload.dir/wt2403_lsm_workload/main.c.o.d"
+  "wt2403_lsm_workload/test_wt2403_lsm_workload"
+  "wt2403_lsm_workload/test_wt2403_lsm_workload.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2403_lsm_workload.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
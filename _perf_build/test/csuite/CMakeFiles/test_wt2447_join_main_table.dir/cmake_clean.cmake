@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2447_join_main_table.dir/wt2447_join_main_table/main.c.o"
+  "CMakeFiles/test_wt2447_join_main_table.dir/wt2447_join_main_table/main.c.o.d"
+  "wt2447_join_main_table/test_wt2447_join_main_table"
+  "wt2447_join_main_table/test_wt2447_join_main_table.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2447_join_main_table.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2535_insert_race.dir/wt2535_insert_race/main.c.o"
+  "CMakeFiles/test_wt2535_insert_race.dir/wt2535_insert_race/main.c.o.d"
+  "wt2535_insert_race/test_wt2535_insert_race"
+  "wt2535_insert_race/test_wt2535_insert_race.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2535_insert_race.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2592_join_schema.dir/wt2592_join_schema/main.c.o"
+  "CMakeFiles/test_wt2592_join_schema.dir/wt2592_join_schema/main.c.o.d"
+  "wt2592_join_schema/test_wt2592_join_schema"
+  "wt2592_join_schema/test_wt2592_join_schema.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2592_join_schema.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2695_checksum.dir/wt2695_checksum/main.c.o"
+  "CMakeFiles/test_wt2695_checksum.dir/wt2695_checksum/main.c.o.d"
+  "wt2695_checksum/test_wt2695_checksum"
+  "wt2695_checksum/test_wt2695_checksum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2695_checksum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2719_reconfig.dir/wt2719_reconfig/main.c.o"
+  "CMakeFiles/test_wt2719_reconfig.dir/wt2719_reconfig/main.c.o.d"
+  "wt2719_reconfig/test_wt2719_reconfig"
+  "wt2719_reconfig/test_wt2719_reconfig.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2719_reconfig.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
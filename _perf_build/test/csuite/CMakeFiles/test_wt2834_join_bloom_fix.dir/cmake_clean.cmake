@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2834_join_bloom_fix.dir/wt2834_join_bloom_fix/main.c.o"
+  "CMakeFiles/test_wt2834_join_bloom_fix.dir/wt2834_join_bloom_fix/main.c.o.d"
+  "wt2834_join_bloom_fix/test_wt2834_join_bloom_fix"
+  "wt2834_join_bloom_fix/test_wt2834_join_bloom_fix.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2834_join_bloom_fix.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2909_checkpoint_integrity.dir/wt2909_checkpoint_integrity/main.c.o"
+  "CMakeFiles/test_wt2909_checkpoint_integrity.dir/wt2909_checkpoint_integrity/main.c.o.d"
+  "wt2909_checkpoint_integrity/test_wt2909_checkpoint_integrity"
+  "wt2909_checkpoint_integrity/test_wt2909_checkpoint_integrity.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2909_checkpoint_integrity.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2999_join_extractor.dir/wt2999_join_extractor/main.c.o"
+  "CMakeFiles/test_wt2999_join_extractor.dir/wt2999_join_extractor/main.c.o.d"
+  "wt2999_join_extractor/test_wt2999_join_extractor"
+  "wt2999_join_extractor/test_wt2999_join_extractor.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2999_join_extractor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt3120_filesys.dir/wt3120_filesys/main.c.o"
+  "CMakeFiles/test_wt3120_filesys.dir/wt3120_filesys/main.c.o.d"
+  "wt3120_filesys/test_wt3120_filesys"
+  "wt3120_filesys/test_wt3120_filesys.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt3120_filesys.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt3135_search_near_collator.dir/wt3135_search_near_collator/main.c.o"
+  "CMakeFiles/test_wt3135_search_near_collator.dir/wt3135_search_near_collator/main.c.o.d"
+  "wt3135_search_near_collator/test_wt3135_search_near_collator"
+  "wt3135_search_near_collator/test_wt3135_search_near_collator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt3135_search_near_collator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
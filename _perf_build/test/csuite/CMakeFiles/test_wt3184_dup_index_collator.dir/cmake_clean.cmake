@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt3184_dup_index_collator.dir/wt3184_dup_index_collator/main.c.o"
+  "CMakeFiles/test_wt3184_dup_index_collator.dir/wt3184_dup_index_collator/main.c.o.d"
+  "wt3184_dup_index_collator/test_wt3184_dup_index_collator"
+  "wt3184_dup_index_collator/test_wt3184_dup_index_collator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt3184_dup_index_collator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt3338_partial_update.dir/wt3338_partial_update/main.c.o"
+  "CMakeFiles/test_wt3338_partial_update.dir/wt3338_partial_update/main.c.o.d"
+  "wt3338_partial_update/test_wt3338_partial_update"
+  "wt3338_partial_update/test_wt3338_partial_update.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt3338_partial_update.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
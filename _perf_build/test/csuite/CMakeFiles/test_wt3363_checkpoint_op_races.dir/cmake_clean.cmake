@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt3363_checkpoint_op_races.dir/wt3363_checkpoint_op_races/main.c.o"
+  "CMakeFiles/test_wt3363_checkpoint_op_races.dir/wt3363_checkpoint_op_races/main.c.o.d"
+  "wt3363_checkpoint_op_races/test_wt3363_checkpoint_op_races"
+  "wt3363_checkpoint_op_races/test_wt3363_checkpoint_op_races.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt3363_checkpoint_op_races.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
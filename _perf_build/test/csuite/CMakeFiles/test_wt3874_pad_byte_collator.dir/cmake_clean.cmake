@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt3874_pad_byte_collator.dir/wt3874_pad_byte_collator/main.c.o"
+  "CMakeFiles/test_wt3874_pad_byte_collator.dir/wt3874_pad_byte_collator/main.c.o.d"
+  "wt3874_pad_byte_collator/test_wt3874_pad_byte_collator"
+  "wt3874_pad_byte_collator/test_wt3874_pad_byte_collator.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt3874_pad_byte_collator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
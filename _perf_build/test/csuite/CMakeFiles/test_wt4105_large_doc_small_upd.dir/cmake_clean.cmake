@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt4105_large_doc_small_upd.dir/wt4105_large_doc_small_upd/main.c.o"
+  "CMakeFiles/test_wt4105_large_doc_small_upd.dir/wt4105_large_doc_small_upd/main.c.o.d"
+  "wt4105_large_doc_small_upd/test_wt4105_large_doc_small_upd"
+  "wt4105_large_doc_small_upd/test_wt4105_large_doc_small_upd.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt4105_large_doc_small_upd.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt4117_checksum.dir/wt4117_checksum/main.c.o"
+  "CMakeFiles/test_wt4117_checksum.dir/wt4117_checksum/main.c.o.d"
+  "wt4117_checksum/test_wt4117_checksum"
+  "wt4117_checksum/test_wt4117_checksum.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt4117_checksum.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
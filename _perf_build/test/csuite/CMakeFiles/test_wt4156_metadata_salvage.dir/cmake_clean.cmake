@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt4156_metadata_salvage.dir/wt4156_metadata_salvage/main.c.o"
+  "CMakeFiles/test_wt4156_metadata_salvage.dir/wt4156_metadata_salvage/main.c.o.d"
+  "wt4156_metadata_salvage/test_wt4156_metadata_salvage"
+  "wt4156_metadata_salvage/test_wt4156_metadata_salvage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt4156_metadata_salvage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
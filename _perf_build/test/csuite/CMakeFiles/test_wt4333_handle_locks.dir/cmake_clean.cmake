@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt4333_handle_locks.dir/wt4333_handle_locks/main.c.o"
+  "CMakeFiles/test_wt4333_handle_locks.dir/wt4333_handle_locks/main.c.o.d"
+  "wt4333_handle_locks/test_wt4333_handle_locks"
+  "wt4333_handle_locks/test_wt4333_handle_locks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt4333_handle_locks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
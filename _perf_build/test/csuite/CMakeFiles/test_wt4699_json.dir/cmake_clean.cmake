@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt4699_json.dir/wt4699_json/main.c.o"
+  "CMakeFiles/test_wt4699_json.dir/wt4699_json/main.c.o.d"
+  "wt4699_json/test_wt4699_json"
+  "wt4699_json/test_wt4699_json.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt4699_json.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt4803_history_store_abort.dir/wt4803_history_store_abort/main.c.o"
+  "CMakeFiles/test_wt4803_history_store_abort.dir/wt4803_history_store_abort/main.c.o.d"
+  "wt4803_history_store_abort/test_wt4803_history_store_abort"
+  "wt4803_history_store_abort/test_wt4803_history_store_abort.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt4803_history_store_abort.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
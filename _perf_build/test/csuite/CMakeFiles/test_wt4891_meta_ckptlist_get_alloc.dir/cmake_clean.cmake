@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt4891_meta_ckptlist_get_alloc.dir/wt4891_meta_ckptlist_get_alloc/main.c.o"
+  "CMakeFiles/test_wt4891_meta_ckptlist_get_alloc.dir/wt4891_meta_ckptlist_get_alloc/main.c.o.d"
+  "wt4891_meta_ckptlist_get_alloc/test_wt4891_meta_ckptlist_get_alloc"
+  "wt4891_meta_ckptlist_get_alloc/test_wt4891_meta_ckptlist_get_alloc.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt4891_meta_ckptlist_get_alloc.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
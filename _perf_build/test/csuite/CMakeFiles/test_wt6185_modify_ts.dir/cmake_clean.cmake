@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt6185_modify_ts.dir/wt6185_modify_ts/main.c.o"
+  "CMakeFiles/test_wt6185_modify_ts.dir/wt6185_modify_ts/main.c.o.d"
+  "wt6185_modify_ts/test_wt6185_modify_ts"
+  "wt6185_modify_ts/test_wt6185_modify_ts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt6185_modify_ts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt6616_checkpoint_oldest_ts.dir/wt6616_checkpoint_oldest_ts/main.c.o"
+  "CMakeFiles/test_wt6616_checkpoint_oldest_ts.dir/wt6616_checkpoint_oldest_ts/main.c.o.d"
+  "wt6616_checkpoint_oldest_ts/test_wt6616_checkpoint_oldest_ts"
+  "wt6616_checkpoint_oldest_ts/test_wt6616_checkpoint_oldest_ts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt6616_checkpoint_oldest_ts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
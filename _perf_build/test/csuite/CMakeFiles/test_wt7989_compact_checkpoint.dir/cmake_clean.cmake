@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt7989_compact_checkpoint.dir/wt7989_compact_checkpoint/main.c.o"
+  "CMakeFiles/test_wt7989_compact_checkpoint.dir/wt7989_compact_checkpoint/main.c.o.d"
+  "wt7989_compact_checkpoint/test_wt7989_compact_checkpoint"
+  "wt7989_compact_checkpoint/test_wt7989_compact_checkpoint.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt7989_compact_checkpoint.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
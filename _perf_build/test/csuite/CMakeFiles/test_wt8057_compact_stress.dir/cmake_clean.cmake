@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt8057_compact_stress.dir/wt8057_compact_stress/main.c.o"
+  "CMakeFiles/test_wt8057_compact_stress.dir/wt8057_compact_stress/main.c.o.d"
+  "wt8057_compact_stress/test_wt8057_compact_stress"
+  "wt8057_compact_stress/test_wt8057_compact_stress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt8057_compact_stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt8246_compact_rts_data_correctness.dir/wt8246_compact_rts_data_correctness/main.c.o"
+  "CMakeFiles/test_wt8246_compact_rts_data_correctness.dir/wt8246_compact_rts_data_correctness/main.c.o.d"
+  "wt8246_compact_rts_data_correctness/test_wt8246_compact_rts_data_correctness"
+  "wt8246_compact_rts_data_correctness/test_wt8246_compact_rts_data_correctness.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt8246_compact_rts_data_correctness.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
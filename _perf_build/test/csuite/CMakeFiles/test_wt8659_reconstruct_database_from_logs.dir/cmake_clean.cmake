@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt8659_reconstruct_database_from_logs.dir/wt8659_reconstruct_database_from_logs/main.c.o"
+  "CMakeFiles/test_wt8659_reconstruct_database_from_logs.dir/wt8659_reconstruct_database_from_logs/main.c.o.d"
+  "wt8659_reconstruct_database_from_logs/test_wt8659_reconstruct_database_from_logs"
+  "wt8659_reconstruct_database_from_logs/test_wt8659_reconstruct_database_from_logs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt8659_reconstruct_database_from_logs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt8963_insert_stress.dir/wt8963_insert_stress/main.c.o"
+  "CMakeFiles/test_wt8963_insert_stress.dir/wt8963_insert_stress/main.c.o.d"
+  "wt8963_insert_stress/test_wt8963_insert_stress"
+  "wt8963_insert_stress/test_wt8963_insert_stress.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt8963_insert_stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
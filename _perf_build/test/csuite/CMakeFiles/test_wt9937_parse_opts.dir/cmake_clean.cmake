@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt9937_parse_opts.dir/wt9937_parse_opts/main.c.o"
+  "CMakeFiles/test_wt9937_parse_opts.dir/wt9937_parse_opts/main.c.o.d"
+  "wt9937_parse_opts/test_wt9937_parse_opts"
+  "wt9937_parse_opts/test_wt9937_parse_opts.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt9937_parse_opts.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,94 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/csuite
+# Build directory: /root/repo/_perf_build/test/csuite
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_wt10461_skip_list_stress "smoke.sh" "/root/repo/_perf_build/test/csuite/wt10461_skip_list_stress/test_wt10461_skip_list_stress")
+set_tests_properties(test_wt10461_skip_list_stress PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt10461_skip_list_stress" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;7;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_incr_backup "smoke.sh" "/root/repo/_perf_build/test/csuite/incr_backup/test_incr_backup")
+set_tests_properties(test_incr_backup PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/incr_backup" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;16;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_random_abort "smoke.sh" "/root/repo/_perf_build/test/csuite/random_abort/test_random_abort")
+set_tests_properties(test_random_abort PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/random_abort" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;25;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_random_directio "smoke.sh" "/root/repo/_perf_build/test/csuite/random_directio/test_random_directio")
+set_tests_properties(test_random_directio PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/random_directio" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;43;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_rwlock "/root/repo/_perf_build/test/csuite/rwlock/test_rwlock" "-h" "/root/repo/_perf_build/test/csuite/rwlock/WT_HOME")
+set_tests_properties(test_rwlock PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/rwlock" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;54;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_rwlock_scalable "/root/repo/_perf_build/test/csuite/rwlock_scalable/test_rwlock_scalable" "-h" "/root/repo/_perf_build/test/csuite/rwlock_scalable/WT_HOME")
+set_tests_properties(test_rwlock_scalable PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/rwlock_scalable" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;64;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_schema_abort "smoke.sh" "/root/repo/_perf_build/test/csuite/schema_abort/test_schema_abort")
+set_tests_properties(test_schema_abort PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/schema_abort" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;73;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_scope "/root/repo/_perf_build/test/csuite/scope/test_scope" "-h" "/root/repo/_perf_build/test/csuite/scope/WT_HOME")
+set_tests_properties(test_scope PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/scope" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;91;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_timestamp_abort "smoke.sh" "-b" "/root/repo/_perf_build/test/csuite/timestamp_abort/test_timestamp_abort")
+set_tests_properties(test_timestamp_abort PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/timestamp_abort" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;121;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_truncated_log "smoke.sh" "/root/repo/_perf_build/test/csuite/truncated_log/test_truncated_log")
+set_tests_properties(test_truncated_log PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/truncated_log" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;139;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt1965_col_efficiency "/root/repo/_perf_build/test/csuite/wt1965_col_efficiency/test_wt1965_col_efficiency" "-h" "/root/repo/_perf_build/test/csuite/wt1965_col_efficiency/WT_HOME")
+set_tests_properties(test_wt1965_col_efficiency PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt1965_col_efficiency" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;148;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2403_lsm_workload "/root/repo/_perf_build/test/csuite/wt2403_lsm_workload/test_wt2403_lsm_workload" "-h" "/root/repo/_perf_build/test/csuite/wt2403_lsm_workload/WT_HOME")
+set_tests_properties(test_wt2403_lsm_workload PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2403_lsm_workload" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;156;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2246_col_append "/root/repo/_perf_build/test/csuite/wt2246_col_append/test_wt2246_col_append" "-h" "/root/repo/_perf_build/test/csuite/wt2246_col_append/WT_HOME")
+set_tests_properties(test_wt2246_col_append PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2246_col_append" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;164;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2323_join_visibility "/root/repo/_perf_build/test/csuite/wt2323_join_visibility/test_wt2323_join_visibility" "-h" "/root/repo/_perf_build/test/csuite/wt2323_join_visibility/WT_HOME")
+set_tests_properties(test_wt2323_join_visibility PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2323_join_visibility" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;171;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2535_insert_race "smoke.sh" "/root/repo/_perf_build/test/csuite/wt2535_insert_race/test_wt2535_insert_race")
+set_tests_properties(test_wt2535_insert_race PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2535_insert_race" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;179;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2447_join_main_table_row "/root/repo/_perf_build/test/csuite/wt2447_join_main_table/test_wt2447_join_main_table" "-t" "r")
+set_tests_properties(test_wt2447_join_main_table_row PROPERTIES  LABELS "check\\;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2447_join_main_table/test_wt2447_join_main_table_row_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/ctest_helpers.cmake;298;define_test_variants;/root/repo/test/csuite/CMakeLists.txt;188;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2447_join_main_table_col "/root/repo/_perf_build/test/csuite/wt2447_join_main_table/test_wt2447_join_main_table" "-t" "c")
+set_tests_properties(test_wt2447_join_main_table_col PROPERTIES  LABELS "check\\;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2447_join_main_table/test_wt2447_join_main_table_col_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/ctest_helpers.cmake;298;define_test_variants;/root/repo/test/csuite/CMakeLists.txt;188;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2695_checksum "/root/repo/_perf_build/test/csuite/wt2695_checksum/test_wt2695_checksum" "-h" "/root/repo/_perf_build/test/csuite/wt2695_checksum/WT_HOME")
+set_tests_properties(test_wt2695_checksum PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2695_checksum" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;197;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2592_join_schema "/root/repo/_perf_build/test/csuite/wt2592_join_schema/test_wt2592_join_schema" "-h" "/root/repo/_perf_build/test/csuite/wt2592_join_schema/WT_HOME")
+set_tests_properties(test_wt2592_join_schema PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2592_join_schema" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;204;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2719_reconfig "/root/repo/_perf_build/test/csuite/wt2719_reconfig/test_wt2719_reconfig" "-h" "/root/repo/_perf_build/test/csuite/wt2719_reconfig/WT_HOME")
+set_tests_properties(test_wt2719_reconfig PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2719_reconfig" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;211;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2834_join_bloom_fix "/root/repo/_perf_build/test/csuite/wt2834_join_bloom_fix/test_wt2834_join_bloom_fix" "-h" "/root/repo/_perf_build/test/csuite/wt2834_join_bloom_fix/WT_HOME")
+set_tests_properties(test_wt2834_join_bloom_fix PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2834_join_bloom_fix" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;219;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2909_checkpoint_integrity "smoke.sh" "-b" "/root/repo/_perf_build" "/root/repo/_perf_build/test/csuite/wt2909_checkpoint_integrity/test_wt2909_checkpoint_integrity")
+set_tests_properties(test_wt2909_checkpoint_integrity PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2909_checkpoint_integrity" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;226;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt2999_join_extractor "/root/repo/_perf_build/test/csuite/wt2999_join_extractor/test_wt2999_join_extractor" "-h" "/root/repo/_perf_build/test/csuite/wt2999_join_extractor/WT_HOME")
+set_tests_properties(test_wt2999_join_extractor PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt2999_join_extractor" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;238;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt3120_filesys "/root/repo/_perf_build/test/csuite/wt3120_filesys/test_wt3120_filesys" "-b" "/root/repo/_perf_build" "-h" "/root/repo/_perf_build/test/csuite/wt3120_filesys/WT_HOME")
+set_tests_properties(test_wt3120_filesys PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt3120_filesys" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;245;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt3135_search_near_collator "/root/repo/_perf_build/test/csuite/wt3135_search_near_collator/test_wt3135_search_near_collator" "-h" "/root/repo/_perf_build/test/csuite/wt3135_search_near_collator/WT_HOME")
+set_tests_properties(test_wt3135_search_near_collator PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt3135_search_near_collator" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;256;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt3184_dup_index_collator "/root/repo/_perf_build/test/csuite/wt3184_dup_index_collator/test_wt3184_dup_index_collator" "-h" "/root/repo/_perf_build/test/csuite/wt3184_dup_index_collator/WT_HOME")
+set_tests_properties(test_wt3184_dup_index_collator PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt3184_dup_index_collator" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;263;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt3338_partial_update "/root/repo/_perf_build/test/csuite/wt3338_partial_update/test_wt3338_partial_update" "-h" "/root/repo/_perf_build/test/csuite/wt3338_partial_update/WT_HOME")
+set_tests_properties(test_wt3338_partial_update PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt3338_partial_update" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;270;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt3363_checkpoint_op_races "/root/repo/_perf_build/test/csuite/wt3363_checkpoint_op_races/test_wt3363_checkpoint_op_races" "-h" "/root/repo/_perf_build/test/csuite/wt3363_checkpoint_op_races/WT_HOME")
+set_tests_properties(test_wt3363_checkpoint_op_races PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt3363_checkpoint_op_races" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;278;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt3874_pad_byte_collator "/root/repo/_perf_build/test/csuite/wt3874_pad_byte_collator/test_wt3874_pad_byte_collator" "-h" "/root/repo/_perf_build/test/csuite/wt3874_pad_byte_collator/WT_HOME")
+set_tests_properties(test_wt3874_pad_byte_collator PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt3874_pad_byte_collator" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;286;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt4105_large_doc_small_upd "smoke.sh" "/root/repo/_perf_build/test/csuite/wt4105_large_doc_small_upd/test_wt4105_large_doc_small_upd")
+set_tests_properties(test_wt4105_large_doc_small_upd PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt4105_large_doc_small_upd" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;293;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt4117_checksum "/root/repo/_perf_build/test/csuite/wt4117_checksum/test_wt4117_checksum" "-h" "/root/repo/_perf_build/test/csuite/wt4117_checksum/WT_HOME")
+set_tests_properties(test_wt4117_checksum PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt4117_checksum" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;302;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt4156_metadata_salvage "/root/repo/_perf_build/test/csuite/wt4156_metadata_salvage/test_wt4156_metadata_salvage" "-h" "/root/repo/_perf_build/test/csuite/wt4156_metadata_salvage/WT_HOME")
+set_tests_properties(test_wt4156_metadata_salvage PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt4156_metadata_salvage" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;309;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt4333_handle_locks "/root/repo/_perf_build/test/csuite/wt4333_handle_locks/test_wt4333_handle_locks" "-h" "/root/repo/_perf_build/test/csuite/wt4333_handle_locks/WT_HOME")
+set_tests_properties(test_wt4333_handle_locks PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt4333_handle_locks" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;317;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt4699_json "/root/repo/_perf_build/test/csuite/wt4699_json/test_wt4699_json" "-h" "/root/repo/_perf_build/test/csuite/wt4699_json/WT_HOME")
+set_tests_properties(test_wt4699_json PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt4699_json" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;325;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt4803_history_store_abort "/root/repo/_perf_build/test/csuite/wt4803_history_store_abort/test_wt4803_history_store_abort" "-h" "/root/repo/_perf_build/test/csuite/wt4803_history_store_abort/WT_HOME")
+set_tests_properties(test_wt4803_history_store_abort PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt4803_history_store_abort" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;332;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt4891_meta_ckptlist_get_alloc "/root/repo/_perf_build/test/csuite/wt4891_meta_ckptlist_get_alloc/test_wt4891_meta_ckptlist_get_alloc" "-h" "/root/repo/_perf_build/test/csuite/wt4891_meta_ckptlist_get_alloc/WT_HOME")
+set_tests_properties(test_wt4891_meta_ckptlist_get_alloc PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt4891_meta_ckptlist_get_alloc" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;340;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt6185_modify_ts "smoke.sh" "/root/repo/_perf_build/test/csuite/wt6185_modify_ts/test_wt6185_modify_ts")
+set_tests_properties(test_wt6185_modify_ts PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt6185_modify_ts" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;347;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt6616_checkpoint_oldest_ts "smoke.sh" "/root/repo/_perf_build/test/csuite/wt6616_checkpoint_oldest_ts/test_wt6616_checkpoint_oldest_ts")
+set_tests_properties(test_wt6616_checkpoint_oldest_ts PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt6616_checkpoint_oldest_ts" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;356;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt7989_compact_checkpoint "/root/repo/_perf_build/test/csuite/wt7989_compact_checkpoint/test_wt7989_compact_checkpoint" "-h" "/root/repo/_perf_build/test/csuite/wt7989_compact_checkpoint/WT_HOME")
+set_tests_properties(test_wt7989_compact_checkpoint PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt7989_compact_checkpoint" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;365;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt8057_compact_stress "/root/repo/_perf_build/test/csuite/wt8057_compact_stress/test_wt8057_compact_stress" "-h" "/root/repo/_perf_build/test/csuite/wt8057_compact_stress/WT_HOME")
+set_tests_properties(test_wt8057_compact_stress PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt8057_compact_stress" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;373;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt8246_compact_rts_data_correctness "/root/repo/_perf_build/test/csuite/wt8246_compact_rts_data_correctness/test_wt8246_compact_rts_data_correctness" "-h" "/root/repo/_perf_build/test/csuite/wt8246_compact_rts_data_correctness/WT_HOME")
+set_tests_properties(test_wt8246_compact_rts_data_correctness PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt8246_compact_rts_data_correctness" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;381;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt8659_reconstruct_database_from_logs "/root/repo/_perf_build/test/csuite/wt8659_reconstruct_database_from_logs/test_wt8659_reconstruct_database_from_logs" "-h" "/root/repo/_perf_build/test/csuite/wt8659_reconstruct_database_from_logs/WT_HOME")
+set_tests_properties(test_wt8659_reconstruct_database_from_logs PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt8659_reconstruct_database_from_logs" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;389;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt8963_insert_stress "/root/repo/_perf_build/test/csuite/wt8963_insert_stress/test_wt8963_insert_stress" "-h" "/root/repo/_perf_build/test/csuite/wt8963_insert_stress/WT_HOME")
+set_tests_properties(test_wt8963_insert_stress PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt8963_insert_stress" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;397;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
+add_test(test_wt9937_parse_opts "/root/repo/_perf_build/test/csuite/wt9937_parse_opts/test_wt9937_parse_opts")
+set_tests_properties(test_wt9937_parse_opts PROPERTIES  LABELS "check;csuite" WORKING_DIRECTORY "/root/repo/_perf_build/test/csuite/wt9937_parse_opts" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;305;add_test;/root/repo/test/csuite/CMakeLists.txt;405;define_c_test;/root/repo/test/csuite/CMakeLists.txt;0;")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/create_dir_test_cursor_order_var"
+  "test_cursor_order_var_test_dir"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/create_dir_test_cursor_order_var.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_cursor_order.dir/cursor_order.c.o"
+  "CMakeFiles/test_cursor_order.dir/cursor_order.c.o.d"
+  "CMakeFiles/test_cursor_order.dir/cursor_order_file.c.o"
+  "CMakeFiles/test_cursor_order.dir/cursor_order_file.c.o.d"
+  "CMakeFiles/test_cursor_order.dir/cursor_order_ops.c.o"
+  "CMakeFiles/test_cursor_order.dir/cursor_order_ops.c.o.d"
+  "test_cursor_order"
+  "test_cursor_order.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_cursor_order.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,12 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/cursor_order
+# Build directory: /root/repo/_perf_build/test/cursor_order
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_cursor_order_row "/root/repo/_perf_build/test/cursor_order/test_cursor_order" "-tr")
+set_tests_properties(test_cursor_order_row PROPERTIES  LABELS "check;test_cursor_order" WORKING_DIRECTORY "/root/repo/_perf_build/test/cursor_order/test_cursor_order_row_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/cursor_order/CMakeLists.txt;10;define_test_variants;/root/repo/test/cursor_order/CMakeLists.txt;0;")
+add_test(test_cursor_order_var "/root/repo/_perf_build/test/cursor_order/test_cursor_order" "-tv")
+set_tests_properties(test_cursor_order_var PROPERTIES  LABELS "check;test_cursor_order" WORKING_DIRECTORY "/root/repo/_perf_build/test/cursor_order/test_cursor_order_var_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/cursor_order/CMakeLists.txt;10;define_test_variants;/root/repo/test/cursor_order/CMakeLists.txt;0;")
+add_test(test_cursor_order_fix "/root/repo/_perf_build/test/cursor_order/test_cursor_order" "-tf")
+set_tests_properties(test_cursor_order_fix PROPERTIES  LABELS "check;test_cursor_order" WORKING_DIRECTORY "/root/repo/_perf_build/test/cursor_order/test_cursor_order_fix_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/cursor_order/CMakeLists.txt;10;define_test_variants;/root/repo/test/cursor_order/CMakeLists.txt;0;")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_fops.dir/fops.c.o"
+  "CMakeFiles/test_fops.dir/fops.c.o.d"
+  "CMakeFiles/test_fops.dir/fops_file.c.o"
+  "CMakeFiles/test_fops.dir/fops_file.c.o.d"
+  "CMakeFiles/test_fops.dir/t.c.o"
+  "CMakeFiles/test_fops.dir/t.c.o.d"
+  "test_fops"
+  "test_fops.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_fops.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
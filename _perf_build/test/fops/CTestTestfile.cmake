@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/fops
+# Build directory: /root/repo/_perf_build/test/fops
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_fops "/root/repo/_perf_build/test/fops/test_fops")
+set_tests_properties(test_fops PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/fops/CMakeLists.txt;15;add_test;/root/repo/test/fops/CMakeLists.txt;0;")
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_format_CONFIG.stress"
+  "CONFIG.stress"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_format_CONFIG.stress.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
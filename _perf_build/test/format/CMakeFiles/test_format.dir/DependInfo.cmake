@@ -0,0 +1,42 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/format/alter.c" "test/format/CMakeFiles/test_format.dir/alter.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/alter.c.o.d"
+  "/root/repo/test/format/backup.c" "test/format/CMakeFiles/test_format.dir/backup.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/backup.c.o.d"
+  "/root/repo/test/format/bulk.c" "test/format/CMakeFiles/test_format.dir/bulk.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/bulk.c.o.d"
+  "/root/repo/test/format/checkpoint.c" "test/format/CMakeFiles/test_format.dir/checkpoint.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/checkpoint.c.o.d"
+  "/root/repo/test/format/compact.c" "test/format/CMakeFiles/test_format.dir/compact.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/compact.c.o.d"
+  "/root/repo/test/format/config_compat.c" "test/format/CMakeFiles/test_format.dir/config_compat.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/config_compat.c.o.d"
+  "/root/repo/test/format/format_config.c" "test/format/CMakeFiles/test_format.dir/format_config.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/format_config.c.o.d"
+  "/root/repo/test/format/format_config_def.c" "test/format/CMakeFiles/test_format.dir/format_config_def.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/format_config_def.c.o.d"
+  "/root/repo/test/format/format_salvage.c" "test/format/CMakeFiles/test_format.dir/format_salvage.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/format_salvage.c.o.d"
+  "/root/repo/test/format/format_timestamp.c" "test/format/CMakeFiles/test_format.dir/format_timestamp.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/format_timestamp.c.o.d"
+  "/root/repo/test/format/format_util.c" "test/format/CMakeFiles/test_format.dir/format_util.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/format_util.c.o.d"
+  "/root/repo/test/format/hs.c" "test/format/CMakeFiles/test_format.dir/hs.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/hs.c.o.d"
+  "/root/repo/test/format/import.c" "test/format/CMakeFiles/test_format.dir/import.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/import.c.o.d"
+  "/root/repo/test/format/kv.c" "test/format/CMakeFiles/test_format.dir/kv.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/kv.c.o.d"
+  "/root/repo/test/format/ops.c" "test/format/CMakeFiles/test_format.dir/ops.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/ops.c.o.d"
+  "/root/repo/test/format/random.c" "test/format/CMakeFiles/test_format.dir/random.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/random.c.o.d"
+  "/root/repo/test/format/replay.c" "test/format/CMakeFiles/test_format.dir/replay.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/replay.c.o.d"
+  "/root/repo/test/format/snap.c" "test/format/CMakeFiles/test_format.dir/snap.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/snap.c.o.d"
+  "/root/repo/test/format/t.c" "test/format/CMakeFiles/test_format.dir/t.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/t.c.o.d"
+  "/root/repo/test/format/trace.c" "test/format/CMakeFiles/test_format.dir/trace.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/trace.c.o.d"
+  "/root/repo/test/format/verify.c" "test/format/CMakeFiles/test_format.dir/verify.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/verify.c.o.d"
+  "/root/repo/test/format/wts.c" "test/format/CMakeFiles/test_format.dir/wts.c.o" "gcc" "test/format/CMakeFiles/test_format.dir/wts.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_format.dir/alter.c.o"
+  "CMakeFiles/test_format.dir/alter.c.o.d"
+  "CMakeFiles/test_format.dir/backup.c.o"
+  "CMakeFiles/test_format.dir/backup.c.o.d"
+  "CMakeFiles/test_format.dir/bulk.c.o"
+  "CMakeFiles/test_format.dir/bulk.c.o.d"
+  "CMakeFiles/test_format.dir/checkpoint.c.o"
+  "CMakeFiles/test_format.dir/checkpoint.c.o.d"
+  "CMakeFiles/test_format.dir/compact.c.o"
+  "CMakeFiles/test_format.dir/compact.c.o.d"
+  "CMakeFiles/test_format.dir/config_compat.c.o"
+  "CMakeFiles/test_format.dir/config_compat.c.o.d"
+  "CMakeFiles/test_format.dir/format_config.c.o"
+  "CMakeFiles/test_format.dir/format_config.c.o.d"
+  "CMakeFiles/test_format.dir/format_config_def.c.o"
+  "CMakeFiles/test_format.dir/format_config_def.c.o.d"
+  "CMakeFiles/test_format.dir/format_salvage.c.o"
+  "CMakeFiles/test_format.dir/format_salvage.c.o.d"
+  "CMakeFiles/test_format.dir/format_timestamp.c.o"
+  "CMakeFiles/test_format.dir/format_timestamp.c.o.d"
+  "CMakeFiles/test_format.dir/format_util.c.o"
+  "CMakeFiles/test_format.dir/format_util.c.o.d"
+  "CMakeFiles/test_format.dir/hs.c.o"
+  "CMakeFiles/test_format.dir/hs.c.o.d"
+  "CMakeFiles/test_format.dir/import.c.o"
+  "CMakeFiles/test_format.dir/import.c.o.d"
+  "CMakeFiles/test_format.dir/kv.c.o"
+  "CMakeFiles/test_format.dir/kv.c.o.d"
+  "CMakeFiles/test_format.dir/ops.c.o"
+  "CMakeFiles/test_format.dir/ops.c.o.d"
+  "CMakeFiles/test_format.dir/random.c.o"
+  "CMakeFiles/test_format.dir/random.c.o.d"
+  "CMakeFiles/test_format.dir/replay.c.o"
+  "CMakeFiles/test_format.dir/replay.c.o.d"
+  "CMakeFiles/test_format.dir/snap.c.o"
+  "CMakeFiles/test_format.dir/snap.c.o.d"
+  "CMakeFiles/test_format.dir/t.c.o"
+  "CMakeFiles/test_format.dir/t.c.o.d"
+  "CMakeFiles/test_format.dir/trace.c.o"
+  "CMakeFiles/test_format.dir/trace.c.o.d"
+  "CMakeFiles/test_format.dir/verify.c.o"
+  "CMakeFiles/test_format.dir/verify.c.o.d"
+  "CMakeFiles/test_format.dir/wts.c.o"
+  "CMakeFiles/test_format.dir/wts.c.o.d"
+  "t"
+  "t.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_format.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
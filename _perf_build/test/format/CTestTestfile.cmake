@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/format
+# Build directory: /root/repo/_perf_build/test/format
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_format "/root/repo/_perf_build/test/format/smoke.sh")
+set_tests_properties(test_format PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/format/CMakeLists.txt;38;add_test;/root/repo/test/format/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_huge.dir/huge.c.o"
+  "CMakeFiles/test_huge.dir/huge.c.o.d"
+  "test_huge"
+  "test_huge.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_huge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/huge
+# Build directory: /root/repo/_perf_build/test/huge
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_huge_small "/root/repo/_perf_build/test/huge/test_huge" "-s")
+set_tests_properties(test_huge_small PROPERTIES  LABELS "check" WORKING_DIRECTORY "/root/repo/_perf_build/test/huge/test_huge_small_test_dir" _BACKTRACE_TRIPLES "/root/repo/test/ctest_helpers.cmake;216;add_test;/root/repo/test/huge/CMakeLists.txt;7;define_test_variants;/root/repo/test/huge/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_manydbs.dir/manydbs.c.o"
+  "CMakeFiles/test_manydbs.dir/manydbs.c.o.d"
+  "test_manydbs"
+  "test_manydbs.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_manydbs.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/manydbs
+# Build directory: /root/repo/_perf_build/test/manydbs
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_manydbs "/root/repo/_perf_build/test/manydbs/test_manydbs")
+set_tests_properties(test_manydbs PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/manydbs/CMakeLists.txt;13;add_test;/root/repo/test/manydbs/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_intpack.dir/intpack-test3.c.o"
+  "CMakeFiles/test_intpack.dir/intpack-test3.c.o.d"
+  "intpack-test3"
+  "intpack-test3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_intpack.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
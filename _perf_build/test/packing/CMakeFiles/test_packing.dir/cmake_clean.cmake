@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_packing.dir/packing-test.c.o"
+  "CMakeFiles/test_packing.dir/packing-test.c.o.d"
+  "packing-test"
+  "packing-test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_packing.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,10 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/packing
+# Build directory: /root/repo/_perf_build/test/packing
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_packing "/root/repo/_perf_build/test/packing/packing-test")
+set_tests_properties(test_packing PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/packing/CMakeLists.txt;15;add_test;/root/repo/test/packing/CMakeLists.txt;0;")
+add_test(test_intpack "/root/repo/_perf_build/test/packing/intpack-test3")
+set_tests_properties(test_intpack PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/packing/CMakeLists.txt;16;add_test;/root/repo/test/packing/CMakeLists.txt;0;")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_readonly.dir/readonly.c.o"
+  "CMakeFiles/test_readonly.dir/readonly.c.o.d"
+  "t"
+  "t.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_readonly.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
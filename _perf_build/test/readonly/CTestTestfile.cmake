@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/readonly
+# Build directory: /root/repo/_perf_build/test/readonly
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_readonly "/root/repo/_perf_build/test/readonly/smoke.sh")
+set_tests_properties(test_readonly PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/readonly/CMakeLists.txt;10;add_test;/root/repo/test/readonly/CMakeLists.txt;0;")
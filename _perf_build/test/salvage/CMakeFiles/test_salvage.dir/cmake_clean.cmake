@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_salvage.dir/salvage.c.o"
+  "CMakeFiles/test_salvage.dir/salvage.c.o.d"
+  "test_salvage"
+  "test_salvage.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_salvage.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/salvage
+# Build directory: /root/repo/_perf_build/test/salvage
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_salvage "/root/repo/_perf_build/test/salvage/test_salvage")
+set_tests_properties(test_salvage PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/salvage/CMakeLists.txt;7;add_test;/root/repo/test/salvage/CMakeLists.txt;0;")
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/simulator/timestamp/src/connection_simulator.cpp" "test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/src/connection_simulator.cpp.o" "gcc" "test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/src/connection_simulator.cpp.o.d"
+  "/root/repo/test/simulator/timestamp/src/session_simulator.cpp" "test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/src/session_simulator.cpp.o" "gcc" "test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/src/session_simulator.cpp.o.d"
+  "/root/repo/test/simulator/timestamp/src/timestamp_manager.cpp" "test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/src/timestamp_manager.cpp.o" "gcc" "test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/src/timestamp_manager.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
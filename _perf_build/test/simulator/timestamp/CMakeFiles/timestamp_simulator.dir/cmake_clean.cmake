@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/timestamp_simulator.dir/src/connection_simulator.cpp.o"
+  "CMakeFiles/timestamp_simulator.dir/src/connection_simulator.cpp.o.d"
+  "CMakeFiles/timestamp_simulator.dir/src/session_simulator.cpp.o"
+  "CMakeFiles/timestamp_simulator.dir/src/session_simulator.cpp.o.d"
+  "CMakeFiles/timestamp_simulator.dir/src/timestamp_manager.cpp.o"
+  "CMakeFiles/timestamp_simulator.dir/src/timestamp_manager.cpp.o.d"
+  "libtimestamp_simulator.pdb"
+  "libtimestamp_simulator.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/timestamp_simulator.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
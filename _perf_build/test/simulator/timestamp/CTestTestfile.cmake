@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/simulator/timestamp
+# Build directory: /root/repo/_perf_build/test/simulator/timestamp
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("call_log_manager")
+subdirs("simulator_interface")
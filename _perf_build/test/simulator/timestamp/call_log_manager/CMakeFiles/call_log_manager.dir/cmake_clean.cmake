@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/call_log_manager.dir/call_log_manager.cpp.o"
+  "CMakeFiles/call_log_manager.dir/call_log_manager.cpp.o.d"
+  "call_log_manager"
+  "call_log_manager.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/call_log_manager.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
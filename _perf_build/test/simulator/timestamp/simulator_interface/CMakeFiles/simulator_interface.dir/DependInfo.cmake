@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/simulator/timestamp/simulator_interface/simulator_interface.cpp" "test/simulator/timestamp/simulator_interface/CMakeFiles/simulator_interface.dir/simulator_interface.cpp.o" "gcc" "test/simulator/timestamp/simulator_interface/CMakeFiles/simulator_interface.dir/simulator_interface.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/simulator/timestamp/CMakeFiles/timestamp_simulator.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/simulator_interface.dir/simulator_interface.cpp.o"
+  "CMakeFiles/simulator_interface.dir/simulator_interface.cpp.o.d"
+  "simulator_interface"
+  "simulator_interface.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/simulator_interface.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
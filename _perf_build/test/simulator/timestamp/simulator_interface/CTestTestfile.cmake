@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/simulator/timestamp/simulator_interface
+# Build directory: /root/repo/_perf_build/test/simulator/timestamp/simulator_interface
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/copy_file_test_wt2336_base_syscall.py"
+  "syscall.py"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/copy_file_test_wt2336_base_syscall.py.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
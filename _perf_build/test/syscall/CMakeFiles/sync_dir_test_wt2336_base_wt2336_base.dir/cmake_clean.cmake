@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/sync_dir_test_wt2336_base_wt2336_base"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/sync_dir_test_wt2336_base_wt2336_base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_wt2336_base.dir/wt2336_base/main.c.o"
+  "CMakeFiles/test_wt2336_base.dir/wt2336_base/main.c.o.d"
+  "test_wt2336_base"
+  "test_wt2336_base.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_wt2336_base.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/syscall
+# Build directory: /root/repo/_perf_build/test/syscall
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_syscall "python3" "/root/repo/_perf_build/test/syscall/syscall.py")
+set_tests_properties(test_syscall PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/test/syscall/CMakeLists.txt;12;add_test;/root/repo/test/syscall/CMakeLists.txt;0;")
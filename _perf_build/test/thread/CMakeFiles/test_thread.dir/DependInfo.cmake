@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/thread/file.c" "test/thread/CMakeFiles/test_thread.dir/file.c.o" "gcc" "test/thread/CMakeFiles/test_thread.dir/file.c.o.d"
+  "/root/repo/test/thread/rw.c" "test/thread/CMakeFiles/test_thread.dir/rw.c.o" "gcc" "test/thread/CMakeFiles/test_thread.dir/rw.c.o.d"
+  "/root/repo/test/thread/stats.c" "test/thread/CMakeFiles/test_thread.dir/stats.c.o" "gcc" "test/thread/CMakeFiles/test_thread.dir/stats.c.o.d"
+  "/root/repo/test/thread/t.c" "test/thread/CMakeFiles/test_thread.dir/t.c.o" "gcc" "test/thread/CMakeFiles/test_thread.dir/t.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/test/utility/CMakeFiles/test_util.dir/DependInfo.cmake"
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
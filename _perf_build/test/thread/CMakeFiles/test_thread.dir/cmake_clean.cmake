@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_thread.dir/file.c.o"
+  "CMakeFiles/test_thread.dir/file.c.o.d"
+  "CMakeFiles/test_thread.dir/rw.c.o"
+  "CMakeFiles/test_thread.dir/rw.c.o.d"
+  "CMakeFiles/test_thread.dir/stats.c.o"
+  "CMakeFiles/test_thread.dir/stats.c.o.d"
+  "CMakeFiles/test_thread.dir/t.c.o"
+  "CMakeFiles/test_thread.dir/t.c.o.d"
+  "t"
+  "t.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_thread.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/test/thread
+# Build directory: /root/repo/_perf_build/test/thread
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(test_thread "/root/repo/_perf_build/test/thread/smoke.sh")
+set_tests_properties(test_thread PROPERTIES  LABELS "check" _BACKTRACE_TRIPLES "/root/repo/test/thread/CMakeLists.txt;14;add_test;/root/repo/test/thread/CMakeLists.txt;0;")
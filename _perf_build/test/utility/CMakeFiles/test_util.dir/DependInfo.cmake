@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/utility/lazyfs.c" "test/utility/CMakeFiles/test_util.dir/lazyfs.c.o" "gcc" "test/utility/CMakeFiles/test_util.dir/lazyfs.c.o.d"
+  "/root/repo/test/utility/misc.c" "test/utility/CMakeFiles/test_util.dir/misc.c.o" "gcc" "test/utility/CMakeFiles/test_util.dir/misc.c.o.d"
+  "/root/repo/test/utility/parse_opts.c" "test/utility/CMakeFiles/test_util.dir/parse_opts.c.o" "gcc" "test/utility/CMakeFiles/test_util.dir/parse_opts.c.o.d"
+  "/root/repo/test/utility/thread.c" "test/utility/CMakeFiles/test_util.dir/thread.c.o" "gcc" "test/utility/CMakeFiles/test_util.dir/thread.c.o.d"
+  "/root/repo/test/utility/tiered.c" "test/utility/CMakeFiles/test_util.dir/tiered.c.o" "gcc" "test/utility/CMakeFiles/test_util.dir/tiered.c.o.d"
+  "/root/repo/test/utility/util_modify.c" "test/utility/CMakeFiles/test_util.dir/util_modify.c.o" "gcc" "test/utility/CMakeFiles/test_util.dir/util_modify.c.o.d"
+  "/root/repo/test/utility/util_random.c" "test/utility/CMakeFiles/test_util.dir/util_random.c.o" "gcc" "test/utility/CMakeFiles/test_util.dir/util_random.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_perf_build/CMakeFiles/wiredtiger_shared.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
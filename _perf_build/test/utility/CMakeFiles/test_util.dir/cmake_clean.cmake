@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test_util.dir/lazyfs.c.o"
+  "CMakeFiles/test_util.dir/lazyfs.c.o.d"
+  "CMakeFiles/test_util.dir/misc.c.o"
+  "CMakeFiles/test_util.dir/misc.c.o.d"
+  "CMakeFiles/test_util.dir/parse_opts.c.o"
+  "CMakeFiles/test_util.dir/parse_opts.c.o.d"
+  "CMakeFiles/test_util.dir/thread.c.o"
+  "CMakeFiles/test_util.dir/thread.c.o.d"
+  "CMakeFiles/test_util.dir/tiered.c.o"
+  "CMakeFiles/test_util.dir/tiered.c.o.d"
+  "CMakeFiles/test_util.dir/util_modify.c.o"
+  "CMakeFiles/test_util.dir/util_modify.c.o.d"
+  "CMakeFiles/test_util.dir/util_random.c.o"
+  "CMakeFiles/test_util.dir/util_random.c.o.d"
+  "libtest_util.a"
+  "libtest_util.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/test_util.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,334 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "micro.h"
+
+/*
+ * Btree microbenchmarks: key comparison, insert list (skiplist) search and insert, and row-store
+ * search of a tree held in memory. The search and insert functions are called directly, with the
+ * cursor's tree pinned by the benchmark, not through the cursor API.
+ */
+#define MICRO_KEY_MAX 1024
+
+static WT_CURSOR *cursor;
+static WT_ITEM *keys;
+static uint64_t nkeys;
+static uint8_t key_a[MICRO_KEY_MAX], key_b[MICRO_KEY_MAX];
+
+/*
+ * lex_compare_run --
+ *     Compare keys that differ in their last byte.
+ */
+static void
+lex_compare_run(MICRO_STATE *state)
+{
+    WT_ITEM a, b;
+    uint64_t i;
+    int sum;
+
+    a.data = key_a;
+    b.data = key_b;
+    a.size = b.size = (size_t)state->arg;
+    memset(key_a, 'a', MICRO_KEY_MAX);
+    memset(key_b, 'a', MICRO_KEY_MAX);
+    key_b[state->arg - 1] = 'b';
+
+    for (sum = 0, i = 0; i < state->iterations; ++i) {
+        sum += __wt_lex_compare(&a, &b);
+        WT_BARRIER();
+    }
+    micro_sink += (uint64_t)sum;
+}
+
+/*
+ * btree_teardown --
+ *     Close the benchmark's cursor and drop its object.
+ */
+static int
+btree_teardown(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_DECL_RET;
+    char uri[64];
+
+    WT_UNUSED(arg);
+
+    testutil_check(__wt_snprintf(uri, sizeof(uri), "%s", cursor->uri));
+    WT_TRET(cursor->close(cursor));
+    cursor = NULL;
+    free(keys);
+    keys = NULL;
+    WT_TRET(micro_drop(session, uri));
+    return (ret);
+}
+
+/*
+ * btree_close --
+ *     Close the benchmark's cursor, leaving its object in place. Trees modified outside of the
+ *     cursor API may not be clean enough to drop, the home directory is removed on exit.
+ */
+static int
+btree_close(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_DECL_RET;
+
+    WT_UNUSED(session);
+    WT_UNUSED(arg);
+
+    ret = cursor->close(cursor);
+    cursor = NULL;
+    return (ret);
+}
+
+/*
+ * page_release --
+ *     Release the page a search pinned, leaving the cursor unpositioned.
+ */
+static int
+page_release(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
+{
+    WT_REF *ref;
+
+    ref = cbt->ref;
+    cbt->ref = NULL;
+    return (__wt_page_release(session, ref, 0));
+}
+
+/*
+ * search_insert_setup --
+ *     Insert keys into an empty tree: they're all added to the insert list of its only page.
+ */
+static int
+search_insert_setup(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_SESSION *wt_session;
+    const char *uri;
+
+    wt_session = (WT_SESSION *)session;
+    uri = "file:micro_search_insert";
+    nkeys = (uint64_t)arg;
+    WT_RET(micro_populate(session, uri,
+      "key_format=u,value_format=u,memory_page_max=1GB,log=(enabled=false)", nkeys, &keys));
+    return (wt_session->open_cursor(wt_session, uri, NULL, NULL, &cursor));
+}
+
+/*
+ * search_insert_loop --
+ *     Search the page's insert list.
+ */
+static int
+search_insert_loop(MICRO_STATE *state, WT_CURSOR_BTREE *cbt)
+{
+    WT_DECL_RET;
+    WT_INSERT_HEAD *ins_head;
+    WT_SESSION_IMPL *session;
+    uint64_t i;
+
+    session = state->session;
+
+    /* Pin the page, then search its insert list. */
+    WT_WITH_PAGE_INDEX(session, ret = __wt_row_search(cbt, &keys[0], false, NULL, false, NULL));
+    WT_RET(ret);
+    ins_head = WT_ROW_INSERT_SMALLEST(cbt->ref->page);
+    testutil_assert(ins_head != NULL);
+    for (i = 0; i < state->iterations; ++i)
+        WT_RET(__wt_search_insert(session, cbt, ins_head, &keys[__wt_random(&state->rnd) % nkeys]));
+    return (page_release(session, cbt));
+}
+
+/*
+ * search_insert_run --
+ *     Search an insert list for random keys.
+ */
+static void
+search_insert_run(MICRO_STATE *state)
+{
+    WT_CURSOR_BTREE *cbt;
+    WT_DECL_RET;
+
+    cbt = (WT_CURSOR_BTREE *)cursor;
+    WT_WITH_BTREE(state->session, CUR2BT(cbt), ret = search_insert_loop(state, cbt));
+    testutil_check(ret);
+}
+
+/*
+ * skiplist_insert_setup --
+ *     Create an empty tree.
+ */
+static int
+skiplist_insert_setup(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_SESSION *wt_session;
+    const char *uri;
+
+    WT_UNUSED(arg);
+    wt_session = (WT_SESSION *)session;
+    uri = "file:micro_skiplist_insert";
+    WT_RET(wt_session->create(wt_session, uri,
+      "key_format=u,value_format=u,memory_page_max=1GB,log=(enabled=false)"));
+    return (wt_session->open_cursor(wt_session, uri, NULL, NULL, &cursor));
+}
+
+/*
+ * skiplist_insert_loop --
+ *     Insert random keys, committing a transaction every thousand keys.
+ */
+static int
+skiplist_insert_loop(MICRO_STATE *state, WT_CURSOR_BTREE *cbt)
+{
+    WT_DECL_RET;
+    WT_ITEM key, value;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    uint64_t i, keyv;
+
+    session = state->session;
+    wt_session = (WT_SESSION *)session;
+    key.data = &keyv;
+    key.size = sizeof(keyv);
+    value.data = "value";
+    value.size = 5;
+
+    for (i = 0; i < state->iterations; ++i) {
+        if (i % WT_THOUSAND == 0) {
+            if (i != 0)
+                WT_RET(wt_session->commit_transaction(wt_session, NULL));
+            WT_RET(wt_session->begin_transaction(wt_session, NULL));
+            __wt_txn_cursor_op(session);
+        }
+        keyv = ((uint64_t)__wt_random(&state->rnd) << 32) | __wt_random(&state->rnd);
+        WT_WITH_PAGE_INDEX(session, ret = __wt_row_search(cbt, &key, true, NULL, false, NULL));
+        WT_RET(ret);
+        WT_RET(__wt_row_modify(cbt, &key, &value, NULL, WT_UPDATE_STANDARD, false, false));
+        WT_RET(page_release(session, cbt));
+    }
+    return (wt_session->commit_transaction(wt_session, NULL));
+}
+
+/*
+ * skiplist_insert_run --
+ *     Insert random keys into a page's insert lists.
+ */
+static void
+skiplist_insert_run(MICRO_STATE *state)
+{
+    WT_CURSOR_BTREE *cbt;
+    WT_DECL_RET;
+
+    cbt = (WT_CURSOR_BTREE *)cursor;
+    WT_WITH_BTREE(state->session, CUR2BT(cbt), ret = skiplist_insert_loop(state, cbt));
+    testutil_check(ret);
+}
+
+/*
+ * row_search_setup --
+ *     Create a tree and read it into memory from disk, so its keys are on its pages rather than in
+ *     insert lists.
+ */
+static int
+row_search_setup(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_CONNECTION *wt_conn;
+    WT_DECL_RET;
+    WT_SESSION *evict_session, *wt_session;
+    const char *uri;
+
+    wt_session = (WT_SESSION *)session;
+    wt_conn = wt_session->connection;
+    uri = "file:micro_row_search";
+    nkeys = (uint64_t)arg;
+    WT_RET(micro_populate(session, uri, "key_format=u,value_format=u,log=(enabled=false)", nkeys,
+      &keys));
+    WT_RET(wt_session->checkpoint(wt_session, NULL));
+
+    /* Walk the tree evicting the clean pages, then walk it again to read them back in. */
+    WT_RET(wt_conn->open_session(
+      wt_conn, NULL, "debug=(release_evict_page=true)", &evict_session));
+    WT_ERR(evict_session->open_cursor(evict_session, uri, NULL, NULL, &cursor));
+    while ((ret = cursor->next(cursor)) == 0)
+        ;
+    WT_ERR_NOTFOUND_OK(ret, false);
+    WT_ERR(cursor->close(cursor));
+    cursor = NULL;
+
+    WT_ERR(wt_session->open_cursor(wt_session, uri, NULL, NULL, &cursor));
+    while ((ret = cursor->next(cursor)) == 0)
+        ;
+    WT_ERR_NOTFOUND_OK(ret, false);
+    WT_ERR(cursor->reset(cursor));
+
+err:
+    WT_TRET(evict_session->close(evict_session, NULL));
+    return (ret);
+}
+
+/*
+ * row_search_loop --
+ *     Search for random keys.
+ */
+static int
+row_search_loop(MICRO_STATE *state, WT_CURSOR_BTREE *cbt)
+{
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    uint64_t i;
+
+    session = state->session;
+    for (i = 0; i < state->iterations; ++i) {
+        WT_WITH_PAGE_INDEX(session,
+          ret = __wt_row_search(
+            cbt, &keys[__wt_random(&state->rnd) % nkeys], false, NULL, false, NULL));
+        WT_RET(ret);
+        testutil_assert(cbt->compare == 0);
+        WT_RET(page_release(session, cbt));
+    }
+    return (0);
+}
+
+/*
+ * row_search_run --
+ *     Search a row-store tree held in memory.
+ */
+static void
+row_search_run(MICRO_STATE *state)
+{
+    WT_CURSOR_BTREE *cbt;
+    WT_DECL_RET;
+
+    cbt = (WT_CURSOR_BTREE *)cursor;
+    WT_WITH_BTREE(state->session, CUR2BT(cbt), ret = row_search_loop(state, cbt));
+    testutil_check(ret);
+}
+
+MICRO_BENCH micro_btree[] = {
+  {"lex_compare", 8, 0, NULL, lex_compare_run, NULL},
+  {"lex_compare", 64, 0, NULL, lex_compare_run, NULL},
+  {"lex_compare", 1024, 0, NULL, lex_compare_run, NULL},
+  {"search_insert", 1000, 0, search_insert_setup, search_insert_run, btree_teardown},
+  {"search_insert", 100000, 0, search_insert_setup, search_insert_run, btree_teardown},
+  {"skiplist_insert", -1, 0, skiplist_insert_setup, skiplist_insert_run, btree_close},
+  {"row_search", 1000000, 0, row_search_setup, row_search_run, btree_teardown},
+  {NULL, 0, 0, NULL, NULL, NULL}};
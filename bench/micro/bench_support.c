@@ -0,0 +1,379 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "micro.h"
+
+/*
+ * Support microbenchmarks: integer packing, checksums, the compressors built with the library, and
+ * lock acquisition by contending threads.
+ */
+#define MICRO_VALUES 1024
+
+#define MICRO_EXT_PFX ",extensions=["
+#define MICRO_EXT_SFX "]"
+#define MICRO_EXTPATH "../../ext/compressors/" /* Extensions path */
+
+static uint64_t values[MICRO_VALUES];
+static uint8_t *buf, *cbuf, *dbuf;
+static size_t cbuf_len, cbuf_size;
+static WT_COMPRESSOR *compressor;
+static WT_RWLOCK rwlock;
+static WT_SPINLOCK spinlock;
+static volatile uint64_t shared_counter;
+
+/*
+ * micro_extensions --
+ *     Return the configuration loading the compressors built with the library.
+ */
+const char *
+micro_extensions(void)
+{
+    return (MICRO_EXT_PFX
+#ifdef LZ4_PATH
+      "\"" MICRO_EXTPATH LZ4_PATH "\","
+#endif
+#ifdef SNAPPY_PATH
+      "\"" MICRO_EXTPATH SNAPPY_PATH "\","
+#endif
+#ifdef ZLIB_PATH
+      "\"" MICRO_EXTPATH ZLIB_PATH "\","
+#endif
+#ifdef ZSTD_PATH
+      "\"" MICRO_EXTPATH ZSTD_PATH "\","
+#endif
+        MICRO_EXT_SFX);
+}
+
+/*
+ * vpack_setup --
+ *     Generate random values of the configured number of bits.
+ */
+static int
+vpack_setup(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_RAND_STATE rnd;
+    u_int i;
+
+    __wt_random_init_seed(session, &rnd);
+    for (i = 0; i < MICRO_VALUES; ++i)
+        values[i] = (((uint64_t)__wt_random(&rnd) << 32) | __wt_random(&rnd)) &
+          (arg == 64 ? UINT64_MAX : (UINT64_C(1) << arg) - 1);
+    return (0);
+}
+
+/*
+ * vpack_uint_run --
+ *     Pack unsigned integers.
+ */
+static void
+vpack_uint_run(MICRO_STATE *state)
+{
+    uint64_t i;
+    uint8_t packed[MICRO_VALUES * WT_INTPACK64_MAXSIZE], *p;
+
+    for (p = packed, i = 0; i < state->iterations; ++i) {
+        if (i % MICRO_VALUES == 0)
+            p = packed;
+        testutil_check(__wt_vpack_uint(&p, WT_INTPACK64_MAXSIZE, values[i % MICRO_VALUES]));
+    }
+    micro_sink += packed[0];
+}
+
+/*
+ * vunpack_uint_run --
+ *     Unpack unsigned integers.
+ */
+static void
+vunpack_uint_run(MICRO_STATE *state)
+{
+    uint64_t i, sum, x;
+    uint8_t packed[MICRO_VALUES * WT_INTPACK64_MAXSIZE], *p;
+    const uint8_t *cp;
+
+    for (p = packed, i = 0; i < MICRO_VALUES; ++i)
+        testutil_check(__wt_vpack_uint(&p, WT_INTPACK64_MAXSIZE, values[i]));
+
+    for (cp = packed, sum = 0, i = 0; i < state->iterations; ++i) {
+        if (i % MICRO_VALUES == 0)
+            cp = packed;
+        testutil_check(__wt_vunpack_uint(&cp, WT_INTPACK64_MAXSIZE, &x));
+        sum += x;
+    }
+    micro_sink += sum;
+}
+
+/*
+ * buffer_setup --
+ *     Fill a buffer with compressible data: random words from a small vocabulary.
+ */
+static int
+buffer_setup(WT_SESSION_IMPL *session, int64_t arg)
+{
+    static const char *const words[] = {"alpha ", "bravo ", "charlie ", "delta ", "echo ",
+      "foxtrot ", "golf ", "hotel ", "india ", "juliet ", "kilo ", "lima ", "mike ", "november ",
+      "oscar ", "papa "};
+    WT_RAND_STATE rnd;
+    size_t len, n;
+    const char *word;
+
+    __wt_random_init_seed(session, &rnd);
+    buf = dcalloc(1, (size_t)arg);
+    for (n = 0; n < (size_t)arg; n += len) {
+        word = words[__wt_random(&rnd) % WT_ELEMENTS(words)];
+        len = WT_MIN(strlen(word), (size_t)arg - n);
+        memcpy(buf + n, word, len);
+    }
+    return (0);
+}
+
+/*
+ * buffer_teardown --
+ *     Free the buffers.
+ */
+static int
+buffer_teardown(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_UNUSED(session);
+    WT_UNUSED(arg);
+
+    free(buf);
+    free(cbuf);
+    free(dbuf);
+    buf = cbuf = dbuf = NULL;
+    compressor = NULL;
+    return (0);
+}
+
+/*
+ * checksum_run --
+ *     Checksum a buffer.
+ */
+static void
+checksum_run(MICRO_STATE *state)
+{
+    uint64_t i;
+    uint32_t sum;
+
+    for (sum = 0, i = 0; i < state->iterations; ++i) {
+        sum += __wt_checksum(buf, (size_t)state->arg);
+        WT_BARRIER();
+    }
+    micro_sink += sum;
+}
+
+/*
+ * compress_setup --
+ *     Find a compressor and compress the buffer once, for decompression.
+ */
+static int
+compress_setup(WT_SESSION_IMPL *session, const char *name, int64_t arg)
+{
+    WT_NAMED_COMPRESSOR *ncomp;
+    int failed;
+
+    WT_RET(buffer_setup(session, arg));
+    TAILQ_FOREACH (ncomp, &S2C(session)->compqh, q)
+        if (strcmp(ncomp->name, name) == 0)
+            compressor = ncomp->compressor;
+    testutil_assert(compressor != NULL);
+
+    cbuf_size = (size_t)arg;
+    if (compressor->pre_size != NULL)
+        WT_RET(compressor->pre_size(
+          compressor, (WT_SESSION *)session, buf, (size_t)arg, &cbuf_size));
+    cbuf = dcalloc(1, cbuf_size);
+    dbuf = dcalloc(1, (size_t)arg);
+    WT_RET(compressor->compress(compressor, (WT_SESSION *)session, buf, (size_t)arg, cbuf,
+      cbuf_size, &cbuf_len, &failed));
+    testutil_assert(failed == 0);
+    return (0);
+}
+
+/*
+ * compress_run --
+ *     Compress the buffer.
+ */
+static void
+compress_run(MICRO_STATE *state)
+{
+    size_t len;
+    uint64_t i;
+    int failed;
+
+    for (i = 0; i < state->iterations; ++i)
+        testutil_check(compressor->compress(compressor, (WT_SESSION *)state->session, buf,
+          (size_t)state->arg, cbuf, cbuf_size, &len, &failed));
+}
+
+/*
+ * decompress_run --
+ *     Decompress the buffer.
+ */
+static void
+decompress_run(MICRO_STATE *state)
+{
+    size_t len;
+    uint64_t i;
+
+    for (i = 0; i < state->iterations; ++i) {
+        testutil_check(compressor->decompress(compressor, (WT_SESSION *)state->session, cbuf,
+          cbuf_len, dbuf, (size_t)state->arg, &len));
+        testutil_assert(len == (size_t)state->arg);
+    }
+}
+
+#define MICRO_COMPRESS_SETUP(name)                                  \
+    static int compress_setup_##name(WT_SESSION_IMPL *s, int64_t a) \
+    {                                                               \
+        return (compress_setup(s, #name, a));                       \
+    }
+#ifdef LZ4_PATH
+MICRO_COMPRESS_SETUP(lz4)
+#endif
+#ifdef SNAPPY_PATH
+MICRO_COMPRESS_SETUP(snappy)
+#endif
+#ifdef ZLIB_PATH
+MICRO_COMPRESS_SETUP(zlib)
+#endif
+#ifdef ZSTD_PATH
+MICRO_COMPRESS_SETUP(zstd)
+#endif
+
+/*
+ * lock_setup --
+ *     Initialize the locks.
+ */
+static int
+lock_setup(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_UNUSED(arg);
+
+    shared_counter = 0;
+    WT_RET(__wt_rwlock_init(session, &rwlock));
+    return (__wt_spin_init(session, &spinlock, "micro"));
+}
+
+/*
+ * lock_teardown --
+ *     Destroy the locks.
+ */
+static int
+lock_teardown(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_UNUSED(arg);
+
+    __wt_rwlock_destroy(session, &rwlock);
+    __wt_spin_destroy(session, &spinlock);
+    return (0);
+}
+
+/*
+ * rwlock_read_run --
+ *     Acquire and release a shared read lock.
+ */
+static void
+rwlock_read_run(MICRO_STATE *state)
+{
+    uint64_t i, sum;
+
+    for (sum = 0, i = 0; i < state->iterations; ++i) {
+        __wt_readlock(state->session, &rwlock);
+        sum += shared_counter;
+        __wt_readunlock(state->session, &rwlock);
+    }
+    micro_sink += sum;
+}
+
+/*
+ * rwlock_write_run --
+ *     Acquire and release an exclusive write lock.
+ */
+static void
+rwlock_write_run(MICRO_STATE *state)
+{
+    uint64_t i;
+
+    for (i = 0; i < state->iterations; ++i) {
+        __wt_writelock(state->session, &rwlock);
+        ++shared_counter;
+        __wt_writeunlock(state->session, &rwlock);
+    }
+}
+
+/*
+ * spinlock_run --
+ *     Acquire and release a spinlock.
+ */
+static void
+spinlock_run(MICRO_STATE *state)
+{
+    uint64_t i;
+
+    for (i = 0; i < state->iterations; ++i) {
+        __wt_spin_lock(state->session, &spinlock);
+        ++shared_counter;
+        __wt_spin_unlock(state->session, &spinlock);
+    }
+}
+
+MICRO_BENCH micro_support[] = {
+  {"vpack_uint", 7, 0, vpack_setup, vpack_uint_run, NULL},
+  {"vpack_uint", 32, 0, vpack_setup, vpack_uint_run, NULL},
+  {"vpack_uint", 64, 0, vpack_setup, vpack_uint_run, NULL},
+  {"vunpack_uint", 7, 0, vpack_setup, vunpack_uint_run, NULL},
+  {"vunpack_uint", 32, 0, vpack_setup, vunpack_uint_run, NULL},
+  {"vunpack_uint", 64, 0, vpack_setup, vunpack_uint_run, NULL},
+  {"checksum", 64, 0, buffer_setup, checksum_run, buffer_teardown},
+  {"checksum", 4096, 0, buffer_setup, checksum_run, buffer_teardown},
+  {"checksum", 32768, 0, buffer_setup, checksum_run, buffer_teardown},
+#ifdef LZ4_PATH
+  {"compress/lz4", 32768, 0, compress_setup_lz4, compress_run, buffer_teardown},
+  {"decompress/lz4", 32768, 0, compress_setup_lz4, decompress_run, buffer_teardown},
+#endif
+#ifdef SNAPPY_PATH
+  {"compress/snappy", 32768, 0, compress_setup_snappy, compress_run, buffer_teardown},
+  {"decompress/snappy", 32768, 0, compress_setup_snappy, decompress_run, buffer_teardown},
+#endif
+#ifdef ZLIB_PATH
+  {"compress/zlib", 32768, 0, compress_setup_zlib, compress_run, buffer_teardown},
+  {"decompress/zlib", 32768, 0, compress_setup_zlib, decompress_run, buffer_teardown},
+#endif
+#ifdef ZSTD_PATH
+  {"compress/zstd", 32768, 0, compress_setup_zstd, compress_run, buffer_teardown},
+  {"decompress/zstd", 32768, 0, compress_setup_zstd, decompress_run, buffer_teardown},
+#endif
+  {"rwlock_read", -1, 1, lock_setup, rwlock_read_run, lock_teardown},
+  {"rwlock_read", -1, 4, lock_setup, rwlock_read_run, lock_teardown},
+  {"rwlock_read", -1, 16, lock_setup, rwlock_read_run, lock_teardown},
+  {"rwlock_write", -1, 1, lock_setup, rwlock_write_run, lock_teardown},
+  {"rwlock_write", -1, 4, lock_setup, rwlock_write_run, lock_teardown},
+  {"rwlock_write", -1, 16, lock_setup, rwlock_write_run, lock_teardown},
+  {"spinlock", -1, 1, lock_setup, spinlock_run, lock_teardown},
+  {"spinlock", -1, 4, lock_setup, spinlock_run, lock_teardown},
+  {"spinlock", -1, 16, lock_setup, spinlock_run, lock_teardown},
+  {NULL, 0, 0, NULL, NULL, NULL}};
@@ -0,0 +1,164 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "micro.h"
+
+/*
+ * Transaction and logging microbenchmarks: writing log records through the log's consolidation
+ * slots, and building a transaction snapshot with other sessions running transactions.
+ */
+#define MICRO_LOG_RECORD 64
+
+static WT_SESSION *txn_sessions[WT_THOUSAND];
+
+/*
+ * log_slot_run --
+ *     Write small log records: each write joins a slot, copies the record into the slot's buffer
+ *     and releases the slot, the last thread out of a slot writes it.
+ */
+static void
+log_slot_run(MICRO_STATE *state)
+{
+    WT_DECL_ITEM(logrec);
+    WT_SESSION_IMPL *session;
+    size_t size;
+    uint64_t i;
+
+    session = state->session;
+
+    /* A message record: the record type followed by a nul-terminated string. */
+    testutil_check(__wt_logrec_alloc(session, sizeof(WT_LOG_RECORD) + MICRO_LOG_RECORD, &logrec));
+    testutil_check(__wt_struct_size(session, &size, WT_UNCHECKED_STRING(I), WT_LOGREC_MESSAGE));
+    testutil_check(__wt_struct_pack(session, (uint8_t *)logrec->data + logrec->size, size,
+      WT_UNCHECKED_STRING(I), WT_LOGREC_MESSAGE));
+    logrec->size += size;
+    memset((uint8_t *)logrec->mem + logrec->size, 'a', MICRO_LOG_RECORD - 1);
+    ((uint8_t *)logrec->mem)[logrec->size + MICRO_LOG_RECORD - 1] = '\0';
+    logrec->size += MICRO_LOG_RECORD;
+    size = logrec->size;
+
+    /* Writes fill in the record's header, the record can be written repeatedly. */
+    for (i = 0; i < state->iterations; ++i) {
+        logrec->size = size;
+        testutil_check(__wt_log_write(session, logrec, NULL, 0));
+    }
+    __wt_scr_free(session, &logrec);
+}
+
+/*
+ * log_slot_teardown --
+ *     Checkpoint so the log files written can be removed.
+ */
+static int
+log_slot_teardown(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_SESSION *wt_session;
+
+    WT_UNUSED(arg);
+    wt_session = (WT_SESSION *)session;
+    return (wt_session->checkpoint(wt_session, NULL));
+}
+
+/*
+ * txn_snapshot_setup --
+ *     Start transactions in other sessions, each with an allocated transaction ID.
+ */
+static int
+txn_snapshot_setup(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_CONNECTION *wt_conn;
+    WT_CURSOR *cursor;
+    WT_SESSION *wt_session;
+    int64_t i;
+    const char *uri;
+
+    wt_session = (WT_SESSION *)session;
+    wt_conn = wt_session->connection;
+    uri = "file:micro_txn_snapshot";
+    WT_RET(
+      wt_session->create(wt_session, uri, "key_format=q,value_format=S,log=(enabled=false)"));
+    for (i = 0; i < arg; ++i) {
+        WT_RET(wt_conn->open_session(wt_conn, NULL, NULL, &txn_sessions[i]));
+        WT_RET(txn_sessions[i]->begin_transaction(txn_sessions[i], NULL));
+        WT_RET(txn_sessions[i]->open_cursor(txn_sessions[i], uri, NULL, NULL, &cursor));
+        cursor->set_key(cursor, i);
+        cursor->set_value(cursor, "value");
+        WT_RET(cursor->insert(cursor));
+        WT_RET(cursor->close(cursor));
+    }
+    return (0);
+}
+
+/*
+ * txn_snapshot_teardown --
+ *     Roll back and close the other sessions.
+ */
+static int
+txn_snapshot_teardown(WT_SESSION_IMPL *session, int64_t arg)
+{
+    WT_DECL_RET;
+    int64_t i;
+
+    for (i = 0; i < arg; ++i) {
+        WT_TRET(txn_sessions[i]->rollback_transaction(txn_sessions[i], NULL));
+        WT_TRET(txn_sessions[i]->close(txn_sessions[i], NULL));
+        txn_sessions[i] = NULL;
+    }
+    WT_TRET(micro_drop(session, "file:micro_txn_snapshot"));
+    return (ret);
+}
+
+/*
+ * txn_snapshot_run --
+ *     Build a snapshot of the running transactions.
+ */
+static void
+txn_snapshot_run(MICRO_STATE *state)
+{
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    uint64_t i;
+
+    session = state->session;
+    wt_session = (WT_SESSION *)session;
+
+    testutil_check(wt_session->begin_transaction(wt_session, "isolation=snapshot"));
+    for (i = 0; i < state->iterations; ++i) {
+        __wt_txn_release_snapshot(session);
+        __wt_txn_get_snapshot(session);
+    }
+    testutil_assert(session->txn->snapshot_count == (uint32_t)state->arg);
+    testutil_check(wt_session->rollback_transaction(wt_session, NULL));
+}
+
+MICRO_BENCH micro_txn[] = {{"log_slot", -1, 1, NULL, log_slot_run, log_slot_teardown},
+  {"log_slot", -1, 4, NULL, log_slot_run, log_slot_teardown},
+  {"log_slot", -1, 16, NULL, log_slot_run, log_slot_teardown},
+  {"txn_snapshot", 0, 0, txn_snapshot_setup, txn_snapshot_run, txn_snapshot_teardown},
+  {"txn_snapshot", 16, 0, txn_snapshot_setup, txn_snapshot_run, txn_snapshot_teardown},
+  {"txn_snapshot", 256, 0, txn_snapshot_setup, txn_snapshot_run, txn_snapshot_teardown},
+  {NULL, 0, 0, NULL, NULL, NULL}};
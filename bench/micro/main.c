@@ -0,0 +1,430 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "micro.h"
+
+/*
+ * Microbenchmark driver: run the selected benchmarks, print a table of results and optionally write
+ * them as JSON in the format of the Google Benchmark library, so they can be tracked by the same
+ * tools.
+ */
+#define MICRO_CONFIG "create,cache_size=2GB,session_max=1000,statistics=(none)"
+#define MICRO_LOG_CONFIG ",log=(enabled=true,file_max=100MB,remove=true)"
+#define MICRO_MAX_ITERATIONS (UINT64_C(1000) * WT_BILLION)
+
+volatile uint64_t micro_sink;
+
+static WT_CONNECTION *conn;
+static WT_SESSION_IMPL *sessions[MICRO_MAX_THREADS];
+static MICRO_STATE states[MICRO_MAX_THREADS];
+static volatile bool run_start;
+static volatile uint32_t threads_ready;
+
+extern int __wt_optind;
+extern char *__wt_optarg;
+
+static MICRO_BENCH *const lists[] = {micro_btree, micro_support, micro_txn};
+
+static void usage(void) WT_GCC_FUNC_DECL_ATTRIBUTE((noreturn));
+
+/*
+ * usage --
+ *     Print usage message and exit.
+ */
+static void
+usage(void)
+{
+    fprintf(stderr, "usage: %s [-l] [-f filter] [-h home] [-m min_time_ms] [-o json] [-r reps]\n",
+      progname);
+    fprintf(stderr, "%s",
+      "\t-f run benchmarks with names containing the filter\n"
+      "\t-h database home directory\n"
+      "\t-l list the benchmarks and exit\n"
+      "\t-m minimum time of each timed run in milliseconds (default 500)\n"
+      "\t-o write the results as JSON to a file\n"
+      "\t-r timed runs of each benchmark (default 3)\n");
+    exit(EXIT_FAILURE);
+}
+
+/*
+ * bench_name --
+ *     Build a benchmark's full name: the name, argument and threads, separated by slashes.
+ */
+static void
+bench_name(MICRO_BENCH *b, char *buf, size_t len)
+{
+    char arg[32], threads[32];
+
+    arg[0] = threads[0] = '\0';
+    if (b->arg >= 0)
+        testutil_check(__wt_snprintf(arg, sizeof(arg), "/%" PRId64, b->arg));
+    if (b->threads != 0)
+        testutil_check(__wt_snprintf(threads, sizeof(threads), "/threads:%u", b->threads));
+    testutil_check(__wt_snprintf(buf, len, "%s%s%s", b->name, arg, threads));
+}
+
+/*
+ * thread_run --
+ *     Run a benchmark's operation in a thread, once all the threads are ready.
+ */
+static void *
+thread_run(void *arg)
+{
+    MICRO_BENCH *b;
+    MICRO_STATE *state;
+
+    b = (MICRO_BENCH *)arg;
+    state = &states[__wt_atomic_add32((uint32_t *)&threads_ready, 1) - 1];
+    while (!run_start)
+        __wt_yield();
+    b->run(state);
+    return (NULL);
+}
+
+/*
+ * cpu_nsec --
+ *     Return the CPU time used by the process.
+ */
+static uint64_t
+cpu_nsec(void)
+{
+    struct timespec ts;
+
+    testutil_check(clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts));
+    return ((uint64_t)ts.tv_sec * WT_BILLION + (uint64_t)ts.tv_nsec);
+}
+
+/*
+ * run_once --
+ *     Run a benchmark once, return the elapsed and CPU times.
+ */
+static void
+run_once(MICRO_BENCH *b, uint64_t iterations, uint64_t *realp, uint64_t *cpup)
+{
+    struct timespec te, ts;
+    pthread_t id[MICRO_MAX_THREADS];
+    uint64_t cpu;
+    u_int i, nthreads;
+
+    nthreads = WT_MAX(b->threads, 1);
+    for (i = 0; i < nthreads; ++i) {
+        states[i].session = sessions[i];
+        states[i].iterations = iterations;
+        states[i].arg = b->arg;
+        states[i].thread = i;
+        states[i].threads = nthreads;
+    }
+
+    if (b->threads == 0) {
+        cpu = cpu_nsec();
+        __wt_epoch(NULL, &ts);
+        b->run(&states[0]);
+        __wt_epoch(NULL, &te);
+    } else {
+        threads_ready = 0;
+        run_start = false;
+        for (i = 0; i < nthreads; ++i)
+            testutil_check(pthread_create(&id[i], NULL, thread_run, b));
+
+        /* Start the clock once every thread is waiting. */
+        while (threads_ready != nthreads)
+            __wt_yield();
+        cpu = cpu_nsec();
+        __wt_epoch(NULL, &ts);
+        WT_PUBLISH(run_start, true);
+        for (i = 0; i < nthreads; ++i)
+            testutil_check(pthread_join(id[i], NULL));
+        __wt_epoch(NULL, &te);
+    }
+    *cpup = cpu_nsec() - cpu;
+    *realp = WT_MAX(WT_TIMEDIFF_NS(te, ts), 1);
+}
+
+/*
+ * run_bench --
+ *     Run a benchmark: find an operation count that takes at least the minimum time, then repeat
+ *     the timed runs. Report the time per operation of each thread.
+ */
+static void
+run_bench(MICRO_BENCH *b, uint64_t min_nsec, u_int reps, FILE *json, bool *firstp)
+{
+    double cpu_op, multiplier, real_op, real_ops[64];
+    uint64_t cpu, iterations, real;
+    u_int i, j, nthreads;
+    char name[128];
+
+    bench_name(b, name, sizeof(name));
+    nthreads = WT_MAX(b->threads, 1);
+    if (b->setup != NULL)
+        testutil_check(b->setup(sessions[0], b->arg));
+
+    /* Grow the operation count until a run takes the minimum time, at most ten-fold at a time. */
+    for (iterations = 1;;) {
+        run_once(b, iterations, &real, &cpu);
+        if (real >= min_nsec || iterations >= MICRO_MAX_ITERATIONS)
+            break;
+        multiplier = real < min_nsec / 10 ? 10 : 1.4 * (double)min_nsec / (double)real;
+        iterations = (uint64_t)((double)iterations * WT_MAX(multiplier, 1.1)) + 1;
+    }
+
+    for (i = 0; i < reps; ++i) {
+        run_once(b, iterations, &real, &cpu);
+        real_op = (double)real / (double)iterations;
+        cpu_op = (double)cpu / (double)(iterations * nthreads);
+        real_ops[i] = real_op;
+        printf("%-40s %14.1f ns %14.1f ns %14" PRIu64 "\n", name, real_op, cpu_op, iterations);
+        if (json != NULL) {
+            fprintf(json,
+              "%s    {\n"
+              "      \"name\": \"%s\",\n"
+              "      \"run_name\": \"%s\",\n"
+              "      \"run_type\": \"iteration\",\n"
+              "      \"repetitions\": %u,\n"
+              "      \"repetition_index\": %u,\n"
+              "      \"threads\": %u,\n"
+              "      \"iterations\": %" PRIu64 ",\n"
+              "      \"real_time\": %.4f,\n"
+              "      \"cpu_time\": %.4f,\n"
+              "      \"time_unit\": \"ns\",\n"
+              "      \"items_per_second\": %.4f\n"
+              "    }",
+              *firstp ? "" : ",\n", name, name, reps, i, nthreads, iterations, real_op, cpu_op,
+              (double)(iterations * nthreads) * WT_BILLION / (double)real);
+            *firstp = false;
+        }
+    }
+
+    /* Report the median of the runs, the statistic regression tracking compares. */
+    if (json != NULL && reps > 1) {
+        for (i = 1; i < reps; ++i)
+            for (j = i; j > 0 && real_ops[j - 1] > real_ops[j]; --j) {
+                real_op = real_ops[j];
+                real_ops[j] = real_ops[j - 1];
+                real_ops[j - 1] = real_op;
+            }
+        fprintf(json,
+          ",\n    {\n"
+          "      \"name\": \"%s_median\",\n"
+          "      \"run_name\": \"%s\",\n"
+          "      \"run_type\": \"aggregate\",\n"
+          "      \"repetitions\": %u,\n"
+          "      \"threads\": %u,\n"
+          "      \"aggregate_name\": \"median\",\n"
+          "      \"iterations\": %u,\n"
+          "      \"real_time\": %.4f,\n"
+          "      \"time_unit\": \"ns\"\n"
+          "    }",
+          name, name, reps, nthreads, reps,
+          reps % 2 == 1 ? real_ops[reps / 2] :
+                          (real_ops[reps / 2 - 1] + real_ops[reps / 2]) / 2);
+    }
+    fflush(stdout);
+
+    if (b->teardown != NULL)
+        testutil_check(b->teardown(sessions[0], b->arg));
+}
+
+/*
+ * micro_populate --
+ *     Create an object and insert random keys, optionally return the keys in insert order.
+ */
+int
+micro_populate(
+  WT_SESSION_IMPL *session, const char *uri, const char *config, uint64_t n, WT_ITEM **keysp)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    WT_ITEM *keys, value;
+    WT_RAND_STATE rnd;
+    WT_SESSION *wt_session;
+    uint64_t i;
+    uint8_t *p;
+
+    wt_session = (WT_SESSION *)session;
+    __wt_random_init(&rnd);
+
+    /*
+     * The keys are an array of items followed by their 16-byte hex strings, random values followed
+     * by the key's index so they're unique. Leave room for the last string's nul terminator.
+     */
+    keys = dcalloc(1, n * (sizeof(WT_ITEM) + 16) + 1);
+    p = (uint8_t *)(keys + n);
+    for (i = 0; i < n; ++i, p += 16) {
+        testutil_check(
+          __wt_snprintf((char *)p, 17, "%08" PRIx32 "%08" PRIx64, __wt_random(&rnd), i));
+        keys[i].data = p;
+        keys[i].size = 16;
+    }
+    value.data = "valuevaluevaluevaluevaluevaluevaluevaluevaluevaluevaluevaluevalu";
+    value.size = 64;
+
+    WT_ERR(wt_session->create(wt_session, uri, config));
+    WT_ERR(wt_session->open_cursor(wt_session, uri, NULL, NULL, &cursor));
+    for (i = 0; i < n; ++i) {
+        cursor->set_key(cursor, &keys[i]);
+        cursor->set_value(cursor, &value);
+        WT_ERR(cursor->insert(cursor));
+    }
+    WT_ERR(cursor->close(cursor));
+
+err:
+    if (ret == 0 && keysp != NULL)
+        *keysp = keys;
+    else
+        free(keys);
+    return (ret);
+}
+
+/*
+ * micro_drop --
+ *     Drop an object. Modified objects can't be dropped until they're checkpointed.
+ */
+int
+micro_drop(WT_SESSION_IMPL *session, const char *uri)
+{
+    WT_SESSION *wt_session;
+
+    wt_session = (WT_SESSION *)session;
+    WT_RET(wt_session->checkpoint(wt_session, NULL));
+    return (wt_session->drop(wt_session, uri, NULL));
+}
+
+/*
+ * main --
+ *     Run the selected benchmarks.
+ */
+int
+main(int argc, char *argv[])
+{
+    FILE *json;
+    MICRO_BENCH *b;
+    WT_SESSION *wt_session;
+    time_t now;
+    uint64_t min_nsec;
+    u_int i, reps;
+    int ch;
+    const char *filter, *jsonfile, *working_dir;
+    char config[1024], home[1024], host[256], name[128];
+    bool first, list;
+
+    (void)testutil_set_progname(argv);
+
+    filter = jsonfile = NULL;
+    working_dir = "WT_TEST.bench_micro";
+    min_nsec = 500 * WT_MILLION;
+    reps = 3;
+    list = false;
+    while ((ch = __wt_getopt(progname, argc, argv, "f:h:lm:o:r:")) != EOF)
+        switch (ch) {
+        case 'f':
+            filter = __wt_optarg;
+            break;
+        case 'h':
+            working_dir = __wt_optarg;
+            break;
+        case 'l':
+            list = true;
+            break;
+        case 'm':
+            min_nsec = (uint64_t)atoll(__wt_optarg) * WT_MILLION;
+            break;
+        case 'o':
+            jsonfile = __wt_optarg;
+            break;
+        case 'r':
+            reps = (u_int)atoi(__wt_optarg);
+            break;
+        default:
+            usage();
+        }
+    argc -= __wt_optind;
+    if (argc != 0 || reps == 0 || reps > 64)
+        usage();
+
+    if (list) {
+        for (i = 0; i < WT_ELEMENTS(lists); ++i)
+            for (b = lists[i]; b->name != NULL; ++b) {
+                bench_name(b, name, sizeof(name));
+                printf("%s\n", name);
+            }
+        return (EXIT_SUCCESS);
+    }
+
+    testutil_work_dir_from_path(home, sizeof(home), working_dir);
+    testutil_make_work_dir(home);
+    testutil_check(__wt_snprintf(
+      config, sizeof(config), "%s%s%s", MICRO_CONFIG, MICRO_LOG_CONFIG, micro_extensions()));
+    testutil_check(wiredtiger_open(home, NULL, config, &conn));
+    for (i = 0; i < MICRO_MAX_THREADS; ++i) {
+        testutil_check(conn->open_session(conn, NULL, NULL, &wt_session));
+        sessions[i] = (WT_SESSION_IMPL *)wt_session;
+        __wt_random_init_seed(sessions[i], &states[i].rnd);
+    }
+
+    json = NULL;
+    if (jsonfile != NULL) {
+        testutil_assert((json = fopen(jsonfile, "w")) != NULL);
+        (void)time(&now);
+        testutil_check(gethostname(host, sizeof(host)));
+        fprintf(json,
+          "{\n"
+          "  \"context\": {\n"
+          "    \"date\": \"%.24s\",\n"
+          "    \"host_name\": \"%s\",\n"
+          "    \"executable\": \"%s\",\n"
+          "    \"num_cpus\": %ld,\n"
+          "    \"library_version\": \"%s\",\n"
+          "    \"library_build_type\": \"%s\"\n"
+          "  },\n"
+          "  \"benchmarks\": [\n",
+          ctime(&now), host, progname, sysconf(_SC_NPROCESSORS_ONLN),
+          wiredtiger_version(NULL, NULL, NULL),
+#ifdef HAVE_DIAGNOSTIC
+          "debug"
+#else
+          "release"
+#endif
+        );
+    }
+
+    printf("%-40s %17s %17s %14s\n", "benchmark", "time", "cpu", "iterations");
+    first = true;
+    for (i = 0; i < WT_ELEMENTS(lists); ++i)
+        for (b = lists[i]; b->name != NULL; ++b) {
+            bench_name(b, name, sizeof(name));
+            if (filter == NULL || strstr(name, filter) != NULL)
+                run_bench(b, min_nsec, reps, json, &first);
+        }
+
+    if (json != NULL) {
+        fprintf(json, "\n  ]\n}\n");
+        testutil_assert(fclose(json) == 0);
+    }
+    testutil_check(conn->close(conn, NULL));
+    testutil_clean_work_dir(home);
+    return (EXIT_SUCCESS);
+}
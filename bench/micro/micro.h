@@ -0,0 +1,84 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef HAVE_MICRO_H
+#define HAVE_MICRO_H
+
+#include "test_util.h"
+
+/*
+ * Microbenchmarks of engine primitives. Each benchmark runs its operation a requested number of
+ * times, the harness increases the count until a run takes long enough to time, then repeats the
+ * run and reports the time per operation.
+ */
+#define MICRO_MAX_THREADS 64
+
+/*
+ * MICRO_STATE --
+ *     What a benchmark thread runs: the operation count, the benchmark's argument, and the thread's
+ *     session and random number state.
+ */
+typedef struct {
+    WT_SESSION_IMPL *session; /* Thread's session */
+    WT_RAND_STATE rnd;        /* Thread's random number state */
+    uint64_t iterations;      /* Operations to run */
+    int64_t arg;              /* Benchmark argument */
+    u_int thread;             /* Thread index */
+    u_int threads;            /* Thread count */
+} MICRO_STATE;
+
+/*
+ * MICRO_BENCH --
+ *     A benchmark. Setup and teardown run in the harness thread, with the first thread's session;
+ *     multithreaded benchmarks run the operation concurrently in each thread.
+ */
+typedef struct {
+    const char *name; /* Benchmark name */
+    int64_t arg;      /* Argument, -1 if none */
+    u_int threads;    /* Thread count, 0 if single-threaded */
+
+    int (*setup)(WT_SESSION_IMPL *, int64_t);
+    void (*run)(MICRO_STATE *);
+    int (*teardown)(WT_SESSION_IMPL *, int64_t);
+} MICRO_BENCH;
+
+/* Benchmarks, each list ends with an entry without a name. */
+extern MICRO_BENCH micro_btree[];
+extern MICRO_BENCH micro_support[];
+extern MICRO_BENCH micro_txn[];
+
+/*
+ * Keep the compiler from discarding a result the benchmark doesn't otherwise use.
+ */
+extern volatile uint64_t micro_sink;
+
+int micro_drop(WT_SESSION_IMPL *, const char *);
+const char *micro_extensions(void);
+int micro_populate(WT_SESSION_IMPL *, const char *, const char *, uint64_t, WT_ITEM **);
+
+#endif
@@ -0,0 +1,189 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Read/write lock microbenchmark: measure throughput of the ticket, reader-scalable and POSIX
+ * read/write locks, sweeping the number of threads and the ratio of write to read acquisitions.
+ * Each thread runs a fixed number of operations with a tiny critical section, readers check the
+ * value writers update is stable while they hold the lock.
+ */
+#define MAX_THREADS 256
+
+typedef enum { LOCK_TICKET, LOCK_SCALABLE, LOCK_POSIX } LOCK_TYPE;
+static const char *const lock_names[] = {"ticket", "scalable", "posix"};
+
+/* One write lock acquisition per N operations, 0 for read-only. */
+static const uint64_t write_intervals[] = {0, 10 * WT_THOUSAND, WT_THOUSAND, 100, 10};
+
+static WT_RWLOCK rwlock;
+static pthread_rwlock_t p_rwlock;
+static LOCK_TYPE lock_type;
+static uint64_t write_interval;
+static volatile uint64_t shared_counter;
+static volatile bool run_start;
+static volatile uint32_t threads_ready;
+
+static void *thread_lock(void *);
+static double run_one(TEST_OPTS *, uint64_t);
+
+/*
+ * main --
+ *     Run the contention sweep and report operations per second for each configuration.
+ */
+int
+main(int argc, char *argv[])
+{
+    TEST_OPTS *opts, _opts;
+    uint64_t nthreads;
+    u_int i, type;
+    char config[64], ratio[32];
+
+    opts = &_opts;
+    memset(opts, 0, sizeof(*opts));
+    opts->nthreads = 16;
+    opts->nops = 100 * WT_THOUSAND; /* per thread */
+    testutil_check(testutil_parse_opts(argc, argv, opts));
+    testutil_assert(opts->nthreads > 0 && opts->nthreads <= MAX_THREADS);
+
+    testutil_make_work_dir(opts->home);
+    testutil_check(
+      __wt_snprintf(config, sizeof(config), "create,session_max=%d", MAX_THREADS + 10));
+    testutil_check(wiredtiger_open(opts->home, NULL, config, &opts->conn));
+
+    printf("%-10s %8s %14s %14s\n", "lock", "threads", "writes/op", "ops/sec");
+    for (i = 0; i < WT_ELEMENTS(write_intervals); ++i)
+        for (nthreads = 1; nthreads <= opts->nthreads; nthreads *= 2)
+            for (type = LOCK_TICKET; type <= LOCK_POSIX; ++type) {
+                lock_type = (LOCK_TYPE)type;
+                write_interval = write_intervals[i];
+                if (write_interval == 0)
+                    testutil_check(__wt_snprintf(ratio, sizeof(ratio), "0"));
+                else
+                    testutil_check(
+                      __wt_snprintf(ratio, sizeof(ratio), "1/%" PRIu64, write_interval));
+                printf("%-10s %8" PRIu64 " %14s %14.0f\n", lock_names[type], nthreads, ratio,
+                  run_one(opts, nthreads));
+                fflush(stdout);
+            }
+
+    testutil_cleanup(opts);
+    return (EXIT_SUCCESS);
+}
+
+/*
+ * run_one --
+ *     Run one configuration of the sweep, return the aggregate operations per second.
+ */
+static double
+run_one(TEST_OPTS *opts, uint64_t nthreads)
+{
+    struct timespec te, ts;
+    pthread_t id[MAX_THREADS];
+    uint64_t i;
+    double secs;
+
+    testutil_check(__wt_rwlock_init(NULL, &rwlock));
+    if (lock_type == LOCK_SCALABLE)
+        testutil_check(__wt_rwlock_scalable(NULL, &rwlock));
+    testutil_check(pthread_rwlock_init(&p_rwlock, NULL));
+    shared_counter = 0;
+    threads_ready = 0;
+    run_start = false;
+
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(pthread_create(&id[i], NULL, thread_lock, opts));
+
+    /* Start the clock once every thread has its session open. */
+    while (threads_ready != nthreads)
+        __wt_yield();
+    __wt_epoch(NULL, &ts);
+    WT_PUBLISH(run_start, true);
+
+    for (i = 0; i < nthreads; ++i)
+        testutil_check(pthread_join(id[i], NULL));
+    __wt_epoch(NULL, &te);
+
+    testutil_check(pthread_rwlock_destroy(&p_rwlock));
+    __wt_rwlock_destroy(NULL, &rwlock);
+
+    secs = (double)WT_TIMEDIFF_NS(te, ts) / WT_BILLION;
+    return ((double)(nthreads * opts->nops) / (secs > 0 ? secs : 1e-9));
+}
+
+/*
+ * thread_lock --
+ *     Acquire the lock, every Nth operation exclusively.
+ */
+static void *
+thread_lock(void *arg)
+{
+    TEST_OPTS *opts;
+    WT_SESSION *wt_session;
+    WT_SESSION_IMPL *session;
+    uint64_t counter, i;
+    bool writelock;
+
+    opts = (TEST_OPTS *)arg;
+    testutil_check(opts->conn->open_session(opts->conn, NULL, NULL, &wt_session));
+    session = (WT_SESSION_IMPL *)wt_session;
+
+    (void)__wt_atomic_add32((uint32_t *)&threads_ready, 1);
+    while (!run_start)
+        __wt_yield();
+
+    for (i = 1; i <= opts->nops; ++i) {
+        writelock = write_interval != 0 && i % write_interval == 0;
+
+        if (lock_type == LOCK_POSIX) {
+            if (writelock)
+                testutil_check(pthread_rwlock_wrlock(&p_rwlock));
+            else
+                testutil_check(pthread_rwlock_rdlock(&p_rwlock));
+        } else if (writelock)
+            __wt_writelock(session, &rwlock);
+        else
+            __wt_readlock(session, &rwlock);
+
+        if (writelock)
+            counter = ++shared_counter;
+        else
+            counter = shared_counter;
+        testutil_assert(counter == shared_counter);
+
+        if (lock_type == LOCK_POSIX)
+            testutil_check(pthread_rwlock_unlock(&p_rwlock));
+        else if (writelock)
+            __wt_writeunlock(session, &rwlock);
+        else
+            __wt_readunlock(session, &rwlock);
+    }
+
+    testutil_check(wt_session->close(wt_session, NULL));
+    return (NULL);
+}
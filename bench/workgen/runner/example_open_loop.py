@@ -0,0 +1,74 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+
+
+# Open-loop workload: operations start at a fixed or Poisson arrival rate whether or not earlier
+# operations have completed, and latencies are measured from each operation's intended start time,
+# so a stall is charged to every operation that should have started during it. Latency percentiles
+# for each sample interval are written to the monitor.json file.
+
+from runner import *
+from wiredtiger import *
+from workgen import *
+
+context = Context()
+conn = context.wiredtiger_open("create,cache_size=500MB")
+s = conn.open_session()
+tname = "table:test"
+s.create(tname, 'key_format=S,value_format=S')
+table = Table(tname)
+table.options.key_size = 20
+table.options.value_size = 100
+
+op = Operation(Operation.OP_INSERT, table)
+thread = Thread(op * 100000)
+pop_workload = Workload(context, thread)
+print('populate:')
+ret = pop_workload.run(conn)
+assert ret == 0, ret
+
+# Per-operation rates are set by giving each operation its own threads.
+treader = Thread(Operation(Operation.OP_SEARCH, table))
+treader.options.arrival_rate = 2000
+treader.options.arrival_distribution = "poisson"
+twriter = Thread(txn(Operation(Operation.OP_UPDATE, table) * 2))
+twriter.options.arrival_rate = 500
+twriter.options.arrival_distribution = "fixed"
+
+workload = Workload(context, treader * 4 + twriter * 2)
+workload.options.run_time = 10
+workload.options.sample_interval_ms = 1000
+print('open-loop workload:')
+ret = workload.run(conn)
+assert ret == 0, ret
+
+latency_read = workload.stats.read
+print('read latency (us): 50% {}, 99% {}, 99.9% {}'.format(
+    latency_read.percentile_latency(50), latency_read.percentile_latency(99),
+    latency_read.percentile_latency(99.9)))
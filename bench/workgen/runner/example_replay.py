@@ -0,0 +1,70 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+
+
+# Capture and replay: run a workload with operation capture enabled, then replay the captured
+# operations against a new database, twice as fast as they were captured.
+
+import os, shutil
+from runner import *
+from wiredtiger import *
+from workgen import *
+
+context = Context()
+capture_dir = "WT_CAPTURE"
+shutil.rmtree(capture_dir, ignore_errors=True)
+os.mkdir(capture_dir)
+conn = context.wiredtiger_open(
+    "create,cache_size=500MB,operation_capture=(enabled=true,path={})".format(capture_dir))
+s = conn.open_session()
+tname = "table:test"
+s.create(tname, 'key_format=S,value_format=S')
+table = Table(tname)
+table.options.key_size = 20
+table.options.value_size = 100
+
+thread = Thread(Operation(Operation.OP_INSERT, table) * 10 +
+    Operation(Operation.OP_SEARCH, table) * 10 + Operation(Operation.OP_UPDATE, table))
+workload = Workload(context, thread * 4)
+workload.options.run_time = 5
+print('captured workload:')
+ret = workload.run(conn)
+assert ret == 0, ret
+conn.close()
+
+replay_home = "WT_REPLAY"
+shutil.rmtree(replay_home, ignore_errors=True)
+os.mkdir(replay_home)
+conn = wiredtiger_open(replay_home, "create,cache_size=500MB")
+replay = Replay(capture_dir)
+replay.options.speedup = 2.0
+print('replay:')
+ret = replay.run(conn)
+assert ret == 0, ret
+conn.close()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+
+# Open-loop overload test: transactions are scheduled at twice the rate the thread can run them, so
+# a backlog builds up over the run. The latency of the update in each transaction is measured from
+# the transaction's intended start, and must include the time spent waiting behind the backlog.
+
+from runner import *
+from wiredtiger import *
+from workgen import *
+
+context = Context()
+conn = context.wiredtiger_open("create,cache_size=100MB")
+s = conn.open_session()
+tname = "table:test"
+s.create(tname, 'key_format=S,value_format=S')
+table = Table(tname)
+table.options.key_size = 20
+table.options.value_size = 100
+
+op = Operation(Operation.OP_INSERT, table)
+thread = Thread(op * 1000)
+pop_workload = Workload(context, thread)
+print('populate:')
+ret = pop_workload.run(conn)
+assert ret == 0, ret
+
+# Each transaction takes at least a millisecond, the thread can run 1000 a second.
+twriter = Thread(txn(Operation(Operation.OP_UPDATE, table) + sleep(0.001)))
+twriter.options.arrival_rate = 2000
+twriter.options.arrival_distribution = "fixed"
+
+run_time = 4
+workload = Workload(context, twriter)
+workload.options.run_time = run_time
+workload.options.sample_interval_ms = 1000
+print('open-loop overload workload:')
+ret = workload.run(conn)
+assert ret == 0, ret
+
+# The backlog grows by about half a second each second, an update waits a second on average. The
+# update itself takes microseconds: without the wait, the median latency would be far under 100ms.
+latency = workload.stats.update
+p50 = latency.percentile_latency(50)
+p99 = latency.percentile_latency(99)
+print('update latency (us): 50% {}, 99% {}'.format(p50, p99))
+assert p50 > 100000, 'median update latency {}us does not include the backlog'.format(p50)
+assert p99 > p50
+assert p99 < (run_time + 1) * 1000000
@@ -63,6 +63,14 @@ extern "C" {
 #define LATENCY_MS_BUCKETS 1000
 #define LATENCY_SEC_BUCKETS 100
 
+/*
+ * Log-linear latency buckets: values below LATENCY_HIST_SUB get a bucket each, larger values are
+ * split into LATENCY_HIST_SUB buckets per power of two, bounding the relative error to 1/64.
+ */
+#define LATENCY_HIST_SUB_BITS 6
+#define LATENCY_HIST_SUB (1 << LATENCY_HIST_SUB_BITS)
+#define LATENCY_HIST_BUCKETS ((64 - LATENCY_HIST_SUB_BITS + 1) * LATENCY_HIST_SUB)
+
 #define TABLE_MAX_RETRIES 10 // times we will retry an operation on a table
 #define THROTTLE_PER_SEC 20  // times per sec we will throttle
 
@@ -137,6 +145,18 @@ thread_runner_main(void *arg)
     return (nullptr);
 }
 
+static void *
+replay_runner_main(void *arg)
+{
+    ReplayRunner *runner = static_cast<ReplayRunner *>(arg);
+    try {
+        runner->_errno = runner->run();
+    } catch (WorkgenException &wge) {
+        runner->_exception = wge;
+    }
+    return (nullptr);
+}
+
 static void *
 thread_workload(void *arg)
 {
@@ -1097,7 +1117,7 @@ Monitor::_format_json_entry(const tm &tm, const timespec &timespec, bool first_i
     } while (0)
 
     // Note: we could allow this to be configurable.
-    int percentiles[4] = {50, 95, 99, 0};
+    double percentiles[5] = {50, 95, 99, 99.9, 0};
     size_t buf_size;
     char time_buf[64];
 
@@ -1170,9 +1190,10 @@ ParetoOptions::ParetoOptions(const ParetoOptions &other)
 ThreadRunner::ThreadRunner()
     : _errno(0), _exception(), _thread(nullptr), _context(nullptr), _icontext(nullptr),
       _workload(nullptr), _wrunner(nullptr), _rand_state(nullptr), _throttle(nullptr),
-      _throttle_ops(0), _throttle_limit(0), _in_transaction(false), _start_time_us(0),
-      _op_time_us(0), _number(0), _stats(false), _table_usage(), _cursors(nullptr), _stop(false),
-      _session(nullptr), _keybuf(nullptr), _valuebuf(nullptr), _repeat(false)
+      _throttle_ops(0), _throttle_limit(0), _arrival(nullptr), _intended_ns(0),
+      _in_transaction(false), _start_time_us(0), _op_time_us(0), _number(0), _stats(false),
+      _table_usage(), _cursors(nullptr), _stop(false), _session(nullptr), _keybuf(nullptr),
+      _valuebuf(nullptr), _repeat(false)
 {
 }
 
@@ -1194,6 +1215,7 @@ ThreadRunner::create_all(WT_CONNECTION *conn)
     WT_RET(workgen_random_alloc(_session, &_rand_state));
     _throttle_ops = 0;
     _throttle_limit = 0;
+    _intended_ns = 0;
     _in_transaction = 0;
 
     size_t keysize = 1;
@@ -1230,6 +1252,10 @@ ThreadRunner::close_all()
         delete _throttle;
         _throttle = nullptr;
     }
+    if (_arrival != nullptr) {
+        delete _arrival;
+        _arrival = nullptr;
+    }
     if (_session != nullptr) {
         WT_RET(_session->close(_session, nullptr));
         _session = nullptr;
@@ -1302,6 +1328,14 @@ ThreadRunner::run()
     if (options->throttle != 0) {
         _throttle = new Throttle(*this, options->throttle, options->throttle_burst);
     }
+    if (options->arrival_rate != 0) {
+        if (options->throttle != 0)
+            THROW("thread " << name << ": throttle and arrival_rate cannot both be set");
+        if (options->arrival_distribution != "fixed" && options->arrival_distribution != "poisson")
+            THROW("thread " << name << ": arrival_distribution must be \"fixed\" or \"poisson\"");
+        _arrival =
+          new Arrival(*this, options->arrival_rate, options->arrival_distribution == "poisson");
+    }
     for (int cnt = 0; !_stop && (_repeat || cnt < 1) && ret == 0; cnt++) {
         WT_ERR(op_run_setup(&_thread->_op));
     }
@@ -1525,6 +1559,16 @@ ThreadRunner::op_run_setup(Operation *op)
             ++_throttle_ops;
     }
 
+    // In open-loop mode, table operations and transactions outside a transaction are scheduled;
+    // operations inside a transaction run when the transaction gets to them. A transaction's
+    // intended start is charged to the first timed operation it runs.
+    if (_arrival != nullptr && !_in_transaction) {
+        if (!_stop && (op->is_table_op() || op->transaction != nullptr))
+            _intended_ns = _arrival->arrive();
+        else
+            _intended_ns = 0;
+    }
+
     // If this is not a table operation, or if it is and has a table assigned, we have
     // nothing more to do here.
     if (!op->is_table_op() || op->has_table()) {
@@ -1651,9 +1695,20 @@ ThreadRunner::op_run(Operation *op)
     measure_latency = track != nullptr && track->ops != 0 && track->track_latency() &&
       (track->ops % _workload->options.sample_rate == 0);
 
-    uint64_t start;
-    if (measure_latency)
-        workgen_clock(&start);
+    // A scheduled operation's latency includes any time it waited behind earlier operations.
+    // Untimed operations leave the intended start to the next timed one.
+    uint64_t start, intended_ns;
+    intended_ns = 0;
+    if (track != nullptr) {
+        intended_ns = _intended_ns;
+        _intended_ns = 0;
+    }
+    if (measure_latency) {
+        if (intended_ns != 0)
+            start = intended_ns;
+        else
+            workgen_clock(&start);
+    }
 
     // Whether or not we are measuring latency, we track how many operations
     // are in progress, or that complete.
@@ -1941,8 +1996,44 @@ Throttle::throttle(uint64_t op_count, uint64_t *op_limit)
     return (0);
 }
 
+Arrival::Arrival(ThreadRunner &runner, double rate, bool poisson)
+    : _runner(runner), _rate(rate), _poisson(poisson), _next_ns(0)
+{
+}
+
+/*
+ * The schedule starts with the first call, and each call advances it by one interval: the
+ * reciprocal of the rate, or for a Poisson process, an exponentially distributed interval with that
+ * mean. The schedule never skips operations when we fall behind, those operations start late and
+ * their latency includes the delay. Sleeps are bounded so a slow schedule doesn't delay stopping.
+ */
+uint64_t
+Arrival::arrive()
+{
+    uint64_t intended_ns, now;
+    double interval_ns;
+
+    workgen_clock(&now);
+    if (_next_ns == 0)
+        _next_ns = now;
+    while (now < _next_ns && !_runner._stop) {
+        usleep((useconds_t)MIN(ns_to_us(_next_ns - now) + 1, ms_to_us(100)));
+        workgen_clock(&now);
+    }
+    intended_ns = _next_ns;
+
+    interval_ns = 1000000000.0 / _rate;
+    if (_poisson)
+        // Inverse transform sampling, the uniform value is in (0, 1) so the logarithm is finite.
+        interval_ns *= -log((_runner.random_value() + 0.5) / 4294967296.0);
+    _next_ns += (uint64_t)interval_ns;
+    DEBUG_CAPTURE(_runner, "arrive: behind=" << (now - intended_ns) << "ns" << std::endl);
+    return (intended_ns);
+}
+
 ThreadOptions::ThreadOptions()
-    : name(), session_config(), throttle(0.0), throttle_burst(1.0), synchronized(false), _options()
+    : name(), session_config(), throttle(0.0), throttle_burst(1.0), arrival_rate(0.0),
+      arrival_distribution("fixed"), synchronized(false), _options()
 {
     _options.add_string("name", name, "name of the thread");
     _options.add_string(
@@ -1951,10 +2042,18 @@ ThreadOptions::ThreadOptions()
     _options.add_double("throttle_burst", throttle_burst,
       "Changes characteristic of throttling from smooth (0.0) "
       "to having large bursts with lulls (10.0 or larger)");
+    _options.add_double("arrival_rate", arrival_rate,
+      "Run open-loop: start operations at this rate per second whether or not earlier "
+      "operations have completed, and measure latency from each operation's intended start "
+      "time. Cannot be combined with throttle");
+    _options.add_string("arrival_distribution", arrival_distribution,
+      "Intervals between operations when arrival_rate is set: \"fixed\" for a constant "
+      "interval, \"poisson\" for exponentially distributed intervals");
 }
 ThreadOptions::ThreadOptions(const ThreadOptions &other)
     : name(other.name), session_config(other.session_config), throttle(other.throttle),
-      throttle_burst(other.throttle_burst), synchronized(other.synchronized),
+      throttle_burst(other.throttle_burst), arrival_rate(other.arrival_rate),
+      arrival_distribution(other.arrival_distribution), synchronized(other.synchronized),
       _options(other._options)
 {
 }
@@ -2430,9 +2529,34 @@ TableOperationInternal::parse_config(const std::string &config)
     }
 }
 
+// Return the log-linear bucket of a latency.
+static inline int
+latency_hist_bucket(uint64_t usecs)
+{
+    int magnitude, shift;
+
+    if (usecs < LATENCY_HIST_SUB)
+        return ((int)usecs);
+    magnitude = 63 - __builtin_clzll(usecs);
+    shift = magnitude - LATENCY_HIST_SUB_BITS;
+    return ((shift + 1) * LATENCY_HIST_SUB + (int)((usecs >> shift) - LATENCY_HIST_SUB));
+}
+
+// Return the largest latency in a log-linear bucket.
+static inline uint64_t
+latency_hist_value(int bucket)
+{
+    int shift;
+
+    if (bucket < LATENCY_HIST_SUB)
+        return ((uint64_t)bucket);
+    shift = bucket / LATENCY_HIST_SUB - 1;
+    return ((((uint64_t)(bucket % LATENCY_HIST_SUB + LATENCY_HIST_SUB) + 1) << shift) - 1);
+}
+
 Track::Track(bool latency_tracking)
     : ops_in_progress(0), ops(0), rollbacks(0), latency_ops(0), latency(0), bucket_ops(0),
-      min_latency(0), max_latency(0), us(nullptr), ms(nullptr), sec(nullptr)
+      min_latency(0), max_latency(0), us(nullptr), ms(nullptr), sec(nullptr), hist(nullptr)
 {
     track_latency(latency_tracking);
 }
@@ -2441,15 +2565,17 @@ Track::Track(const Track &other)
     : ops_in_progress(other.ops_in_progress), ops(other.ops), rollbacks(other.rollbacks),
       latency_ops(other.latency_ops), latency(other.latency), bucket_ops(other.bucket_ops),
       min_latency(other.min_latency), max_latency(other.max_latency), us(nullptr), ms(nullptr),
-      sec(nullptr)
+      sec(nullptr), hist(nullptr)
 {
     if (other.us != nullptr) {
         us = new uint32_t[LATENCY_US_BUCKETS];
         ms = new uint32_t[LATENCY_MS_BUCKETS];
         sec = new uint32_t[LATENCY_SEC_BUCKETS];
+        hist = new uint32_t[LATENCY_HIST_BUCKETS];
         memcpy(us, other.us, sizeof(uint32_t) * LATENCY_US_BUCKETS);
         memcpy(ms, other.ms, sizeof(uint32_t) * LATENCY_MS_BUCKETS);
         memcpy(sec, other.sec, sizeof(uint32_t) * LATENCY_SEC_BUCKETS);
+        memcpy(hist, other.hist, sizeof(uint32_t) * LATENCY_HIST_BUCKETS);
     }
 }
 
@@ -2459,6 +2585,7 @@ Track::~Track()
         delete us;
         delete ms;
         delete sec;
+        delete hist;
     }
 }
 
@@ -2484,6 +2611,8 @@ Track::add(Track &other, bool reset)
             ms[i] += other.ms[i];
         for (int i = 0; i < LATENCY_SEC_BUCKETS; i++)
             sec[i] += other.sec[i];
+        for (int i = 0; i < LATENCY_HIST_BUCKETS; i++)
+            hist[i] += other.hist[i];
     }
 }
 
@@ -2501,18 +2630,22 @@ Track::assign(const Track &other)
         delete us;
         delete ms;
         delete sec;
+        delete hist;
         us = nullptr;
         ms = nullptr;
         sec = nullptr;
+        hist = nullptr;
     } else if (other.us != nullptr && us == nullptr) {
         us = new uint32_t[LATENCY_US_BUCKETS];
         ms = new uint32_t[LATENCY_MS_BUCKETS];
         sec = new uint32_t[LATENCY_SEC_BUCKETS];
+        hist = new uint32_t[LATENCY_HIST_BUCKETS];
     }
     if (us != nullptr) {
         memcpy(us, other.us, sizeof(uint32_t) * LATENCY_US_BUCKETS);
         memcpy(ms, other.ms, sizeof(uint32_t) * LATENCY_MS_BUCKETS);
         memcpy(sec, other.sec, sizeof(uint32_t) * LATENCY_SEC_BUCKETS);
+        memcpy(hist, other.hist, sizeof(uint32_t) * LATENCY_HIST_BUCKETS);
     }
 }
 
@@ -2546,6 +2679,7 @@ Track::clear()
         memset(us, 0, sizeof(uint32_t) * LATENCY_US_BUCKETS);
         memset(ms, 0, sizeof(uint32_t) * LATENCY_MS_BUCKETS);
         memset(sec, 0, sizeof(uint32_t) * LATENCY_SEC_BUCKETS);
+        memset(hist, 0, sizeof(uint32_t) * LATENCY_HIST_BUCKETS);
     }
 }
 
@@ -2586,14 +2720,19 @@ Track::complete_with_latency(uint64_t usecs)
     // >100 seconds, accumulate in the biggest bucket. */
     else
         sec[LATENCY_SEC_BUCKETS - 1]++;
+
+    // The log-linear buckets cover all latencies, they're used for percentiles.
+    hist[latency_hist_bucket(usecs)]++;
 }
 
 /*
  * Return the latency for which the given percent is lower than it. E.g. for percent == 95, returns
- * the latency for which 95% of latencies are faster (lower), and 5% are slower (higher).
+ * the latency for which 95% of latencies are faster (lower), and 5% are slower (higher). The result
+ * is the largest latency in the log-linear bucket holding the percentile, within 1/64 of the actual
+ * latency.
  */
 uint64_t
-Track::percentile_latency(int percent) const
+Track::percentile_latency(double percent) const
 {
     /*
      * Get the total number of operations in the latency buckets. We can't reliably use latency_ops,
@@ -2601,34 +2740,20 @@ Track::percentile_latency(int percent) const
      * updated.
      */
     uint64_t total = 0;
-    for (int i = 0; i < LATENCY_SEC_BUCKETS; i++)
-        total += sec[i];
-    for (int i = 0; i < LATENCY_MS_BUCKETS; i++)
-        total += ms[i];
-    for (int i = 0; i < LATENCY_US_BUCKETS; i++)
-        total += us[i];
+    for (int i = 0; i < LATENCY_HIST_BUCKETS; i++)
+        total += hist[i];
     if (total == 0)
         return (0);
 
-    // optimized for percent values over 50, we start counting from above.
+    // Optimized for percent values over 50, we start counting from above.
     uint64_t n = 0;
-    uint64_t k = (100 - percent) * total / 100;
+    uint64_t k = (uint64_t)((100.0 - percent) * total / 100.0);
     if (k == 0)
-        return (0);
-    for (int i = LATENCY_SEC_BUCKETS - 1; i >= 0; --i) {
-        n += sec[i];
+        k = 1;
+    for (int i = LATENCY_HIST_BUCKETS - 1; i >= 0; --i) {
+        n += hist[i];
         if (n >= k)
-            return (sec_to_us(i));
-    }
-    for (int i = LATENCY_MS_BUCKETS - 1; i >= 0; --i) {
-        n += ms[i];
-        if (n >= k)
-            return (ms_to_us(i));
-    }
-    for (int i = LATENCY_US_BUCKETS - 1; i >= 0; --i) {
-        n += us[i];
-        if (n >= k)
-            return (100 * i);
+            return (latency_hist_value(i));
     }
     // We should have accounted for all the buckets.
     ASSERT(false);
@@ -2652,6 +2777,8 @@ Track::subtract(const Track &other)
             ms[i] -= other.ms[i];
         for (int i = 0; i < LATENCY_SEC_BUCKETS; i++)
             sec[i] -= other.sec[i];
+        for (int i = 0; i < LATENCY_HIST_BUCKETS; i++)
+            hist[i] -= other.hist[i];
     }
 }
 
@@ -2663,18 +2790,22 @@ Track::track_latency(bool newval)
             us = new uint32_t[LATENCY_US_BUCKETS];
             ms = new uint32_t[LATENCY_MS_BUCKETS];
             sec = new uint32_t[LATENCY_SEC_BUCKETS];
+            hist = new uint32_t[LATENCY_HIST_BUCKETS];
             memset(us, 0, sizeof(uint32_t) * LATENCY_US_BUCKETS);
             memset(ms, 0, sizeof(uint32_t) * LATENCY_MS_BUCKETS);
             memset(sec, 0, sizeof(uint32_t) * LATENCY_SEC_BUCKETS);
+            memset(hist, 0, sizeof(uint32_t) * LATENCY_HIST_BUCKETS);
         }
     } else {
         if (us != nullptr) {
             delete us;
             delete ms;
             delete sec;
+            delete hist;
             us = nullptr;
             ms = nullptr;
             sec = nullptr;
+            hist = nullptr;
         }
     }
 }
@@ -3420,4 +3551,311 @@ WorkloadRunner::run_all(WT_CONNECTION *conn)
     return (ret);
 }
 
+ReplayOptions::ReplayOptions() : create(true), speedup(1.0), threads(0), _options()
+{
+    _options.add_bool("create", create,
+      "create tables that don't exist, with string keys and values. Otherwise replayed tables "
+      "must exist and have string, raw or record number keys");
+    _options.add_double("speedup", speedup,
+      "replay operations this many times faster than they were captured, scaling the time "
+      "between operations including think times. 0 replays operations back to back");
+    _options.add_int("threads", threads,
+      "number of replay threads, captured sessions are assigned to threads round-robin. "
+      "0 to replay each captured session in its own thread");
+}
+ReplayOptions::ReplayOptions(const ReplayOptions &other)
+    : create(other.create), speedup(other.speedup), threads(other.threads),
+      _options(other._options)
+{
+}
+
+Replay::Replay(const std::string &path) : options(), stats(true), _path(path) {}
+Replay::Replay(const Replay &other) : options(other.options), stats(other.stats), _path(other._path)
+{
+}
+
+// Fill a buffer with the hexadecimal digits of a key hash, repeated as needed.
+static void
+replay_fill(std::string &buf, size_t len, uint64_t hash)
+{
+    static const char hex[] = "0123456789abcdef";
+
+    buf.resize(len);
+    for (size_t i = 0; i < len; i++)
+        buf[i] = hex[(hash >> (4 * (i % 16))) & 0xf];
+}
+
+ReplayRunner::ReplayRunner()
+    : _errno(0), _exception(), _replay(nullptr), _conn(nullptr), _uris(nullptr), _ops(), _cursors(),
+      _session(nullptr), _stats(true), _start_ns(0), _base_ns(0), _keybuf(), _valuebuf()
+{
+}
+
+int
+ReplayRunner::run()
+{
+    WT_DECL_RET;
+    double speedup = _replay->options.speedup;
+    uint64_t intended_ns, now;
+
+    WT_RET(_conn->open_session(_conn, nullptr, nullptr, &_session));
+    for (const CaptureRecord &rec : _ops) {
+        // Operations start on the captured schedule, scaled by the speedup, and their latency is
+        // measured from the scheduled start, whether or not earlier operations have completed.
+        workgen_clock(&now);
+        if (speedup != 0) {
+            intended_ns = _start_ns + (uint64_t)((rec.timestamp - _base_ns) / speedup);
+            if (now < intended_ns) {
+                usleep((useconds_t)ns_to_us(intended_ns - now));
+                workgen_clock(&now);
+            }
+        } else
+            intended_ns = now;
+        WT_ERR(op_run(rec, intended_ns));
+    }
+
+err:
+    WT_TRET(_session->close(_session, nullptr));
+    _session = nullptr;
+    return (ret);
+}
+
+int
+ReplayRunner::op_run(const CaptureRecord &rec, uint64_t intended_ns)
+{
+    Track *track;
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    WT_ITEM item;
+    uint64_t stop;
+
+    if ((cursor = _cursors[rec.table]) == nullptr) {
+        const std::string &uri = (*_uris)[rec.table];
+        WT_RET(_session->open_cursor(_session, uri.c_str(), nullptr, nullptr, &cursor));
+        _cursors[rec.table] = cursor;
+    }
+
+    // Captured keys are hashed, generate a key of the captured size from the hash. String sizes
+    // include the trailing nul byte, record numbers have no size.
+    const std::string key_format(cursor->key_format);
+    if (key_format == "r")
+        cursor->set_key(cursor, rec.key_hash != 0 ? rec.key_hash : 1);
+    else {
+        size_t key_size = key_format == "S" ? (rec.key_size > 1 ? rec.key_size - 1 : 16) :
+                                              (rec.key_size > 0 ? rec.key_size : 8);
+        replay_fill(_keybuf, key_size, rec.key_hash);
+        if (key_format == "S")
+            cursor->set_key(cursor, _keybuf.c_str());
+        else if (key_format == "u") {
+            item.data = _keybuf.data();
+            item.size = _keybuf.size();
+            cursor->set_key(cursor, &item);
+        } else
+            THROW("replay of " << (*_uris)[rec.table] << ": the key format ('" << key_format
+                               << "') must be 'r', 'u' or 'S'.");
+    }
+
+    // Modifications are replayed as updates with the captured size of the modified value.
+    if (rec.op == CAPTURE_INSERT || rec.op == CAPTURE_MODIFY || rec.op == CAPTURE_UPDATE) {
+        const std::string value_format(cursor->value_format);
+        if (value_format == "S") {
+            _valuebuf.assign(rec.value_size > 1 ? rec.value_size - 1 : 1, 'v');
+            cursor->set_value(cursor, _valuebuf.c_str());
+        } else if (value_format == "u") {
+            _valuebuf.assign(rec.value_size, 'v');
+            item.data = _valuebuf.data();
+            item.size = _valuebuf.size();
+            cursor->set_value(cursor, &item);
+        } else
+            THROW("replay of " << (*_uris)[rec.table] << ": the value format ('" << value_format
+                               << "') must be 'u' or 'S'.");
+    }
+
+    switch (rec.op) {
+    case CAPTURE_INSERT:
+        track = &_stats.insert;
+        track->begin();
+        ret = cursor->insert(cursor);
+        break;
+    case CAPTURE_MODIFY:
+    case CAPTURE_UPDATE:
+        track = &_stats.update;
+        track->begin();
+        ret = cursor->update(cursor);
+        break;
+    case CAPTURE_REMOVE:
+        track = &_stats.remove;
+        track->begin();
+        ret = cursor->remove(cursor);
+        break;
+    case CAPTURE_SEARCH:
+    case CAPTURE_SEARCH_NEAR:
+        track = &_stats.read;
+        track->begin();
+        ret = cursor->search(cursor);
+        break;
+    default:
+        THROW("replay: unknown captured operation " << (int)rec.op);
+    }
+
+    // The replayed database needn't hold the captured keys, and operations run without explicit
+    // transactions, so conflicts are counted rather than retried.
+    if (ret == WT_NOTFOUND && track == &_stats.read) {
+        --track->ops_in_progress;
+        track = &_stats.not_found;
+        track->begin();
+    }
+    if (ret == WT_ROLLBACK)
+        track->rollbacks++;
+    else if (ret != 0 && ret != WT_NOTFOUND && ret != WT_DUPLICATE_KEY)
+        return (ret);
+
+    workgen_clock(&stop);
+    track->complete_with_latency(ns_to_us(stop - intended_ns));
+    return (cursor->reset(cursor));
+}
+
+int
+Replay::run(WT_CONNECTION *conn)
+{
+    WT_DECL_RET;
+    WT_SESSION *session;
+    WorkgenException *exception;
+    std::map<std::string, uint32_t> uri_index;
+    std::map<std::pair<uintmax_t, uint32_t>, uint32_t> table_index;
+    std::vector<std::string> uris;
+    std::vector<std::vector<CaptureRecord>> streams;
+    timespec start, stop;
+    uint64_t base_ns;
+    void *status;
+
+    // Read the capture map files, mapping each process' table IDs to an index into the URIs.
+    if (!std::filesystem::is_directory(_path))
+        THROW("replay: " << _path << " is not a directory");
+    for (const auto &entry : std::filesystem::directory_iterator(_path)) {
+        const std::string name = entry.path().filename().string();
+        const std::string prefix = "capture-map.";
+        if (name.compare(0, prefix.size(), prefix) != 0)
+            continue;
+        uintmax_t pid = std::stoull(name.substr(prefix.size()));
+        std::ifstream map(entry.path());
+        uint32_t id;
+        std::string uri;
+        while (map >> id >> uri) {
+            if (uri_index.count(uri) == 0) {
+                uri_index[uri] = (uint32_t)uris.size();
+                uris.push_back(uri);
+            }
+            table_index[std::make_pair(pid, id)] = uri_index[uri];
+        }
+    }
+
+    // Read the per-session capture files. The capture map only describes the last connection of
+    // each process, skip files left by earlier connections.
+    std::vector<std::pair<std::filesystem::path, uintmax_t>> files;
+    std::map<uintmax_t, uint64_t> epoch;
+    for (const auto &entry : std::filesystem::directory_iterator(_path)) {
+        const std::string name = entry.path().filename().string();
+        const std::string prefix = "capture.";
+        if (name.compare(0, prefix.size(), prefix) != 0)
+            continue;
+        uintmax_t pid = std::stoull(name.substr(prefix.size()));
+        std::ifstream file(entry.path(), std::ios::binary);
+        CaptureHeader header;
+        if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+          header.version != CAPTURE_VERSION)
+            THROW("replay: " << entry.path().string() << ": not a capture file");
+        epoch[pid] = std::max(epoch[pid], header.epoch_nsec);
+        files.push_back(std::make_pair(entry.path(), pid));
+    }
+    base_ns = UINT64_MAX;
+    for (const auto &f : files) {
+        std::ifstream file(f.first, std::ios::binary);
+        CaptureHeader header;
+        file.read(reinterpret_cast<char *>(&header), sizeof(header));
+        if (header.epoch_nsec != epoch[f.second])
+            continue;
+        std::vector<CaptureRecord> stream;
+        CaptureRecord rec;
+        while (file.read(reinterpret_cast<char *>(&rec), sizeof(rec))) {
+            auto table = table_index.find(std::make_pair(f.second, rec.table));
+            if (table == table_index.end())
+                THROW("replay: " << f.first.string() << ": table " << rec.table
+                                 << " missing from the capture map");
+            rec.table = table->second;
+            stream.push_back(rec);
+        }
+        if (stream.empty())
+            continue;
+        base_ns = std::min(base_ns, stream.front().timestamp);
+        streams.push_back(stream);
+    }
+    if (streams.empty())
+        THROW("replay: no captured operations in " << _path);
+
+    // Create missing tables.
+    WT_RET(conn->open_session(conn, nullptr, nullptr, &session));
+    for (const std::string &uri : uris) {
+        WT_CURSOR *cursor;
+        if ((ret = session->open_cursor(session, uri.c_str(), nullptr, nullptr, &cursor)) == 0)
+            ret = cursor->close(cursor);
+        else if (ret == ENOENT && options.create)
+            ret = session->create(session, uri.c_str(), "key_format=S,value_format=S");
+        if (ret != 0)
+            break;
+    }
+    WT_TRET(session->close(session, nullptr));
+    WT_RET(ret);
+
+    // Assign the captured sessions to threads, each thread replays its operations in the order
+    // they were captured.
+    size_t nthreads = options.threads > 0 ? (size_t)options.threads : streams.size();
+    std::vector<ReplayRunner> runners(nthreads);
+    for (size_t i = 0; i < streams.size(); i++) {
+        std::vector<CaptureRecord> &ops = runners[i % nthreads]._ops;
+        ops.insert(ops.end(), streams[i].begin(), streams[i].end());
+    }
+    for (ReplayRunner &runner : runners)
+        std::stable_sort(runner._ops.begin(), runner._ops.end(),
+          [](const CaptureRecord &a, const CaptureRecord &b) {
+              return (a.timestamp < b.timestamp);
+          });
+
+    std::vector<pthread_t> handles(nthreads);
+    size_t started;
+    workgen_epoch(&start);
+    uint64_t start_ns;
+    workgen_clock(&start_ns);
+    for (started = 0; started < nthreads; started++) {
+        ReplayRunner &runner = runners[started];
+        runner._replay = this;
+        runner._conn = conn;
+        runner._uris = &uris;
+        runner._start_ns = start_ns;
+        runner._base_ns = base_ns;
+        if ((ret = pthread_create(&handles[started], nullptr, replay_runner_main, &runner)) != 0) {
+            std::cerr << "pthread_create failed err=" << ret << std::endl;
+            break;
+        }
+    }
+
+    exception = nullptr;
+    stats.clear();
+    for (size_t i = 0; i < started; i++) {
+        WT_TRET(pthread_join(handles[i], &status));
+        WT_TRET(runners[i]._errno);
+        if (exception == nullptr && !runners[i]._exception._str.empty())
+            exception = &runners[i]._exception;
+        stats.add(runners[i]._stats);
+    }
+    workgen_epoch(&stop);
+
+    timespec totalsecs = stop - start;
+    stats.final_report(std::cout, totalsecs);
+    std::cout << "Replay completed: " << totalsecs << " seconds" << std::endl;
+    if (exception != nullptr)
+        throw *exception;
+    return (ret);
+}
+
 } // namespace workgen
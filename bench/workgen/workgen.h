@@ -109,7 +109,7 @@ struct Track {
     void clear();
     void complete();
     void complete_with_latency(uint64_t usecs);
-    uint64_t percentile_latency(int percent) const;
+    uint64_t percentile_latency(double percent) const;
     void subtract(const Track&);
     void track_latency(bool);
     bool track_latency() const { return (us != NULL); }
@@ -123,6 +123,7 @@ private:
     uint32_t *us;                        // < 1us ... 1000us
     uint32_t *ms;                        // < 1ms ... 1000ms
     uint32_t *sec;                       // < 1s 2s ... 100s
+    uint32_t *hist;                      // Log-linear buckets, for percentiles
 
     Track & operator=(const Track &other);   // use explicit assign method
 };
@@ -341,6 +342,8 @@ struct ThreadOptions {
     std::string session_config;
     double throttle;
     double throttle_burst;
+    double arrival_rate;
+    std::string arrival_distribution;
     bool synchronized;
 
     ThreadOptions();
@@ -350,6 +353,8 @@ struct ThreadOptions {
     void describe(std::ostream &os) const {
 	os << "throttle " << throttle;
 	os << ", throttle_burst " << throttle_burst;
+	os << ", arrival_rate " << arrival_rate;
+	os << ", arrival_distribution " << arrival_distribution;
 	os << ", synchronized " << synchronized;
 	os << ", session_config " << session_config;
     }
@@ -510,4 +515,53 @@ struct Workload {
     int run(WT_CONNECTION *conn);
 };
 
+// To prevent silent errors, this class is set up in Python so that new
+// properties are prevented, only existing properties can be set.
+struct ReplayOptions {
+    bool create;
+    double speedup;
+    int threads;
+
+    ReplayOptions();
+    ReplayOptions(const ReplayOptions &other);
+    ~ReplayOptions() = default;
+
+    void describe(std::ostream &os) const {
+	os << "create " << create;
+	os << ", speedup " << speedup;
+	os << ", threads " << threads;
+    }
+
+    std::string help() const { return _options.help(); }
+    std::string help_description(const std::string& option_name) const {
+	return _options.help_description(option_name); }
+    std::string help_type(const std::string& option_name) const {
+	return _options.help_type(option_name); }
+
+private:
+    OptionsList _options;
+};
+
+/*
+ * Replay the cursor operations captured by WiredTiger's operation_capture
+ * configuration. The path is the directory holding the capture files. Keys
+ * are generated from the captured key hashes, so the same captured key maps
+ * to the same replayed key, values are generated with the captured sizes.
+ */
+struct Replay {
+    ReplayOptions options;
+    Stats stats;
+    std::string _path;
+
+    Replay(const std::string &path);
+    Replay(const Replay &other);
+    ~Replay() = default;
+
+    void describe(std::ostream &os) const {
+	os << "Replay: " << _path << ", ";
+	options.describe(os);
+    }
+    int run(WT_CONNECTION *conn);
+};
+
 }
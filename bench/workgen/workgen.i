@@ -114,6 +114,7 @@
 %enddef
 
 InterruptableFunction(workgen::execute)
+InterruptableFunction(workgen::Replay::run)
 InterruptableFunction(workgen::Workload::run)
 
 %module workgen
@@ -128,6 +129,8 @@ InterruptableFunction(workgen::Workload::run)
 
 WorkgenClass(Key)
 WorkgenClass(Operation)
+WorkgenClass(Replay)
+WorkgenClass(ReplayOptions)
 WorkgenClass(Stats)
 WorkgenClass(Table)
 WorkgenClass(TableOptions)
@@ -139,6 +142,7 @@ WorkgenClass(Workload)
 WorkgenClass(WorkloadOptions)
 WorkgenClass(Context)
 
+WorkgenFrozenClass(ReplayOptions)
 WorkgenFrozenClass(TableOptions)
 WorkgenFrozenClass(ThreadOptions)
 WorkgenFrozenClass(WorkloadOptions)
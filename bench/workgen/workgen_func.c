@@ -65,7 +65,8 @@ workgen_atomic_sub32(uint32_t *vp, uint32_t v)
 void
 workgen_clock(uint64_t *clockp)
 {
-    *clockp = __wt_clock(NULL);
+    /* Workgen times are in nanoseconds, convert from clock ticks. */
+    *clockp = __wt_clock_to_nsec(__wt_clock(NULL), 0);
 }
 
 void
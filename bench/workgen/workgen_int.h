@@ -116,6 +116,28 @@ struct Throttle {
     int throttle(uint64_t op_count, uint64_t *op_limit);
 };
 
+/*
+ * Open-loop scheduling: operations arrive at a configured rate whether or not earlier operations
+ * have completed, and latency is measured from the time an operation was scheduled to start. A
+ * thread that falls behind its schedule runs operations back to back until it catches up, the
+ * time spent waiting to start counts as latency, avoiding coordinated omission.
+ */
+struct Arrival {
+    ThreadRunner &_runner;
+    double _rate;                              // operations per second
+    bool _poisson;                             // exponential inter-arrival times
+    uint64_t _next_ns;                         // intended start of the next operation
+
+    Arrival(ThreadRunner &runner, double rate, bool poisson);
+    ~Arrival() = default;
+
+    /*
+     * Sleeps until the intended start time of the next operation, if it is in the future, and
+     * returns it.
+     */
+    uint64_t arrive();
+};
+
 // There is one of these per Thread object. It exists for the duration of a
 // call to Workload::run() method.
 struct ThreadRunner {
@@ -130,6 +152,8 @@ struct ThreadRunner {
     Throttle *_throttle;
     uint64_t _throttle_ops;
     uint64_t _throttle_limit;
+    Arrival *_arrival;
+    uint64_t _intended_ns;  // intended start of the scheduled operation
     uint64_t _start_time_us;
     uint64_t _op_time_us;   // time that current operation starts
     bool _in_transaction;
@@ -345,4 +369,58 @@ private:
     WorkloadRunner& operator=(const WorkloadRunner &other); // disallowed
 };
 
+// The layout of captured operations, matching WT_CAPTURE_HEADER and WT_CAPTURE_RECORD in
+// WiredTiger's capture.h.
+#define CAPTURE_VERSION 1
+#define CAPTURE_INSERT 1
+#define CAPTURE_MODIFY 2
+#define CAPTURE_REMOVE 3
+#define CAPTURE_SEARCH 4
+#define CAPTURE_SEARCH_NEAR 5
+#define CAPTURE_UPDATE 6
+
+struct CaptureHeader {
+    uint32_t version;
+    uint32_t session_id;
+    uint64_t epoch_nsec;
+};
+
+struct CaptureRecord {
+    uint64_t timestamp;                        // nanoseconds since capture started
+    uint64_t key_hash;                         // key hash, or record number
+    uint32_t duration;
+    uint32_t key_size;                         // 0 for record numbers
+    uint32_t value_size;
+    uint32_t table;                            // table ID, replaced by a URI index when loaded
+    int32_t ret;
+    uint8_t op;
+    uint8_t padding[3];
+};
+
+// There is one of these per replay thread. It exists for the duration of a
+// call to the Replay::run() method.
+struct ReplayRunner {
+    int _errno;
+    WorkgenException _exception;
+    Replay *_replay;
+    WT_CONNECTION *_conn;
+    const std::vector<std::string> *_uris;     // indexed by CaptureRecord.table
+    std::vector<CaptureRecord> _ops;           // in timestamp order
+    std::map<uint32_t, WT_CURSOR *> _cursors;  // indexed by CaptureRecord.table
+    WT_SESSION *_session;
+    Stats _stats;
+    uint64_t _start_ns;                        // when the replay started
+    uint64_t _base_ns;                         // captured timestamp of the replay start
+    std::string _keybuf;
+    std::string _valuebuf;
+
+    ReplayRunner();
+    ~ReplayRunner() = default;
+
+    int run();
+
+private:
+    int op_run(const CaptureRecord &rec, uint64_t intended_ns);
+};
+
 }
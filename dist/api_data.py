@@ -177,6 +177,24 @@ lsm_config = [
             the minimum number of chunks to include in a merge operation. If set to 0 or 1 half
             the value of merge_max is used''',
             max='100'),
+        Config('merge_partitions', '1', r'''
+            the maximum number of key ranges a merge is split into. Each range is written to its
+            own chunk by a separate thread, so large merges complete faster. A merge is only
+            split if each range would contain at least \c chunk_size bytes of input and combine
+            at least two chunks''',
+            min='1', max='16'),
+        Config('merge_strategy', 'generational', r'''
+            the policy used to choose chunks to merge. The \c "generational" policy merges
+            chunks of similar merge generation. The \c "leveled" policy repeatedly merges newly
+            flushed chunks into the youngest larger chunk until it reaches \c chunk_max, trading
+            write amplification for fewer chunks to search. The \c "size_tiered" policy merges
+            runs of chunks of similar size. The \c "time_windowed" policy only merges chunks
+            created within the same \c merge_time_window, so data written at similar times stays
+            together''',
+            choices=['generational', 'leveled', 'size_tiered', 'time_windowed']),
+        Config('merge_time_window', '3600', r'''
+            the window in seconds used by the \c "time_windowed" merge strategy''',
+            min='1', max='1000000000'),
     ]),
 ]
 
@@ -295,6 +313,13 @@ file_config = format_meta + file_runtime_config + tiered_config + [
             first use of a (name, keyid) combination, the WT_ENCRYPTOR::customize function is
             called with the keyid as an argument'''),
         ]),
+    Config('fixed_width', 'false', r'''
+        store a column-store object with a \c value_format of a single 32 or 64-bit integer (one
+        of \c i, \c I, \c l, \c L, \c q or \c Q) as a fixed-length column store. Values are
+        stored in a dense, aligned array on each leaf page and record numbers are found without a
+        search of the page, but as for other fixed-length column stores, deleted and missing
+        records read as 0. Requires a \c key_format of \c r''',
+        type='boolean'),
     Config('format', 'btree', r'''
         the file format''',
         choices=['btree']),
@@ -383,6 +408,23 @@ file_config = format_meta + file_runtime_config + tiered_config + [
         when a Btree page is split, it will be split into smaller pages, where each page is
         the specified percentage of the maximum Btree page size''',
         min='50', max='100'),
+    Config('time_to_live', '', r'''
+        configure records to expire after a time-to-live. Expired records are hidden from readers
+        whose read timestamp is at or after the record's expiry, and are removed when their pages
+        are reconciled once the expiry is older than every reader's timestamp. Only supported for
+        row-store objects. See @ref time_to_live for more information''',
+        type='category', subconfig=[
+        Config('duration', '0', r'''
+            the number of timestamp units after a record's commit timestamp at which the record
+            expires. Records committed without a timestamp never expire. 0 for no duration
+            expiry''',
+            min='0'),
+        Config('value_field', '-1', r'''
+            the 0-based index of an integer field of the value format holding the timestamp at
+            which the record expires, a field value of 0 never expires. -1 for no value field
+            expiry''',
+            min='-1'),
+        ]),
 ]
 
 # File metadata, including both configurable and non-configurable (internal)
@@ -546,6 +588,27 @@ connection_runtime_config = [
             periodic checkpoints''',
             min='0', max='100000'),
         ]),
+    Config('compact_server', '', r'''
+        run a background thread that periodically compacts tables with reclaimable space. Page
+        rewrites done by the server are paced by the \c io_capacity settings, and the server
+        backs off when the cache needs eviction. Enabling the server uses a session from the
+        configured \c session_max''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            if true, start the background compaction server''',
+            type='boolean'),
+        Config('exclude', '', r'''
+            list of table URIs the background compaction server will not compact''',
+            type='list'),
+        Config('free_space_target', '20MB', r'''
+            minimum amount of space that must be recoverable from a file before the server
+            compacts it''',
+            min='1MB', max='1TB'),
+        Config('wait', '60', r'''
+            seconds to wait between each pass of the background compaction server over the
+            database''',
+            min='1', max='100000'),
+        ]),
     Config('debug_mode', '', r'''
         control the settings of various extended debugging features''',
         type='category', subconfig=[
@@ -611,6 +674,27 @@ connection_runtime_config = [
         ]),
     Config('error_prefix', '', r'''
         prefix string for error messages'''),
+    Config('event_tracing', '', r'''
+        continuously record performance-critical events in per-session memory buffers. See
+        @ref event_tracing for more information''',
+        type='category', subconfig=[
+            Config('buffer_size', '64KB', r'''
+                the size of each session's event buffer. Each event uses 32B, a buffer holds
+                the most recent events of its session''',
+                min='4KB', max='64MB'),
+            Config('enabled', 'false', r'''
+                enable event tracing''',
+                type='boolean'),
+            Config('latency_threshold_ms', '0', r'''
+                if non-zero, write the event buffers to a file when an application API call takes
+                longer than this number of milliseconds. At most one file is written each
+                second''',
+                min='0'),
+            Config('path', '"."', r'''
+                the name of a directory into which event trace files are written. The directory
+                must already exist. If the value is not an absolute path, the path is relative to
+                the database home (see @ref absolute_path for more information)'''),
+        ]),
     Config('eviction', '', r'''
         eviction configuration options''',
         type='category', subconfig=[
@@ -738,6 +822,20 @@ connection_runtime_config = [
             merge LSM chunks where possible''',
             type='boolean')
         ]),
+    Config('operation_capture', '', r'''
+        capture application cursor operations on files and simple tables into compact
+        per-session binary files, for replay by workgen. See @ref operation_capture
+        for more information''',
+        type='category', subconfig=[
+            Config('enabled', 'false', r'''
+                enable operation capture''',
+                type='boolean'),
+            Config('path', '"."', r'''
+                the name of a directory into which operation capture files are written. The
+                directory must already exist. If the value is not an absolute path, the path
+                is relative to the database home (see @ref absolute_path for more information).
+                The path can't be changed by reconfiguration'''),
+        ]),
     Config('operation_timeout_ms', '0', r'''
         if non-zero, a requested limit on the number of elapsed real time milliseconds
         application threads will take to complete database operations. Time is measured from the
@@ -1002,6 +1100,24 @@ wiredtiger_open_tiered_storage_configuration = [
             a directory to store locally cached versions of files in the storage source. By
             default, it is named with \c "-cache" appended to the bucket name. A relative
             directory name is relative to the home directory'''),
+        Config('cache_chunk_size', '0', r'''
+            if non-zero, objects are cached on demand: reads copy the ranges of this size they
+            need from the storage source into the cache, rather than whole objects being copied
+            when they're opened. Storage sources that don't cache on demand, such as the S3
+            storage source, ignore this setting and copy whole objects''',
+            min='0', max='1GB'),
+        Config('cache_prefetch', '0', r'''
+            the number of ranges read ahead when objects are cached on demand''',
+            min='0', max='1000'),
+        Config('flush_part_size', '16MB', r'''
+            objects larger than this size are copied to the storage source in parts of this
+            size, which the flush threads copy in parallel, if the storage source supports
+            multipart flushes''',
+            min='4KB', max='5GB'),
+        Config('flush_threads', '1', r'''
+            the number of threads copying objects to the storage source after a flush_tier
+            call. With a single thread, the tiered storage server thread copies the objects''',
+            min=1, max=20),
         Config('interval', '60', r'''
             interval in seconds at which to check for tiered storage related work to perform''',
             min=1, max=1000),
@@ -1096,9 +1212,12 @@ wiredtiger_open_common =\
         warnings. Including \c "data" will cause WiredTiger data files, including WiredTiger
         internal data files, to use direct I/O; including \c "log" will cause WiredTiger log
         files to use direct I/O; including \c "checkpoint" will cause WiredTiger data files
-        opened using a (read-only) checkpoint cursor to use direct I/O. \c direct_io should
-        be combined with \c write_through to get the equivalent of \c O_DIRECT on Windows''',
-        type='list', choices=['checkpoint', 'data', 'log']),
+        opened using a (read-only) checkpoint cursor to use direct I/O; including \c "read"
+        will cause blocks read from WiredTiger data files to use direct I/O, while writes go
+        through the system buffer cache, which is only supported on Linux ext4 and XFS
+        filesystems. \c direct_io should be combined with \c write_through to get the
+        equivalent of \c O_DIRECT on Windows''',
+        type='list', choices=['checkpoint', 'data', 'log', 'read']),
     Config('encryption', '', r'''
         configure an encryptor for system wide metadata and logs. If a system wide encryptor is
         set, it is also used for encrypting data files and tables, unless encryption configuration
@@ -1159,6 +1278,15 @@ wiredtiger_open_common =\
         open connection in read-only mode. The database must exist. All methods that may
         modify a database are disabled. See @ref readonly for more information''',
         type='boolean'),
+    Config('rwlock_scalable', '', r'''
+        switch heavily read-shared read/write locks to a reader-scalable implementation, where
+        readers announce themselves in per-session cache-line padded slots instead of updating a
+        single shared word. Read lock acquisition scales with the number of cores at the cost of
+        more expensive write lock acquisition. Options are given as a list, such as
+        <code>"rwlock_scalable=[dhandle,table]"</code>. Including \c "dhandle" switches the data
+        handle list lock, \c "table" the table list lock, and \c "txn_global" the global
+        transaction lock''',
+        type='list', choices=['dhandle', 'table', 'txn_global']),
     Config('salvage', 'false', r'''
         open connection and salvage any WiredTiger-owned database and log files that it detects as
         corrupted. This call should only be used after getting an error return of WT_TRY_SALVAGE.
@@ -1299,6 +1427,9 @@ methods = {
 'WT_SESSION.close' : Method([]),
 
 'WT_SESSION.compact' : Method([
+    Config('free_space_target', '1MB', r'''
+        minimum amount of space recoverable for compaction to proceed''',
+        min='1MB', max='1TB'),
     Config('timeout', '1200', r'''
         maximum amount of time to allow for compact in seconds. The actual amount of time spent
         in compact may exceed the configured value. A value of zero disables the timeout''',
@@ -1387,8 +1518,19 @@ methods = {
     Config('strategy', '', r'''
         when set to \c bloom, a Bloom filter is created and populated for this index. This has an
         up front cost but may reduce the number of accesses to the main table when iterating
-        the joined cursor. The \c bloom setting requires that \c count be set''',
-        choices=['bloom', 'default']),
+        the joined cursor. The \c bloom setting requires that \c count be set. When set to \c set,
+        the primary keys matching this index are collected into a sorted set when the join
+        cursor is first advanced, the sets are intersected (or for "operation=or", merged), and
+        the main table is read in primary key order. The \c set setting must be used for every
+        cursor joined to the join cursor and cannot be combined with nested joins; when \c count
+        is set, it is used to size the set''',
+        choices=['bloom', 'default', 'set']),
+    Config('set_max', '64MB', r'''
+        the maximum memory used by the sets of primary keys built when \c strategy is \c set. If
+        the sets grow larger, they are discarded and the join falls back to checking each key
+        returned by the first joined cursor against the other joins. When cursors joined to the
+        same join cursor configure different values, the smallest is used''',
+        min='0', max='1TB'),
 ]),
 
 'WT_SESSION.log_flush' : Method([
@@ -1402,6 +1544,24 @@ methods = {
 'WT_SESSION.log_printf' : Method([]),
 
 'WT_SESSION.open_cursor' : Method(cursor_runtime_config + [
+    Config('batch', '', r'''
+        configure a table cursor to scan the table in batches of rows, with the key and projected
+        value columns decoded into contiguous per-column arrays. Batch cursors support only the
+        WT_CURSOR::next, WT_CURSOR::reset and WT_CURSOR::close methods. See @ref cursor_batch
+        for more information''',
+        type='category', subconfig=[
+        Config('filter', '', r'''
+            the name of a fixed-width value column used to filter the batch. Only rows where the
+            column's value is between \c filter_min and \c filter_max, inclusive, are
+            returned'''),
+        Config('filter_max', '', r'''
+            the largest value of the filter column returned, no limit if not set'''),
+        Config('filter_min', '', r'''
+            the smallest value of the filter column returned, no limit if not set'''),
+        Config('size', '0', r'''
+            the maximum number of rows in a batch, zero for a standard cursor''',
+            min='0', max='1M'),
+        ]),
     Config('bulk', 'false', r'''
         configure the cursor for bulk-loading, a fast, initial load path (see @ref tune_bulk_load
         for more information). Bulk-load may only be used for newly created objects and
@@ -1413,6 +1573,12 @@ methods = {
         records in the bitmap (as specified by the object's \c value_format configuration).
         Bulk-loaded bitmap values must end on a byte boundary relative to the bit count (except
         for the last set of values loaded)'''),
+    Config('bulk_write_threads', '0', r'''
+        when bulk-loading, the number of threads the page writes are offloaded to. The application
+        thread builds every page, completed pages are compressed, checksummed and written by these
+        threads, allowing page construction to overlap with page writes. The default of \c 0
+        writes pages in the application thread''',
+        min='0', max='32'),
     Config('checkpoint', '', r'''
         the name of a checkpoint to open. (The reserved name "WiredTigerCheckpoint" opens
         the most recent checkpoint taken for the object.) The cursor does not support data
@@ -1453,6 +1619,28 @@ methods = {
         a format where only non-printing characters are hexadecimal encoded. These formats are
         compatible with the @ref util_dump and @ref util_load commands''',
         choices=['hex', 'json', 'pretty', 'pretty_hex', 'print']),
+    Config('filter', '', r'''
+        configure a row-store cursor to skip entries not matching a predicate while iterating
+        with WT_CURSOR::next and WT_CURSOR::prev. Entries are tested inside the page iteration,
+        key patterns before the entry's visibility is checked, so skipped entries are never
+        returned to the application. Searches are not filtered''',
+        type='category', subconfig=[
+        Config('key_prefix', '', r'''
+            only return entries whose keys start with the given string. Requires a \c key_format
+            of \c S or \c u'''),
+        Config('key_suffix', '', r'''
+            only return entries whose keys end with the given string. Requires a \c key_format
+            of \c S or \c u'''),
+        Config('value_field', '-1', r'''
+            the 0-based index of an integer field of the value format, only entries where that
+            field is between \c value_min and \c value_max, inclusive, are returned. -1 for no
+            value predicate''',
+            min='-1'),
+        Config('value_max', '', r'''
+            the largest value of the value field returned, no limit if not set'''),
+        Config('value_min', '', r'''
+            the smallest value of the value field returned, no limit if not set'''),
+        ]),
     Config('incremental', '', r'''
         configure the cursor for block incremental backup usage. These formats are only compatible
         with the backup data source; see @ref backup''',
@@ -1463,6 +1651,11 @@ methods = {
             blocks only. This must be set on the primary backup cursor and it applies to all
             files for this backup''',
             type='boolean'),
+        Config('consolidate_max', '0', r'''
+            the maximum size of a range returned when block incremental backup information is
+            consolidated, zero for no limit. Setting this value implies \c consolidate. This must
+            be set on the primary backup cursor and it applies to all files for this backup''',
+            min='0', max='2GB'),
         Config('enabled', 'false', r'''
             whether to configure this backup as the starting point for a subsequent incremental
             backup''',
@@ -1480,6 +1673,20 @@ methods = {
             internally. The larger the granularity, the smaller amount of information WiredTiger
             need to maintain''',
             min='4KB', max='2GB'),
+        Config('parallel', 'false', r'''
+            configure a duplicate incremental backup cursor to return work units from a queue
+            shared by all parallel cursors duplicated from the same primary backup cursor. Each
+            work unit is a file name plus the offset, size and type information returned by a
+            \c file duplicate cursor, and no two cursors return the same unit. Parallel cursors
+            may be opened in different sessions and used concurrently, and must be closed before
+            the primary backup cursor''',
+            type='boolean'),
+        Config('return_data', 'false', r'''
+            configure a duplicate incremental backup cursor to return the contents of each
+            \c WT_BACKUP_RANGE as the cursor's value, read directly into memory owned by the
+            cursor. The value is empty for \c WT_BACKUP_FILE, which must be copied by the
+            application''',
+            type='boolean'),
         Config('src_id', '', r'''
             a string that identifies a previous checkpoint backup source as the source of this
             incremental backup. This identifier must have already been created by use of the
@@ -1491,6 +1698,16 @@ methods = {
             incremental backup cursor and an error will be returned if one is not provided.
             The identifiers can be any text string, but should be unique'''),
         ]),
+    Config('index_batch', '0', r'''
+        for table cursors on tables with indices, buffer up to the specified number of index
+        updates made in an explicit transaction rather than applying them as part of each
+        operation. Buffered updates are applied in index key order when the buffer fills, when
+        the cursor is reset or closed, and before the transaction commits or is prepared; they
+        are discarded if the transaction rolls back. Until they are applied, buffered index
+        entries are not visible to index cursors in the same transaction, and write conflicts
+        on them are reported when they are applied. Indices with custom extractors are always
+        updated as part of each operation. The default of 0 disables buffering''',
+        min='0', max='1M'),
     Config('next_random', 'false', r'''
         configure the cursor to return a pseudo-random record from the object when the
         WT_CURSOR::next method is called; valid only for row-store cursors. See @ref cursor_random
@@ -1556,6 +1773,10 @@ methods = {
     Config('force', 'false', r'''
         force salvage even of files that do not appear to be WiredTiger files''',
         type='boolean'),
+    Config('threads', '1', r'''
+        the number of threads used to scan the file. Additional threads read, decompress and
+        check blocks ahead of the salvage scan, which still processes blocks in file order''',
+        min='1', max='32'),
 ]),
 
 'WT_SESSION.flush_tier' : Method([
@@ -1626,6 +1847,11 @@ methods = {
         Treat any verification problem as an error; by default, verify will warn, but not fail,
         in the case of errors that won't affect future behavior (for example, a leaked block)''',
         type='boolean'),
+    Config('threads', '1', r'''
+        the number of threads used to verify each file. Additional threads read and check the
+        physical structure of leaf pages ahead of the verification traversal, key order and
+        block extent checks are done by the verifying thread''',
+        min='1', max='32'),
 ]),
 
 'WT_SESSION.begin_transaction' : Method([
@@ -1840,6 +2066,8 @@ methods = {
         print log information''', type='boolean'),
     Config('sessions', 'false', r'''
         print open session information''', type='boolean'),
+    Config('trace', 'false', r'''
+        write the event tracing buffers to a file, see @ref event_tracing''', type='boolean'),
     Config('txn', 'false', r'''
         print global txn information''', type='boolean'),
 ]),
@@ -7,7 +7,7 @@ from operator import attrgetter
 
 # Read the source files.
 from stat_data import groups, dsrc_stats, conn_stats, conn_dsrc_stats, join_stats, \
-    session_stats
+    session_stats, session_waits_stats
 
 ##########################################
 # Check for duplicate stat descriptions:
@@ -25,6 +25,7 @@ check_unique_description(conn_stats)
 check_unique_description(dsrc_stats)
 check_unique_description(session_stats)
 check_unique_description(join_stats)
+check_unique_description(session_waits_stats)
 check_unique_description(conn_dsrc_stats)
 
 # Statistic categories need to be sorted in order to generate a valid statistics JSON file.
@@ -64,6 +65,7 @@ for line in open('../src/include/stat.h', 'r'):
         print_struct('data sources', 'dsrc', 2000, sorted_dsrc_statistics)
         print_struct('join cursors', 'join', 3000, join_stats)
         print_struct('session', 'session', 4000, session_stats)
+        print_struct('session wait events', 'session_waits', 5000, session_waits_stats)
 f.close()
 format_srcfile(tmp_file)
 compare_srcfile(tmp_file, '../src/include/stat.h')
@@ -128,6 +130,15 @@ def print_defines():
  */
 ''')
     print_defines_one('SESSION', 4000, session_stats)
+    f.write('''
+/*!
+ * @}
+ * @name Statistics for session wait events
+ * @anchor statistics_session_waits
+ * @{
+ */
+''')
+    print_defines_one('SESSION_WAITS', 5000, session_waits_stats)
     f.write('/*! @} */\n')
 
 # Update the #defines in the wiredtiger.in file.
@@ -213,7 +224,7 @@ __wt_stat_''' + name + '_clear_single(WT_' + name.upper() + '''_STATS *stats)
             f.write('\tstats->' + l.name + ' = 0;\n')
     f.write('}\n')
 
-    if name != 'session':
+    if name not in ['session', 'session_waits']:
         f.write('''
 void
 __wt_stat_''' + name + '_clear_all(WT_' + name.upper() + '''_STATS **stats)
@@ -244,7 +255,7 @@ __wt_stat_''' + name + '''_aggregate_single(
             f.write(o)
         f.write('}\n')
 
-    if name != 'session':
+    if name not in ['session', 'session_waits']:
         f.write('''
 void
 __wt_stat_''' + name + '''_aggregate(
@@ -282,6 +293,7 @@ print_func('dsrc', 'WT_DATA_HANDLE', sorted_dsrc_statistics)
 print_func('connection', 'WT_CONNECTION_IMPL', sorted_conn_stats)
 print_func('join', None, join_stats)
 print_func('session', None, session_stats)
+print_func('session_waits', None, session_waits_stats)
 f.close()
 format_srcfile(tmp_file)
 compare_srcfile(tmp_file, '../src/support/stat.c')
@@ -84,6 +84,11 @@ class JoinStat(Stat):
     prefix = 'join'
     def __init__(self, name, desc, flags=''):
         Stat.__init__(self, name, JoinStat.prefix, desc, flags)
+class LatencyStat(Stat):
+    prefix = 'latency'
+    def __init__(self, name, desc, flags=''):
+        flags += ',no_clear,no_scale'
+        Stat.__init__(self, name, LatencyStat.prefix, desc, flags)
 class LockStat(Stat):
     prefix = 'lock'
     def __init__(self, name, desc, flags=''):
@@ -112,6 +117,10 @@ class SessionOpStat(Stat):
     prefix = 'session'
     def __init__(self, name, desc, flags=''):
         Stat.__init__(self, name, SessionOpStat.prefix, desc, flags)
+class SessionWaitStat(Stat):
+    prefix = 'session-wait'
+    def __init__(self, name, desc, flags=''):
+        Stat.__init__(self, name, SessionWaitStat.prefix, desc, flags)
 class StorageStat(Stat):
     prefix = 'session'
     def __init__(self, name, desc, flags=''):
@@ -154,6 +163,7 @@ groups['system'] = [
     CapacityStat.prefix,
     ConnStat.prefix,
     DhandleStat.prefix,
+    LatencyStat.prefix,
     PerfHistStat.prefix,
     SessionOpStat.prefix,
     ThreadStat.prefix
@@ -216,6 +226,7 @@ conn_stats = [
     ##########################################
     BlockStat('block_byte_map_read', 'mapped bytes read', 'size'),
     BlockStat('block_byte_read', 'bytes read', 'size'),
+    BlockStat('block_byte_read_direct', 'bytes read via direct I/O', 'size'),
     BlockStat('block_byte_read_mmap', 'bytes read via memory map API', 'size'),
     BlockStat('block_byte_read_syscall', 'bytes read via system call API', 'size'),
     BlockStat('block_byte_write', 'bytes written', 'size'),
@@ -313,12 +324,14 @@ conn_stats = [
     # Capacity statistics
     ##########################################
     CapacityStat('capacity_bytes_ckpt', 'bytes written for checkpoint'),
+    CapacityStat('capacity_bytes_compact', 'bytes written for compaction'),
     CapacityStat('capacity_bytes_evict', 'bytes written for eviction'),
     CapacityStat('capacity_bytes_log', 'bytes written for log'),
     CapacityStat('capacity_bytes_read', 'bytes read'),
     CapacityStat('capacity_bytes_written', 'bytes written total'),
     CapacityStat('capacity_threshold', 'threshold to call fsync'),
     CapacityStat('capacity_time_ckpt', 'time waiting during checkpoint (usecs)'),
+    CapacityStat('capacity_time_compact', 'time waiting during compaction (usecs)'),
     CapacityStat('capacity_time_evict', 'time waiting during eviction (usecs)'),
     CapacityStat('capacity_time_log', 'time waiting during logging (usecs)'),
     CapacityStat('capacity_time_read', 'time waiting during read (usecs)'),
@@ -339,6 +352,9 @@ conn_stats = [
     CursorStat('cursor_modify', 'cursor modify calls'),
     CursorStat('cursor_modify_bytes', 'cursor modify key and value bytes affected', 'size'),
     CursorStat('cursor_modify_bytes_touch', 'cursor modify value bytes modified', 'size'),
+    CursorStat('cursor_index_batch_apply', 'cursor table index update batches applied'),
+    CursorStat('cursor_index_batch_cancel', 'cursor table index updates cancelled in a batch'),
+    CursorStat('cursor_index_batch_ops', 'cursor table index updates batched'),
     CursorStat('cursor_next', 'cursor next calls'),
     CursorStat('cursor_prev', 'cursor prev calls'),
     CursorStat('cursor_remove', 'cursor remove calls'),
@@ -369,6 +385,8 @@ conn_stats = [
     ##########################################
     DhandleStat('dh_conn_handle_count', 'connection data handles currently active', 'no_clear,no_scale'),
     DhandleStat('dh_conn_handle_size', 'connection data handle size', 'no_clear,no_scale,size'),
+    DhandleStat('dh_conn_lockfree_find', 'connection data handle lock-free lookups'),
+    DhandleStat('dh_conn_lockfree_miss', 'connection data handle lock-free lookups that fell back to the handle list lock'),
     DhandleStat('dh_session_handles', 'session dhandles swept'),
     DhandleStat('dh_session_sweeps', 'session sweep attempts'),
     DhandleStat('dh_sweep_close', 'connection sweep dhandles closed'),
@@ -378,6 +396,20 @@ conn_stats = [
     DhandleStat('dh_sweep_tod', 'connection sweep time-of-death sets'),
     DhandleStat('dh_sweeps', 'connection sweeps'),
 
+    ##########################################
+    # Latency histogram statistics
+    ##########################################
+    LatencyStat('latency_log_sync_p50', 'log sync 50th percentile (nsecs)'),
+    LatencyStat('latency_log_sync_p90', 'log sync 90th percentile (nsecs)'),
+    LatencyStat('latency_log_sync_p99', 'log sync 99th percentile (nsecs)'),
+    LatencyStat('latency_log_sync_p999', 'log sync 99.9th percentile (nsecs)'),
+    LatencyStat('latency_log_sync_max', 'log sync maximum (nsecs)'),
+    LatencyStat('latency_txn_commit_p50', 'transaction commit 50th percentile (nsecs)'),
+    LatencyStat('latency_txn_commit_p90', 'transaction commit 90th percentile (nsecs)'),
+    LatencyStat('latency_txn_commit_p99', 'transaction commit 99th percentile (nsecs)'),
+    LatencyStat('latency_txn_commit_p999', 'transaction commit 99.9th percentile (nsecs)'),
+    LatencyStat('latency_txn_commit_max', 'transaction commit maximum (nsecs)'),
+
     ##########################################
     # Locking statistics
     ##########################################
@@ -518,6 +550,15 @@ conn_stats = [
     ##########################################
     # Session operations
     ##########################################
+    SessionOpStat('session_background_compact_bytes_recovered', 'background compact recovered bytes', 'no_scale,size'),
+    SessionOpStat('session_background_compact_excluded', 'background compact skipped excluded objects'),
+    SessionOpStat('session_background_compact_fail', 'background compact failed calls', 'no_clear,no_scale'),
+    SessionOpStat('session_background_compact_interrupted', 'background compact interrupted by shutdown or reconfiguration', 'no_clear,no_scale'),
+    SessionOpStat('session_background_compact_passes', 'background compact server passes'),
+    SessionOpStat('session_background_compact_running', 'background compact running', 'no_clear,no_scale'),
+    SessionOpStat('session_background_compact_skipped', 'background compact skipped as process would not reduce file size', 'no_clear,no_scale'),
+    SessionOpStat('session_background_compact_success', 'background compact successful calls', 'no_clear,no_scale'),
+    SessionOpStat('session_background_compact_yield_eviction', 'background compact yielded to eviction'),
     SessionOpStat('session_open', 'open session count', 'no_clear,no_scale'),
     SessionOpStat('session_query_ts', 'session query timestamp calls'),
     SessionOpStat('session_table_alter_fail', 'table alter failed calls', 'no_clear,no_scale'),
@@ -554,6 +595,8 @@ conn_stats = [
     StorageStat('flush_tier_switched', 'flush_tier tables switched'),
     StorageStat('local_objects_inuse', 'attempts to remove a local object and the object is in use'),
     StorageStat('local_objects_removed', 'local objects removed'),
+    StorageStat('tiered_flush_parts', 'tiered multipart flush parts copied'),
+    StorageStat('tiered_flush_multipart', 'tiered multipart flushes started'),
     StorageStat('tiered_retention', 'tiered storage local retention time (secs)', 'no_clear,no_scale,size'),
     StorageStat('tiered_work_units_created', 'tiered operations scheduled'),
     StorageStat('tiered_work_units_dequeued', 'tiered operations dequeued and processed'),
@@ -680,9 +723,11 @@ dsrc_stats = [
     BtreeStat('btree_column_rle', 'column-store variable-size RLE encoded values', 'no_scale,tree_walk'),
     BtreeStat('btree_column_tws', 'column-store fixed-size time windows', 'no_scale,tree_walk'),
     BtreeStat('btree_column_variable', 'column-store variable-size leaf pages', 'no_scale,tree_walk'),
+    BtreeStat('btree_compact_bytes_rewritten', 'btree compact bytes rewritten', 'no_clear,no_scale,size'),
     BtreeStat('btree_compact_pages_reviewed', 'btree compact pages reviewed', 'no_clear,no_scale'),
     BtreeStat('btree_compact_pages_rewritten', 'btree compact pages rewritten', 'no_clear,no_scale'),
     BtreeStat('btree_compact_pages_skipped', 'btree compact pages skipped', 'no_clear,no_scale'),
+    BtreeStat('btree_compact_pages_time_to_live', 'btree compact pages marked for rewrite to remove expired records', 'no_clear,no_scale'),
     BtreeStat('btree_compact_skipped', 'btree skipped by compaction as process would not reduce size', 'no_clear,no_scale'),
     BtreeStat('btree_entries', 'number of key/value pairs', 'no_scale,tree_walk'),
     BtreeStat('btree_fixed_len', 'fixed-record size', 'max_aggregate,no_scale,size'),
@@ -784,6 +829,15 @@ dsrc_stats = [
     LSMStat('lsm_chunk_count', 'chunks in the LSM tree', 'no_scale'),
     LSMStat('lsm_generation_max', 'highest merge generation in the LSM tree', 'max_aggregate,no_scale'),
     LSMStat('lsm_lookup_no_bloom', 'queries that could have benefited from a Bloom filter that did not exist'),
+    LSMStat('lsm_merge_bytes_flushed', 'bytes written by chunk flushes', 'size'),
+    LSMStat('lsm_merge_bytes_read', 'bytes read by merges', 'size'),
+    LSMStat('lsm_merge_bytes_written', 'bytes written by merges', 'size'),
+    LSMStat('lsm_merge_count', 'merges completed'),
+    LSMStat('lsm_merge_partitions', 'merge partitions written'),
+    LSMStat('lsm_merge_rows', 'rows written by merges'),
+    LSMStat('lsm_merge_throughput', 'merge throughput in bytes per second', 'no_clear,no_scale'),
+    LSMStat('lsm_merge_time', 'merge time (msecs)'),
+    LSMStat('lsm_merge_write_amplification', 'merge write amplification (bytes written per 100 bytes flushed)', 'no_clear,no_scale'),
 
     ##########################################
     # Reconciliation statistics
@@ -900,6 +954,11 @@ conn_dsrc_stats = [
     CursorStat('cursor_bounds_search_near_repositioned_cursor', 'cursor bounds search near call repositioned cursor'),
     CursorStat('cursor_bounds_next_unpositioned', 'cursor bounds next called on an unpositioned cursor'),
     CursorStat('cursor_bounds_prev_unpositioned', 'cursor bounds prev called on an unpositioned cursor'),
+    CursorStat('cursor_filter_key_skip', 'cursor next and prev entries skipped by the key filter'),
+    CursorStat('cursor_filter_value_skip', 'cursor next and prev entries skipped by the value filter'),
+    CursorStat('cursor_insert_index_build', 'cursor insert list search indexes built'),
+    CursorStat('cursor_insert_index_hit', 'cursor searches found in an insert list search index'),
+    CursorStat('cursor_insert_index_miss', 'cursor searches not found in an insert list search index'),
     CursorStat('cursor_next_hs_tombstone', 'cursor next calls that skip due to a globally visible history store tombstone'),
     CursorStat('cursor_next_skip_lt_100', 'cursor next calls that skip greater than 1 and fewer than 100 entries'),
     CursorStat('cursor_next_skip_ge_100', 'cursor next calls that skip greater than or equal to 100 entries'),
@@ -948,6 +1007,35 @@ conn_dsrc_stats = [
     CheckpointCleanupStat('cc_pages_visited', 'pages visited'),
     CheckpointCleanupStat('cc_pages_walk_skipped', 'pages skipped during tree walk'),
 
+    ##########################################
+    # Latency histogram statistics
+    ##########################################
+    LatencyStat('latency_cursor_insert_p50', 'cursor insert 50th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_insert_p90', 'cursor insert 90th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_insert_p99', 'cursor insert 99th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_insert_p999', 'cursor insert 99.9th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_insert_max', 'cursor insert maximum (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_remove_p50', 'cursor remove 50th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_remove_p90', 'cursor remove 90th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_remove_p99', 'cursor remove 99th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_remove_p999', 'cursor remove 99.9th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_remove_max', 'cursor remove maximum (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_search_p50', 'cursor search 50th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_search_p90', 'cursor search 90th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_search_p99', 'cursor search 99th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_search_p999', 'cursor search 99.9th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_search_max', 'cursor search maximum (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_update_p50', 'cursor update 50th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_update_p90', 'cursor update 90th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_update_p99', 'cursor update 99th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_update_p999', 'cursor update 99.9th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_cursor_update_max', 'cursor update maximum (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_evict_app_p50', 'application thread page eviction 50th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_evict_app_p90', 'application thread page eviction 90th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_evict_app_p99', 'application thread page eviction 99th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_evict_app_p999', 'application thread page eviction 99.9th percentile (nsecs)', 'max_aggregate'),
+    LatencyStat('latency_evict_app_max', 'application thread page eviction maximum (nsecs)', 'max_aggregate'),
+
     ##########################################
     # LSM statistics
     ##########################################
@@ -957,6 +1045,7 @@ conn_dsrc_stats = [
     ##########################################
     # Reconciliation statistics
     ##########################################
+    RecStat('rec_bulk_offload_pages', 'bulk-load pages written by write offload threads'),
     RecStat('rec_page_delete', 'pages deleted'),
     RecStat('rec_page_delete_fast', 'fast-path pages deleted'),
     RecStat('rec_pages', 'page reconciliation calls'),
@@ -968,6 +1057,8 @@ conn_dsrc_stats = [
     RecStat('rec_time_aggr_newest_txn', 'pages written including an aggregated newest transaction ID '),
     RecStat('rec_time_aggr_oldest_start_ts', 'pages written including an aggregated oldest start timestamp '),
     RecStat('rec_time_aggr_prepared', 'pages written including an aggregated prepare'),
+    RecStat('rec_time_to_live_bytes', 'bytes reclaimed from records removed after their time-to-live expired', 'size'),
+    RecStat('rec_time_to_live_expired', 'records removed after their time-to-live expired'),
     RecStat('rec_time_window_bytes_ts', 'approximate byte size of timestamps in pages written'),
     RecStat('rec_time_window_bytes_txn', 'approximate byte size of transaction IDs in pages written'),
     RecStat('rec_time_window_durable_start_ts', 'records written including a start durable timestamp'),
@@ -1013,6 +1104,8 @@ join_stats = [
     JoinStat('iterated', 'items iterated'),
     JoinStat('main_access', 'accesses to the main table'),
     JoinStat('membership_check', 'checks that conditions of membership are satisfied'),
+    JoinStat('set_insert', 'items inserted into a set'),
+    JoinStat('set_result', 'items in the set after combining with previous joins'),
 ]
 
 join_stats = sorted(join_stats, key=attrgetter('desc'))
@@ -1032,3 +1125,29 @@ session_stats = [
 ]
 
 session_stats = sorted(session_stats, key=attrgetter('desc'))
+
+##########################################
+# Session wait event statistics
+##########################################
+session_waits_stats = [
+    SessionWaitStat('cache_eviction_count', 'cache eviction waits'),
+    SessionWaitStat('cache_eviction_current', 'cache eviction current wait time (usecs)', 'no_clear,no_scale'),
+    SessionWaitStat('cache_eviction_time', 'cache eviction wait time (usecs)'),
+    SessionWaitStat('capacity_count', 'capacity throttle waits'),
+    SessionWaitStat('capacity_current', 'capacity throttle current wait time (usecs)', 'no_clear,no_scale'),
+    SessionWaitStat('capacity_time', 'capacity throttle wait time (usecs)'),
+    SessionWaitStat('checkpoint_gather_count', 'checkpoint handle gathering waits'),
+    SessionWaitStat('checkpoint_gather_current', 'checkpoint handle gathering current wait time (usecs)', 'no_clear,no_scale'),
+    SessionWaitStat('checkpoint_gather_time', 'checkpoint handle gathering wait time (usecs)'),
+    SessionWaitStat('dhandle_lock_count', 'data handle lock waits'),
+    SessionWaitStat('dhandle_lock_current', 'data handle lock current wait time (usecs)', 'no_clear,no_scale'),
+    SessionWaitStat('dhandle_lock_time', 'data handle lock wait time (usecs)'),
+    SessionWaitStat('log_slot_count', 'log slot join waits'),
+    SessionWaitStat('log_slot_current', 'log slot join current wait time (usecs)', 'no_clear,no_scale'),
+    SessionWaitStat('log_slot_time', 'log slot join wait time (usecs)'),
+    SessionWaitStat('page_lock_count', 'page lock waits'),
+    SessionWaitStat('page_lock_current', 'page lock current wait time (usecs)', 'no_clear,no_scale'),
+    SessionWaitStat('page_lock_time', 'page lock wait time (usecs)'),
+]
+
+session_waits_stats = sorted(session_waits_stats, key=attrgetter('desc'))
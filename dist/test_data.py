@@ -149,6 +149,24 @@ metrics_monitor = enabled_config_true + component_config + [
         type='category', subconfig=stat_config),
 ]
 
+#
+# Configuration that applies to the perf_monitor component, which records the throughput and latency
+# of the operations performed by the workload threads.
+#
+perf_monitor = enabled_config_false + component_config + [
+    Config('baseline', '""', r'''
+        The file containing the baseline results the test's results are compared to. Results worse
+        than their baseline by more than the tolerance are reported. If empty, the results are
+        recorded but not compared.'''),
+    Config('enforce', 'false', r'''
+        Fail the test if a result is worse than its baseline by more than the tolerance. Baselines
+        depend on the machine they were recorded on, only enforce them on that class of machine.''',
+        type='boolean'),
+    Config('tolerance', 10, r'''
+        The percentage a result can be worse than its baseline before it's reported.''',
+        min=0, max=100),
+]
+
 #
 # Configuration that applies to the timestamp_manager component.
 #
@@ -205,6 +223,9 @@ test_config = [
     Config('metrics_monitor', '', r'''
         Configuration options for the metrics_monitor''',
         type='category', subconfig=metrics_monitor),
+    Config('perf_monitor', '', r'''
+        Configuration options for the perf_monitor''',
+        type='category', subconfig=perf_monitor),
     Config('timestamp_manager', '', r'''
         Configuration options for the timestamp manager''',
         type='category', subconfig=timestamp_manager),
@@ -244,6 +265,7 @@ test_config = [
 # Test and their respective configuration sorted alphabetically.
 #
 methods = {
+    'bounded_cursor_filter_perf' : Method(test_config),
     'bounded_cursor_perf' : Method(test_config),
     'bounded_cursor_prefix_indices' : Method(test_config),
     'bounded_cursor_prefix_search_near' : Method(test_config),
@@ -257,6 +279,10 @@ methods = {
     'cache_resize' : Method(test_config),
     'hs_cleanup' : Method(test_config),
     'operations_test' : Method(test_config),
+    'perf_many_tables' : Method(test_config),
+    'perf_point_read' : Method(test_config),
+    'perf_scan' : Method(test_config),
+    'perf_update_history' : Method(test_config),
     'reverse_split' : Method(test_config),
     'search_near_01' : Method(test_config + [
         Config("search_near_threads", 10, r'''
@@ -82,6 +82,9 @@ typedef struct {
     uint32_t force_error; /* Force a simulated network error every N operations */
     uint32_t verbose;     /* Verbose level */
 
+    uint32_t transfer_part_size; /* Size of the ranges copied in parallel */
+    uint32_t transfer_threads;   /* Threads copying an object */
+
     /*
      * Statistics are collected but not yet exposed.
      */
@@ -109,14 +112,49 @@ typedef struct {
     char *bucket_dir;     /* Directory that stands in for cloud storage bucket */
     char *cache_dir;      /* Directory for cached objects */
     const char *home_dir; /* Owned by the connection */
+
+    uint32_t cache_chunk_size; /* Size of the ranges cached on demand, 0 to cache whole objects */
+    uint32_t cache_prefetch;   /* Chunks read ahead when a chunk is cached on demand */
 } DIR_STORE_FILE_SYSTEM;
 
+/*
+ * A file copied in ranges by several threads: each thread claims the next range and copies it.
+ */
+typedef struct {
+    int src_fd;  /* Source file */
+    int dest_fd; /* Destination file */
+
+    wt_off_t file_size;  /* Size of the file */
+    wt_off_t part_size;  /* Size of a range */
+    wt_off_t next_range; /* Offset of the next range to copy */
+    int ret;             /* First error */
+
+    pthread_mutex_t lock; /* Protects the next range and error */
+} DIR_STORE_COPY;
+
 typedef struct dir_store_file_handle {
     WT_FILE_HANDLE iface; /* Must come first */
 
     DIR_STORE *dir_store; /* Enclosing storage source */
     WT_FILE_HANDLE *fh;   /* File handle */
 
+    /*
+     * A partially cached object: the cache file is sparse, chunks are read from the bucket the
+     * first time they're read and the map records the chunks present in the cache file.
+     */
+    bool partial;               /* Object is cached on demand */
+    pthread_mutex_t cache_lock; /* Protects the map */
+    int bucket_fd;              /* Object in the bucket, closed once fully cached */
+    int cache_fd;               /* Cache file */
+    int map_fd;                 /* Map file */
+    char *map_path;             /* Map file path */
+    uint8_t *chunk_map;         /* Map of the chunks present in the cache file */
+    uint32_t chunk_size;        /* Size of a chunk */
+    uint32_t prefetch;          /* Chunks read ahead when a chunk is cached */
+    uint32_t chunks;            /* Chunks in the object */
+    uint32_t chunks_cached;     /* Chunks present in the cache file */
+    wt_off_t object_size;       /* Size of the object */
+
     TAILQ_ENTRY(dir_store_file_handle) q; /* Queue of handles */
 } DIR_STORE_FILE_HANDLE;
 
@@ -124,6 +162,11 @@ typedef struct dir_store_file_handle {
  * Forward function declarations for internal functions
  */
 static int dir_store_bucket_path(WT_FILE_SYSTEM *, const char *, char **);
+static int dir_store_cache_complete(DIR_STORE *, WT_SESSION *, DIR_STORE_FILE_HANDLE *);
+static int dir_store_cache_fetch(
+  DIR_STORE *, WT_SESSION *, DIR_STORE_FILE_HANDLE *, wt_off_t, size_t);
+static int dir_store_cache_open_partial(
+  DIR_STORE *, WT_SESSION *, const char *, const char *, DIR_STORE_FILE_HANDLE *);
 static int dir_store_cache_path(WT_FILE_SYSTEM *, const char *, char **);
 static int dir_store_home_path(WT_FILE_SYSTEM *, const char *, char **);
 static int dir_store_configure(DIR_STORE *, WT_CONFIG_ARG *);
@@ -132,7 +175,12 @@ static int dir_store_delay(DIR_STORE *);
 static int dir_store_err(DIR_STORE *, WT_SESSION *, int, const char *, ...);
 static int dir_store_file_copy(
   DIR_STORE *, WT_SESSION *, const char *, const char *, WT_FS_OPEN_FILE_TYPE, bool);
+static int dir_store_file_copy_parallel(
+  DIR_STORE *, WT_SESSION *, const char *, const char *, wt_off_t);
+static int dir_store_file_copy_range(int, int, wt_off_t, wt_off_t);
 static int dir_store_get_directory(const char *, const char *, ssize_t len, bool, char **);
+static int dir_store_map_path(WT_FILE_SYSTEM *, const char *, char **);
+static int dir_store_part_path(WT_FILE_SYSTEM *, const char *, char **);
 static int dir_store_path(WT_FILE_SYSTEM *, const char *, const char *, char **);
 static int dir_store_stat(
   WT_FILE_SYSTEM *, WT_SESSION *, const char *, const char *, bool, struct stat *);
@@ -145,8 +193,12 @@ static int dir_store_customize_file_system(
   WT_STORAGE_SOURCE *, WT_SESSION *, const char *, const char *, const char *, WT_FILE_SYSTEM **);
 static int dir_store_flush(
   WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *, const char *, const char *, const char *);
+static int dir_store_flush_complete(WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *,
+  const char *, const char *, uint32_t, bool, const char *);
 static int dir_store_flush_finish(
   WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *, const char *, const char *, const char *);
+static int dir_store_flush_part(WT_STORAGE_SOURCE *, WT_SESSION *, WT_FILE_SYSTEM *, const char *,
+  const char *, uint32_t, wt_off_t, size_t, const char *);
 static int dir_store_terminate(WT_STORAGE_SOURCE *, WT_SESSION *);
 
 /*
@@ -209,8 +261,17 @@ dir_store_configure(DIR_STORE *dir_store, WT_CONFIG_ARG *config)
     if ((ret = dir_store_configure_int(
            dir_store, config, "force_error", &dir_store->force_error)) != 0)
         return (ret);
+    if ((ret = dir_store_configure_int(
+           dir_store, config, "transfer_part_size", &dir_store->transfer_part_size)) != 0)
+        return (ret);
+    if ((ret = dir_store_configure_int(
+           dir_store, config, "transfer_threads", &dir_store->transfer_threads)) != 0)
+        return (ret);
     if ((ret = dir_store_configure_int(dir_store, config, "verbose", &dir_store->verbose)) != 0)
         return (ret);
+    if (dir_store->transfer_part_size == 0 || dir_store->transfer_threads == 0)
+        return (dir_store_err(dir_store, NULL, EINVAL,
+          "transfer_part_size and transfer_threads config args must be non-zero"));
 
     return (0);
 }
@@ -392,6 +453,61 @@ dir_store_home_path(WT_FILE_SYSTEM *file_system, const char *name, char **pathp)
       dir_store_path(file_system, ((DIR_STORE_FILE_SYSTEM *)file_system)->home_dir, name, pathp));
 }
 
+/*
+ * dir_store_part_path --
+ *     Construct the pathname of the parts of an object being flushed in parts. The parts are
+ *     written in place into a single file, which is renamed when the flush completes.
+ */
+static int
+dir_store_part_path(WT_FILE_SYSTEM *file_system, const char *name, char **pathp)
+{
+    size_t len;
+    int ret;
+    char *bucket_path, *p;
+
+    *pathp = NULL;
+
+    if ((ret = dir_store_bucket_path(file_system, name, &bucket_path)) != 0)
+        return (ret);
+    len = strlen(bucket_path) + 10;
+    if ((p = malloc(len)) == NULL)
+        ret = dir_store_err(FS2DS(file_system), NULL, ENOMEM, "dir_store_part_path");
+    else if (snprintf(p, len, "%s.PART", bucket_path) >= (int)len) {
+        free(p);
+        ret = dir_store_err(FS2DS(file_system), NULL, EINVAL, "overflow snprintf");
+    } else
+        *pathp = p;
+    free(bucket_path);
+    return (ret);
+}
+
+/*
+ * dir_store_map_path --
+ *     Construct the pathname of the map of the chunks present in a partially cached object.
+ */
+static int
+dir_store_map_path(WT_FILE_SYSTEM *file_system, const char *name, char **pathp)
+{
+    size_t len;
+    int ret;
+    char *cache_path, *p;
+
+    *pathp = NULL;
+
+    if ((ret = dir_store_cache_path(file_system, name, &cache_path)) != 0)
+        return (ret);
+    len = strlen(cache_path) + 10;
+    if ((p = malloc(len)) == NULL)
+        ret = dir_store_err(FS2DS(file_system), NULL, ENOMEM, "dir_store_map_path");
+    else if (snprintf(p, len, "%s.MAP", cache_path) >= (int)len) {
+        free(p);
+        ret = dir_store_err(FS2DS(file_system), NULL, EINVAL, "overflow snprintf");
+    } else
+        *pathp = p;
+    free(cache_path);
+    return (ret);
+}
+
 /*
  * dir_store_path --
  *     Construct a pathname from the file system and dir_store name.
@@ -500,7 +616,7 @@ dir_store_customize_file_system(WT_STORAGE_SOURCE *storage_source, WT_SESSION *s
 {
     DIR_STORE *dir_store;
     DIR_STORE_FILE_SYSTEM *fs;
-    WT_CONFIG_ITEM cachedir;
+    WT_CONFIG_ITEM cachedir, chunk_size, prefetch;
     WT_FILE_SYSTEM *wt_fs;
     int ret;
     const char *p;
@@ -523,6 +639,28 @@ dir_store_customize_file_system(WT_STORAGE_SOURCE *storage_source, WT_SESSION *s
         }
     }
 
+    /* Objects are cached on demand in ranges of the chunk size, if it's configured. */
+    if ((ret = dir_store->wt_api->config_get_string(
+           dir_store->wt_api, session, config, "cache_chunk_size", &chunk_size)) != 0) {
+        if (ret == WT_NOTFOUND) {
+            ret = 0;
+            chunk_size.val = 0;
+        } else {
+            ret = dir_store_err(dir_store, session, ret, "customize_file_system: config parsing");
+            goto err;
+        }
+    }
+    if ((ret = dir_store->wt_api->config_get_string(
+           dir_store->wt_api, session, config, "cache_prefetch", &prefetch)) != 0) {
+        if (ret == WT_NOTFOUND) {
+            ret = 0;
+            prefetch.val = 0;
+        } else {
+            ret = dir_store_err(dir_store, session, ret, "customize_file_system: config parsing");
+            goto err;
+        }
+    }
+
     if ((ret = dir_store->wt_api->file_system_get(dir_store->wt_api, session, &wt_fs)) != 0) {
         ret = dir_store_err(
           dir_store, session, ret, "dir_store_file_system: cannot get WiredTiger file system");
@@ -534,6 +672,8 @@ dir_store_customize_file_system(WT_STORAGE_SOURCE *storage_source, WT_SESSION *s
     }
     fs->dir_store = dir_store;
     fs->wt_fs = wt_fs;
+    fs->cache_chunk_size = (uint32_t)chunk_size.val;
+    fs->cache_prefetch = (uint32_t)prefetch.val;
 
     if ((fs->auth_token = strdup(auth_token)) == NULL) {
         ret = dir_store_err(dir_store, session, ENOMEM, "dir_store_file_system.auth_token");
@@ -624,6 +764,129 @@ dir_store_exist(WT_FILE_SYSTEM *file_system, WT_SESSION *session, const char *na
     return (ret);
 }
 
+/*
+ * dir_store_file_copy_range --
+ *     Copy a range of a file. Returns an error number.
+ */
+static int
+dir_store_file_copy_range(int src_fd, int dest_fd, wt_off_t offset, wt_off_t len)
+{
+    ssize_t n, nr, nw;
+    size_t copy_size;
+    char buffer[1024 * 64];
+
+    for (; len > 0; offset += nr, len -= nr) {
+        copy_size = len < (wt_off_t)sizeof(buffer) ? (size_t)len : sizeof(buffer);
+        if ((nr = pread(src_fd, buffer, copy_size, offset)) <= 0)
+            return (nr == 0 ? EIO : errno);
+        for (nw = 0; nw < nr; nw += n)
+            if ((n = pwrite(dest_fd, buffer + nw, (size_t)(nr - nw), offset + nw)) < 0)
+                return (errno);
+    }
+    return (0);
+}
+
+/*
+ * dir_store_file_copy_thread --
+ *     Copy ranges of a file until there are none left.
+ */
+static void *
+dir_store_file_copy_thread(void *arg)
+{
+    DIR_STORE_COPY *copy;
+    wt_off_t len, offset;
+    int ret;
+
+    copy = arg;
+    for (;;) {
+        (void)pthread_mutex_lock(&copy->lock);
+        offset = copy->next_range;
+        if (copy->ret != 0 || offset >= copy->file_size) {
+            (void)pthread_mutex_unlock(&copy->lock);
+            break;
+        }
+        copy->next_range += copy->part_size;
+        (void)pthread_mutex_unlock(&copy->lock);
+
+        len = copy->file_size - offset < copy->part_size ? copy->file_size - offset :
+                                                           copy->part_size;
+        if ((ret = dir_store_file_copy_range(copy->src_fd, copy->dest_fd, offset, len)) != 0) {
+            (void)pthread_mutex_lock(&copy->lock);
+            if (copy->ret == 0)
+                copy->ret = ret;
+            (void)pthread_mutex_unlock(&copy->lock);
+            break;
+        }
+    }
+    return (NULL);
+}
+
+/*
+ * dir_store_file_copy_parallel --
+ *     Copy a file in ranges, using several threads. This stands in for the ranged parallel gets and
+ *     puts of a cloud object store.
+ */
+static int
+dir_store_file_copy_parallel(DIR_STORE *dir_store, WT_SESSION *session, const char *src_path,
+  const char *dest_path, wt_off_t file_size)
+{
+    DIR_STORE_COPY copy;
+    pthread_t *tids;
+    uint32_t i, nthreads;
+    int ret;
+
+    memset(&copy, 0, sizeof(copy));
+    copy.src_fd = copy.dest_fd = -1;
+    copy.file_size = file_size;
+    copy.part_size = (wt_off_t)dir_store->transfer_part_size;
+    tids = NULL;
+    ret = 0;
+
+    /* The calling thread is one of the copying threads. */
+    nthreads = (uint32_t)((file_size + copy.part_size - 1) / copy.part_size);
+    if (nthreads > dir_store->transfer_threads)
+        nthreads = dir_store->transfer_threads;
+    if ((tids = calloc(nthreads, sizeof(pthread_t))) == NULL)
+        return (ENOMEM);
+    if ((ret = pthread_mutex_init(&copy.lock, NULL)) != 0) {
+        free(tids);
+        return (dir_store_err(dir_store, session, ret, "pthread_mutex_init"));
+    }
+
+    if ((copy.src_fd = open(src_path, O_RDONLY)) < 0) {
+        ret = dir_store_err(dir_store, session, errno, "%s: cannot open for read", src_path);
+        goto err;
+    }
+    if ((copy.dest_fd = open(dest_path, O_WRONLY)) < 0) {
+        ret = dir_store_err(dir_store, session, errno, "%s: cannot open for write", dest_path);
+        goto err;
+    }
+
+    for (i = 1; i < nthreads; ++i)
+        if ((ret = pthread_create(&tids[i], NULL, dir_store_file_copy_thread, &copy)) != 0) {
+            /* Stop the threads already started and don't wait for threads that weren't. */
+            (void)pthread_mutex_lock(&copy.lock);
+            copy.ret = ret;
+            (void)pthread_mutex_unlock(&copy.lock);
+            nthreads = i;
+            break;
+        }
+    (void)dir_store_file_copy_thread(&copy);
+    for (i = 1; i < nthreads; ++i)
+        (void)pthread_join(tids[i], NULL);
+    if ((ret = copy.ret) != 0)
+        ret = dir_store_err(dir_store, session, ret, "%s: cannot copy to %s", src_path, dest_path);
+
+err:
+    if (copy.src_fd >= 0)
+        (void)close(copy.src_fd);
+    if (copy.dest_fd >= 0)
+        (void)close(copy.dest_fd);
+    (void)pthread_mutex_destroy(&copy.lock);
+    free(tids);
+    return (ret);
+}
+
 /*
  * dir_store_file_copy --
  *     Copy a file.
@@ -676,17 +939,23 @@ dir_store_file_copy(DIR_STORE *dir_store, WT_SESSION *session, const char *src_p
         ret = dir_store_err(dir_store, session, ret, "%s: cannot get size", src_path);
         goto err;
     }
-    for (pos = 0, left = file_size; left > 0; pos += copy_size, left -= copy_size) {
-        copy_size = left < (wt_off_t)sizeof(buffer) ? left : (wt_off_t)sizeof(buffer);
-        if ((ret = src->fh_read(src, session, pos, (size_t)copy_size, buffer)) != 0) {
-            ret = dir_store_err(dir_store, session, ret, "%s: cannot read", src_path);
-            goto err;
-        }
-        if ((ret = dest->fh_write(dest, session, pos, (size_t)copy_size, buffer)) != 0) {
-            ret = dir_store_err(dir_store, session, ret, "%s: cannot write", tmp_path);
+    /* Copy larger files in ranges from several threads if configured. */
+    if (dir_store->transfer_threads > 1 && file_size > (wt_off_t)dir_store->transfer_part_size) {
+        if ((ret = dir_store_file_copy_parallel(
+               dir_store, session, src_path, tmp_path, file_size)) != 0)
             goto err;
+    } else
+        for (pos = 0, left = file_size; left > 0; pos += copy_size, left -= copy_size) {
+            copy_size = left < (wt_off_t)sizeof(buffer) ? left : (wt_off_t)sizeof(buffer);
+            if ((ret = src->fh_read(src, session, pos, (size_t)copy_size, buffer)) != 0) {
+                ret = dir_store_err(dir_store, session, ret, "%s: cannot read", src_path);
+                goto err;
+            }
+            if ((ret = dest->fh_write(dest, session, pos, (size_t)copy_size, buffer)) != 0) {
+                ret = dir_store_err(dir_store, session, ret, "%s: cannot write", tmp_path);
+                goto err;
+            }
         }
-    }
     if (ret == 0 && (ret = chmod(tmp_path, 0444)) < 0)
         ret = dir_store_err(dir_store, session, errno, "%s: file_copy chmod failed", tmp_path);
     if ((ret = rename(tmp_path, dest_path)) != 0) {
@@ -708,6 +977,178 @@ err:
     return (ret);
 }
 
+/*
+ * dir_store_cache_open_partial --
+ *     Set up a handle to cache an object on demand. The cache file is created sparse with the size
+ *     of the object, unless an earlier handle left a partially cached object and a map of its
+ *     chunks.
+ */
+static int
+dir_store_cache_open_partial(DIR_STORE *dir_store, WT_SESSION *session, const char *bucket_path,
+  const char *cache_path, DIR_STORE_FILE_HANDLE *dir_store_fh)
+{
+    struct stat sb;
+    uint32_t i;
+    int ret;
+    bool resume;
+
+    dir_store_fh->bucket_fd = dir_store_fh->cache_fd = dir_store_fh->map_fd = -1;
+    if ((ret = pthread_mutex_init(&dir_store_fh->cache_lock, NULL)) != 0)
+        return (dir_store_err(dir_store, session, ret, "%s: pthread_mutex_init", cache_path));
+    dir_store_fh->partial = true;
+
+    if ((dir_store_fh->bucket_fd = open(bucket_path, O_RDONLY)) < 0 ||
+      fstat(dir_store_fh->bucket_fd, &sb) != 0)
+        return (dir_store_err(dir_store, session, errno, "%s: cannot open for read", bucket_path));
+    dir_store_fh->object_size = sb.st_size;
+    dir_store_fh->chunks = (uint32_t)(
+      (dir_store_fh->object_size + dir_store_fh->chunk_size - 1) / dir_store_fh->chunk_size);
+    if ((dir_store_fh->chunk_map = calloc((size_t)dir_store_fh->chunks + 1, 1)) == NULL)
+        return (dir_store_err(dir_store, session, ENOMEM, "%s: chunk map", cache_path));
+
+    /*
+     * Pick up a partially cached object if the map matches the object, otherwise start with an
+     * empty map and cache file. The map is cleared before the cache file is truncated so the map
+     * never claims a chunk the cache file doesn't have.
+     */
+    if ((dir_store_fh->map_fd = open(dir_store_fh->map_path, O_RDWR | O_CREAT, 0644)) < 0 ||
+      fstat(dir_store_fh->map_fd, &sb) != 0)
+        return (
+          dir_store_err(dir_store, session, errno, "%s: cannot open", dir_store_fh->map_path));
+    resume = sb.st_size == (wt_off_t)dir_store_fh->chunks &&
+      (dir_store_fh->cache_fd = open(cache_path, O_RDWR)) >= 0;
+    if (resume) {
+        if (pread(dir_store_fh->map_fd, dir_store_fh->chunk_map, dir_store_fh->chunks, 0) !=
+          (ssize_t)dir_store_fh->chunks)
+            return (
+              dir_store_err(dir_store, session, EIO, "%s: cannot read", dir_store_fh->map_path));
+        for (i = 0; i < dir_store_fh->chunks; ++i)
+            if (dir_store_fh->chunk_map[i] != 0)
+                ++dir_store_fh->chunks_cached;
+    } else {
+        if (ftruncate(dir_store_fh->map_fd, 0) != 0 ||
+          ftruncate(dir_store_fh->map_fd, (wt_off_t)dir_store_fh->chunks) != 0)
+            return (dir_store_err(
+              dir_store, session, errno, "%s: cannot truncate", dir_store_fh->map_path));
+        if ((dir_store_fh->cache_fd = open(cache_path, O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0 ||
+          ftruncate(dir_store_fh->cache_fd, dir_store_fh->object_size) != 0)
+            return (dir_store_err(dir_store, session, errno, "%s: cannot create", cache_path));
+    }
+
+    VERBOSE_LS(dir_store, "Partial cache %s: %" PRIu32 " of %" PRIu32 " chunks cached\n",
+      cache_path, dir_store_fh->chunks_cached, dir_store_fh->chunks);
+
+    if (dir_store_fh->chunks_cached == dir_store_fh->chunks)
+        return (dir_store_cache_complete(dir_store, session, dir_store_fh));
+    return (0);
+}
+
+/*
+ * dir_store_cache_complete --
+ *     All of a partially cached object is in the cache file: remove the map and make the cache file
+ *     look like any other cached object. The map is removed first, a cache file without a map is
+ *     complete.
+ */
+static int
+dir_store_cache_complete(
+  DIR_STORE *dir_store, WT_SESSION *session, DIR_STORE_FILE_HANDLE *dir_store_fh)
+{
+    int ret;
+
+    ret = 0;
+    if (unlink(dir_store_fh->map_path) != 0 && errno != ENOENT)
+        ret = dir_store_err(dir_store, session, errno, "%s: cannot remove", dir_store_fh->map_path);
+    else if (fchmod(dir_store_fh->cache_fd, 0444) != 0)
+        ret = dir_store_err(
+          dir_store, session, errno, "%s: cache chmod failed", dir_store_fh->iface.name);
+
+    (void)close(dir_store_fh->bucket_fd);
+    (void)close(dir_store_fh->cache_fd);
+    (void)close(dir_store_fh->map_fd);
+    dir_store_fh->bucket_fd = dir_store_fh->cache_fd = dir_store_fh->map_fd = -1;
+    return (ret);
+}
+
+/*
+ * dir_store_cache_fetch --
+ *     Make sure a range of a partially cached object is in the cache file, along with any chunks
+ *     configured to be read ahead. Each run of missing chunks is read from the bucket with a single
+ *     ranged read.
+ */
+static int
+dir_store_cache_fetch(DIR_STORE *dir_store, WT_SESSION *session,
+  DIR_STORE_FILE_HANDLE *dir_store_fh, wt_off_t offset, size_t len)
+{
+    wt_off_t end, start;
+    uint32_t first, i, j, last;
+    int ret, t_ret;
+
+    if (len == 0 || offset >= dir_store_fh->object_size)
+        return (0);
+
+    if ((ret = pthread_mutex_lock(&dir_store_fh->cache_lock)) != 0)
+        return (dir_store_err(dir_store, session, ret, "cache fetch: pthread_mutex_lock"));
+
+    if (dir_store_fh->chunks_cached == dir_store_fh->chunks)
+        goto err;
+
+    first = (uint32_t)(offset / dir_store_fh->chunk_size);
+    last = (uint32_t)((offset + (wt_off_t)len - 1) / dir_store_fh->chunk_size);
+    last = last + dir_store_fh->prefetch < dir_store_fh->chunks ? last + dir_store_fh->prefetch :
+      dir_store_fh->chunks - 1;
+
+    for (i = first; i <= last; i = j) {
+        j = i + 1;
+        if (dir_store_fh->chunk_map[i] != 0)
+            continue;
+        while (j <= last && dir_store_fh->chunk_map[j] == 0)
+            ++j;
+
+        start = (wt_off_t)i * dir_store_fh->chunk_size;
+        end = (wt_off_t)j * dir_store_fh->chunk_size;
+        if (end > dir_store_fh->object_size)
+            end = dir_store_fh->object_size;
+        if ((ret = dir_store_delay(dir_store)) != 0)
+            goto err;
+        dir_store->object_reads++;
+        if ((ret = dir_store_file_copy_range(
+               dir_store_fh->bucket_fd, dir_store_fh->cache_fd, start, end - start)) != 0) {
+            ret = dir_store_err(
+              dir_store, session, ret, "%s: cannot cache range", dir_store_fh->iface.name);
+            goto err;
+        }
+
+        /*
+         * Flush the chunks to the cache file before the map records them, the map must never claim
+         * a chunk that could be lost in a crash.
+         */
+        if (fsync(dir_store_fh->cache_fd) != 0) {
+            ret = dir_store_err(
+              dir_store, session, errno, "%s: cannot sync cache", dir_store_fh->iface.name);
+            goto err;
+        }
+        memset(dir_store_fh->chunk_map + i, 1, j - i);
+        if (pwrite(dir_store_fh->map_fd, dir_store_fh->chunk_map + i, j - i, (wt_off_t)i) !=
+          (ssize_t)(j - i)) {
+            ret =
+              dir_store_err(dir_store, session, errno, "%s: cannot write", dir_store_fh->map_path);
+            goto err;
+        }
+        dir_store_fh->chunks_cached += j - i;
+    }
+
+    if (dir_store_fh->chunks_cached == dir_store_fh->chunks)
+        ret = dir_store_cache_complete(dir_store, session, dir_store_fh);
+
+err:
+    if ((t_ret = pthread_mutex_unlock(&dir_store_fh->cache_lock)) != 0) {
+        (void)dir_store_err(dir_store, session, t_ret, "cache fetch: pthread_mutex_unlock");
+        if (ret == 0)
+            ret = t_ret;
+    }
+    return (ret);
+}
+
 /*
  * dir_store_flush --
  *     Return when the file has been flushed.
@@ -749,6 +1190,120 @@ err:
     return (ret);
 }
 
+/*
+ * dir_store_flush_part --
+ *     Copy a part of a file being flushed in parts. The part is written at its offset in the parts
+ *     file, so parts can be copied concurrently and in any order.
+ */
+static int
+dir_store_flush_part(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
+  WT_FILE_SYSTEM *file_system, const char *source, const char *object, uint32_t part,
+  wt_off_t offset, size_t len, const char *config)
+{
+    DIR_STORE *dir_store;
+    int dest_fd, ret, src_fd;
+    char *part_path, *src_path;
+
+    (void)config; /* unused */
+    (void)part;   /* unused, the parts file is written at the part's offset */
+    part_path = src_path = NULL;
+    dest_fd = src_fd = -1;
+    dir_store = (DIR_STORE *)storage_source;
+
+    if (file_system == NULL || source == NULL || object == NULL)
+        return dir_store_err(
+          dir_store, session, EINVAL, "ss_flush_part: required arguments missing");
+
+    if ((ret = dir_store_home_path(file_system, source, &src_path)) != 0)
+        goto err;
+
+    if ((ret = dir_store_part_path(file_system, object, &part_path)) != 0)
+        goto err;
+
+    if ((ret = dir_store_delay(dir_store)) != 0)
+        goto err;
+
+    /*
+     * It is normal and possible that the source file was dropped. Don't print out an error message
+     * in that case, but still return the ENOENT error value.
+     */
+    if ((src_fd = open(src_path, O_RDONLY)) < 0) {
+        ret = errno;
+        if (ret != ENOENT)
+            ret = dir_store_err(dir_store, session, ret, "%s: cannot open for read", src_path);
+        goto err;
+    }
+    if ((dest_fd = open(part_path, O_WRONLY | O_CREAT, 0644)) < 0) {
+        ret = dir_store_err(dir_store, session, errno, "%s: cannot create", part_path);
+        goto err;
+    }
+    if ((ret = dir_store_file_copy_range(src_fd, dest_fd, offset, (wt_off_t)len)) != 0)
+        ret = dir_store_err(
+          dir_store, session, ret, "%s: cannot copy part to %s", src_path, part_path);
+
+    dir_store->object_writes++;
+
+err:
+    if (src_fd >= 0)
+        (void)close(src_fd);
+    if (dest_fd >= 0)
+        (void)close(dest_fd);
+    free(part_path);
+    free(src_path);
+    return (ret);
+}
+
+/*
+ * dir_store_flush_complete --
+ *     Complete a flush in parts by renaming the parts file to the object, or discard the parts.
+ */
+static int
+dir_store_flush_complete(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
+  WT_FILE_SYSTEM *file_system, const char *source, const char *object, uint32_t parts, bool abort,
+  const char *config)
+{
+    DIR_STORE *dir_store;
+    int ret;
+    char *dest_path, *part_path;
+
+    (void)config; /* unused */
+    (void)parts;  /* unused */
+    dest_path = part_path = NULL;
+    dir_store = (DIR_STORE *)storage_source;
+    ret = 0;
+
+    if (file_system == NULL || source == NULL || object == NULL)
+        return dir_store_err(
+          dir_store, session, EINVAL, "ss_flush_complete: required arguments missing");
+
+    if ((ret = dir_store_part_path(file_system, object, &part_path)) != 0)
+        goto err;
+
+    if (abort) {
+        if (unlink(part_path) != 0 && errno != ENOENT)
+            ret = dir_store_err(dir_store, session, errno, "%s: cannot remove", part_path);
+        goto err;
+    }
+
+    if ((ret = dir_store_bucket_path(file_system, object, &dest_path)) != 0)
+        goto err;
+
+    dir_store->op_count++;
+    if (chmod(part_path, 0444) < 0) {
+        ret = dir_store_err(
+          dir_store, session, errno, "%s: ss_flush_complete chmod failed", part_path);
+        goto err;
+    }
+    if (rename(part_path, dest_path) != 0)
+        ret = dir_store_err(
+          dir_store, session, errno, "%s: cannot rename from %s", dest_path, part_path);
+
+err:
+    free(dest_path);
+    free(part_path);
+    return (ret);
+}
+
 /*
  * dir_store_flush_finish --
  *     Cache a file in the new file system.
@@ -759,10 +1314,10 @@ dir_store_flush_finish(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
 {
     DIR_STORE *dir_store;
     int ret;
-    char *dest_path, *src_path;
+    char *dest_path, *map_path, *src_path;
 
     (void)config; /* unused */
-    dest_path = src_path = NULL;
+    dest_path = map_path = src_path = NULL;
     dir_store = (DIR_STORE *)storage_source;
     ret = 0;
 
@@ -779,6 +1334,14 @@ dir_store_flush_finish(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
     if ((ret = dir_store_cache_path(file_system, object, &dest_path)) != 0)
         goto err;
 
+    /* A stale map would make the linked file look partially cached. */
+    if ((ret = dir_store_map_path(file_system, object, &map_path)) != 0)
+        goto err;
+    if (unlink(map_path) != 0 && errno != ENOENT) {
+        ret = dir_store_err(dir_store, session, errno, "%s: cannot remove", map_path);
+        goto err;
+    }
+
     dir_store->op_count++;
     /*
      * Link the object with the original dir_store object. The could be replaced by a file copy if
@@ -795,6 +1358,7 @@ dir_store_flush_finish(WT_STORAGE_SOURCE *storage_source, WT_SESSION *session,
           dir_store_err(dir_store, session, errno, "%s: ss_flush_finish chmod failed", dest_path);
 err:
     free(dest_path);
+    free(map_path);
     free(src_path);
     return (ret);
 }
@@ -989,6 +1553,7 @@ dir_store_open(WT_FILE_SYSTEM *file_system, WT_SESSION *session, const char *nam
     struct stat sb;
     int ret;
     char *bucket_path, *cache_path;
+    bool exist;
 
     ret = 0;
     *file_handlep = NULL;
@@ -1022,17 +1587,41 @@ dir_store_open(WT_FILE_SYSTEM *file_system, WT_SESSION *session, const char *nam
         ret = ENOMEM;
         goto err;
     }
+    file_handle = (WT_FILE_HANDLE *)dir_store_fh;
+    if ((file_handle->name = strdup(name)) == NULL) {
+        ret = ENOMEM;
+        goto err;
+    }
     if (dir_store->cache != 0) {
         if ((ret = dir_store_cache_path(file_system, name, &cache_path)) != 0)
             goto err;
         ret = stat(cache_path, &sb);
-        if (ret != 0) {
-            if (errno != ENOENT) {
-                ret =
-                  dir_store_err(dir_store, session, errno, "%s: dir_store_open stat", cache_path);
+        if (ret != 0 && errno != ENOENT) {
+            ret = dir_store_err(dir_store, session, errno, "%s: dir_store_open stat", cache_path);
+            goto err;
+        }
+        exist = ret == 0;
+        ret = 0;
+
+        /*
+         * If configured, cache the object on demand instead of copying all of it before the first
+         * read. A cache file with a map beside it is partially cached, without a map it's complete.
+         */
+        if (dir_store_fs->cache_chunk_size != 0) {
+            dir_store_fh->chunk_size = dir_store_fs->cache_chunk_size;
+            dir_store_fh->prefetch = dir_store_fs->cache_prefetch;
+            if ((ret = dir_store_map_path(file_system, name, &dir_store_fh->map_path)) != 0)
                 goto err;
+            if (!exist || stat(dir_store_fh->map_path, &sb) == 0) {
+                if ((ret = dir_store_bucket_path(file_system, name, &bucket_path)) != 0)
+                    goto err;
+                if ((ret = dir_store_cache_open_partial(
+                       dir_store, session, bucket_path, cache_path, dir_store_fh)) != 0)
+                    goto err;
+                exist = true;
             }
-
+        }
+        if (!exist) {
             /*
              * The file doesn't exist locally, make a copy of it from the cloud.
              */
@@ -1070,9 +1659,6 @@ dir_store_open(WT_FILE_SYSTEM *file_system, WT_SESSION *session, const char *nam
     dir_store_fh->fh = wt_fh;
     dir_store_fh->dir_store = dir_store;
 
-    /* Initialize public information. */
-    file_handle = (WT_FILE_HANDLE *)dir_store_fh;
-
     /*
      * Setup the function call table for our custom storage source. Set the function pointer to NULL
      * where our implementation doesn't support the functionality.
@@ -1092,10 +1678,6 @@ dir_store_open(WT_FILE_SYSTEM *file_system, WT_SESSION *session, const char *nam
     file_handle->fh_sync_nowait = NULL;
     file_handle->fh_truncate = NULL;
     file_handle->fh_write = dir_store_file_write;
-    if ((file_handle->name = strdup(name)) == NULL) {
-        ret = ENOMEM;
-        goto err;
-    }
 
     if ((ret = pthread_rwlock_wrlock(&dir_store->file_handle_lock)) != 0) {
         (void)dir_store_err(dir_store, session, ret, "ss_open_object: pthread_rwlock_wrlock");
@@ -1147,9 +1729,9 @@ dir_store_remove(WT_FILE_SYSTEM *file_system, WT_SESSION *session, const char *n
 {
     DIR_STORE *dir_store;
     int ret;
-    char *bucket_path, *cache_path;
+    char *bucket_path, *cache_path, *map_path;
 
-    bucket_path = cache_path = NULL;
+    bucket_path = cache_path = map_path = NULL;
     dir_store = ((DIR_STORE_FILE_SYSTEM *)file_system)->dir_store;
     ret = 0;
 
@@ -1159,6 +1741,11 @@ dir_store_remove(WT_FILE_SYSTEM *file_system, WT_SESSION *session, const char *n
             goto err;
         if ((ret = dir_store_remove_if_exists(file_system, session, cache_path, flags)) != 0)
             goto err;
+        /* Remove the map of a partially cached object. */
+        if ((ret = dir_store_map_path(file_system, name, &map_path)) != 0)
+            goto err;
+        if ((ret = dir_store_remove_if_exists(file_system, session, map_path, flags)) != 0)
+            goto err;
     }
 
     /* Check to see if the file exists in the bucket directory before attempting to remove it. */
@@ -1171,6 +1758,7 @@ err:
     free(bucket_path);
     if (cache_path != NULL)
         free(cache_path);
+    free(map_path);
     return (ret);
 }
 
@@ -1315,6 +1903,17 @@ dir_store_file_close_internal(
     if (wt_fh != NULL && (ret = wt_fh->close(wt_fh, session)) != 0)
         ret = dir_store_err(dir_store, session, ret, "WT_FILE_HANDLE->close: close");
 
+    if (dir_store_fh->partial) {
+        if (dir_store_fh->bucket_fd >= 0)
+            (void)close(dir_store_fh->bucket_fd);
+        if (dir_store_fh->cache_fd >= 0)
+            (void)close(dir_store_fh->cache_fd);
+        if (dir_store_fh->map_fd >= 0)
+            (void)close(dir_store_fh->map_fd);
+        (void)pthread_mutex_destroy(&dir_store_fh->cache_lock);
+        free(dir_store_fh->chunk_map);
+    }
+    free(dir_store_fh->map_path);
     free(dir_store_fh->iface.name);
     free(dir_store_fh);
 
@@ -1345,13 +1944,21 @@ static int
 dir_store_file_read(
   WT_FILE_HANDLE *file_handle, WT_SESSION *session, wt_off_t offset, size_t len, void *buf)
 {
+    DIR_STORE *dir_store;
     DIR_STORE_FILE_HANDLE *dir_store_fh;
     WT_FILE_HANDLE *wt_fh;
+    int ret;
 
     dir_store_fh = (DIR_STORE_FILE_HANDLE *)file_handle;
+    dir_store = dir_store_fh->dir_store;
     wt_fh = dir_store_fh->fh;
 
-    dir_store_fh->dir_store->read_ops++;
+    dir_store->read_ops++;
+
+    /* Read any chunks of a partially cached object that aren't in the cache file yet. */
+    if (dir_store_fh->partial &&
+      (ret = dir_store_cache_fetch(dir_store, session, dir_store_fh, offset, len)) != 0)
+        return (ret);
     return (wt_fh->fh_read(wt_fh, session, offset, len, buf));
 }
 
@@ -1431,6 +2038,8 @@ wiredtiger_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
     dir_store->storage_source.ss_customize_file_system = dir_store_customize_file_system;
     dir_store->storage_source.ss_flush = dir_store_flush;
     dir_store->storage_source.ss_flush_finish = dir_store_flush_finish;
+    dir_store->storage_source.ss_flush_part = dir_store_flush_part;
+    dir_store->storage_source.ss_flush_complete = dir_store_flush_complete;
     dir_store->storage_source.terminate = dir_store_terminate;
 
     /*
@@ -1438,9 +2047,13 @@ wiredtiger_extension_init(WT_CONNECTION *connection, WT_CONFIG_ARG *config)
      */
     dir_store->reference_count = 1;
 
-    /* Cache files locally by default */
+    /* Cache files locally by default, copying all of an object before it's read. */
     dir_store->cache = 1;
 
+    /* Copy objects with a single thread by default, in 1MB ranges otherwise. */
+    dir_store->transfer_part_size = 1024 * 1024;
+    dir_store->transfer_threads = 1;
+
     if ((ret = dir_store_configure(dir_store, config)) != 0) {
         free(dir_store);
         return (ret);
@@ -43,6 +43,7 @@ This provides an API similar to the C API, with the following modifications:
   - C Constants starting with WT_STAT_DSRC are instead exposed under wiredtiger.stat.dsrc
   - C Constants starting with WT_STAT_CONN are instead exposed under wiredtiger.stat.conn
   - C Constants starting with WT_STAT_SESSION are instead exposed under wiredtiger.stat.session
+  - C Constants starting with WT_STAT_SESSION_WAITS are instead exposed under wiredtiger.stat.session_waits
 "
 %enddef
 
@@ -1085,6 +1086,18 @@ SIDESTEP_METHOD(__wt_storage_source, ss_flush_finish,
     const char *source, const char *object, const char *config),
   (self, session, file_system, source, object, config))
 
+SIDESTEP_METHOD(__wt_storage_source, ss_flush_part,
+  (WT_SESSION *session, WT_FILE_SYSTEM *file_system,
+    const char *source, const char *object, uint32_t part,
+    wt_off_t offset, size_t len, const char *config),
+  (self, session, file_system, source, object, part, offset, len, config))
+
+SIDESTEP_METHOD(__wt_storage_source, ss_flush_complete,
+  (WT_SESSION *session, WT_FILE_SYSTEM *file_system,
+    const char *source, const char *object, uint32_t parts,
+    bool abort, const char *config),
+  (self, session, file_system, source, object, parts, abort, config))
+
 SIDESTEP_METHOD(__wt_storage_source, terminate,
   (WT_SESSION *session),
   (self, session))
@@ -1531,13 +1544,18 @@ class stat:
 		'''keys for cursors on session statistics'''
 		pass
 
+	class session_waits:
+		'''keys for cursors on session wait event statistics'''
+		pass
+
 ## @}
 
 import sys
 # All names starting with 'WT_STAT_DSRC_' are renamed to
 # the wiredtiger.stat.dsrc class, those starting with 'WT_STAT_CONN' are
 # renamed to the wiredtiger.stat.conn class. All names starting with 'WT_STAT_SESSION'
-# are renamed to the wiredtiger.stat.session class.
+# are renamed to the wiredtiger.stat.session class, except those starting with
+# 'WT_STAT_SESSION_WAITS', which are renamed to the wiredtiger.stat.session_waits class.
 def _rename_with_prefix(prefix, toclass):
 	curmodule = sys.modules[__name__]
 	for name in dir(curmodule):
@@ -1548,6 +1566,7 @@ def _rename_with_prefix(prefix, toclass):
 
 _rename_with_prefix('WT_STAT_CONN_', stat.conn)
 _rename_with_prefix('WT_STAT_DSRC_', stat.dsrc)
+_rename_with_prefix('WT_STAT_SESSION_WAITS_', stat.session_waits)
 _rename_with_prefix('WT_STAT_SESSION_', stat.session)
 _rename_with_prefix('WT_FS_', FileSystem)
 _rename_with_prefix('WT_FILE_HANDLE_', FileHandle)
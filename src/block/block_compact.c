@@ -24,6 +24,7 @@ __wt_block_compact_start(WT_SESSION_IMPL *session, WT_BLOCK *block)
 
     /* Reset the compaction state information. */
     block->compact_pct_tenths = 0;
+    block->compact_bytes_rewritten = 0;
     block->compact_pages_rewritten = 0;
     block->compact_pages_reviewed = 0;
     block->compact_pages_skipped = 0;
@@ -56,7 +57,8 @@ __wt_block_compact_end(WT_SESSION_IMPL *session, WT_BLOCK *block)
  */
 void
 __wt_block_compact_get_progress_stats(WT_SESSION_IMPL *session, WT_BM *bm,
-  uint64_t *pages_reviewedp, uint64_t *pages_skippedp, uint64_t *pages_rewrittenp)
+  uint64_t *pages_reviewedp, uint64_t *pages_skippedp, uint64_t *pages_rewrittenp,
+  uint64_t *bytes_rewrittenp)
 {
     WT_BLOCK *block;
 
@@ -65,6 +67,7 @@ __wt_block_compact_get_progress_stats(WT_SESSION_IMPL *session, WT_BM *bm,
     *pages_reviewedp = block->compact_pages_reviewed;
     *pages_skippedp = block->compact_pages_skipped;
     *pages_rewrittenp = block->compact_pages_rewritten;
+    *bytes_rewrittenp = block->compact_bytes_rewritten;
 }
 
 /*
@@ -101,10 +104,16 @@ __wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp)
 {
     WT_EXT *ext;
     WT_EXTLIST *el;
-    wt_off_t avail_eighty, avail_ninety, eighty, ninety;
+    wt_off_t avail_eighty, avail_ninety, eighty, ninety, target;
 
     *skipp = true; /* Return a default skip. */
 
+    /*
+     * Foreground compaction tries any file where it can recover at least 1MB, the background server
+     * is configured with a larger target so it leaves files alone until the work is worthwhile.
+     */
+    target = (wt_off_t)session->compact->free_space_target;
+
     /*
      * We do compaction by copying blocks from the end of the file to the beginning of the file, and
      * we need some metrics to decide if it's worth doing. Ignore small files, and files where we
@@ -138,7 +147,7 @@ __wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp)
         }
 
     /*
-     * Skip files where we can't recover at least 1MB.
+     * Skip files where we can't recover at least the target amount of space (1MB by default).
      *
      * If at least 20% of the total file is available and in the first 80% of the file, we'll try
      * compaction on the last 20% of the file; else, if at least 10% of the total file is available
@@ -147,10 +156,10 @@ __wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp)
      * We could push this further, but there's diminishing returns, a mostly empty file can be
      * processed quickly, so more aggressive compaction is less useful.
      */
-    if (avail_eighty > WT_MEGABYTE && avail_eighty >= ((block->size / 10) * 2)) {
+    if (avail_eighty > target && avail_eighty >= ((block->size / 10) * 2)) {
         *skipp = false;
         block->compact_pct_tenths = 2;
-    } else if (avail_ninety > WT_MEGABYTE && avail_ninety >= block->size / 10) {
+    } else if (avail_ninety > target && avail_ninety >= block->size / 10) {
         *skipp = false;
         block->compact_pct_tenths = 1;
     }
@@ -270,6 +279,9 @@ __wt_block_compact_page_rewrite(
     if (*skipp)
         return (0);
 
+    /* Compaction reads and rewrites the block, pace it against the configured I/O capacity. */
+    __wt_capacity_throttle(session, size, WT_THROTTLE_COMPACT);
+
     /* Read the block. */
     WT_ERR(__wt_scr_alloc(session, size, &tmp));
     WT_ERR(__wt_read(session, block->fh, offset, size, tmp->mem));
@@ -298,6 +310,7 @@ __wt_block_compact_page_rewrite(
 
     WT_STAT_CONN_INCR(session, block_write);
     WT_STAT_CONN_INCRV(session, block_byte_write, size);
+    block->compact_bytes_rewritten += size;
 
     discard_block = false;
 
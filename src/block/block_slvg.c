@@ -161,6 +161,61 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_block_salvage_peek --
+ *     Return a possible block from the file without changing the salvage state, used to read blocks
+ *     ahead of the salvage scan. Start at the passed-in offset, or at the salvage scan's offset if
+ *     the passed-in offset is negative, and return the offset following the block. The block's
+ *     checksum isn't checked, that happens when the block is read.
+ */
+int
+__wt_block_salvage_peek(WT_SESSION_IMPL *session, WT_BLOCK *block, wt_off_t *offp, uint8_t *addr,
+  size_t *addr_sizep, bool *eofp)
+{
+    WT_BLOCK_HEADER *blk;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    wt_off_t max, offset;
+    uint32_t allocsize, checksum, objectid, size;
+    uint8_t *endp;
+
+    *eofp = false;
+
+    /* Salvage isn't implemented (yet) for tiered trees. */
+    objectid = 0;
+
+    allocsize = block->allocsize;
+    WT_ERR(__wt_scr_alloc(session, allocsize, &tmp));
+
+    if ((offset = *offp) < 0)
+        WT_ORDERED_READ(offset, block->slvg_off);
+    for (max = block->size;; offset += allocsize) {
+        if (offset >= max) { /* Check eof. */
+            *eofp = true;
+            goto done;
+        }
+
+        /* Read the start of a possible page and check the block size is not insane. */
+        WT_ERR(__wt_read(session, block->fh, offset, (size_t)allocsize, tmp->mem));
+        blk = WT_BLOCK_HEADER_REF(tmp->mem);
+        __wt_block_header_byteswap(blk);
+        size = blk->disk_size;
+        checksum = blk->checksum;
+        if (!__wt_block_offset_invalid(block, offset, size))
+            break;
+    }
+
+    endp = addr;
+    WT_ERR(__wt_block_addr_pack(block, &endp, objectid, offset, size, checksum));
+    *addr_sizep = WT_PTRDIFF(endp, addr);
+    *offp = offset + size;
+
+done:
+err:
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
+
 /*
  * __wt_block_salvage_valid --
  *     Let salvage know if a block is valid.
@@ -532,6 +532,17 @@ __bm_salvage_next(
     return (__wt_block_salvage_next(session, bm->block, addr, addr_sizep, eofp));
 }
 
+/*
+ * __bm_salvage_peek --
+ *     Return a possible block from the file without changing the salvage state.
+ */
+static int
+__bm_salvage_peek(WT_BM *bm, WT_SESSION_IMPL *session, wt_off_t *offp, uint8_t *addr,
+  size_t *addr_sizep, bool *eofp)
+{
+    return (__wt_block_salvage_peek(session, bm->block, offp, addr, addr_sizep, eofp));
+}
+
 /*
  * __bm_salvage_start --
  *     Start a block manager salvage.
@@ -788,6 +799,7 @@ __bm_method_set(WT_BM *bm, bool readonly)
     bm->read = __bm_read;
     bm->salvage_end = __bm_salvage_end;
     bm->salvage_next = __bm_salvage_next;
+    bm->salvage_peek = __bm_salvage_peek;
     bm->salvage_start = __bm_salvage_start;
     bm->salvage_valid = __bm_salvage_valid;
     bm->size = __wt_block_manager_size;
@@ -276,20 +276,69 @@ err:
     return (ret);
 }
 
+/*
+ * __compact_ttl_expired --
+ *     Return if most of an on-disk leaf page's records have outlived the tree's time-to-live, based
+ *     on the page's aggregated commit timestamps.
+ */
+static bool
+__compact_ttl_expired(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_ADDR_COPY addr;
+    WT_BTREE *btree;
+    WT_TIME_AGGREGATE *ta;
+    wt_timestamp_t cutoff, pinned_ts;
+
+    btree = S2BT(session);
+    if (btree->ttl_duration == 0 || ref->state != WT_REF_DISK ||
+      !__wt_ref_addr_copy(session, ref, &addr))
+        return (false);
+
+    /* Records committed at or before the cutoff have expired for every reader. */
+    __wt_txn_pinned_timestamp(session, &pinned_ts);
+    if (pinned_ts <= btree->ttl_duration)
+        return (false);
+    cutoff = pinned_ts - btree->ttl_duration;
+
+    /* Assume the page's commit timestamps are evenly spread, and look for half of them expired. */
+    ta = &addr.ta;
+    if (ta->oldest_start_ts > cutoff)
+        return (false);
+    if (ta->newest_start_durable_ts <= cutoff)
+        return (true);
+    return (
+      cutoff - ta->oldest_start_ts >= (ta->newest_start_durable_ts - ta->oldest_start_ts) / 2);
+}
+
 /*
  * __compact_walk_page_skip --
- *     Skip leaf pages, all we want are internal pages.
+ *     Skip leaf pages, all we want are internal pages and leaf pages with mostly expired records.
  */
 static int
 __compact_walk_page_skip(
   WT_SESSION_IMPL *session, WT_REF *ref, void *context, bool visible_all, bool *skipp)
 {
     WT_UNUSED(context);
-    WT_UNUSED(session);
     WT_UNUSED(visible_all);
 
-    /* All we want are the internal pages. */
-    *skipp = F_ISSET(ref, WT_REF_FLAG_LEAF) ? true : false;
+    /* All we want are the internal pages, and leaf pages we can shrink by removing records. */
+    *skipp = F_ISSET(ref, WT_REF_FLAG_LEAF) && !__compact_ttl_expired(session, ref);
+    return (0);
+}
+
+/*
+ * __compact_background_yield --
+ *     Wait for eviction to catch up before the background compaction server pulls more pages into
+ *     the cache.
+ */
+static int
+__compact_background_yield(WT_SESSION_IMPL *session)
+{
+    while (__wt_eviction_needed(session, false, false, NULL)) {
+        WT_STAT_CONN_INCR(session, session_background_compact_yield_eviction);
+        WT_RET(__wt_session_compact_check_timeout(session));
+        __wt_sleep(0, 10 * WT_THOUSAND);
+    }
     return (0);
 }
 
@@ -306,6 +355,7 @@ __wt_compact(WT_SESSION_IMPL *session)
     u_int i, msg_count;
     bool skip;
 
+    uint64_t stats_bytes_rewritten; /* Bytes rewritten */
     uint64_t stats_pages_rewritten; /* Pages rewritten */
     uint64_t stats_pages_reviewed;  /* Pages reviewed */
     uint64_t stats_pages_skipped;   /* Pages skipped */
@@ -330,8 +380,9 @@ __wt_compact(WT_SESSION_IMPL *session)
     for (i = 0;;) {
 
         /* Track progress. */
-        __wt_block_compact_get_progress_stats(
-          session, bm, &stats_pages_reviewed, &stats_pages_skipped, &stats_pages_rewritten);
+        __wt_block_compact_get_progress_stats(session, bm, &stats_pages_reviewed,
+          &stats_pages_skipped, &stats_pages_rewritten, &stats_bytes_rewritten);
+        WT_STAT_DATA_SET(session, btree_compact_bytes_rewritten, stats_bytes_rewritten);
         WT_STAT_DATA_SET(session, btree_compact_pages_reviewed, stats_pages_reviewed);
         WT_STAT_DATA_SET(session, btree_compact_pages_skipped, stats_pages_skipped);
         WT_STAT_DATA_SET(session, btree_compact_pages_rewritten, stats_pages_rewritten);
@@ -359,9 +410,13 @@ __wt_compact(WT_SESSION_IMPL *session)
 
         /*
          * Compact pulls pages into cache during the walk without checking whether the cache is
-         * full. Check now to throttle compact to match eviction speed.
+         * full. Check now to throttle compact to match eviction speed. The background server
+         * doesn't help evict pages, it gets out of the way until eviction has caught up.
          */
-        WT_ERR(__wt_cache_eviction_check(session, false, false, NULL));
+        if (session->compact->background)
+            WT_ERR(__compact_background_yield(session));
+        else
+            WT_ERR(__wt_cache_eviction_check(session, false, false, NULL));
 
         /*
          * Pages read for compaction aren't "useful"; don't update the read generation of pages
@@ -378,9 +433,19 @@ __wt_compact(WT_SESSION_IMPL *session)
          * WT_REF in the WT_REF_DISK state pointing to an internal page, can transition to a leaf
          * page when it is being read in. Handle that here, by re-checking the page type now that
          * the page is in memory.
+         *
+         * Leaf pages are otherwise only returned when most of their records have expired: mark them
+         * dirty so reconciliation removes the expired records and writes new blocks.
          */
-        if (F_ISSET(ref, WT_REF_FLAG_INTERNAL))
+        if (F_ISSET(ref, WT_REF_FLAG_INTERNAL)) {
             WT_WITH_PAGE_INDEX(session, ret = __compact_walk_internal(session, ref));
+        } else if (S2BT(session)->ttl_duration != 0 && !__wt_page_is_modified(ref->page)) {
+            WT_ERR(__wt_page_modify_init(session, ref->page));
+            __wt_page_modify_set(session, ref->page);
+            F_SET_ATOMIC_16(ref->page, WT_PAGE_COMPACTION_WRITE);
+            WT_STAT_DATA_INCR(session, btree_compact_pages_time_to_live);
+            session->compact_state = WT_COMPACT_SUCCESS;
+        }
 
         WT_ERR(ret);
     }
@@ -16,6 +16,7 @@ static inline int
 __cursor_fix_append_next(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
 {
     WT_SESSION_IMPL *session;
+    bool match;
 
     session = CUR2S(cbt);
 
@@ -26,10 +27,15 @@ __cursor_fix_append_next(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
     if (newpage) {
         if ((cbt->ins = WT_SKIP_FIRST(cbt->ins_head)) == NULL)
             return (WT_NOTFOUND);
-    } else if (cbt->recno >= WT_INSERT_RECNO(cbt->ins) &&
-      (cbt->ins = WT_SKIP_NEXT(cbt->ins)) == NULL)
+        goto new_page;
+    }
+
+next:
+    if (cbt->recno >= WT_INSERT_RECNO(cbt->ins) && (cbt->ins = WT_SKIP_NEXT(cbt->ins)) == NULL)
         return (WT_NOTFOUND);
 
+new_page:
+
     /*
      * This code looks different from the cursor-previous code. The append list may be preceded by
      * other rows, which means the cursor's recno will be set to a value and we simply want to
@@ -53,20 +59,21 @@ __cursor_fix_append_next(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
      * we are at the end of the data.
      */
     if (cbt->recno < WT_INSERT_RECNO(cbt->ins)) {
-        cbt->v = 0;
-        cbt->iface.value.data = &cbt->v;
-        cbt->iface.value.size = 1;
+        __col_fix_value_set(cbt, &cbt->iface.value, 0);
     } else {
 restart_read:
         WT_RET(__wt_txn_read_upd_list(session, cbt, cbt->ins->upd));
         if (cbt->upd_value->type == WT_UPDATE_INVALID ||
           cbt->upd_value->type == WT_UPDATE_TOMBSTONE) {
-            cbt->v = 0;
-            cbt->iface.value.data = &cbt->v;
-            cbt->iface.value.size = 1;
+            __col_fix_value_set(cbt, &cbt->iface.value, 0);
         } else
             __wt_value_return(cbt, cbt->upd_value);
     }
+
+    /* If the record doesn't match the iteration filter, move to the next one. */
+    WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+    if (!match)
+        goto next;
     return (0);
 }
 
@@ -77,8 +84,11 @@ restart_read:
 static inline int
 __cursor_fix_next(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
 {
+    WT_INSERT *ins;
     WT_PAGE *page;
     WT_SESSION_IMPL *session;
+    uint64_t last, skipped;
+    bool match;
 
     session = CUR2S(cbt);
     page = cbt->ref->page;
@@ -100,12 +110,33 @@ __cursor_fix_next(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
         goto new_page;
     }
 
+next:
     /* Move to the next entry and return the item. */
     if (cbt->recno >= cbt->last_standard_recno)
         return (WT_NOTFOUND);
     __cursor_set_recno(cbt, cbt->recno + 1);
 
 new_page:
+    /*
+     * Skip on-page values that don't match the iteration filter without reading them one at a time.
+     * Pages without time windows only hold globally visible values, so values can be skipped up to
+     * the next record with updates.
+     */
+    if (cbt->filter != NULL && cbt->filter->value_field != -1 && !WT_COL_FIX_TWS_SET(page)) {
+        ins = __col_insert_search_gt(WT_COL_UPDATE_SINGLE(page), cbt->recno - 1);
+        last = ins == NULL ? cbt->last_standard_recno : WT_INSERT_RECNO(ins) - 1;
+        if (last >= cbt->recno) {
+            skipped = __col_fix_filter_skip(cbt, page->pg_fix_bitf,
+              cbt->recno - cbt->ref->ref_recno, last - cbt->recno + 1, true);
+            cbt->filter_value_skipped += skipped;
+            if (cbt->recno + skipped > cbt->last_standard_recno) {
+                __cursor_set_recno(cbt, cbt->last_standard_recno);
+                return (WT_NOTFOUND);
+            }
+            __cursor_set_recno(cbt, cbt->recno + skipped);
+        }
+    }
+
 restart_read:
     /* We only have one slot. */
     cbt->slot = 0;
@@ -135,12 +166,14 @@ restart_read:
          * produce a zero value depending on the desired end-of-tree semantics. For now, we produce
          * zero so as not to change the preexisting end-of-tree behavior.
          */
-        cbt->v = 0;
-        cbt->iface.value.data = &cbt->v;
-        cbt->iface.value.size = 1;
+        __col_fix_value_set(cbt, &cbt->iface.value, 0);
     } else
         __wt_value_return(cbt, cbt->upd_value);
 
+    /* Updated and history values aren't skipped above, check the value being returned. */
+    WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+    if (!match)
+        goto next;
     return (0);
 }
 
@@ -396,6 +429,7 @@ __cursor_row_next(
     WT_PAGE *page;
     WT_ROW *rip;
     WT_SESSION_IMPL *session;
+    bool match;
 
     key = &cbt->iface.key;
     page = cbt->ref->page;
@@ -458,6 +492,9 @@ restart_read_insert:
                 WT_STAT_CONN_DATA_INCR(session, cursor_bounds_next_early_exit);
             WT_RET(ret);
 
+            if (!__wt_btcur_filter_key(cbt))
+                continue;
+
             WT_RET(__wt_txn_read_upd_list(session, cbt, ins->upd));
             if (cbt->upd_value->type == WT_UPDATE_INVALID) {
                 ++*skippedp;
@@ -471,6 +508,9 @@ restart_read_insert:
                 continue;
             }
             __wt_value_return(cbt, cbt->upd_value);
+            WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+            if (!match)
+                continue;
             return (0);
         }
 
@@ -510,6 +550,10 @@ restart_read_page:
             WT_STAT_CONN_DATA_INCR(session, cursor_bounds_next_early_exit);
         WT_RET(ret);
 
+        /* Skip entries not matching the iteration filter before checking their visibility. */
+        if (!__wt_btcur_filter_key(cbt))
+            continue;
+
         /*
          * Read the on-disk value and/or history. Pass an update list: the update list may contain
          * the base update for a modify chain after rollback-to-stable, required for correctness.
@@ -528,6 +572,9 @@ restart_read_page:
             continue;
         }
         __wt_value_return(cbt, cbt->upd_value);
+        WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+        if (!match)
+            continue;
         return (0);
     }
     /* NOTREACHED */
@@ -771,7 +818,7 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt, bool truncating)
     WT_SESSION_IMPL *session;
     size_t total_skipped, skipped;
     uint32_t flags;
-    bool key_out_of_bounds, newpage, restart, need_walk;
+    bool key_out_of_bounds, match, newpage, restart, need_walk;
 #ifdef HAVE_DIAGNOSTIC
     bool inclusive_set;
 
@@ -804,7 +851,13 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt, bool truncating)
         WT_ERR(__wt_btcur_bounds_position(session, cbt, true, &need_walk));
         if (!need_walk) {
             __wt_value_return(cbt, cbt->upd_value);
-            goto done;
+
+            /* If the record doesn't match the iteration filter, continue from it. */
+            match = __wt_btcur_filter_key(cbt);
+            if (match)
+                WT_ERR(__wt_btcur_filter_value(session, cbt, &match));
+            if (match)
+                goto done;
         }
     }
 
@@ -939,6 +992,12 @@ err:
 
     WT_STAT_CONN_DATA_INCRV(session, cursor_next_skip_total, total_skipped);
 
+    if (cbt->filter != NULL) {
+        WT_STAT_CONN_DATA_INCRV(session, cursor_filter_key_skip, cbt->filter_key_skipped);
+        WT_STAT_CONN_DATA_INCRV(session, cursor_filter_value_skip, cbt->filter_value_skipped);
+        cbt->filter_key_skipped = cbt->filter_value_skipped = 0;
+    }
+
     switch (ret) {
     case 0:
         F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
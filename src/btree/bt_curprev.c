@@ -141,6 +141,7 @@ static inline int
 __cursor_fix_append_prev(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
 {
     WT_SESSION_IMPL *session;
+    bool match;
 
     session = CUR2S(cbt);
 
@@ -152,6 +153,7 @@ __cursor_fix_append_prev(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
         if ((cbt->ins = WT_SKIP_LAST(cbt->ins_head)) == NULL)
             return (WT_NOTFOUND);
     } else {
+next:
         /* Move to the previous record in the append list, if any. */
         if (cbt->ins != NULL && cbt->recno <= WT_INSERT_RECNO(cbt->ins))
             WT_RET(__cursor_skip_prev(cbt));
@@ -197,9 +199,10 @@ __cursor_fix_append_prev(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
      * definition we're starting a new iteration and we set the record number to the last record
      * found on the page. Otherwise, decrement the record.
      */
-    if (newpage)
+    if (newpage) {
         __cursor_set_recno(cbt, WT_INSERT_RECNO(cbt->ins));
-    else
+        newpage = false;
+    } else
         __cursor_set_recno(cbt, cbt->recno - 1);
 
     if (F_ISSET(&cbt->iface, WT_CURSTD_KEY_ONLY))
@@ -214,20 +217,21 @@ __cursor_fix_append_prev(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
      * can be never seen by a read.
      */
     if (cbt->ins == NULL || cbt->recno > WT_INSERT_RECNO(cbt->ins)) {
-        cbt->v = 0;
-        cbt->iface.value.data = &cbt->v;
-        cbt->iface.value.size = 1;
+        __col_fix_value_set(cbt, &cbt->iface.value, 0);
     } else {
 restart_read:
         WT_RET(__wt_txn_read_upd_list(session, cbt, cbt->ins->upd));
         if (cbt->upd_value->type == WT_UPDATE_INVALID ||
           cbt->upd_value->type == WT_UPDATE_TOMBSTONE) {
-            cbt->v = 0;
-            cbt->iface.value.data = &cbt->v;
-            cbt->iface.value.size = 1;
+            __col_fix_value_set(cbt, &cbt->iface.value, 0);
         } else
             __wt_value_return(cbt, cbt->upd_value);
     }
+
+    /* If the record doesn't match the iteration filter, move to the previous one. */
+    WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+    if (!match)
+        goto next;
     return (0);
 }
 
@@ -238,8 +242,11 @@ restart_read:
 static inline int
 __cursor_fix_prev(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
 {
+    WT_INSERT *ins;
     WT_PAGE *page;
     WT_SESSION_IMPL *session;
+    uint64_t first, skipped;
+    bool match;
 
     session = CUR2S(cbt);
     page = cbt->ref->page;
@@ -261,12 +268,34 @@ __cursor_fix_prev(WT_CURSOR_BTREE *cbt, bool newpage, bool restart)
         goto new_page;
     }
 
+next:
     /* Move to the previous entry and return the item. */
     if (cbt->recno == cbt->ref->ref_recno)
         return (WT_NOTFOUND);
     __cursor_set_recno(cbt, cbt->recno - 1);
 
 new_page:
+    /*
+     * Skip on-page values that don't match the iteration filter without reading them one at a time.
+     * Pages without time windows only hold globally visible values, so values can be skipped back
+     * to the previous record with updates.
+     */
+    if (cbt->filter != NULL && cbt->filter->value_field != -1 && !WT_COL_FIX_TWS_SET(page) &&
+      !F_ISSET(&cbt->iface, WT_CURSTD_KEY_ONLY)) {
+        ins = __col_insert_search_lt(WT_COL_UPDATE_SINGLE(page), cbt->recno + 1);
+        first = ins == NULL ? cbt->ref->ref_recno : WT_INSERT_RECNO(ins) + 1;
+        if (first <= cbt->recno) {
+            skipped = __col_fix_filter_skip(cbt, page->pg_fix_bitf,
+              cbt->recno - cbt->ref->ref_recno, cbt->recno - first + 1, false);
+            cbt->filter_value_skipped += skipped;
+            if (cbt->recno - cbt->ref->ref_recno < skipped) {
+                __cursor_set_recno(cbt, cbt->ref->ref_recno);
+                return (WT_NOTFOUND);
+            }
+            __cursor_set_recno(cbt, cbt->recno - skipped);
+        }
+    }
+
 restart_read:
     /* We only have one slot. */
     cbt->slot = 0;
@@ -300,12 +329,14 @@ restart_read:
          * produce a zero value depending on the desired end-of-tree semantics. For now, we produce
          * zero so as not to change the preexisting end-of-tree behavior.
          */
-        cbt->v = 0;
-        cbt->iface.value.data = &cbt->v;
-        cbt->iface.value.size = 1;
+        __col_fix_value_set(cbt, &cbt->iface.value, 0);
     } else
         __wt_value_return(cbt, cbt->upd_value);
 
+    /* Updated and history values aren't skipped above, check the value being returned. */
+    WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+    if (!match)
+        goto next;
     return (0);
 }
 
@@ -572,6 +603,7 @@ __cursor_row_prev(
     WT_PAGE *page;
     WT_ROW *rip;
     WT_SESSION_IMPL *session;
+    bool match;
 
     key = &cbt->iface.key;
     page = cbt->ref->page;
@@ -642,6 +674,9 @@ restart_read_insert:
                 WT_STAT_CONN_DATA_INCR(session, cursor_bounds_prev_early_exit);
             WT_RET(ret);
 
+            if (!__wt_btcur_filter_key(cbt))
+                continue;
+
             WT_RET(__wt_txn_read_upd_list(session, cbt, ins->upd));
             if (cbt->upd_value->type == WT_UPDATE_INVALID) {
                 ++*skippedp;
@@ -655,6 +690,9 @@ restart_read_insert:
                 continue;
             }
             __wt_value_return(cbt, cbt->upd_value);
+            WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+            if (!match)
+                continue;
             return (0);
         }
 
@@ -699,6 +737,10 @@ restart_read_page:
             WT_STAT_CONN_DATA_INCR(session, cursor_bounds_prev_early_exit);
         WT_RET(ret);
 
+        /* Skip entries not matching the iteration filter before checking their visibility. */
+        if (!__wt_btcur_filter_key(cbt))
+            continue;
+
         /*
          * Read the on-disk value and/or history. Pass an update list: the update list may contain
          * the base update for a modify chain after rollback-to-stable, required for correctness.
@@ -717,6 +759,9 @@ restart_read_page:
             continue;
         }
         __wt_value_return(cbt, cbt->upd_value);
+        WT_RET(__wt_btcur_filter_value(session, cbt, &match));
+        if (!match)
+            continue;
         return (0);
     }
     /* NOTREACHED */
@@ -735,7 +780,7 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, bool truncating)
     WT_SESSION_IMPL *session;
     size_t total_skipped, skipped;
     uint32_t flags;
-    bool key_out_of_bounds, newpage, restart, need_walk;
+    bool key_out_of_bounds, match, newpage, restart, need_walk;
 #ifdef HAVE_DIAGNOSTIC
     bool inclusive_set;
 
@@ -769,7 +814,13 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, bool truncating)
         WT_ERR(__wt_btcur_bounds_position(session, cbt, false, &need_walk));
         if (!need_walk) {
             __wt_value_return(cbt, cbt->upd_value);
-            goto done;
+
+            /* If the record doesn't match the iteration filter, continue from it. */
+            match = __wt_btcur_filter_key(cbt);
+            if (match)
+                WT_ERR(__wt_btcur_filter_value(session, cbt, &match));
+            if (match)
+                goto done;
         }
     }
 
@@ -900,6 +951,12 @@ err:
 
     WT_STAT_CONN_DATA_INCRV(session, cursor_prev_skip_total, total_skipped);
 
+    if (cbt->filter != NULL) {
+        WT_STAT_CONN_DATA_INCRV(session, cursor_filter_key_skip, cbt->filter_key_skipped);
+        WT_STAT_CONN_DATA_INCRV(session, cursor_filter_value_skip, cbt->filter_value_skipped);
+        cbt->filter_key_skipped = cbt->filter_value_skipped = 0;
+    }
+
     switch (ret) {
     case 0:
         if (F_ISSET(&cbt->iface, WT_CURSTD_KEY_ONLY))
@@ -177,19 +177,14 @@ __cursor_size_chk(WT_SESSION_IMPL *session, WT_ITEM *kv)
     WT_BTREE *btree;
     WT_DECL_RET;
     size_t size;
+    uint64_t v;
 
     btree = S2BT(session);
     bm = btree->bm;
 
-    if (btree->type == BTREE_COL_FIX) {
-        /* Fixed-size column-stores take a single byte. */
-        if (kv->size != 1)
-            WT_RET_MSG(session, EINVAL,
-              "item size of %" WT_SIZET_FMT
-              " does not match fixed-length file requirement of 1 byte",
-              kv->size);
-        return (0);
-    }
+    /* Fixed-size column-stores take a single byte or an integer that fits the field. */
+    if (btree->type == BTREE_COL_FIX)
+        return (__col_fix_value_unpack(session, btree, kv->data, kv->size, &v));
 
     /* Don't waste effort, 1GB is always cool. */
     if (kv->size <= WT_GIGABYTE)
@@ -833,9 +828,7 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
          * fills the gap with empty records.
          */
         cbt->recno = cursor->recno;
-        cbt->v = 0;
-        cursor->value.data = &cbt->v;
-        cursor->value.size = 1;
+        __col_fix_value_set(cbt, &cursor->value, 0);
         F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
         F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
     } else
@@ -1052,9 +1045,7 @@ __wt_btcur_search_near(WT_CURSOR_BTREE *cbt, int *exactp)
         }
     } else if (__cursor_fix_implicit(btree, cbt)) {
         cbt->recno = cursor->recno;
-        cbt->v = 0;
-        cursor->value.data = &cbt->v;
-        cursor->value.size = 1;
+        __col_fix_value_set(cbt, &cursor->value, 0);
         exact = 0;
         F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
         F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
@@ -1225,17 +1216,13 @@ retry:
                 if (valid)
                     goto duplicate;
                 if (btree->type == BTREE_COL_FIX) {
-                    cbt->v = 0;
                     cbt->upd_value->type = WT_UPDATE_STANDARD;
-                    cbt->upd_value->buf.data = &cbt->v;
-                    cbt->upd_value->buf.size = 1;
+                    __col_fix_value_set(cbt, &cbt->upd_value->buf, 0);
                     goto duplicate;
                 }
             } else if (__cursor_fix_implicit(btree, cbt)) {
-                cbt->v = 0;
                 cbt->upd_value->type = WT_UPDATE_STANDARD;
-                cbt->upd_value->buf.data = &cbt->v;
-                cbt->upd_value->buf.size = 1;
+                __col_fix_value_set(cbt, &cbt->upd_value->buf, 0);
                 goto duplicate;
             }
         }
@@ -2280,6 +2267,11 @@ __wt_btcur_close(WT_CURSOR_BTREE *cbt, bool lowlevel)
     if (!lowlevel)
         ret = __cursor_reset(cbt);
 
+    if (cbt->filter != NULL) {
+        __wt_buf_free(session, &cbt->filter->key_prefix);
+        __wt_buf_free(session, &cbt->filter->key_suffix);
+        __wt_free(session, cbt->filter);
+    }
     __wt_buf_free(session, &cbt->_row_key);
     __wt_buf_free(session, &cbt->_tmp);
     __wt_buf_free(session, &cbt->_modify_update.buf);
@@ -2291,6 +2283,42 @@ __wt_btcur_close(WT_CURSOR_BTREE *cbt, bool lowlevel)
     return (ret);
 }
 
+/*
+ * __wt_btcur_filter_value_range --
+ *     Return if the cursor's value field is within the range of the cursor's iteration filter.
+ */
+int
+__wt_btcur_filter_value_range(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, bool *matchp)
+{
+    WT_CURSOR *cursor;
+    WT_CURSOR_FILTER *filter;
+    WT_DECL_PACK_VALUE(pv);
+    WT_PACK pack;
+    int field;
+    const uint8_t *end, *p;
+
+    cursor = &cbt->iface;
+    filter = cbt->filter;
+    *matchp = false;
+
+    /* The field was checked to be an integer when the filter was configured. */
+    p = cursor->value.data;
+    end = p + cursor->value.size;
+    WT_RET(__pack_init(session, &pack, cursor->value_format));
+    for (field = 0;;) {
+        WT_RET(__pack_next(&pack, &pv));
+        WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
+        if (pv.type != 'x' && field++ == filter->value_field)
+            break;
+    }
+
+    if (filter->value_unsigned)
+        *matchp = pv.u.u >= filter->value_umin && pv.u.u <= filter->value_umax;
+    else
+        *matchp = pv.u.i >= filter->value_min && pv.u.i <= filter->value_max;
+    return (0);
+}
+
 /*
  * __wt_btcur_bounds_position --
  *     An unpositioned bounded cursor need to start its cursor next and prev walk from the lower or
@@ -89,6 +89,18 @@ __debug_hex_byte(WT_DBG *ds, uint8_t v)
     return (ds->f(ds, "#%c%c", __wt_hex((v & 0xf0) >> 4), __wt_hex(v & 0x0f)));
 }
 
+/*
+ * __debug_col_fix_value --
+ *     Output a fixed-length column-store value in hex.
+ */
+static inline int
+__debug_col_fix_value(WT_DBG *ds, uint64_t v)
+{
+    if (S2BT(ds->session)->bitcnt <= 8)
+        return (__debug_hex_byte(ds, (uint8_t)v));
+    return (ds->f(ds, "#%" PRIx64, v));
+}
+
 /*
  * __debug_bytes --
  *     Dump a single set of bytes.
@@ -746,8 +758,8 @@ __debug_dsk_col_fix(WT_DBG *ds, const WT_PAGE_HEADER *dsk)
     WT_BTREE *btree;
     WT_CELL_UNPACK_KV unpack;
     WT_COL_FIX_AUXILIARY_HEADER auxhdr;
+    uint64_t v;
     uint32_t i;
-    uint8_t v;
 
     btree = S2BT(ds->session);
 
@@ -767,7 +779,7 @@ __debug_dsk_col_fix(WT_DBG *ds, const WT_PAGE_HEADER *dsk)
 
     WT_COL_FIX_FOREACH_BITS (btree, dsk, v, i) {
         WT_RET(ds->f(ds, "\t{"));
-        WT_RET(__debug_hex_byte(ds, v));
+        WT_RET(__debug_col_fix_value(ds, v));
         WT_RET(ds->f(ds, "}\n"));
     }
 
@@ -1267,9 +1279,8 @@ __debug_page_col_fix(WT_DBG *ds, WT_REF *ref)
     WT_PAGE *page;
     const WT_PAGE_HEADER *dsk;
     WT_SESSION_IMPL *session;
-    uint64_t recno;
+    uint64_t recno, v;
     uint32_t curtw, i, numtws;
-    uint8_t v;
     char time_string[WT_TIME_STRING_SIZE];
 
     WT_ASSERT(ds->session, S2BT_SAFE(ds->session) != NULL);
@@ -1288,7 +1299,7 @@ __debug_page_col_fix(WT_DBG *ds, WT_REF *ref)
         WT_COL_FIX_FOREACH_BITS (btree, dsk, v, i) {
             if (F_ISSET(ds, WT_DEBUG_UNREDACT)) {
                 WT_RET(ds->f(ds, "\t%" PRIu64 "\t{", recno));
-                WT_RET(__debug_hex_byte(ds, v));
+                WT_RET(__debug_col_fix_value(ds, v));
                 WT_RET(ds->f(ds, "}"));
             } else
                 WT_RET(ds->f(ds, "\t%" PRIu64 "\t{REDACTED}", recno));
@@ -1307,7 +1318,7 @@ __debug_page_col_fix(WT_DBG *ds, WT_REF *ref)
                     WT_RET(ds->f(ds, "\tupdate %" PRIu64 "\n", WT_INSERT_RECNO(ins)));
                 else
                     WT_RET(ds->f(ds, "\tupdate {REDACTED}\n"));
-                WT_RET(__debug_update(ds, ins->upd, true));
+                WT_RET(__debug_update(ds, ins->upd, btree->bitcnt <= 8));
                 ins = WT_SKIP_NEXT(ins);
             }
             ++recno;
@@ -1316,11 +1327,12 @@ __debug_page_col_fix(WT_DBG *ds, WT_REF *ref)
 
     if (WT_COL_UPDATE_SINGLE(page) != NULL) {
         WT_RET(ds->f(ds, "%s", sep));
-        WT_RET(__debug_col_skip(ds, WT_COL_UPDATE_SINGLE(page), "update", true, NULL));
+        WT_RET(
+          __debug_col_skip(ds, WT_COL_UPDATE_SINGLE(page), "update", btree->bitcnt <= 8, NULL));
     }
     if (WT_COL_APPEND(page) != NULL) {
         WT_RET(ds->f(ds, "%s", sep));
-        WT_RET(__debug_col_skip(ds, WT_COL_APPEND(page), "append", true, NULL));
+        WT_RET(__debug_col_skip(ds, WT_COL_APPEND(page), "append", btree->bitcnt <= 8, NULL));
     }
     return (0);
 }
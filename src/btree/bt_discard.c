@@ -408,6 +408,7 @@ __free_skip_array(
   WT_SESSION_IMPL *session, WT_INSERT_HEAD **head_arg, uint32_t entries, bool update_ignore)
 {
     WT_INSERT_HEAD **head;
+    WT_INSERT_INDEX *index;
 
     /*
      * For each non-NULL slot in the page's array of inserts, free the linked list anchored in that
@@ -416,6 +417,8 @@ __free_skip_array(
     for (head = head_arg; entries > 0; --entries, ++head)
         if (*head != NULL) {
             __free_skip_list(session, WT_SKIP_FIRST(*head), update_ignore);
+            if ((index = WT_INSERT_INDEX_PTR((*head)->index)) != NULL)
+                __wt_free(session, index);
             __wt_free(session, *head);
         }
 
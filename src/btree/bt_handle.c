@@ -148,9 +148,16 @@ __wt_btree_open(WT_SESSION_IMPL *session, const char *op_cfg[])
         else {
             WT_ERR(__wt_btree_tree_open(session, root_addr, root_addr_size));
 
-            /* Warm the cache, if possible. */
-            WT_WITH_PAGE_INDEX(session, ret = __btree_preload(session));
-            WT_ERR(ret);
+            /*
+             * Warm the cache, if possible. Don't warm tiered trees with objects cached on demand,
+             * their pages can be in shared objects and reading them all would fetch most of the
+             * objects before the first read.
+             */
+            if (dhandle->type != WT_DHANDLE_TYPE_TIERED ||
+              ((WT_TIERED *)dhandle)->bstorage->cache_chunk_size == 0) {
+                WT_WITH_PAGE_INDEX(session, ret = __btree_preload(session));
+                WT_ERR(ret);
+            }
 
             /* Get the last record number in a column-store file. */
             if (btree->type != BTREE_ROW)
@@ -306,7 +313,7 @@ static int
 __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
 {
     WT_BTREE *btree;
-    WT_CONFIG_ITEM cval, metadata;
+    WT_CONFIG_ITEM cval, metadata, width;
     WT_CONNECTION_IMPL *conn;
     int64_t maj_version, min_version;
     uint32_t bitcnt;
@@ -365,6 +372,21 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
         }
     }
 
+    /*
+     * Column-store: 32 and 64-bit integer values can be configured to use the fixed-length store,
+     * the values are stored in the page's bitmap as an array of little-endian integers.
+     */
+    WT_RET(__wt_config_gets(session, cfg, "fixed_width", &width));
+    if (width.val != 0) {
+        if (btree->type != BTREE_COL_VAR || cval.len != 1 || strchr("iIlLqQ", cval.str[0]) == NULL)
+            WT_RET_MSG(session, EINVAL,
+              "fixed_width requires a key_format of r and a value_format of a single 32 or 64-bit "
+              "integer");
+        btree->bitcnt = cval.str[0] == 'q' || cval.str[0] == 'Q' ? 64 : 32;
+        btree->bitsigned = strchr("ilq", cval.str[0]) != NULL;
+        btree->type = BTREE_COL_FIX;
+    }
+
     /* Page sizes */
     WT_RET(__btree_page_sizes(session));
 
@@ -466,6 +488,9 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt, bool is_ckpt)
         break;
     }
 
+    /* Record time-to-live (row-store) */
+    WT_RET(__wt_ttl_config(session, cfg));
+
     WT_RET(__wt_config_gets_none(session, cfg, "block_compressor", &cval));
     WT_RET(__wt_compressor_config(session, &cval, &btree->compressor));
 
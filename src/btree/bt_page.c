@@ -226,7 +226,7 @@ __wt_page_inmem_prepare(WT_SESSION_IMPL *session, WT_REF *ref)
     size_t size, total_size;
     uint64_t recno, rle;
     uint32_t i, numtws, tw;
-    uint8_t v;
+    uint8_t v[WT_INTPACK64_MAXSIZE];
 
     btree = S2BT(session);
     page = ref->page;
@@ -278,9 +278,9 @@ __wt_page_inmem_prepare(WT_SESSION_IMPL *session, WT_REF *ref)
             recno = ref->ref_recno + page->pg_fix_tws[tw].recno_offset;
 
             /* Get the value. The update will copy it, so we don't need to allocate here. */
-            v = __bit_getv_recno(ref, recno, btree->bitcnt);
-            value->data = &v;
-            value->size = 1;
+            value->size =
+              __col_fix_value_pack(btree, __bit_getv_recno(ref, recno, btree->bitcnt), v);
+            value->data = v;
 
             /* Create an update to resolve the prepare. */
             WT_ERR(__page_inmem_prepare_update_col(
@@ -1074,9 +1074,10 @@ __inmem_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page, bool *preparedp)
              * repeatedly unpacking their cells.
              *
              * The visibility information is not referenced on the page so we need to ensure that
-             * the value is globally visible at the point in time where we read the page into cache.
+             * the value is globally visible at the point in time where we read the page into cache,
+             * and that the tree doesn't expire records based on their commit timestamps.
              */
-            if (!btree->huffman_value &&
+            if (!btree->huffman_value && btree->ttl_duration == 0 &&
               (WT_TIME_WINDOW_IS_EMPTY(&unpack.tw) ||
                 (!WT_TIME_WINDOW_HAS_STOP(&unpack.tw) &&
                   __wt_txn_tw_start_visible_all(session, &unpack.tw))))
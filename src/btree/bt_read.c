@@ -180,7 +180,10 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
     }
 
     /* There's an address, read the backing disk page and build an in-memory version of the page. */
-    WT_ERR(__wt_blkcache_read(session, &tmp, addr.addr, addr.size));
+    WT_EVENT_TRACE_BEGIN_OP(session, WT_EVENT_TRACE_PAGE_READ);
+    ret = __wt_blkcache_read(session, &tmp, addr.addr, addr.size);
+    WT_EVENT_TRACE_END_OP(session, WT_EVENT_TRACE_PAGE_READ, tmp.size);
+    WT_ERR(ret);
 
     /*
      * Build the in-memory version of the page. Clear our local reference to the allocated copy of
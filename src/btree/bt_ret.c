@@ -221,7 +221,8 @@ __wt_value_return_buf(WT_CURSOR_BTREE *cbt, WT_REF *ref, WT_ITEM *buf, WT_TIME_W
     WT_PAGE *page;
     WT_ROW *rip;
     WT_SESSION_IMPL *session;
-    uint8_t v;
+    uint64_t v;
+    uint8_t vbuf[WT_INTPACK64_MAXSIZE];
     bool found;
 
     session = CUR2S(cbt);
@@ -262,7 +263,7 @@ __wt_value_return_buf(WT_CURSOR_BTREE *cbt, WT_REF *ref, WT_ITEM *buf, WT_TIME_W
                 WT_TIME_WINDOW_INIT(tw);
         }
         v = __bit_getv_recno(ref, cursor->recno, btree->bitcnt);
-        return (__wt_buf_set(session, buf, &v, 1));
+        return (__wt_buf_set(session, buf, vbuf, __col_fix_value_pack(btree, v, vbuf)));
     }
 
     /* Compilers can't in general tell that other values of page->type aren't valid here. */
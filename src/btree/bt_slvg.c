@@ -8,6 +8,12 @@
 
 #include "wt_internal.h"
 
+struct __wt_slvg_read;
+typedef struct __wt_slvg_read WT_SLVG_READ;
+struct __wt_slvg_readahead;
+typedef struct __wt_slvg_readahead WT_SLVG_READAHEAD;
+struct __wt_slvg_thread;
+typedef struct __wt_slvg_thread WT_SLVG_THREAD;
 struct __wt_stuff;
 typedef struct __wt_stuff WT_STUFF;
 struct __wt_track;
@@ -41,6 +47,65 @@ struct __wt_stuff {
     WT_ITEM *tmp2; /* Verbose print buffer */
 
     uint64_t fcnt; /* Progress counter */
+
+    WT_SLVG_READAHEAD *ra; /* Block read-ahead */
+};
+
+/*
+ * WT_SLVG_READ --
+ *	A block read ahead of the salvage scan.
+ */
+struct __wt_slvg_read {
+    uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE]; /* Block address */
+    size_t addr_size;
+
+    WT_ITEM buf;    /* Block, decompressed */
+    int read_ret;   /* Block read result */
+    int verify_ret; /* Leaf or overflow page verification result */
+
+    volatile bool done; /* Read complete */
+};
+
+/*
+ * WT_SLVG_READAHEAD --
+ *	Salvage block read-ahead. The salvage scan has to walk the file in order, each block it accepts
+ * determines where it looks for the next one. Helper threads walk the file ahead of the scan,
+ * assuming every block they find is good, and read, decompress and verify those blocks. The scan
+ * uses the results when it arrives at the same blocks, and restarts the helper threads from its own
+ * position when the two walks diverge.
+ */
+struct __wt_slvg_readahead {
+    WT_SPINLOCK lock;      /* Read-ahead lock */
+    WT_CONDVAR *work_cond; /* Wake helper threads */
+    WT_CONDVAR *done_cond; /* Wake the salvage scan */
+
+    WT_DATA_HANDLE *dhandle; /* Tree being salvaged */
+
+    WT_SLVG_READ *reads; /* Circular queue of blocks */
+    uint32_t reads_cnt;
+    uint64_t head; /* Oldest block */
+    uint64_t tail; /* Next slot to fill */
+    bool hold;     /* Scan is using the oldest block */
+
+    wt_off_t offset; /* Helper threads' file offset */
+    uint64_t gen;    /* Helper threads' restart generation */
+    bool eof;        /* Helper threads reached the end of the file */
+    bool peeking;    /* A helper thread is finding the next block */
+
+    volatile bool running; /* Helper threads should keep running */
+
+    u_int nthreads;          /* Helper threads */
+    WT_SLVG_THREAD *threads; /* Helper thread sessions and IDs */
+};
+
+/*
+ * WT_SLVG_THREAD --
+ *	A salvage read-ahead helper thread.
+ */
+struct __wt_slvg_thread {
+    WT_SLVG_READAHEAD *ra;    /* Owning read-ahead */
+    WT_SESSION_IMPL *session; /* Helper thread session */
+    wt_thread_t tid;          /* Helper thread ID */
 };
 
 /*
@@ -134,6 +199,10 @@ static int __slvg_ovfl_reconcile(WT_SESSION_IMPL *, WT_STUFF *);
 static int __slvg_ovfl_ref(WT_SESSION_IMPL *, WT_TRACK *, bool);
 static int __slvg_ovfl_ref_all(WT_SESSION_IMPL *, WT_TRACK *);
 static int __slvg_read(WT_SESSION_IMPL *, WT_STUFF *);
+static int __slvg_readahead_create(WT_SESSION_IMPL *, WT_STUFF *, u_int);
+static int __slvg_readahead_destroy(WT_SESSION_IMPL *, WT_STUFF *);
+static void __slvg_readahead_get(
+  WT_SESSION_IMPL *, WT_SLVG_READAHEAD *, const uint8_t *, size_t, WT_SLVG_READ **);
 static int __slvg_reconcile_free(WT_BM *, WT_SESSION_IMPL *, const uint8_t *, size_t);
 static int __slvg_row_build_internal(WT_SESSION_IMPL *, uint32_t, WT_STUFF *);
 static int __slvg_row_build_leaf(WT_SESSION_IMPL *, WT_TRACK *, WT_REF *, WT_STUFF *);
@@ -232,12 +301,11 @@ __wt_salvage(WT_SESSION_IMPL *session, const char *cfg[])
 {
     WT_BM *bm;
     WT_BTREE *btree;
+    WT_CONFIG_ITEM cval;
     WT_DECL_RET;
     WT_STUFF *ss, stuff;
     uint32_t i, leaf_cnt;
 
-    WT_UNUSED(cfg);
-
     btree = S2BT(session);
     bm = btree->bm;
 
@@ -266,9 +334,13 @@ __wt_salvage(WT_SESSION_IMPL *session, const char *cfg[])
      * Turn off read checksum and verification error messages while we're reading the file, we
      * expect to see corrupted blocks.
      */
+    WT_ERR(__wt_config_gets(session, cfg, "threads", &cval));
+    if (cval.val > 1)
+        WT_ERR(__slvg_readahead_create(session, ss, (u_int)cval.val - 1));
     F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
     ret = __slvg_read(session, ss);
     F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
+    WT_TRET(__slvg_readahead_destroy(session, ss));
     WT_ERR(ret);
 
     /*
@@ -427,6 +499,8 @@ __slvg_read(WT_SESSION_IMPL *session, WT_STUFF *ss)
     WT_DECL_ITEM(as);
     WT_DECL_ITEM(buf);
     WT_DECL_RET;
+    WT_ITEM *ip;
+    WT_SLVG_READ *rd;
     const WT_PAGE_HEADER *dsk;
     size_t addr_size;
     uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE];
@@ -453,8 +527,20 @@ __slvg_read(WT_SESSION_IMPL *session, WT_STUFF *ss)
          * relying on compression.
          *
          * Report the block's status to the block manager.
+         *
+         * If helper threads already read the block, use their results.
          */
-        if ((ret = __wt_blkcache_read(session, buf, addr, addr_size)) == 0)
+        rd = NULL;
+        if (ss->ra != NULL)
+            __slvg_readahead_get(session, ss->ra, addr, addr_size, &rd);
+        if (rd != NULL) {
+            ip = &rd->buf;
+            ret = rd->read_ret;
+        } else {
+            ip = buf;
+            ret = __wt_blkcache_read(session, buf, addr, addr_size);
+        }
+        if (ret == 0)
             valid = true;
         else {
             valid = false;
@@ -477,7 +563,7 @@ __slvg_read(WT_SESSION_IMPL *session, WT_STUFF *ss)
          * file to grow as little as possible, or shrink, and future salvage calls don't need them
          * either.
          */
-        dsk = buf->data;
+        dsk = ip->data;
         switch (dsk->type) {
         case WT_PAGE_BLOCK_MANAGER:
         case WT_PAGE_COL_INT:
@@ -495,7 +581,7 @@ __slvg_read(WT_SESSION_IMPL *session, WT_STUFF *ss)
          * the end of the file or overflow references to non-existent pages, might as well discard
          * these pages now.
          */
-        if (__wt_verify_dsk(session, as->data, buf) != 0) {
+        if ((rd != NULL ? rd->verify_ret : __wt_verify_dsk(session, as->data, ip)) != 0) {
             __wt_verbose(session, WT_VERB_SALVAGE, "%s page failed verify %s",
               __wt_page_type_string(dsk->type), (const char *)as->data);
             WT_ERR(bm->free(bm, session, addr, addr_size));
@@ -531,6 +617,282 @@ err:
     return (ret);
 }
 
+/*
+ * __slvg_readahead_read --
+ *     Read and verify a block ahead of the salvage scan.
+ */
+static void
+__slvg_readahead_read(WT_SESSION_IMPL *session, WT_SLVG_READ *rd, WT_ITEM *as)
+{
+    WT_BM *bm;
+    const WT_PAGE_HEADER *dsk;
+
+    bm = S2BT(session)->bm;
+
+    rd->verify_ret = 0;
+    if ((rd->read_ret = __wt_blkcache_read(session, &rd->buf, rd->addr, rd->addr_size)) != 0)
+        return;
+
+    /* The salvage scan only verifies leaf and overflow pages. */
+    dsk = rd->buf.data;
+    switch (dsk->type) {
+    case WT_PAGE_COL_FIX:
+    case WT_PAGE_COL_VAR:
+    case WT_PAGE_OVFL:
+    case WT_PAGE_ROW_LEAF:
+        if ((rd->verify_ret = bm->addr_string(bm, session, as, rd->addr, rd->addr_size)) == 0)
+            rd->verify_ret = __wt_verify_dsk(session, as->data, &rd->buf);
+        break;
+    }
+}
+
+/*
+ * __slvg_readahead_server --
+ *     Salvage read-ahead helper thread: find, read and verify blocks ahead of the salvage scan.
+ */
+static WT_THREAD_RET
+__slvg_readahead_server(void *arg)
+{
+    WT_BM *bm;
+    WT_DECL_ITEM(as);
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    WT_SLVG_READ *rd;
+    WT_SLVG_READAHEAD *ra;
+    WT_SLVG_THREAD *thread;
+    wt_off_t offset;
+    size_t addr_size;
+    uint64_t gen;
+    uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE];
+    bool eof;
+
+    thread = arg;
+    ra = thread->ra;
+    session = thread->session;
+    bm = ((WT_BTREE *)ra->dhandle->handle)->bm;
+
+    if (__wt_scr_alloc(session, 0, &as) != 0)
+        return (WT_THREAD_RET_VALUE);
+
+    while (ra->running) {
+        /*
+         * Finding the next block depends on the previous one, one helper thread at a time walks the
+         * file. Claim the walk, then find the block without holding the lock, it reads the file.
+         */
+        __wt_spin_lock(session, &ra->lock);
+        if (ra->eof || ra->peeking || ra->tail - ra->head >= ra->reads_cnt) {
+            __wt_spin_unlock(session, &ra->lock);
+            __wt_cond_wait(session, ra->work_cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+        ra->peeking = true;
+        offset = ra->offset;
+        gen = ra->gen;
+        __wt_spin_unlock(session, &ra->lock);
+
+        ret = bm->salvage_peek(bm, session, &offset, addr, &addr_size, &eof);
+
+        /*
+         * Publish the block and claim a slot for it, unless the salvage scan restarted the helper
+         * threads while we were looking, in which case the block is no longer interesting.
+         */
+        __wt_spin_lock(session, &ra->lock);
+        ra->peeking = false;
+        rd = NULL;
+        if (gen == ra->gen) {
+            if (ret != 0 || eof)
+                /* Leave the rest of the file to the salvage scan. */
+                ra->eof = true;
+            else {
+                ra->offset = offset;
+                rd = &ra->reads[ra->tail % ra->reads_cnt];
+                memcpy(rd->addr, addr, addr_size);
+                rd->addr_size = addr_size;
+                rd->done = false;
+                ++ra->tail;
+            }
+        }
+        __wt_spin_unlock(session, &ra->lock);
+        ret = 0;
+
+        /* Let another helper thread find the next block while we read this one. */
+        __wt_cond_signal(session, ra->work_cond);
+        if (rd == NULL) {
+            __wt_cond_signal(session, ra->done_cond);
+            continue;
+        }
+
+        WT_WITH_DHANDLE(session, ra->dhandle, __slvg_readahead_read(session, rd, as));
+        WT_PUBLISH(rd->done, true);
+        __wt_cond_signal(session, ra->done_cond);
+    }
+
+    __wt_scr_free(session, &as);
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __slvg_readahead_wait --
+ *     Wait for the helper threads to finish reading blocks up to, but not including, a sequence
+ *     number. Called with the read-ahead lock held.
+ */
+static void
+__slvg_readahead_wait(WT_SESSION_IMPL *session, WT_SLVG_READAHEAD *ra, uint64_t seq)
+{
+    uint64_t i;
+
+    for (i = ra->head; i < seq; ++i)
+        while (!ra->reads[i % ra->reads_cnt].done) {
+            __wt_spin_unlock(session, &ra->lock);
+            __wt_cond_wait(session, ra->done_cond, WT_THOUSAND, NULL);
+            __wt_spin_lock(session, &ra->lock);
+        }
+}
+
+/*
+ * __slvg_readahead_get --
+ *     Return the helper threads' results for a block, or NULL if the helper threads didn't read it.
+ */
+static void
+__slvg_readahead_get(WT_SESSION_IMPL *session, WT_SLVG_READAHEAD *ra, const uint8_t *addr,
+  size_t addr_size, WT_SLVG_READ **rdp)
+{
+    WT_SLVG_READ *rd;
+    uint64_t seq;
+
+    *rdp = NULL;
+
+    __wt_spin_lock(session, &ra->lock);
+
+    /* Release the block the scan finished with. */
+    if (ra->hold) {
+        ++ra->head;
+        ra->hold = false;
+    }
+
+    for (;;) {
+        for (seq = ra->head; seq < ra->tail; ++seq) {
+            rd = &ra->reads[seq % ra->reads_cnt];
+            if (rd->addr_size == addr_size && memcmp(rd->addr, addr, addr_size) == 0)
+                break;
+        }
+
+        /*
+         * If the helper threads found the block, any blocks before it are ones the scan skipped:
+         * discard them and return the block once it's been read.
+         */
+        if (seq < ra->tail) {
+            __slvg_readahead_wait(session, ra, seq + 1);
+            ra->head = seq;
+            ra->hold = true;
+            *rdp = &ra->reads[seq % ra->reads_cnt];
+            break;
+        }
+
+        /*
+         * If the helper threads might still find the block, wait for them. Otherwise the scan and
+         * the helper threads have diverged, restart the helper threads from the scan's position.
+         */
+        if (!ra->eof && ra->tail - ra->head < ra->reads_cnt) {
+            __wt_spin_unlock(session, &ra->lock);
+            __wt_cond_wait(session, ra->done_cond, WT_THOUSAND, NULL);
+            __wt_spin_lock(session, &ra->lock);
+            continue;
+        }
+        __slvg_readahead_wait(session, ra, ra->tail);
+        ra->head = ra->tail;
+        ra->offset = -1;
+        ++ra->gen;
+        ra->eof = false;
+        break;
+    }
+
+    __wt_spin_unlock(session, &ra->lock);
+    __wt_cond_signal(session, ra->work_cond);
+}
+
+/*
+ * __slvg_readahead_destroy --
+ *     Stop the salvage read-ahead helper threads.
+ */
+static int
+__slvg_readahead_destroy(WT_SESSION_IMPL *session, WT_STUFF *ss)
+{
+    WT_DECL_RET;
+    WT_SLVG_READAHEAD *ra;
+    uint32_t i;
+
+    if ((ra = ss->ra) == NULL)
+        return (0);
+    ss->ra = NULL;
+
+    ra->running = false;
+    if (ra->threads != NULL)
+        for (i = 0; i < ra->nthreads; ++i) {
+            __wt_cond_signal(session, ra->work_cond);
+            WT_TRET(__wt_thread_join(session, &ra->threads[i].tid));
+            if (ra->threads[i].session != NULL)
+                WT_TRET(__wt_session_close_internal(ra->threads[i].session));
+        }
+    __wt_free(session, ra->threads);
+
+    if (ra->reads != NULL)
+        for (i = 0; i < ra->reads_cnt; ++i)
+            __wt_buf_free(session, &ra->reads[i].buf);
+    __wt_free(session, ra->reads);
+
+    __wt_cond_destroy(session, &ra->work_cond);
+    __wt_cond_destroy(session, &ra->done_cond);
+    __wt_spin_destroy(session, &ra->lock);
+    __wt_free(session, ra);
+    return (ret);
+}
+
+/*
+ * __slvg_readahead_create --
+ *     Start the salvage read-ahead helper threads.
+ */
+static int
+__slvg_readahead_create(WT_SESSION_IMPL *session, WT_STUFF *ss, u_int nthreads)
+{
+    WT_DECL_RET;
+    WT_SLVG_READAHEAD *ra;
+    WT_SLVG_THREAD *thread;
+    u_int i;
+
+    WT_RET(__wt_calloc_one(session, &ss->ra));
+    ra = ss->ra;
+    ra->dhandle = session->dhandle;
+    ra->offset = -1;
+    ra->running = true;
+
+    WT_ERR(__wt_spin_init(session, &ra->lock, "salvage read-ahead"));
+    WT_ERR(__wt_cond_alloc(session, "salvage read-ahead work", &ra->work_cond));
+    WT_ERR(__wt_cond_alloc(session, "salvage read-ahead done", &ra->done_cond));
+
+    /* A few blocks per helper thread: more just holds more memory. */
+    ra->reads_cnt = 4 * nthreads;
+    WT_ERR(__wt_calloc_def(session, ra->reads_cnt, &ra->reads));
+
+    WT_ERR(__wt_calloc_def(session, nthreads, &ra->threads));
+    for (i = 0; i < nthreads; ++i) {
+        thread = &ra->threads[i];
+        thread->ra = ra;
+        WT_ERR(__wt_open_internal_session(S2C(session), "salvage-readahead", false,
+          WT_SESSION_CAN_WAIT | WT_SESSION_IGNORE_CACHE_SIZE, 0, &thread->session));
+
+        /* We expect to see corrupted blocks, turn off read checksum and verification messages. */
+        F_SET(thread->session, WT_SESSION_QUIET_CORRUPT_FILE);
+        ra->nthreads = i + 1;
+        WT_ERR(__wt_thread_create(session, &thread->tid, __slvg_readahead_server, thread));
+    }
+    return (0);
+
+err:
+    WT_TRET(__slvg_readahead_destroy(session, ss));
+    return (ret);
+}
+
 /*
  * __slvg_trk_init --
  *     Initialize tracking information for a page.
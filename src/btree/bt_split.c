@@ -1759,6 +1759,7 @@ __split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
     WT_DECL_RET;
     WT_INSERT *ins, **insp, *moved_ins, *prev_ins;
     WT_INSERT_HEAD *ins_head, *tmp_ins_head;
+    WT_INSERT_INDEX *index;
     WT_PAGE *page, *right;
     WT_REF *child, *split_ref[2] = {NULL, NULL};
     size_t key_size, page_decr, parent_incr, right_incr;
@@ -1940,6 +1941,17 @@ __split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
         }
     }
 
+    /*
+     * The moved item may be in the insert list's search index. We have exclusive access to the
+     * page, discard the index, it's rebuilt if the list continues to grow.
+     */
+    if (type == WT_PAGE_ROW_LEAF && (index = WT_INSERT_INDEX_PTR(ins_head->index)) != NULL) {
+        __wt_cache_page_inmem_decr(
+          session, page, sizeof(WT_INSERT_INDEX) + (index->mask + 1) * sizeof(WT_INSERT *));
+        __wt_free(session, index);
+        ins_head->index = NULL;
+    }
+
 #ifdef HAVE_DIAGNOSTIC
     /*
      * Verify the moved insert item appears nowhere on the skip list.
@@ -0,0 +1,108 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_ttl_config --
+ *     Configure a tree's record time-to-live.
+ */
+int
+__wt_ttl_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_BTREE *btree;
+    WT_CONFIG_ITEM duration, field;
+    WT_DECL_PACK_VALUE(pv);
+    WT_DECL_RET;
+    WT_PACK pack;
+    int64_t i;
+
+    btree = S2BT(session);
+
+    btree->ttl_duration = 0;
+    btree->ttl_field = -1;
+    btree->ttl_unsigned = false;
+
+    WT_RET(__wt_config_gets(session, cfg, "time_to_live.duration", &duration));
+    WT_RET(__wt_config_gets(session, cfg, "time_to_live.value_field", &field));
+    if (duration.val == 0 && field.val == -1)
+        return (0);
+
+    if (btree->type != BTREE_ROW)
+        WT_RET_MSG(session, ENOTSUP, "time_to_live configuration not supported for column-stores");
+
+    btree->ttl_duration = (uint64_t)duration.val;
+    if (field.val == -1)
+        return (0);
+
+    WT_RET(__pack_init(session, &pack, btree->value_format));
+    for (i = 0;;) {
+        if ((ret = __pack_next(&pack, &pv)) == WT_NOTFOUND)
+            WT_RET_MSG(session, EINVAL,
+              "time_to_live value_field %" PRId64 " not in value format %s", field.val,
+              btree->value_format);
+        WT_RET(ret);
+        if (pv.type != 'x' && i++ == field.val)
+            break;
+    }
+    if (strchr("bhilqBHILQr", pv.type) == NULL)
+        WT_RET_MSG(session, EINVAL, "time_to_live value_field %" PRId64 " is not an integer field",
+          field.val);
+
+    btree->ttl_field = (int)field.val;
+    btree->ttl_unsigned = strchr("BHILQr", pv.type) != NULL;
+    return (0);
+}
+
+/*
+ * __wt_ttl_expiry --
+ *     Return the timestamp at which a record expires, WT_TS_MAX if it never does. The expiry value
+ *     field is only checked if the record's complete value is passed in.
+ */
+int
+__wt_ttl_expiry(WT_SESSION_IMPL *session, wt_timestamp_t start_ts, const WT_ITEM *value,
+  wt_timestamp_t *expiryp)
+{
+    WT_BTREE *btree;
+    WT_DECL_PACK_VALUE(pv);
+    WT_PACK pack;
+    wt_timestamp_t expiry;
+    int field;
+    const uint8_t *end, *p;
+
+    btree = S2BT(session);
+    *expiryp = WT_TS_MAX;
+
+    /* Records committed without a timestamp never expire by duration. */
+    if (btree->ttl_duration != 0 && start_ts != WT_TS_NONE &&
+      start_ts < WT_TS_MAX - btree->ttl_duration)
+        *expiryp = start_ts + btree->ttl_duration;
+
+    if (btree->ttl_field == -1 || value == NULL || value->size == 0)
+        return (0);
+
+    /* The field was checked to be an integer when the tree was configured. */
+    p = value->data;
+    end = p + value->size;
+    WT_RET(__pack_init(session, &pack, btree->value_format));
+    for (field = 0;;) {
+        WT_RET(__pack_next(&pack, &pv));
+        WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
+        if (pv.type != 'x' && field++ == btree->ttl_field)
+            break;
+    }
+
+    /* Zero and negative expiry values never expire. */
+    if (btree->ttl_unsigned)
+        expiry = pv.u.u;
+    else
+        expiry = pv.u.i > 0 ? (wt_timestamp_t)pv.u.i : WT_TS_NONE;
+    if (expiry != WT_TS_NONE)
+        *expiryp = WT_MIN(*expiryp, expiry);
+    return (0);
+}
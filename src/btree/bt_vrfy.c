@@ -8,6 +8,39 @@
 
 #include "wt_internal.h"
 
+/*
+ * Verification read-ahead: reading a page into memory through a verify handle checks the block's
+ * checksum, decompresses it and verifies the disk image's physical structure, which is most of the
+ * cost of verification. Helper threads read the leaf pages of an internal page ahead of the
+ * traversal, the traversal still checks key order, record numbers and block extents in order.
+ */
+struct __verify_readahead;
+typedef struct __verify_readahead WT_VERIFY_READAHEAD;
+
+typedef struct {
+    WT_VERIFY_READAHEAD *ra;  /* Owning read-ahead */
+    WT_SESSION_IMPL *session; /* Helper thread session */
+    wt_thread_t tid;          /* Helper thread ID */
+} WT_VERIFY_READAHEAD_THREAD;
+
+struct __verify_readahead {
+    WT_SPINLOCK lock; /* Read-ahead lock */
+    WT_CONDVAR *cond; /* Wake helper threads */
+
+    WT_DATA_HANDLE *dhandle; /* Tree being verified */
+
+    WT_PAGE *page;         /* Internal page whose children are read */
+    WT_PAGE_INDEX *pindex; /* Its child references */
+    uint32_t next;         /* Next child to read */
+    uint32_t limit;        /* Read children up to this slot */
+    uint32_t active;       /* Reads in progress */
+
+    volatile bool running; /* Helper threads should keep running */
+
+    u_int nthreads;                      /* Helper threads */
+    WT_VERIFY_READAHEAD_THREAD *threads; /* Helper thread sessions and IDs */
+};
+
 /*
  * There's a bunch of stuff we pass around during verification, group it together to make the code
  * prettier.
@@ -37,6 +70,8 @@ typedef struct {
 
     WT_ITEM *tmp1, *tmp2, *tmp3, *tmp4; /* Temporary buffers */
 
+    WT_VERIFY_READAHEAD *ra; /* Leaf page read-ahead */
+
     int verify_err;
 } WT_VSTUFF;
 
@@ -52,6 +87,208 @@ static int __verify_row_int_key_order(
 static int __verify_row_leaf_key_order(WT_SESSION_IMPL *, WT_REF *, WT_VSTUFF *);
 static int __verify_tree(WT_SESSION_IMPL *, WT_REF *, WT_CELL_UNPACK_ADDR *, WT_VSTUFF *);
 
+/*
+ * __verify_readahead_read --
+ *     Read a page into memory and release it.
+ */
+static int
+__verify_readahead_read(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+    WT_RET(__wt_page_in(session, ref, WT_READ_NO_EVICT));
+    return (__wt_page_release(session, ref, WT_READ_NO_EVICT));
+}
+
+/*
+ * __verify_readahead_server --
+ *     Verify read-ahead helper thread: read child pages into memory ahead of the traversal.
+ */
+static WT_THREAD_RET
+__verify_readahead_server(void *arg)
+{
+    WT_REF *ref;
+    WT_SESSION_IMPL *session;
+    WT_VERIFY_READAHEAD *ra;
+    WT_VERIFY_READAHEAD_THREAD *thread;
+
+    thread = arg;
+    ra = thread->ra;
+    session = thread->session;
+
+    while (ra->running) {
+        ref = NULL;
+        __wt_spin_lock(session, &ra->lock);
+        if (ra->pindex != NULL && ra->next < ra->limit) {
+            ref = ra->pindex->index[ra->next++];
+            ++ra->active;
+        }
+        __wt_spin_unlock(session, &ra->lock);
+
+        if (ref == NULL) {
+            __wt_cond_wait(session, ra->cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+
+        /*
+         * Read the page and release it, leaving it in memory for the traversal. Ignore errors, the
+         * traversal reads the page again and reports any problem.
+         */
+        if (ref->state == WT_REF_DISK)
+            WT_WITH_DHANDLE(
+              session, ra->dhandle, WT_IGNORE_RET(__verify_readahead_read(session, ref)));
+
+        __wt_spin_lock(session, &ra->lock);
+        --ra->active;
+        __wt_spin_unlock(session, &ra->lock);
+    }
+
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __verify_readahead_destroy --
+ *     Stop the verify read-ahead helper threads.
+ */
+static int
+__verify_readahead_destroy(WT_SESSION_IMPL *session, WT_VSTUFF *vs)
+{
+    WT_DECL_RET;
+    WT_VERIFY_READAHEAD *ra;
+    u_int i;
+
+    if ((ra = vs->ra) == NULL)
+        return (0);
+    vs->ra = NULL;
+
+    ra->running = false;
+    if (ra->threads != NULL)
+        for (i = 0; i < ra->nthreads; ++i) {
+            __wt_cond_signal(session, ra->cond);
+            WT_TRET(__wt_thread_join(session, &ra->threads[i].tid));
+            if (ra->threads[i].session != NULL)
+                WT_TRET(__wt_session_close_internal(ra->threads[i].session));
+        }
+    __wt_free(session, ra->threads);
+
+    __wt_cond_destroy(session, &ra->cond);
+    __wt_spin_destroy(session, &ra->lock);
+    __wt_free(session, ra);
+    return (ret);
+}
+
+/*
+ * __verify_readahead_create --
+ *     Start the verify read-ahead helper threads.
+ */
+static int
+__verify_readahead_create(WT_SESSION_IMPL *session, WT_VSTUFF *vs, u_int nthreads)
+{
+    WT_DECL_RET;
+    WT_VERIFY_READAHEAD *ra;
+    WT_VERIFY_READAHEAD_THREAD *thread;
+    u_int i;
+
+    WT_RET(__wt_calloc_one(session, &vs->ra));
+    ra = vs->ra;
+    ra->dhandle = session->dhandle;
+    ra->running = true;
+
+    WT_ERR(__wt_spin_init(session, &ra->lock, "verify read-ahead"));
+    WT_ERR(__wt_cond_alloc(session, "verify read-ahead", &ra->cond));
+
+    WT_ERR(__wt_calloc_def(session, nthreads, &ra->threads));
+    for (i = 0; i < nthreads; ++i) {
+        thread = &ra->threads[i];
+        thread->ra = ra;
+        WT_ERR(__wt_open_internal_session(S2C(session), "verify-readahead", false,
+          WT_SESSION_CAN_WAIT | WT_SESSION_IGNORE_CACHE_SIZE, 0, &thread->session));
+
+        /* The traversal reports corruption, the helper threads stay quiet. */
+        F_SET(thread->session, WT_SESSION_QUIET_CORRUPT_FILE);
+        ra->nthreads = i + 1;
+        WT_ERR(__wt_thread_create(session, &thread->tid, __verify_readahead_server, thread));
+    }
+    return (0);
+
+err:
+    WT_TRET(__verify_readahead_destroy(session, vs));
+    return (ret);
+}
+
+/*
+ * __verify_readahead_start --
+ *     Start reading ahead the children of an internal page if they're all leaf pages.
+ */
+static void
+__verify_readahead_start(WT_SESSION_IMPL *session, WT_PAGE *page, WT_VSTUFF *vs)
+{
+    WT_PAGE_INDEX *pindex;
+    WT_VERIFY_READAHEAD *ra;
+    uint32_t slot;
+
+    if ((ra = vs->ra) == NULL)
+        return;
+
+    /*
+     * Only read ahead at the bottom of the tree: the traversal recurses into internal children, and
+     * there's a single read-ahead window.
+     */
+    WT_INTL_INDEX_GET(session, page, pindex);
+    for (slot = 0; slot < pindex->entries; ++slot)
+        if (!F_ISSET(pindex->index[slot], WT_REF_FLAG_LEAF))
+            return;
+
+    __wt_spin_lock(session, &ra->lock);
+    ra->page = page;
+    ra->pindex = pindex;
+    ra->next = ra->limit = 0;
+    __wt_spin_unlock(session, &ra->lock);
+}
+
+/*
+ * __verify_readahead_advance --
+ *     The traversal is about to read a child page, move the read-ahead window.
+ */
+static void
+__verify_readahead_advance(WT_SESSION_IMPL *session, WT_PAGE *page, uint32_t slot, WT_VSTUFF *vs)
+{
+    WT_VERIFY_READAHEAD *ra;
+
+    if ((ra = vs->ra) == NULL || ra->page != page)
+        return;
+
+    /* Keep a couple of pages per helper thread in flight, more just fills the cache. */
+    __wt_spin_lock(session, &ra->lock);
+    ra->limit = WT_MIN(slot + 1 + 2 * ra->nthreads, ra->pindex->entries);
+    if (ra->next <= slot)
+        ra->next = slot + 1;
+    __wt_spin_unlock(session, &ra->lock);
+    __wt_cond_signal(session, ra->cond);
+}
+
+/*
+ * __verify_readahead_stop --
+ *     Stop reading ahead the children of an internal page and wait for reads in progress: the page
+ *     is about to be released.
+ */
+static void
+__verify_readahead_stop(WT_SESSION_IMPL *session, WT_PAGE *page, WT_VSTUFF *vs)
+{
+    WT_VERIFY_READAHEAD *ra;
+
+    if ((ra = vs->ra) == NULL || ra->page != page)
+        return;
+
+    __wt_spin_lock(session, &ra->lock);
+    ra->page = NULL;
+    ra->pindex = NULL;
+    while (ra->active != 0) {
+        __wt_spin_unlock(session, &ra->lock);
+        __wt_yield();
+        __wt_spin_lock(session, &ra->lock);
+    }
+    __wt_spin_unlock(session, &ra->lock);
+}
+
 /*
  * __verify_config --
  *     Debugging: verification supports dumping pages in various formats.
@@ -183,6 +420,7 @@ __wt_verify(WT_SESSION_IMPL *session, const char *cfg[])
     WT_CELL_UNPACK_ADDR addr_unpack;
     WT_CKPT *ckptbase, *ckpt;
     WT_DECL_RET;
+    WT_CONFIG_ITEM cval;
     WT_VSTUFF *vs, _vstuff;
     size_t root_addr_size;
     uint8_t root_addr[WT_BTREE_MAX_ADDR_COOKIE];
@@ -226,6 +464,11 @@ __wt_verify(WT_SESSION_IMPL *session, const char *cfg[])
     WT_ERR(bm->verify_start(bm, session, ckptbase, cfg));
     bm_start = true;
 
+    /* Optionally start helper threads reading leaf pages ahead of the traversal. */
+    WT_ERR(__wt_config_gets(session, cfg, "threads", &cval));
+    if (cval.val > 1)
+        WT_ERR(__verify_readahead_create(session, vs, (u_int)cval.val - 1));
+
     /* Loop through the file's checkpoints, verifying each one. */
     WT_CKPT_FOREACH (ckptbase, ckpt) {
         __wt_verbose(session, WT_VERB_VERIFY, "%s: checkpoint %s", name, ckpt->name);
@@ -269,6 +512,7 @@ __wt_verify(WT_SESSION_IMPL *session, const char *cfg[])
             /* Verify the tree. */
             WT_WITH_PAGE_INDEX(
               session, ret = __verify_tree(session, &btree->root, &addr_unpack, vs));
+            __verify_readahead_stop(session, btree->root.page, vs);
 
             /*
              * If the read_corrupt mode was turned on, we may have continued traversing and
@@ -307,6 +551,8 @@ __wt_verify(WT_SESSION_IMPL *session, const char *cfg[])
 
 done:
 err:
+    WT_TRET(__verify_readahead_destroy(session, vs));
+
     /* Inform the underlying block manager we're done. */
     if (bm_start)
         WT_TRET(bm->verify_end(bm, session));
@@ -556,6 +802,7 @@ celltype_err:
     switch (page->type) {
     case WT_PAGE_COL_INT:
         /* For each entry in an internal page, verify the subtree. */
+        __verify_readahead_start(session, page, vs);
         entry = 0;
         WT_INTL_FOREACH_BEGIN (session, page, child_ref) {
             /*
@@ -603,6 +850,7 @@ celltype_err:
 
             /* Verify the subtree. */
             ++vs->depth;
+            __verify_readahead_advance(session, page, entry - 1, vs);
             ret = __wt_page_in(session, child_ref, 0);
 
             /*
@@ -616,6 +864,7 @@ celltype_err:
             } else
                 WT_RET(ret);
             ret = __verify_tree(session, child_ref, unpack, vs);
+            __verify_readahead_stop(session, child_ref->page, vs);
             WT_TRET(__wt_page_release(session, child_ref, 0));
             --vs->depth;
             WT_RET(ret);
@@ -626,6 +875,7 @@ celltype_err:
         break;
     case WT_PAGE_ROW_INT:
         /* For each entry in an internal page, verify the subtree. */
+        __verify_readahead_start(session, page, vs);
         entry = 0;
         WT_INTL_FOREACH_BEGIN (session, page, child_ref) {
             /*
@@ -644,6 +894,7 @@ celltype_err:
 
             /* Verify the subtree. */
             ++vs->depth;
+            __verify_readahead_advance(session, page, entry - 1, vs);
             ret = __wt_page_in(session, child_ref, 0);
 
             /*
@@ -657,6 +908,7 @@ celltype_err:
             } else
                 WT_RET(ret);
             ret = __verify_tree(session, child_ref, unpack, vs);
+            __verify_readahead_stop(session, child_ref->page, vs);
             WT_TRET(__wt_page_release(session, child_ref, 0));
             --vs->depth;
             WT_RET(ret);
@@ -36,6 +36,136 @@ err:
     return (ret);
 }
 
+/*
+ * __row_insert_index_set --
+ *     Add an item to a row-store insert list's search index.
+ */
+static inline void
+__row_insert_index_set(WT_INSERT_INDEX *index, WT_INSERT *ins)
+{
+    uint32_t i;
+
+    /*
+     * Linear probing: slots are only ever filled, and callers never fill more than three-quarters
+     * of the table, so there's always an empty slot.
+     */
+    i = (uint32_t)__wt_hash_city64(WT_INSERT_KEY(ins), WT_INSERT_KEY_SIZE(ins));
+    for (i &= index->mask;; i = (i + 1) & index->mask)
+        if (index->slot[i] == NULL && __wt_atomic_cas_ptr(&index->slot[i], NULL, ins))
+            return;
+}
+
+/*
+ * __row_insert_index_build --
+ *     Build, or rebuild, a row-store insert list's search index.
+ */
+static int
+__row_insert_index_build(
+  WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_head, uint32_t count)
+{
+    WT_INSERT *ins;
+    WT_INSERT_INDEX *index, *old_index;
+    size_t size;
+    uint64_t split_gen;
+    uint32_t entries, slots;
+
+    /*
+     * Size the table at four times the insert list's current size: items inserted while it's in use
+     * are added until the list doubles, at which point it's rebuilt, keeping the table at most
+     * three-quarters full.
+     */
+    count = WT_MIN(count, UINT32_MAX / 16);
+    for (slots = WT_INSERT_INDEX_MIN; slots < 4 * count; slots <<= 1)
+        ;
+    size = sizeof(WT_INSERT_INDEX) + slots * sizeof(WT_INSERT *);
+    WT_RET(__wt_calloc(session, 1, size, &index));
+    index->count = index->build_count = count;
+    index->mask = slots - 1;
+
+    /*
+     * Concurrent inserts may be racing with us, the list may be longer than counted; the index is a
+     * hint, stop if the table is a quarter full.
+     */
+    entries = 0;
+    WT_SKIP_FOREACH (ins, ins_head) {
+        if (++entries > slots / 4)
+            break;
+        __row_insert_index_set(index, ins);
+    }
+
+    /* Items counted in the insert head while we were building the index are lost, it's a hint. */
+    old_index = WT_INSERT_INDEX_PTR(ins_head->index);
+    WT_PUBLISH(ins_head->index, index);
+    __wt_cache_page_inmem_incr(session, page, size);
+    WT_STAT_CONN_DATA_INCR(session, cursor_insert_index_build);
+    if (old_index == NULL)
+        return (0);
+
+    /*
+     * Threads may still be searching the previous index, free it once they can no longer be using
+     * it.
+     */
+    size = sizeof(WT_INSERT_INDEX) + (old_index->mask + 1) * sizeof(WT_INSERT *);
+    __wt_cache_page_inmem_decr(session, page, size);
+    WT_FULL_BARRIER();
+    split_gen = __wt_gen(session, WT_GEN_SPLIT);
+    WT_RET(__wt_stash_add(session, WT_GEN_SPLIT, split_gen, old_index, size));
+    __wt_gen_next(session, WT_GEN_SPLIT, NULL);
+    return (0);
+}
+
+/*
+ * __row_insert_index_add --
+ *     Add a newly inserted item to a row-store insert list's search index, building the index once
+ *     the list is large enough.
+ */
+static void
+__row_insert_index_add(WT_SESSION_IMPL *session, WT_PAGE *page, WT_INSERT_HEAD *ins_head,
+  WT_INSERT *ins, bool exclusive)
+{
+    WT_INSERT_INDEX *index;
+    uint32_t count;
+    void *v;
+    bool added;
+
+    /* Index lookups match keys byte-for-byte, they can't be used with a custom collator. */
+    if (S2BT(session)->collator != NULL)
+        return;
+
+    /* Count the item, in the index if there is one, otherwise in the insert head. */
+    added = false;
+    WT_ENTER_PAGE_INDEX(session);
+    for (;;) {
+        WT_ORDERED_READ(v, ins_head->index);
+        if ((index = WT_INSERT_INDEX_PTR(v)) != NULL) {
+            count = __wt_atomic_addv32(&index->count, 1);
+            break;
+        }
+        count = WT_INSERT_INDEX_DECODE_COUNT(v) + 1;
+        if (__wt_atomic_cas_ptr(&ins_head->index, v, WT_INSERT_INDEX_ENCODE_COUNT(count)))
+            break;
+    }
+    if (index != NULL && count <= 2 * index->build_count) {
+        __row_insert_index_set(index, ins);
+        added = true;
+    }
+    WT_LEAVE_PAGE_INDEX(session);
+    if (added || count < WT_INSERT_INDEX_MIN)
+        return;
+
+    /*
+     * Build a new index. Don't wait on the page lock, another thread is building it or inserting,
+     * and any thread inserting into this list will try again. The index is only a hint, ignore
+     * failures.
+     */
+    if (!exclusive && WT_PAGE_TRYLOCK(session, page) != 0)
+        return;
+    if (WT_INSERT_INDEX_PTR(ins_head->index) == index)
+        WT_IGNORE_RET(__row_insert_index_build(session, page, ins_head, count));
+    if (!exclusive)
+        WT_PAGE_UNLOCK(session, page);
+}
+
 /*
  * __wt_row_modify --
  *     Row-store insert, update and delete.
@@ -243,6 +373,9 @@ __wt_row_modify(WT_CURSOR_BTREE *cbt, const WT_ITEM *key, const WT_ITEM *value,
         /* Insert the WT_INSERT structure. */
         WT_ERR(__wt_insert_serial(
           session, page, cbt->ins_head, cbt->ins_stack, &ins, ins_size, skipdepth, exclusive));
+
+        /* Add the new item to the insert list's search index. */
+        __row_insert_index_add(session, page, ins_head, cbt->ins, exclusive);
     }
 
     inserted_to_update_chain = true;
@@ -79,6 +79,60 @@ __search_insert_append(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_INSERT
     return (0);
 }
 
+/*
+ * __search_insert_index --
+ *     Search a row-store insert list's hash index for an exact match.
+ */
+static inline void
+__search_insert_index(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_INSERT_HEAD *ins_head,
+  WT_ITEM *srch_key, bool *donep)
+{
+    WT_INSERT *ins;
+    WT_INSERT_INDEX *index;
+    uint32_t i;
+    void *v;
+
+    *donep = false;
+
+    /*
+     * The index may be replaced while we're searching it, the split generation keeps it from being
+     * freed. Stop at the first empty slot: the key isn't in the index, although it may be in the
+     * skiplist.
+     */
+    WT_ENTER_PAGE_INDEX(session);
+    WT_ORDERED_READ(v, ins_head->index);
+    index = WT_INSERT_INDEX_PTR(v);
+    for (i = (uint32_t)__wt_hash_city64(srch_key->data, srch_key->size) & index->mask;;
+         i = (i + 1) & index->mask) {
+        WT_ORDERED_READ(ins, index->slot[i]);
+        if (ins == NULL)
+            break;
+        if (WT_INSERT_KEY_SIZE(ins) == srch_key->size &&
+          memcmp(WT_INSERT_KEY(ins), srch_key->data, srch_key->size) == 0) {
+            *donep = true;
+            break;
+        }
+    }
+    WT_LEAVE_PAGE_INDEX(session);
+    if (!*donep) {
+        WT_STAT_CONN_DATA_INCR(session, cursor_insert_index_miss);
+        return;
+    }
+    WT_STAT_CONN_DATA_INCR(session, cursor_insert_index_hit);
+
+    /*
+     * An exact match doesn't need the skiplist stack, we're updating an existing item; clear it so
+     * it can't be used.
+     */
+    cbt->ins_stack[0] = NULL;
+    cbt->next_stack[0] = NULL;
+    cbt->compare = 0;
+    cbt->ins = ins;
+    cbt->ins_head = ins_head;
+    cbt->tmp->data = WT_INSERT_KEY(ins);
+    cbt->tmp->size = WT_INSERT_KEY_SIZE(ins);
+}
+
 /*
  * __wt_search_insert --
  *     Search a row-store insert list, creating a skiplist stack as we go.
@@ -740,6 +794,16 @@ leaf_match:
         if (done)
             return (0);
     }
+
+    /*
+     * Large insert lists have a search index, check it for an exact match before searching the
+     * skiplist.
+     */
+    if (WT_INSERT_INDEX_PTR(ins_head->index) != NULL && btree->collator == NULL) {
+        __search_insert_index(session, cbt, ins_head, srch_key, &done);
+        if (done)
+            return (0);
+    }
     WT_ERR(__wt_search_insert(session, cbt, ins_head, srch_key));
     if (cbt->compare == 0) {
         cbt->tmp->data = WT_INSERT_KEY(cbt->ins);
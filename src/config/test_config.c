@@ -35,6 +35,11 @@ static const WT_CONFIG_CHECK confchk_operation_tracker_subconfigs[] = {
   {"tracking_key_format", "string", NULL, NULL, NULL, 0},
   {"tracking_value_format", "string", NULL, NULL, NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
 
+static const WT_CONFIG_CHECK confchk_perf_monitor_subconfigs[] = {
+  {"baseline", "string", NULL, NULL, NULL, 0}, {"enabled", "boolean", NULL, NULL, NULL, 0},
+  {"enforce", "boolean", NULL, NULL, NULL, 0}, {"op_rate", "string", NULL, NULL, NULL, 0},
+  {"tolerance", "int", NULL, "min=0,max=100", NULL, 0}, {NULL, NULL, NULL, NULL, NULL, 0}};
+
 static const WT_CONFIG_CHECK confchk_statistics_config_subconfigs[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0}, {"type", "string", NULL, NULL, NULL, 0},
   {NULL, NULL, NULL, NULL, NULL, 0}};
@@ -100,6 +105,21 @@ static const WT_CONFIG_CHECK confchk_workload_manager_subconfigs[] = {
   {"update_config", "category", NULL, NULL, confchk_update_config_subconfigs, 5},
   {NULL, NULL, NULL, NULL, NULL, 0}};
 
+static const WT_CONFIG_CHECK confchk_bounded_cursor_filter_perf[] = {
+  {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
+  {"cache_size_mb", "int", NULL, "min=0,max=100000000000", NULL, 0},
+  {"compression_enabled", "boolean", NULL, NULL, NULL, 0},
+  {"duration_seconds", "int", NULL, "min=0,max=1000000", NULL, 0},
+  {"enable_logging", "boolean", NULL, NULL, NULL, 0},
+  {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
+  {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
+  {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
+  {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
+  {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
+  {"workload_manager", "category", NULL, NULL, confchk_workload_manager_subconfigs, 9},
+  {NULL, NULL, NULL, NULL, NULL, 0}};
+
 static const WT_CONFIG_CHECK confchk_bounded_cursor_perf[] = {
   {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
   {"cache_size_mb", "int", NULL, "min=0,max=100000000000", NULL, 0},
@@ -108,6 +128,7 @@ static const WT_CONFIG_CHECK confchk_bounded_cursor_perf[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -122,6 +143,7 @@ static const WT_CONFIG_CHECK confchk_bounded_cursor_prefix_indices[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -136,6 +158,7 @@ static const WT_CONFIG_CHECK confchk_bounded_cursor_prefix_search_near[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -150,6 +173,7 @@ static const WT_CONFIG_CHECK confchk_bounded_cursor_prefix_stat[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"search_near_threads", "string", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
@@ -165,6 +189,7 @@ static const WT_CONFIG_CHECK confchk_bounded_cursor_stress[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -180,6 +205,7 @@ static const WT_CONFIG_CHECK confchk_burst_inserts[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -194,6 +220,7 @@ static const WT_CONFIG_CHECK confchk_cache_resize[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -208,6 +235,7 @@ static const WT_CONFIG_CHECK confchk_hs_cleanup[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -222,6 +250,67 @@ static const WT_CONFIG_CHECK confchk_operations_test[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
+  {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
+  {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
+  {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
+  {"workload_manager", "category", NULL, NULL, confchk_workload_manager_subconfigs, 9},
+  {NULL, NULL, NULL, NULL, NULL, 0}};
+
+static const WT_CONFIG_CHECK confchk_perf_many_tables[] = {
+  {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
+  {"cache_size_mb", "int", NULL, "min=0,max=100000000000", NULL, 0},
+  {"compression_enabled", "boolean", NULL, NULL, NULL, 0},
+  {"duration_seconds", "int", NULL, "min=0,max=1000000", NULL, 0},
+  {"enable_logging", "boolean", NULL, NULL, NULL, 0},
+  {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
+  {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
+  {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
+  {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
+  {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
+  {"workload_manager", "category", NULL, NULL, confchk_workload_manager_subconfigs, 9},
+  {NULL, NULL, NULL, NULL, NULL, 0}};
+
+static const WT_CONFIG_CHECK confchk_perf_point_read[] = {
+  {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
+  {"cache_size_mb", "int", NULL, "min=0,max=100000000000", NULL, 0},
+  {"compression_enabled", "boolean", NULL, NULL, NULL, 0},
+  {"duration_seconds", "int", NULL, "min=0,max=1000000", NULL, 0},
+  {"enable_logging", "boolean", NULL, NULL, NULL, 0},
+  {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
+  {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
+  {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
+  {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
+  {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
+  {"workload_manager", "category", NULL, NULL, confchk_workload_manager_subconfigs, 9},
+  {NULL, NULL, NULL, NULL, NULL, 0}};
+
+static const WT_CONFIG_CHECK confchk_perf_scan[] = {
+  {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
+  {"cache_size_mb", "int", NULL, "min=0,max=100000000000", NULL, 0},
+  {"compression_enabled", "boolean", NULL, NULL, NULL, 0},
+  {"duration_seconds", "int", NULL, "min=0,max=1000000", NULL, 0},
+  {"enable_logging", "boolean", NULL, NULL, NULL, 0},
+  {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
+  {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
+  {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
+  {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
+  {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
+  {"workload_manager", "category", NULL, NULL, confchk_workload_manager_subconfigs, 9},
+  {NULL, NULL, NULL, NULL, NULL, 0}};
+
+static const WT_CONFIG_CHECK confchk_perf_update_history[] = {
+  {"cache_max_wait_ms", "int", NULL, "min=0", NULL, 0},
+  {"cache_size_mb", "int", NULL, "min=0,max=100000000000", NULL, 0},
+  {"compression_enabled", "boolean", NULL, NULL, NULL, 0},
+  {"duration_seconds", "int", NULL, "min=0,max=1000000", NULL, 0},
+  {"enable_logging", "boolean", NULL, NULL, NULL, 0},
+  {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
+  {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -236,6 +325,7 @@ static const WT_CONFIG_CHECK confchk_reverse_split[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -250,6 +340,7 @@ static const WT_CONFIG_CHECK confchk_search_near_01[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"search_near_threads", "string", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
@@ -265,6 +356,7 @@ static const WT_CONFIG_CHECK confchk_search_near_02[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -279,6 +371,7 @@ static const WT_CONFIG_CHECK confchk_search_near_03[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -293,6 +386,7 @@ static const WT_CONFIG_CHECK confchk_test_template[] = {
   {"enable_logging", "boolean", NULL, NULL, NULL, 0},
   {"metrics_monitor", "category", NULL, NULL, confchk_metrics_monitor_subconfigs, 6},
   {"operation_tracker", "category", NULL, NULL, confchk_operation_tracker_subconfigs, 4},
+  {"perf_monitor", "category", NULL, NULL, confchk_perf_monitor_subconfigs, 5},
   {"reverse_collator", "boolean", NULL, NULL, NULL, 0},
   {"statistics_config", "category", NULL, NULL, confchk_statistics_config_subconfigs, 2},
   {"timestamp_manager", "category", NULL, NULL, confchk_timestamp_manager_subconfigs, 4},
@@ -300,7 +394,7 @@ static const WT_CONFIG_CHECK confchk_test_template[] = {
   {NULL, NULL, NULL, NULL, NULL, 0}};
 
 static const WT_CONFIG_ENTRY config_entries[] = {
-  {"bounded_cursor_perf",
+  {"bounded_cursor_filter_perf",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -310,23 +404,24 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_bounded_cursor_perf, 11},
-  {"bounded_cursor_prefix_indices",
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_bounded_cursor_filter_perf, 12},
+  {"bounded_cursor_perf",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -336,23 +431,24 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_bounded_cursor_prefix_indices, 11},
-  {"bounded_cursor_prefix_search_near",
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_bounded_cursor_perf, 12},
+  {"bounded_cursor_prefix_indices",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -362,23 +458,24 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_bounded_cursor_prefix_search_near, 11},
-  {"bounded_cursor_prefix_stat",
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_bounded_cursor_prefix_indices, 12},
+  {"bounded_cursor_prefix_search_near",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -388,7 +485,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,search_near_threads=10,"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
     "statistics_config=(enable_logging=true,type=all),"
     "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
     "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
@@ -403,8 +501,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
     "thread_count=0),update_config=(key_size=5,op_rate=1s,"
     "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
-    confchk_bounded_cursor_prefix_stat, 12},
-  {"bounded_cursor_stress",
+    confchk_bounded_cursor_prefix_search_near, 12},
+  {"bounded_cursor_prefix_stat",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -414,7 +512,9 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "search_near_threads=10,statistics_config=(enable_logging=true,"
     "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
     "op_rate=1s,stable_lag=1),"
     "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
@@ -429,7 +529,34 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "ops_per_transaction=(max=1,min=0),thread_count=0),"
     "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
     "min=0),thread_count=0,value_size=5))",
-    confchk_bounded_cursor_stress, 11},
+    confchk_bounded_cursor_prefix_stat, 13},
+  {"bounded_cursor_stress",
+    "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
+    "duration_seconds=0,enable_logging=false,"
+    "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false),cc_pages_removed=(max=1,min=0,"
+    "postrun=false,runtime=false,save=false),enabled=true,op_rate=1s,"
+    "stat_cache_size=(max=1,min=0,postrun=false,runtime=false,"
+    "save=false),stat_db_size=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false)),operation_tracker=(enabled=true,"
+    "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_bounded_cursor_stress, 12},
   {"burst_inserts",
     "burst_duration=90,cache_max_wait_ms=0,cache_size_mb=0,"
     "compression_enabled=false,duration_seconds=0,"
@@ -441,22 +568,23 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "min=0,postrun=false,runtime=false,save=false)),"
     "operation_tracker=(enabled=true,op_rate=1s,"
     "tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_burst_inserts, 12},
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_burst_inserts, 13},
   {"cache_resize",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
@@ -467,22 +595,23 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_cache_resize, 11},
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_cache_resize, 12},
   {"hs_cleanup",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
@@ -493,22 +622,23 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_hs_cleanup, 11},
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_hs_cleanup, 12},
   {"operations_test",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
@@ -519,23 +649,24 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_operations_test, 11},
-  {"reverse_split",
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_operations_test, 12},
+  {"perf_many_tables",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -545,23 +676,24 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_reverse_split, 11},
-  {"search_near_01",
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_perf_many_tables, 12},
+  {"perf_point_read",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -571,7 +703,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,search_near_threads=10,"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
     "statistics_config=(enable_logging=true,type=all),"
     "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
     "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
@@ -586,8 +719,89 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
     "thread_count=0),update_config=(key_size=5,op_rate=1s,"
     "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
-    confchk_search_near_01, 12},
-  {"search_near_02",
+    confchk_perf_point_read, 12},
+  {"perf_scan",
+    "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
+    "duration_seconds=0,enable_logging=false,"
+    "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false),cc_pages_removed=(max=1,min=0,"
+    "postrun=false,runtime=false,save=false),enabled=true,op_rate=1s,"
+    "stat_cache_size=(max=1,min=0,postrun=false,runtime=false,"
+    "save=false),stat_db_size=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false)),operation_tracker=(enabled=true,"
+    "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_perf_scan, 12},
+  {"perf_update_history",
+    "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
+    "duration_seconds=0,enable_logging=false,"
+    "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false),cc_pages_removed=(max=1,min=0,"
+    "postrun=false,runtime=false,save=false),enabled=true,op_rate=1s,"
+    "stat_cache_size=(max=1,min=0,postrun=false,runtime=false,"
+    "save=false),stat_db_size=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false)),operation_tracker=(enabled=true,"
+    "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_perf_update_history, 12},
+  {"reverse_split",
+    "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
+    "duration_seconds=0,enable_logging=false,"
+    "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false),cc_pages_removed=(max=1,min=0,"
+    "postrun=false,runtime=false,save=false),enabled=true,op_rate=1s,"
+    "stat_cache_size=(max=1,min=0,postrun=false,runtime=false,"
+    "save=false),stat_db_size=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false)),operation_tracker=(enabled=true,"
+    "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_reverse_split, 12},
+  {"search_near_01",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
     "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
@@ -597,7 +811,9 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "search_near_threads=10,statistics_config=(enable_logging=true,"
     "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
     "op_rate=1s,stable_lag=1),"
     "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
@@ -612,7 +828,34 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "ops_per_transaction=(max=1,min=0),thread_count=0),"
     "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
     "min=0),thread_count=0,value_size=5))",
-    confchk_search_near_02, 11},
+    confchk_search_near_01, 13},
+  {"search_near_02",
+    "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
+    "duration_seconds=0,enable_logging=false,"
+    "metrics_monitor=(cache_hs_insert=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false),cc_pages_removed=(max=1,min=0,"
+    "postrun=false,runtime=false,save=false),enabled=true,op_rate=1s,"
+    "stat_cache_size=(max=1,min=0,postrun=false,runtime=false,"
+    "save=false),stat_db_size=(max=1,min=0,postrun=false,"
+    "runtime=false,save=false)),operation_tracker=(enabled=true,"
+    "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_search_near_02, 12},
   {"search_near_03",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
@@ -623,22 +866,23 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_search_near_03, 11},
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_search_near_03, 12},
   {"test_template",
     "cache_max_wait_ms=0,cache_size_mb=0,compression_enabled=false,"
     "duration_seconds=0,enable_logging=false,"
@@ -649,22 +893,23 @@ static const WT_CONFIG_ENTRY config_entries[] = {
     "save=false),stat_db_size=(max=1,min=0,postrun=false,"
     "runtime=false,save=false)),operation_tracker=(enabled=true,"
     "op_rate=1s,tracking_key_format=QSQ,tracking_value_format=iS),"
-    "reverse_collator=false,statistics_config=(enable_logging=true,"
-    "type=all),timestamp_manager=(enabled=true,oldest_lag=1,"
-    "op_rate=1s,stable_lag=1),"
-    "workload_manager=(checkpoint_config=(op_rate=60s,thread_count=1)"
-    ",custom_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1"
-    ",min=0),thread_count=0,value_size=5),enabled=true,"
-    "insert_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5),op_rate=1s,"
-    "populate_config=(collection_count=1,key_count_per_collection=0,"
-    "key_size=5,thread_count=1,value_size=5),read_config=(key_size=5,"
-    "op_rate=1s,ops_per_transaction=(max=1,min=0),thread_count=0,"
-    "value_size=5),remove_config=(op_rate=1s,"
-    "ops_per_transaction=(max=1,min=0),thread_count=0),"
-    "update_config=(key_size=5,op_rate=1s,ops_per_transaction=(max=1,"
-    "min=0),thread_count=0,value_size=5))",
-    confchk_test_template, 11},
+    "perf_monitor=(baseline=\"\",enabled=false,enforce=false,"
+    "op_rate=1s,tolerance=10),reverse_collator=false,"
+    "statistics_config=(enable_logging=true,type=all),"
+    "timestamp_manager=(enabled=true,oldest_lag=1,op_rate=1s,"
+    "stable_lag=1),workload_manager=(checkpoint_config=(op_rate=60s,"
+    "thread_count=1),custom_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "enabled=true,insert_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "op_rate=1s,populate_config=(collection_count=1,"
+    "key_count_per_collection=0,key_size=5,thread_count=1,"
+    "value_size=5),read_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5),"
+    "remove_config=(op_rate=1s,ops_per_transaction=(max=1,min=0),"
+    "thread_count=0),update_config=(key_size=5,op_rate=1s,"
+    "ops_per_transaction=(max=1,min=0),thread_count=0,value_size=5))",
+    confchk_test_template, 12},
   {NULL, NULL, NULL, 0}};
 
 /*
@@ -1121,6 +1121,12 @@ err:
           conn->default_session->event_handler, &conn->iface, NULL, WT_EVENT_CONN_CLOSE, NULL));
     F_CLR(conn, WT_CONN_MINIMAL | WT_CONN_READY);
 
+    /*
+     * Shut down the background compaction server first, it opens handles and does checkpoints of
+     * its own.
+     */
+    WT_TRET(__wt_compact_server_destroy(session));
+
     /*
      * Rollback all running transactions. We do this as a separate pass because an active
      * transaction in one session could cause trouble when closing a file, even if that session
@@ -1255,6 +1261,10 @@ __conn_debug_info(WT_CONNECTION *wt_conn, const char *config)
     if (cval.val != 0)
         WT_ERR(__wt_verbose_dump_sessions(session, false));
 
+    WT_ERR(__wt_config_gets(session, cfg, "trace", &cval));
+    if (cval.val != 0)
+        WT_ERR(__wt_event_trace_dump(session));
+
     WT_ERR(__wt_config_gets(session, cfg, "txn", &cval));
     if (cval.val != 0)
         WT_ERR(__wt_verbose_dump_txn(session));
@@ -1690,6 +1700,7 @@ __conn_hash_config(WT_SESSION_IMPL *session, const char *cfg[])
     }
     WT_RET(__wt_calloc_def(session, conn->dh_hash_size, &conn->dh_bucket_count));
     WT_RET(__wt_calloc_def(session, conn->dh_hash_size, &conn->dhhash));
+    WT_RET(__wt_calloc_def(session, conn->dh_hash_size, &conn->dhhash_lf));
     for (i = 0; i < conn->dh_hash_size; ++i)
         TAILQ_INIT(&conn->dhhash[i]);
 
@@ -2678,7 +2689,11 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
       __conn_add_encryptor, __conn_add_extractor, __conn_set_file_system, __conn_add_storage_source,
       __conn_get_storage_source, __conn_get_extension_api};
     static const WT_NAME_FLAG file_types[] = {{"checkpoint", WT_DIRECT_IO_CHECKPOINT},
-      {"data", WT_DIRECT_IO_DATA}, {"log", WT_DIRECT_IO_LOG}, {NULL, 0}};
+      {"data", WT_DIRECT_IO_DATA}, {"log", WT_DIRECT_IO_LOG}, {"read", WT_DIRECT_IO_READ},
+      {NULL, 0}};
+    static const WT_NAME_FLAG rwlock_types[] = {{"dhandle", WT_RWLOCK_SCALABLE_DHANDLE},
+      {"table", WT_RWLOCK_SCALABLE_TABLE}, {"txn_global", WT_RWLOCK_SCALABLE_TXN_GLOBAL},
+      {NULL, 0}};
 
     WT_CONFIG_ITEM cval, keyid, secretkey, sval;
     WT_CONNECTION_IMPL *conn;
@@ -2896,6 +2911,8 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     WT_ERR(__wt_timing_stress_config(session, cfg));
     WT_ERR(__wt_blkcache_setup(session, cfg, false));
     WT_ERR(__wt_extra_diagnostics_config(session, cfg));
+    WT_ERR(__wt_conn_capture_setup(session, cfg, false));
+    WT_ERR(__wt_conn_event_trace_setup(session, cfg, false));
     WT_ERR(__wt_conn_optrack_setup(session, cfg, false));
     WT_ERR(__conn_session_size(session, cfg, &conn->session_size));
     WT_ERR(__wt_config_gets(session, cfg, "session_scratch_max", &cval));
@@ -2915,6 +2932,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
         } else
             WT_ERR_NOTFOUND_OK(ret, false);
     }
+#ifndef __linux__
+    if (FLD_ISSET(conn->direct_io, WT_DIRECT_IO_READ))
+        WT_ERR_MSG(session, ENOTSUP, "direct_io=[read] is only supported on Linux");
+#endif
 
     WT_ERR(__wt_config_gets(session, cfg, "write_through", &cval));
     for (ft = file_types; ft->name != NULL; ft++) {
@@ -2988,6 +3009,24 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler, const char *c
     WT_ERR(__wt_config_gets(session, cfg, "operation_timeout_ms", &cval));
     conn->operation_timeout_us = (uint64_t)(cval.val * WT_THOUSAND);
 
+    /*
+     * Switch the configured locks to reader-scalable mode. The global transaction lock isn't yet
+     * initialized, it's switched when the transaction subsystem starts.
+     */
+    WT_ERR(__wt_config_gets(session, cfg, "rwlock_scalable", &cval));
+    for (ft = rwlock_types; ft->name != NULL; ft++) {
+        ret = __wt_config_subgets(session, &cval, ft->name, &sval);
+        if (ret == 0) {
+            if (sval.val)
+                FLD_SET(conn->rwlock_scalable, ft->flag);
+        } else
+            WT_ERR_NOTFOUND_OK(ret, false);
+    }
+    if (FLD_ISSET(conn->rwlock_scalable, WT_RWLOCK_SCALABLE_DHANDLE))
+        WT_ERR(__wt_rwlock_scalable(session, &conn->dhandle_lock));
+    if (FLD_ISSET(conn->rwlock_scalable, WT_RWLOCK_SCALABLE_TABLE))
+        WT_ERR(__wt_rwlock_scalable(session, &conn->table_lock));
+
     WT_ERR(__wt_config_gets(session, cfg, "salvage", &cval));
     if (cval.val) {
         if (F_ISSET(conn, WT_CONN_READONLY))
@@ -47,6 +47,7 @@ __capacity_config(WT_SESSION_IMPL *session, const char *cfg[])
          * We've been given a total capacity, set the capacity of all the subsystems.
          */
         cap->ckpt = WT_CAPACITY_SYS(total, WT_CAP_CKPT);
+        cap->compact = WT_CAPACITY_SYS(total, WT_CAP_COMPACT);
         cap->evict = WT_CAPACITY_SYS(total, WT_CAP_EVICT);
         cap->log = WT_CAPACITY_SYS(total, WT_CAP_LOG);
         cap->read = WT_CAPACITY_SYS(total, WT_CAP_READ);
@@ -55,7 +56,8 @@ __capacity_config(WT_SESSION_IMPL *session, const char *cfg[])
          * Set the threshold to the percent of our capacity to periodically asynchronously flush
          * what we've written.
          */
-        cap->threshold = ((cap->ckpt + cap->evict + cap->log) / 100) * WT_CAPACITY_PCT;
+        cap->threshold =
+          ((cap->ckpt + cap->compact + cap->evict + cap->log) / 100) * WT_CAPACITY_PCT;
         if (cap->threshold < WT_CAPACITY_MIN_THRESHOLD)
             cap->threshold = WT_CAPACITY_MIN_THRESHOLD;
         WT_STAT_CONN_SET(session, capacity_threshold, cap->threshold);
@@ -295,6 +297,12 @@ __wt_capacity_throttle(WT_SESSION_IMPL *session, uint64_t bytes, WT_THROTTLE_TYP
         WT_STAT_CONN_INCRV(session, capacity_bytes_ckpt, bytes);
         WT_STAT_CONN_INCRV(session, capacity_bytes_written, bytes);
         break;
+    case WT_THROTTLE_COMPACT:
+        capacity = cap->compact;
+        reservation = &cap->reservation_compact;
+        WT_STAT_CONN_INCRV(session, capacity_bytes_compact, bytes);
+        WT_STAT_CONN_INCRV(session, capacity_bytes_written, bytes);
+        break;
     case WT_THROTTLE_EVICT:
         capacity = cap->evict;
         reservation = &cap->reservation_evict;
@@ -356,6 +364,11 @@ again:
             steal_capacity = cap->ckpt;
             best_res = this_res;
         }
+        if (type != WT_THROTTLE_COMPACT && (this_res = cap->reservation_compact) < best_res) {
+            steal = &cap->reservation_compact;
+            steal_capacity = cap->compact;
+            best_res = this_res;
+        }
         if (type != WT_THROTTLE_EVICT && (this_res = cap->reservation_evict) < best_res) {
             steal = &cap->reservation_evict;
             steal_capacity = cap->evict;
@@ -413,6 +426,9 @@ again:
             case WT_THROTTLE_CKPT:
                 WT_STAT_CONN_INCRV(session, capacity_time_ckpt, sleep_us);
                 break;
+            case WT_THROTTLE_COMPACT:
+                WT_STAT_CONN_INCRV(session, capacity_time_compact, sleep_us);
+                break;
             case WT_THROTTLE_EVICT:
                 WT_STAT_CONN_INCRV(session, capacity_time_evict, sleep_us);
                 break;
@@ -423,8 +439,11 @@ again:
                 WT_STAT_CONN_INCRV(session, capacity_time_read, sleep_us);
                 break;
             }
-        if (sleep_us > WT_CAPACITY_SLEEP_CUTOFF_US)
+        if (sleep_us > WT_CAPACITY_SLEEP_CUTOFF_US) {
             /* Sleep handles large usec values. */
+            __wt_wait_start(session, WT_WAIT_CAPACITY);
             __wt_sleep(0, sleep_us);
+            __wt_wait_end(session, WT_WAIT_CAPACITY);
+        }
     }
 }
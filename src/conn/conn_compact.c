@@ -0,0 +1,426 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The background compaction server periodically walks the metadata and calls WT_SESSION::compact on
+ * each table. Compaction itself decides if a file has enough space to recover to be worth the
+ * effort (using the server's free space target rather than the foreground default), paces the page
+ * rewrites against the configured I/O capacity and waits for eviction to catch up rather than
+ * pulling more pages into a full cache.
+ */
+
+/*
+ * __compact_list_free --
+ *     Free a NULL-terminated list of URIs.
+ */
+static void
+__compact_list_free(WT_SESSION_IMPL *session, char ***listp)
+{
+    char **p;
+
+    if ((p = *listp) != NULL) {
+        for (; *p != NULL; ++p)
+            __wt_free(session, *p);
+        __wt_free(session, *listp);
+    }
+}
+
+/*
+ * __compact_server_config --
+ *     Parse the background compaction server options.
+ */
+static int
+__compact_server_config(WT_SESSION_IMPL *session, const char **cfg, bool *enabledp,
+  uint64_t *free_space_targetp, uint64_t *waitp, char ***excludep)
+{
+    WT_CONFIG objectconf;
+    WT_CONFIG_ITEM cval, k, v;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    u_int cnt;
+    char **exclude;
+
+    *enabledp = false;
+    *free_space_targetp = *waitp = 0;
+    *excludep = NULL;
+
+    conn = S2C(session);
+    exclude = NULL;
+
+    WT_RET(__wt_config_gets(session, cfg, "compact_server.enabled", &cval));
+    if (cval.val == 0)
+        return (0);
+
+    WT_RET(__wt_config_gets(session, cfg, "compact_server.free_space_target", &cval));
+    *free_space_targetp = (uint64_t)cval.val;
+
+    WT_RET(__wt_config_gets(session, cfg, "compact_server.wait", &cval));
+    *waitp = (uint64_t)cval.val;
+
+    WT_RET(__wt_config_gets(session, cfg, "compact_server.exclude", &cval));
+    __wt_config_subinit(session, &objectconf, &cval);
+    for (cnt = 0; (ret = __wt_config_next(&objectconf, &k, &v)) == 0; ++cnt)
+        ;
+    WT_RET_NOTFOUND_OK(ret);
+    if (cnt != 0) {
+        WT_RET(__wt_calloc_def(session, cnt + 1, &exclude));
+        __wt_config_subinit(session, &objectconf, &cval);
+        for (cnt = 0; (ret = __wt_config_next(&objectconf, &k, &v)) == 0; ++cnt) {
+            if (!WT_PREFIX_MATCH(k.str, "table:"))
+                WT_ERR_MSG(session, EINVAL,
+                  "compact_server exclude configuration only supports objects of type \"table\"");
+            WT_ERR(__wt_strndup(session, k.str, k.len, &exclude[cnt]));
+        }
+        WT_ERR_NOTFOUND_OK(ret, false);
+    }
+
+    /* Background compaction is meaningless for in-memory and readonly databases. */
+    if (F_ISSET(conn, WT_CONN_IN_MEMORY | WT_CONN_READONLY))
+        WT_ERR_MSG(session, EINVAL,
+          "compact_server configuration incompatible with in-memory or readonly configuration");
+
+    *enabledp = true;
+    *excludep = exclude;
+    exclude = NULL;
+
+err:
+    __compact_list_free(session, &exclude);
+    return (ret);
+}
+
+/*
+ * __compact_list_equal --
+ *     Return if two NULL-terminated lists of URIs hold the same URIs in the same order.
+ */
+static bool
+__compact_list_equal(char **a, char **b)
+{
+    if (a == NULL || b == NULL)
+        return (a == b);
+    for (; *a != NULL && *b != NULL; ++a, ++b)
+        if (strcmp(*a, *b) != 0)
+            return (false);
+    return (*a == NULL && *b == NULL);
+}
+
+/*
+ * __compact_server_run_chk --
+ *     Check to decide if the background compaction server should continue running.
+ */
+static bool
+__compact_server_run_chk(WT_SESSION_IMPL *session)
+{
+    return (FLD_ISSET(S2C(session)->server_flags, WT_CONN_SERVER_COMPACT));
+}
+
+/*
+ * __compact_list_match --
+ *     Return if a URI appears in a NULL-terminated list.
+ */
+static bool
+__compact_list_match(char **list, const char *uri)
+{
+    if (list != NULL)
+        for (; *list != NULL; ++list)
+            if (strcmp(*list, uri) == 0)
+                return (true);
+    return (false);
+}
+
+/*
+ * __compact_server_list_append --
+ *     Append a copy of a URI to a NULL-terminated list.
+ */
+static int
+__compact_server_list_append(
+  WT_SESSION_IMPL *session, const char *uri, char ***listp, size_t *allocp, u_int *cntp)
+{
+    WT_RET(__wt_realloc_def(session, allocp, *cntp + 2, listp));
+    WT_RET(__wt_strdup(session, uri, &(*listp)[*cntp]));
+    (*listp)[++*cntp] = NULL;
+    return (0);
+}
+
+/*
+ * __compact_server_gather --
+ *     Build the list of tables to compact. Tables with column groups that aren't stored in files
+ *     (LSM and tiered tables) are left alone: they manage their own space.
+ */
+static int
+__compact_server_gather(WT_SESSION_IMPL *session, char ***tablesp)
+{
+    WT_CONFIG_ITEM cval;
+    WT_CURSOR *cursor;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    size_t skip_alloc, tables_alloc;
+    u_int i, j, skip_cnt, tables_cnt;
+    const char *key, *p, *value;
+    char **skip, **tables;
+
+    *tablesp = NULL;
+
+    cursor = NULL;
+    skip = tables = NULL;
+    skip_alloc = tables_alloc = 0;
+    skip_cnt = tables_cnt = 0;
+
+    WT_RET(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_metadata_cursor(session, &cursor));
+    while ((ret = cursor->next(cursor)) == 0) {
+        WT_ERR(cursor->get_key(cursor, &key));
+        if (WT_PREFIX_MATCH(key, "table:")) {
+            if (WT_PREFIX_MATCH(key + strlen("table:"), "WiredTiger"))
+                continue;
+            if (__compact_list_match(S2C(session)->compact_exclude, key)) {
+                WT_STAT_CONN_INCR(session, session_background_compact_excluded);
+                continue;
+            }
+            WT_ERR(__compact_server_list_append(session, key, &tables, &tables_alloc, &tables_cnt));
+        } else if (WT_PREFIX_MATCH(key, "colgroup:")) {
+            WT_ERR(cursor->get_value(cursor, &value));
+            WT_ERR(__wt_config_getones(session, value, "source", &cval));
+            if (WT_PREFIX_MATCH(cval.str, "file:"))
+                continue;
+
+            /* The table name ends at the column group name, if there is one. */
+            key += strlen("colgroup:");
+            if ((p = strchr(key, ':')) == NULL)
+                p = key + strlen(key);
+            WT_ERR(__wt_buf_fmt(session, tmp, "table:%.*s", (int)WT_PTRDIFF(p, key), key));
+            WT_ERR(
+              __compact_server_list_append(session, tmp->data, &skip, &skip_alloc, &skip_cnt));
+        }
+    }
+    WT_ERR_NOTFOUND_OK(ret, false);
+
+    /* Remove the tables we can't compact, keeping the list NULL-terminated. */
+    for (i = j = 0; i < tables_cnt; ++i)
+        if (__compact_list_match(skip, tables[i]))
+            __wt_free(session, tables[i]);
+        else
+            tables[j++] = tables[i];
+    if (tables != NULL)
+        tables[j] = NULL;
+
+    *tablesp = tables;
+    tables = NULL;
+
+err:
+    WT_TRET(__wt_metadata_cursor_release(session, &cursor));
+    __compact_list_free(session, &skip);
+    __compact_list_free(session, &tables);
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
+
+/*
+ * __compact_server_pass --
+ *     Make one pass over the database, compacting any table with enough space to recover.
+ */
+static int
+__compact_server_pass(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION *wt_session;
+    char config[64], **p, **tables;
+
+    conn = S2C(session);
+    wt_session = (WT_SESSION *)session;
+    tables = NULL;
+
+    WT_STAT_CONN_INCR(session, session_background_compact_passes);
+
+    WT_ERR(__wt_snprintf(config, sizeof(config), "timeout=0,free_space_target=%" PRIu64,
+      conn->compact_free_space_target));
+
+    WT_ERR(__compact_server_gather(session, &tables));
+    for (p = tables; p != NULL && *p != NULL; ++p) {
+        if (!__compact_server_run_chk(session))
+            break;
+
+        __wt_verbose_debug1(session, WT_VERB_COMPACT, "background compaction of %s", *p);
+        ret = wt_session->compact(wt_session, *p, config);
+
+        /*
+         * Failing to compact one table doesn't stop the pass: the table may have been dropped since
+         * we walked the metadata, be locked by another operation, or compaction may have given up
+         * because of cache pressure or because the server is shutting down. Anything else is
+         * reported and we move on.
+         */
+        switch (ret) {
+        case 0:
+        case EBUSY:
+        case ECANCELED:
+        case ENOENT:
+        case WT_ROLLBACK:
+            break;
+        default:
+            __wt_err(session, ret, "background compaction of %s failed", *p);
+            break;
+        }
+        ret = 0;
+    }
+
+err:
+    __compact_list_free(session, &tables);
+    return (ret);
+}
+
+/*
+ * __compact_server --
+ *     The background compaction server thread.
+ */
+static WT_THREAD_RET
+__compact_server(void *arg)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    session = arg;
+    conn = S2C(session);
+
+    for (;;) {
+        /* Wait until the next pass. */
+        __wt_cond_wait(
+          session, conn->compact_cond, conn->compact_wait * WT_MILLION, __compact_server_run_chk);
+
+        /* Check if we're quitting or being reconfigured. */
+        if (!__compact_server_run_chk(session))
+            break;
+
+        WT_ERR(__compact_server_pass(session));
+    }
+
+    if (0) {
+err:
+        WT_IGNORE_RET(__wt_panic(session, ret, "background compaction server error"));
+    }
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __compact_server_start --
+ *     Start the background compaction server thread.
+ */
+static int
+__compact_server_start(WT_CONNECTION_IMPL *conn)
+{
+    WT_SESSION_IMPL *session;
+
+    FLD_SET(conn->server_flags, WT_CONN_SERVER_COMPACT);
+
+    /*
+     * The background compaction server gets its own session.
+     *
+     * Compaction does enough I/O it may be called upon to perform slow operations for the block
+     * manager.
+     */
+    WT_RET(__wt_open_internal_session(
+      conn, "compact-server", true, WT_SESSION_CAN_WAIT, 0, &conn->compact_session));
+    session = conn->compact_session;
+
+    WT_RET(__wt_cond_alloc(session, "compact server", &conn->compact_cond));
+
+    /*
+     * Start the thread.
+     */
+    WT_RET(__wt_thread_create(session, &conn->compact_tid, __compact_server, session));
+    conn->compact_tid_set = true;
+
+    return (0);
+}
+
+/*
+ * __wt_compact_server_create --
+ *     Configure and start the background compaction server.
+ */
+int
+__wt_compact_server_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    uint64_t free_space_target, wait;
+    char **exclude;
+    bool enabled;
+
+    conn = S2C(session);
+
+    WT_RET(__compact_server_config(session, cfg, &enabled, &free_space_target, &wait, &exclude));
+
+    /*
+     * Leave the server alone if its configuration hasn't changed: connection reconfiguration passes
+     * the complete configuration, and bouncing the server abandons the table it's compacting.
+     */
+    if (enabled == (conn->compact_session != NULL) &&
+      (!enabled ||
+        (free_space_target == conn->compact_free_space_target && wait == conn->compact_wait &&
+          __compact_list_equal(exclude, conn->compact_exclude))))
+        goto err;
+
+    /*
+     * Otherwise stop any server that is already running (see the checkpoint server for the
+     * details). A pass in progress notices the server has stopped and gives up on the table it is
+     * compacting.
+     */
+    if (conn->compact_session != NULL)
+        WT_ERR(__wt_compact_server_destroy(session));
+
+    if (enabled) {
+        conn->compact_free_space_target = free_space_target;
+        conn->compact_wait = wait;
+        conn->compact_exclude = exclude;
+        exclude = NULL;
+        WT_ERR(__compact_server_start(conn));
+    }
+
+err:
+    __compact_list_free(session, &exclude);
+    return (ret);
+}
+
+/*
+ * __wt_compact_server_destroy --
+ *     Destroy the background compaction server thread.
+ */
+int
+__wt_compact_server_destroy(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    FLD_CLR(conn->server_flags, WT_CONN_SERVER_COMPACT);
+    if (conn->compact_tid_set) {
+        __wt_cond_signal(session, conn->compact_cond);
+        WT_TRET(__wt_thread_join(session, &conn->compact_tid));
+        conn->compact_tid_set = false;
+    }
+    __wt_cond_destroy(session, &conn->compact_cond);
+
+    /* Close the server thread's session. */
+    if (conn->compact_session != NULL)
+        WT_TRET(__wt_session_close_internal(conn->compact_session));
+
+    /*
+     * Ensure background compaction settings are cleared - so that reconfigure doesn't get confused.
+     */
+    __compact_list_free(session, &conn->compact_exclude);
+    conn->compact_session = NULL;
+    conn->compact_tid_set = false;
+    conn->compact_cond = NULL;
+    conn->compact_free_space_target = 0;
+    conn->compact_wait = 0;
+
+    return (ret);
+}
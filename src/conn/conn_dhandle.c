@@ -165,6 +165,7 @@ __conn_dhandle_destroy(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, bool f
     __conn_dhandle_config_clear(session);
     __wt_spin_destroy(session, &dhandle->close_lock);
     __wt_stat_dsrc_discard(session, dhandle);
+    __wt_latency_discard(session, dhandle);
     __wt_overwrite_and_free(session, dhandle);
     return (ret);
 }
@@ -289,6 +290,73 @@ __wt_conn_dhandle_find(WT_SESSION_IMPL *session, const char *uri, const char *ch
     return (WT_NOTFOUND);
 }
 
+/*
+ * __conn_dhandle_match --
+ *     Return if a data handle matches a URI and checkpoint name.
+ */
+static bool
+__conn_dhandle_match(WT_DATA_HANDLE *dhandle, const char *uri, const char *checkpoint)
+{
+    if (F_ISSET(dhandle, WT_DHANDLE_DEAD) || strcmp(uri, dhandle->name) != 0)
+        return (false);
+    if (checkpoint == NULL)
+        return (dhandle->checkpoint == NULL);
+    return (dhandle->checkpoint != NULL && strcmp(checkpoint, dhandle->checkpoint) == 0);
+}
+
+/*
+ * __wt_conn_dhandle_find_lockfree --
+ *     Find a previously opened data handle and acquire a reference to it without taking the handle
+ *     list lock.
+ */
+int
+__wt_conn_dhandle_find_lockfree(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    uint64_t bucket;
+    uint32_t ref;
+    bool found;
+
+    conn = S2C(session);
+    found = false;
+
+    bucket = __wt_hash_city64(uri, strlen(uri)) & (conn->dh_hash_size - 1);
+
+    /*
+     * Handles removed from the chain aren't freed until the data handle generation drains, so it's
+     * safe to walk the chain and examine handles while in the generation.
+     */
+    WT_ENTER_GENERATION(session, WT_GEN_DHANDLE);
+    WT_ORDERED_READ(dhandle, conn->dhhash_lf[bucket]);
+    while (dhandle != NULL && !__conn_dhandle_match(dhandle, uri, checkpoint))
+        WT_ORDERED_READ(dhandle, dhandle->hashq_lf);
+
+    /*
+     * Acquire a reference unless the handle is being removed, in which case the caller falls back
+     * to searching under the handle list lock.
+     */
+    while (dhandle != NULL) {
+        WT_ORDERED_READ(ref, dhandle->session_ref);
+        if (ref == WT_DHANDLE_REF_REMOVED)
+            break;
+        if (__wt_atomic_cas32(&dhandle->session_ref, ref, ref + 1)) {
+            found = true;
+            break;
+        }
+    }
+    WT_LEAVE_GENERATION(session, WT_GEN_DHANDLE);
+
+    if (!found) {
+        WT_STAT_CONN_INCR(session, dh_conn_lockfree_miss);
+        return (WT_NOTFOUND);
+    }
+
+    WT_STAT_CONN_INCR(session, dh_conn_lockfree_find);
+    session->dhandle = dhandle;
+    return (0);
+}
+
 /*
  * __wt_conn_dhandle_close --
  *     Sync and close the underlying btree handle.
@@ -840,8 +908,14 @@ __conn_dhandle_remove(WT_SESSION_IMPL *session, bool final)
     WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE));
     WT_ASSERT(session, dhandle != conn->cache->walk_tree);
 
-    /* Check if the handle was reacquired by a session while we waited. */
-    if (!final && (dhandle->session_inuse != 0 || dhandle->session_ref != 0))
+    /*
+     * Check if the handle was reacquired by a session while we waited. Lock-free lookups can
+     * acquire a reference without the handle list lock, swap the reference count to a sentinel so
+     * they can't race with the removal.
+     */
+    if (!final &&
+      (dhandle->session_inuse != 0 ||
+        !__wt_atomic_cas32(&dhandle->session_ref, 0, WT_DHANDLE_REF_REMOVED)))
         return (__wt_set_return(session, EBUSY));
 
     WT_CONN_DHANDLE_REMOVE(conn, dhandle, bucket);
@@ -855,13 +929,22 @@ __conn_dhandle_remove(WT_SESSION_IMPL *session, bool final)
 int
 __wt_conn_dhandle_discard_single(WT_SESSION_IMPL *session, bool final, bool mark_dead)
 {
+    WT_CONNECTION_IMPL *conn;
     WT_DATA_HANDLE *dhandle;
     WT_DECL_RET;
     int tret;
-    bool set_pass_intr;
+    bool defer, set_pass_intr;
 
+    conn = S2C(session);
     dhandle = session->dhandle;
 
+    /*
+     * Callers removing a batch of handles under the handle list lock don't want to wait for
+     * lock-free lookups while holding it: queue the handles they remove, the caller destroys them
+     * with __wt_conn_dhandle_discard_deferred once the lock is released.
+     */
+    defer = !final && FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE);
+
     if (F_ISSET(dhandle, WT_DHANDLE_OPEN)) {
         tret = __wt_conn_dhandle_close(session, final, mark_dead);
         if (final && tret != 0) {
@@ -877,26 +960,69 @@ __wt_conn_dhandle_discard_single(WT_SESSION_IMPL *session, bool final, bool mark
     set_pass_intr = false;
     if (!FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST)) {
         set_pass_intr = true;
-        (void)__wt_atomic_addv32(&S2C(session)->cache->pass_intr, 1);
+        (void)__wt_atomic_addv32(&conn->cache->pass_intr, 1);
     }
 
     /* Try to remove the handle, protected by the data handle lock. */
     WT_WITH_HANDLE_LIST_WRITE_LOCK(session, tret = __conn_dhandle_remove(session, final));
     if (set_pass_intr)
-        (void)__wt_atomic_subv32(&S2C(session)->cache->pass_intr, 1);
+        (void)__wt_atomic_subv32(&conn->cache->pass_intr, 1);
     WT_TRET(tret);
 
     /*
-     * After successfully removing the handle, clean it up.
+     * After successfully removing the handle, wait for lock-free lookups that may still be looking
+     * at it, then clean it up.
      */
     if (ret == 0 || final) {
-        WT_TRET(__conn_dhandle_destroy(session, dhandle, final));
+        if (defer)
+            TAILQ_INSERT_TAIL(&conn->dhdiscardqh, dhandle, q);
+        else {
+            __wt_gen_next_drain(session, WT_GEN_DHANDLE);
+            WT_TRET(__conn_dhandle_destroy(session, dhandle, final));
+        }
         session->dhandle = NULL;
     }
 
     return (ret);
 }
 
+/*
+ * __wt_conn_dhandle_discard_deferred --
+ *     Destroy the handles removed while the handle list lock was held, waiting once for lock-free
+ *     lookups that may still be looking at any of them.
+ */
+int
+__wt_conn_dhandle_discard_deferred(WT_SESSION_IMPL *session)
+{
+    struct __wt_dhandle_qh discard;
+    WT_CONNECTION_IMPL *conn;
+    WT_DATA_HANDLE *dhandle;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    WT_ASSERT(session, !FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST));
+
+    TAILQ_INIT(&discard);
+    WT_WITH_HANDLE_LIST_WRITE_LOCK(session, TAILQ_CONCAT(&discard, &conn->dhdiscardqh, q));
+    if (TAILQ_EMPTY(&discard))
+        return (0);
+
+    __wt_gen_next_drain(session, WT_GEN_DHANDLE);
+    while ((dhandle = TAILQ_FIRST(&discard)) != NULL) {
+        TAILQ_REMOVE(&discard, dhandle, q);
+        if (dhandle->type == WT_DHANDLE_TYPE_TABLE)
+            WT_WITH_TABLE_WRITE_LOCK(session,
+              WT_WITH_DHANDLE(
+                session, dhandle, WT_TRET(__conn_dhandle_destroy(session, dhandle, false))));
+        else
+            WT_WITH_DHANDLE(
+              session, dhandle, WT_TRET(__conn_dhandle_destroy(session, dhandle, false)));
+    }
+
+    return (ret);
+}
+
 /*
  * __wt_conn_dhandle_discard --
  *     Close/discard all data handles.
@@ -916,6 +1042,9 @@ __wt_conn_dhandle_discard(WT_SESSION_IMPL *session)
      */
     __wt_session_close_cache(session);
 
+    /* Destroy any handles removed but not yet destroyed. */
+    WT_TRET(__wt_conn_dhandle_discard_deferred(session));
+
 /*
  * Close open data handles: first, everything apart from metadata and the history store (as closing
  * a normal file may write metadata and read history store entries). Then close whatever is left
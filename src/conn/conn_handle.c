@@ -20,6 +20,7 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
     session = conn->default_session;
 
     TAILQ_INIT(&conn->dhqh);         /* Data handle list */
+    TAILQ_INIT(&conn->dhdiscardqh);  /* Data handle discard list */
     TAILQ_INIT(&conn->dlhqh);        /* Library list */
     TAILQ_INIT(&conn->dsrcqh);       /* Data source list */
     TAILQ_INIT(&conn->fhqh);         /* File list */
@@ -30,6 +31,8 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
     TAILQ_INIT(&conn->storagesrcqh); /* Storage source list */
     TAILQ_INIT(&conn->tieredqh);     /* Tiered work unit list */
 
+    TAILQ_INIT(&conn->tiered_uploadqh); /* Tiered multipart flush list */
+
     TAILQ_INIT(&conn->lsmqh); /* WT_LSM_TREE list */
 
     /* Setup the LSM work queues. */
@@ -137,6 +140,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_free(session, conn->blockhash);
     __wt_free(session, conn->dh_bucket_count);
     __wt_free(session, conn->dhhash);
+    __wt_free(session, conn->dhhash_lf);
     __wt_free(session, conn->fhhash);
 
     /* Free allocated recovered checkpoint snapshot memory */
@@ -149,6 +153,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
     __wt_free(session, conn->home);
     __wt_free(session, conn->sessions);
     __wt_stat_connection_discard(session, conn);
+    __wt_latency_discard(session, NULL);
 
     __wt_free(NULL, conn);
 }
@@ -91,6 +91,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
      */
     WT_TRET(__wt_capacity_server_destroy(session));
     WT_TRET(__wt_checkpoint_server_destroy(session));
+    WT_TRET(__wt_compact_server_destroy(session));
     WT_TRET(__wt_statlog_destroy(session, true));
     WT_TRET(__wt_tiered_storage_destroy(session, false));
     WT_TRET(__wt_sweep_destroy(session));
@@ -150,6 +151,11 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
     /* Close operation tracking */
     WT_TRET(__wt_conn_optrack_teardown(session, false));
 
+    /* Close operation capture, sessions have written their records. */
+    WT_TRET(__wt_conn_capture_teardown(session));
+
+    __wt_free(session, conn->event_trace_path);
+
 #ifdef HAVE_CALL_LOG
     WT_TRET(__wt_conn_call_log_teardown(session));
 #endif
@@ -169,8 +175,9 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
     }
 
     /*
-     * The session split stash, hazard information and handle arrays aren't discarded during normal
-     * session close, they persist past the life of the session. Discard them now.
+     * The session split stash, hazard information, handle arrays and event trace buffers aren't
+     * discarded during normal session close, they persist past the life of the session. Discard
+     * them now.
      */
     if (!F_ISSET(conn, WT_CONN_LEAK_MEMORY))
         if ((s = conn->sessions) != NULL)
@@ -179,6 +186,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
                 __wt_free(session, s->dhhash);
                 __wt_stash_discard_all(session, s);
                 __wt_free(session, s->hazard);
+                __wt_free(session, s->trace_buf);
             }
 
     /* Destroy the file-system configuration. */
@@ -253,5 +261,8 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
     /* Start the optional checkpoint thread. */
     WT_RET(__wt_checkpoint_server_create(session, cfg));
 
+    /* Start the optional background compaction thread. */
+    WT_RET(__wt_compact_server_create(session, cfg));
+
     return (0);
 }
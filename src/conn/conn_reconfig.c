@@ -195,6 +195,128 @@ err:
     return (ret);
 }
 
+/*
+ * __wt_conn_capture_setup --
+ *     Set up operation capture.
+ */
+int
+__wt_conn_capture_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
+{
+    struct timespec ts;
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(buf);
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    /* Once an operation capture path has been set it can't be changed. */
+    if (!reconfig) {
+        WT_RET(__wt_config_gets(session, cfg, "operation_capture.path", &cval));
+        WT_RET(__wt_strndup(session, cval.str, cval.len, &conn->capture_path));
+    }
+
+    /*
+     * Sessions stop capturing when capture is turned off, their buffered records are written when
+     * they close.
+     */
+    WT_RET(__wt_config_gets(session, cfg, "operation_capture.enabled", &cval));
+    if (cval.val == 0) {
+        F_CLR(conn, WT_CONN_CAPTURE);
+        return (0);
+    }
+    if (F_ISSET(conn, WT_CONN_READONLY))
+        WT_RET_MSG(
+          session, EINVAL, "Operation capture is incompatible with read only configuration");
+
+    /*
+     * The map from table IDs to URIs and the start of the capture clock last the life of the
+     * connection, records captured when capture is turned back on continue the same timeline.
+     */
+    if (conn->capture_map_fh == NULL) {
+        WT_RET(__wt_scr_alloc(session, 0, &buf));
+        WT_ERR(__wt_filename_construct(
+          session, conn->capture_path, "capture-map", __wt_process_id(), UINT32_MAX, buf));
+        WT_ERR(__wt_spin_init(session, &conn->capture_map_spinlock, "capture map spinlock"));
+        if ((ret = __wt_open(session, (const char *)buf->data, WT_FS_OPEN_FILE_TYPE_REGULAR,
+               WT_FS_OPEN_CREATE, &conn->capture_map_fh)) != 0) {
+            __wt_spin_destroy(session, &conn->capture_map_spinlock);
+            goto err;
+        }
+        /* Discard the map of an earlier connection in this process, table IDs restart at 1. */
+        WT_ERR(__wt_ftruncate(session, conn->capture_map_fh, 0));
+
+        conn->capture_start = __wt_clock(session);
+        __wt_epoch(session, &ts);
+        conn->capture_epoch_nsec = (uint64_t)ts.tv_sec * WT_BILLION + (uint64_t)ts.tv_nsec;
+    }
+    F_SET(conn, WT_CONN_CAPTURE);
+
+err:
+    __wt_scr_free(session, &buf);
+    return (ret);
+}
+
+/*
+ * __wt_conn_capture_teardown --
+ *     Clean up connection-wide resources used for operation capture.
+ */
+int
+__wt_conn_capture_teardown(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+
+    conn = S2C(session);
+
+    F_CLR(conn, WT_CONN_CAPTURE);
+    if (conn->capture_map_fh != NULL) {
+        WT_TRET(__wt_close(session, &conn->capture_map_fh));
+        __wt_spin_destroy(session, &conn->capture_map_spinlock);
+    }
+    __wt_free(session, conn->capture_path);
+    return (ret);
+}
+
+/*
+ * __wt_conn_event_trace_setup --
+ *     Set up event tracing.
+ */
+int
+__wt_conn_event_trace_setup(WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
+{
+    WT_CONFIG_ITEM cval;
+    WT_CONNECTION_IMPL *conn;
+    uint64_t records;
+
+    conn = S2C(session);
+
+    /*
+     * Once the event tracing path and buffer size have been set they can't be changed, session
+     * buffers are allocated when sessions first record an event and never resized. Round the buffer
+     * size down to a power-of-two number of records.
+     */
+    if (!reconfig) {
+        WT_RET(__wt_config_gets(session, cfg, "event_tracing.path", &cval));
+        WT_RET(__wt_strndup(session, cval.str, cval.len, &conn->event_trace_path));
+
+        WT_RET(__wt_config_gets(session, cfg, "event_tracing.buffer_size", &cval));
+        for (records = 1; records * 2 * sizeof(WT_EVENT_TRACE_RECORD) <= (uint64_t)cval.val;)
+            records *= 2;
+        conn->event_trace_records = records;
+    }
+
+    WT_RET(__wt_config_gets(session, cfg, "event_tracing.latency_threshold_ms", &cval));
+    conn->event_trace_threshold = (uint64_t)cval.val * WT_MILLION;
+
+    WT_RET(__wt_config_gets(session, cfg, "event_tracing.enabled", &cval));
+    if (cval.val != 0)
+        F_SET(conn, WT_CONN_EVENT_TRACE);
+    else
+        F_CLR(conn, WT_CONN_EVENT_TRACE);
+    return (0);
+}
+
 /*
  * __wt_conn_optrack_setup --
  *     Set up operation logging.
@@ -406,11 +528,14 @@ __wt_conn_reconfig(WT_SESSION_IMPL *session, const char **cfg)
     WT_WITH_CHECKPOINT_LOCK(session, ret = __wt_conn_compat_config(session, cfg, true));
     WT_ERR(ret);
     WT_ERR(__wt_blkcache_setup(session, cfg, true));
+    WT_ERR(__wt_conn_capture_setup(session, cfg, true));
+    WT_ERR(__wt_conn_event_trace_setup(session, cfg, true));
     WT_ERR(__wt_conn_optrack_setup(session, cfg, true));
     WT_ERR(__wt_conn_statistics_config(session, cfg));
     WT_ERR(__wt_cache_config(session, cfg, true));
     WT_ERR(__wt_capacity_server_create(session, cfg));
     WT_ERR(__wt_checkpoint_server_create(session, cfg));
+    WT_ERR(__wt_compact_server_create(session, cfg));
     WT_ERR(__wt_debug_mode_config(session, cfg));
     WT_ERR(__wt_extra_diagnostics_config(session, cfg));
     WT_ERR(__wt_hs_config(session, cfg));
@@ -399,8 +399,15 @@ __sweep_server(void *arg)
 
         WT_ERR(__sweep_discard_trees(session, &dead_handles));
 
-        if (dead_handles > 0)
-            WT_ERR(__sweep_remove_handles(session));
+        /*
+         * Handles are removed one at a time under the handle list lock, then destroyed together
+         * once the lock is released.
+         */
+        if (dead_handles > 0) {
+            ret = __sweep_remove_handles(session);
+            WT_TRET(__wt_conn_dhandle_discard_deferred(session));
+            WT_ERR(ret);
+        }
 
         /*
          * Check for any "rogue" sessions, which did not run a session sweep in a long time.
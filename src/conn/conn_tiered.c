@@ -155,6 +155,101 @@ err:
     return (ret);
 }
 
+/*
+ * __tier_object_name --
+ *     Return the name of an object in the bucket: the bucket prefix followed by the object's name.
+ *     The caller is responsible for freeing the returned name.
+ */
+static int
+__tier_object_name(WT_SESSION_IMPL *session, WT_TIERED *tiered, const char *obj_uri, char **namep)
+{
+    WT_CONFIG_ITEM pfx;
+    WT_DECL_RET;
+    size_t len;
+    char *tmp;
+    const char *cfg[2], *obj_name;
+
+    *namep = NULL;
+
+    obj_name = obj_uri;
+    WT_PREFIX_SKIP_REQUIRED(session, obj_name, "object:");
+    cfg[0] = tiered->obj_config;
+    cfg[1] = NULL;
+    WT_RET(__wt_config_gets(session, cfg, "tiered_storage.bucket_prefix", &pfx));
+    WT_ASSERT(session, pfx.len != 0);
+    len = strlen(obj_name) + pfx.len + 1;
+    WT_RET(__wt_calloc_def(session, len, &tmp));
+    WT_ERR(__wt_snprintf(tmp, len, "%.*s%s", (int)pfx.len, pfx.str, obj_name));
+    *namep = tmp;
+    return (0);
+
+err:
+    __wt_free(session, tmp);
+    return (ret);
+}
+
+/*
+ * __tier_flush_queue_done --
+ *     Record a completed flush in the metadata and queue the work that follows it. Called with the
+ *     schema lock held so a drop can't remove the table's work in between.
+ */
+static int
+__tier_flush_queue_done(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint32_t id,
+  const char *local_uri, const char *obj_uri)
+{
+    WT_DECL_RET;
+    char *obj_value;
+
+    /*
+     * The table may have been dropped while the object was copied. The drop removed the object's
+     * metadata, check for it before using the tiered handle, which may have been discarded.
+     */
+    if ((ret = __wt_metadata_search(session, obj_uri, &obj_value)) == WT_NOTFOUND)
+        return (ENOENT);
+    WT_RET(ret);
+    __wt_free(session, obj_value);
+
+    WT_RET(__tier_flush_meta(session, tiered, local_uri, obj_uri));
+
+    /*
+     * After successful flushing, push a work unit to perform whatever post-processing the shared
+     * storage wants to do for this object. Note that this work unit is unrelated to the remove
+     * local work unit below. They do not need to be in any order and do not interfere with each
+     * other.
+     */
+    WT_RET(__wt_tiered_put_flush_finish(session, tiered, id));
+    /*
+     * After successful flushing, push a work unit to remove the local object in the future. The
+     * object will be removed locally after the local retention period expires.
+     */
+    WT_RET(__wt_tiered_put_remove_local(session, tiered, id));
+    return (0);
+}
+
+/*
+ * __tier_flush_done --
+ *     Finish a flush once the object has been copied to shared storage, or the copy failed.
+ */
+static int
+__tier_flush_done(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint32_t id, const char *local_uri,
+  const char *obj_uri, int flush_ret)
+{
+    WT_DECL_RET;
+
+    ret = flush_ret;
+    if (ret == 0)
+        WT_WITH_CHECKPOINT_LOCK(session,
+          WT_WITH_SCHEMA_LOCK(
+            session, ret = __tier_flush_queue_done(session, tiered, id, local_uri, obj_uri)));
+    /*
+     * If a user did a flush_tier with sync off, it is possible that a drop happened before the
+     * flush work unit was processed. Ignore non-existent errors from either previous call.
+     */
+    if (ret == ENOENT)
+        return (0);
+    return (ret);
+}
+
 /*
  * __tier_do_operation --
  *     Perform one iteration of copying newly flushed objects to shared storage or post-flush
@@ -164,13 +259,11 @@ static int
 __tier_do_operation(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint32_t id, const char *local_uri,
   const char *obj_uri, uint32_t op)
 {
-    WT_CONFIG_ITEM pfx;
     WT_DECL_RET;
     WT_FILE_SYSTEM *bucket_fs;
     WT_STORAGE_SOURCE *storage_source;
-    size_t len;
     char *tmp;
-    const char *cfg[2], *local_name, *obj_name;
+    const char *local_name;
 
     WT_ASSERT(session, (op == WT_TIERED_WORK_FLUSH || op == WT_TIERED_WORK_FLUSH_FINISH));
     tmp = NULL;
@@ -183,15 +276,7 @@ __tier_do_operation(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint32_t id, co
 
     local_name = local_uri;
     WT_PREFIX_SKIP_REQUIRED(session, local_name, "file:");
-    obj_name = obj_uri;
-    WT_PREFIX_SKIP_REQUIRED(session, obj_name, "object:");
-    cfg[0] = tiered->obj_config;
-    cfg[1] = NULL;
-    WT_RET(__wt_config_gets(session, cfg, "tiered_storage.bucket_prefix", &pfx));
-    WT_ASSERT(session, pfx.len != 0);
-    len = strlen(obj_name) + pfx.len + 1;
-    WT_RET(__wt_calloc_def(session, len, &tmp));
-    WT_ERR(__wt_snprintf(tmp, len, "%.*s%s", (int)pfx.len, pfx.str, obj_name));
+    WT_RET(__tier_object_name(session, tiered, obj_uri, &tmp));
 
     if (op == WT_TIERED_WORK_FLUSH_FINISH)
         WT_ERR(storage_source->ss_flush_finish(
@@ -201,32 +286,7 @@ __tier_do_operation(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint32_t id, co
         /* This call make take a while, and may fail due to network timeout. */
         ret = storage_source->ss_flush(
           storage_source, &session->iface, bucket_fs, local_name, tmp, NULL);
-        if (ret == 0)
-            WT_WITH_CHECKPOINT_LOCK(session,
-              WT_WITH_SCHEMA_LOCK(
-                session, ret = __tier_flush_meta(session, tiered, local_uri, obj_uri)));
-        /*
-         * If a user did a flush_tier with sync off, it is possible that a drop happened before the
-         * flush work unit was processed. Ignore non-existent errors from either previous call.
-         */
-        if (ret == ENOENT)
-            ret = 0;
-        else {
-            WT_ERR(ret);
-
-            /*
-             * After successful flushing, push a work unit to perform whatever post-processing the
-             * shared storage wants to do for this object. Note that this work unit is unrelated to
-             * the remove local work unit below. They do not need to be in any order and do not
-             * interfere with each other.
-             */
-            WT_ERR(__wt_tiered_put_flush_finish(session, tiered, id));
-            /*
-             * After successful flushing, push a work unit to remove the local object in the future.
-             * The object will be removed locally after the local retention period expires.
-             */
-            WT_ERR(__wt_tiered_put_remove_local(session, tiered, id));
-        }
+        WT_ERR(__tier_flush_done(session, tiered, id, local_uri, obj_uri, ret));
     }
 
 err:
@@ -297,6 +357,203 @@ err:
     return (ret);
 }
 
+/*
+ * __tier_upload_free --
+ *     Free a multipart flush, not including its flush work unit.
+ */
+static void
+__tier_upload_free(WT_SESSION_IMPL *session, WT_TIERED_UPLOAD *upload)
+{
+    __wt_free(session, upload->local_uri);
+    __wt_free(session, upload->obj_uri);
+    __wt_free(session, upload->object);
+    __wt_free(session, upload);
+}
+
+/*
+ * __tier_upload_start --
+ *     Start a multipart flush of the object of a flush work unit if the storage source supports
+ *     them and the object is larger than a part. The multipart flush takes ownership of the work
+ *     unit, the work unit is cleared to tell the caller.
+ */
+static int
+__tier_upload_start(WT_SESSION_IMPL *session, WT_TIERED_WORK_UNIT **entryp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_TIERED *tiered;
+    WT_TIERED_UPLOAD *upload;
+    WT_TIERED_WORK_UNIT *entry;
+    const char *local_name;
+
+    conn = S2C(session);
+    entry = *entryp;
+    tiered = entry->tiered;
+
+    if (tiered->bstorage->storage_source->ss_flush_part == NULL)
+        return (0);
+
+    WT_RET(__wt_calloc_one(session, &upload));
+    WT_ERR(__wt_tiered_name(
+      session, &tiered->iface, entry->id, WT_TIERED_NAME_LOCAL, &upload->local_uri));
+    WT_ERR(__wt_tiered_name(
+      session, &tiered->iface, entry->id, WT_TIERED_NAME_OBJECT, &upload->obj_uri));
+
+    /*
+     * Small objects are flushed with a single call. So are dropped files, the flush ignores the
+     * error.
+     */
+    local_name = upload->local_uri;
+    WT_PREFIX_SKIP_REQUIRED(session, local_name, "file:");
+    WT_ERR_ERROR_OK(__wt_fs_size(session, local_name, &upload->size), ENOENT, true);
+    if (ret == ENOENT || (uint64_t)upload->size <= conn->tiered_part_size) {
+        ret = 0;
+        goto err;
+    }
+
+    WT_ERR(__tier_object_name(session, tiered, upload->obj_uri, &upload->object));
+    upload->storage_source = tiered->bstorage->storage_source;
+    upload->bucket_fs = tiered->bstorage->file_system;
+    upload->part_size = conn->tiered_part_size;
+    upload->parts =
+      (uint32_t)(((uint64_t)upload->size + upload->part_size - 1) / upload->part_size);
+    upload->entry = entry;
+
+    __wt_verbose_debug2(session, WT_VERB_TIERED,
+      "UPLOAD: %s in %" PRIu32 " parts of %" PRIu64 " bytes", upload->object, upload->parts,
+      upload->part_size);
+    WT_STAT_CONN_INCR(session, tiered_flush_multipart);
+    __wt_spin_lock(session, &conn->tiered_lock);
+    TAILQ_INSERT_TAIL(&conn->tiered_uploadqh, upload, q);
+    __wt_spin_unlock(session, &conn->tiered_lock);
+    *entryp = NULL;
+
+    /* Wake the other flush threads to help copy the parts. */
+    if (conn->tiered_flush_workers > 1)
+        __wt_cond_signal(session, conn->tiered_flush_threads.wait_cond);
+    return (0);
+
+err:
+    __tier_upload_free(session, upload);
+    return (ret);
+}
+
+/*
+ * __wt_tiered_upload_discard --
+ *     Discard the parts of a multipart flush that won't complete, and free it and its flush work
+ *     unit. The flush must be off the queue with no parts being copied.
+ */
+int
+__wt_tiered_upload_discard(WT_SESSION_IMPL *session, WT_TIERED_UPLOAD *upload)
+{
+    WT_DECL_RET;
+    WT_STORAGE_SOURCE *storage_source;
+    const char *local_name;
+
+    storage_source = upload->storage_source;
+    local_name = upload->local_uri;
+    WT_PREFIX_SKIP_REQUIRED(session, local_name, "file:");
+    ret = storage_source->ss_flush_complete(storage_source, &session->iface, upload->bucket_fs,
+      local_name, upload->object, upload->parts, true, NULL);
+    __wt_verbose_debug2(session, WT_VERB_TIERED, "UPLOAD: %s discarded: %d", upload->object, ret);
+    __wt_tiered_work_free(session, upload->entry);
+    __tier_upload_free(session, upload);
+    return (ret);
+}
+
+/*
+ * __tier_upload_next_part --
+ *     Claim the next part to copy of a multipart flush in progress, if there is one.
+ */
+static void
+__tier_upload_next_part(WT_SESSION_IMPL *session, WT_TIERED_UPLOAD **uploadp, uint32_t *partp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_TIERED_UPLOAD *upload;
+
+    *uploadp = NULL;
+    *partp = 0;
+
+    conn = S2C(session);
+    if (TAILQ_EMPTY(&conn->tiered_uploadqh))
+        return;
+    __wt_spin_lock(session, &conn->tiered_lock);
+    TAILQ_FOREACH (upload, &conn->tiered_uploadqh, q)
+        if (upload->next_part < upload->parts) {
+            *partp = upload->next_part++;
+            *uploadp = upload;
+            break;
+        }
+    __wt_spin_unlock(session, &conn->tiered_lock);
+}
+
+/*
+ * __tier_upload_part --
+ *     Copy a part of a multipart flush. The thread that accounts for the last part completes the
+ *     flush.
+ */
+static int
+__tier_upload_part(WT_SESSION_IMPL *session, WT_TIERED_UPLOAD *upload, uint32_t part)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_STORAGE_SOURCE *storage_source;
+    WT_TIERED_WORK_UNIT *entry;
+    wt_off_t offset;
+    size_t len;
+    const char *local_name;
+    bool done;
+
+    conn = S2C(session);
+    storage_source = upload->storage_source;
+    local_name = upload->local_uri;
+    WT_PREFIX_SKIP_REQUIRED(session, local_name, "file:");
+
+    /* Once the flush has failed, skip the remaining parts. */
+    if (upload->error == 0) {
+        offset = (wt_off_t)(part * upload->part_size);
+        len = (size_t)WT_MIN(upload->part_size, (uint64_t)(upload->size - offset));
+        /* This call make take a while, and may fail due to network timeout. */
+        ret = storage_source->ss_flush_part(storage_source, &session->iface, upload->bucket_fs,
+          local_name, upload->object, part, offset, len, NULL);
+        if (ret == 0)
+            WT_STAT_CONN_INCR(session, tiered_flush_parts);
+    }
+
+    /*
+     * A dropped table's flush has been taken off the queue, the dropping thread waits for its parts
+     * in progress and discards it.
+     */
+    __wt_spin_lock(session, &conn->tiered_lock);
+    if (ret != 0 && upload->error == 0)
+        upload->error = ret;
+    done = ++upload->parts_done == upload->parts && !upload->dropped;
+    if (done)
+        TAILQ_REMOVE(&conn->tiered_uploadqh, upload, q);
+    __wt_spin_unlock(session, &conn->tiered_lock);
+    if (!done)
+        return (0);
+
+    /*
+     * All the parts are copied, complete the flush, or discard the parts if it failed. A flush that
+     * failed because the local file or the table was dropped is discarded without touching the
+     * tiered handle, which may have been closed.
+     */
+    entry = upload->entry;
+    ret = upload->error;
+    WT_TRET(storage_source->ss_flush_complete(storage_source, &session->iface, upload->bucket_fs,
+      local_name, upload->object, upload->parts, upload->error != 0, NULL));
+    __wt_verbose_debug2(
+      session, WT_VERB_TIERED, "UPLOAD: %s complete: %d", upload->object, upload->error);
+    ret = __tier_flush_done(
+      session, entry->tiered, entry->id, upload->local_uri, upload->obj_uri, ret);
+
+    /* We are responsible for freeing the work unit when we're done with it. */
+    __wt_tiered_work_free(session, entry);
+    __tier_upload_free(session, upload);
+    return (ret);
+}
+
 /*
  * __tier_storage_copy --
  *     Perform one iteration of copying newly flushed objects to the shared storage.
@@ -305,17 +562,27 @@ static int
 __tier_storage_copy(WT_SESSION_IMPL *session)
 {
     WT_DECL_RET;
+    WT_TIERED_UPLOAD *upload;
     WT_TIERED_WORK_UNIT *entry;
+    uint32_t part;
 
-    /* There is nothing to do until the checkpoint after the flush completes. */
-    if (!S2C(session)->flush_ckpt_complete)
-        return (0);
     entry = NULL;
     for (;;) {
         /* Check if we're quitting or being reconfigured. */
         if (!__tiered_server_run_chk(session))
             break;
 
+        /* Help copy the parts of multipart flushes in progress before starting another flush. */
+        __tier_upload_next_part(session, &upload, &part);
+        if (upload != NULL) {
+            WT_ERR(__tier_upload_part(session, upload, part));
+            continue;
+        }
+
+        /* There is nothing to do until the checkpoint after the flush completes. */
+        if (!S2C(session)->flush_ckpt_complete)
+            break;
+
         /*
          * We probably need some kind of flush generation so that we don't process flush items for
          * tables that are added during an in-progress flush_tier. This thread could run due to a
@@ -326,6 +593,9 @@ __tier_storage_copy(WT_SESSION_IMPL *session)
         __wt_tiered_get_flush(session, &entry);
         if (entry == NULL)
             break;
+        WT_ERR(__tier_upload_start(session, &entry));
+        if (entry == NULL)
+            continue;
         WT_ERR(__tier_operation(session, entry->tiered, entry->id, WT_TIERED_WORK_FLUSH));
         /*
          * We are responsible for freeing the work unit when we're done with it.
@@ -340,6 +610,25 @@ err:
     return (ret);
 }
 
+/*
+ * __tiered_flush_thread_run --
+ *     Entry function for a tiered flush thread. This is called repeatedly from the thread group
+ *     code so it does not need to loop itself.
+ */
+static int
+__tiered_flush_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+    WT_CONNECTION_IMPL *conn;
+
+    WT_UNUSED(thread);
+    conn = S2C(session);
+
+    /* Wait until the tiered storage server or another flush thread signals there is work. */
+    __wt_cond_wait(session, conn->tiered_flush_threads.wait_cond,
+      conn->tiered_interval * WT_MILLION, __tiered_server_run_chk);
+    return (__tier_storage_copy(session));
+}
+
 /*
  * __tier_storage_remove --
  *     Perform one iteration of tiered storage local tier removal.
@@ -396,13 +685,17 @@ __tiered_server(void *arg)
         timediff = WT_CLOCKDIFF_SEC(time_stop, time_start);
         /*
          * Here is where we do work. Work we expect to do:
-         *  - Copy any files that need moving from a flush tier call.
+         *  - Copy any files that need moving from a flush tier call, or wake the flush threads to
+         *    copy them.
          *  - Perform any shared storage processing after flushing.
          *  - Remove any cached objects that are aged out.
          */
         if (timediff >= conn->tiered_interval || signalled) {
             msg = "tier_storage_copy";
-            WT_ERR(__tier_storage_copy(session));
+            if (conn->tiered_flush_workers > 1)
+                __wt_cond_signal(session, conn->tiered_flush_threads.wait_cond);
+            else
+                WT_ERR(__tier_storage_copy(session));
             msg = "tier_storage_finish";
             WT_ERR(__tier_storage_finish(session));
             msg = "tier_storage_remove";
@@ -446,6 +739,17 @@ __wt_tiered_storage_create(WT_SESSION_IMPL *session)
      * work is already done in the flush_tier. So do it there and keep that code together.
      */
     F_SET(conn, WT_CONN_TIERED_FIRST_FLUSH);
+
+    /*
+     * With more than one flush thread, a thread group copies the objects to shared storage. Start
+     * it before the server thread, the server signals it.
+     */
+    if (conn->tiered_flush_workers > 1)
+        WT_ERR(__wt_thread_group_create(session, &conn->tiered_flush_threads, "tiered-flush",
+          conn->tiered_flush_workers, conn->tiered_flush_workers,
+          WT_THREAD_CAN_WAIT | WT_THREAD_PANIC_FAIL, __tiered_server_run_chk,
+          __tiered_flush_thread_run, NULL));
+
     /* Start the thread. */
     WT_ERR(__wt_thread_create(session, &conn->tiered_tid, __tiered_server, session));
     conn->tiered_tid_set = true;
@@ -467,6 +771,7 @@ __wt_tiered_storage_destroy(WT_SESSION_IMPL *session, bool final_flush)
 {
     WT_CONNECTION_IMPL *conn;
     WT_DECL_RET;
+    WT_TIERED_UPLOAD *upload;
     WT_TIERED_WORK_UNIT *entry;
 
     conn = S2C(session);
@@ -487,10 +792,20 @@ __wt_tiered_storage_destroy(WT_SESSION_IMPL *session, bool final_flush)
         __wt_cond_signal(session, conn->tiered_cond);
         WT_TRET(__wt_thread_join(session, &conn->tiered_tid));
         conn->tiered_tid_set = false;
-        while ((entry = TAILQ_FIRST(&conn->tieredqh)) != NULL) {
-            TAILQ_REMOVE(&conn->tieredqh, entry, q);
-            __wt_tiered_work_free(session, entry);
-        }
+    }
+    /* The server signals the flush threads, stop them only after the server has exited. */
+    if (conn->tiered_flush_threads.alloc != 0) {
+        __wt_writelock(session, &conn->tiered_flush_threads.lock);
+        WT_TRET(__wt_thread_group_destroy(session, &conn->tiered_flush_threads));
+    }
+    while ((entry = TAILQ_FIRST(&conn->tieredqh)) != NULL) {
+        TAILQ_REMOVE(&conn->tieredqh, entry, q);
+        __wt_tiered_work_free(session, entry);
+    }
+    /* Discard the parts of unfinished multipart flushes, recovery flushes the objects again. */
+    while ((upload = TAILQ_FIRST(&conn->tiered_uploadqh)) != NULL) {
+        TAILQ_REMOVE(&conn->tiered_uploadqh, upload, q);
+        WT_TRET(__wt_tiered_upload_discard(session, upload));
     }
     if (conn->tiered_session != NULL) {
         WT_TRET(__wt_session_close_internal(conn->tiered_session));
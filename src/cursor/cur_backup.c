@@ -230,8 +230,12 @@ err:
      */
     if (F_ISSET(cb, WT_CURBACKUP_DUP)) {
         WT_TRET(__backup_free(session, cb));
-        /* Make sure the original backup cursor is still open. */
-        WT_ASSERT(session, F_ISSET(session, WT_SESSION_BACKUP_CURSOR));
+        /*
+         * Make sure the original backup cursor is still open. Parallel cursors can be opened in
+         * sessions other than the one owning the original backup cursor.
+         */
+        WT_ASSERT(session,
+          F_ISSET(cb, WT_CURBACKUP_PARALLEL) || F_ISSET(session, WT_SESSION_BACKUP_CURSOR));
         F_CLR(session, WT_SESSION_BACKUP_DUP);
         F_CLR(cb, WT_CURBACKUP_DUP);
     } else if (F_ISSET(cb, WT_CURBACKUP_LOCKER))
@@ -311,7 +315,7 @@ __wt_curbackup_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *other,
     WT_WITH_CHECKPOINT_LOCK(
       session, WT_WITH_SCHEMA_LOCK(session, ret = __backup_start(session, cb, othercb, cfg)));
     WT_ERR(ret);
-    WT_ERR(cb->incr_file == NULL ?
+    WT_ERR(cb->incr_file == NULL && !F_ISSET(cb, WT_CURBACKUP_PARALLEL) ?
         __wt_cursor_init(cursor, uri, NULL, cfg, cursorp) :
         __wt_curbackup_open_incr(session, uri, other, cursor, cfg, cursorp));
 
@@ -506,6 +510,15 @@ __backup_config(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb, const char *cfg[
         F_SET(cb, WT_CURBACKUP_CONSOLIDATE);
         incremental_config = true;
     }
+    WT_RET(__wt_config_gets(session, cfg, "incremental.consolidate_max", &cval));
+    if (cval.val != 0) {
+        if (is_dup)
+            WT_RET_MSG(session, EINVAL,
+              "Incremental consolidation can only be specified on a primary backup cursor");
+        cb->consolidate_max = (uint64_t)cval.val;
+        F_SET(cb, WT_CURBACKUP_CONSOLIDATE);
+        incremental_config = true;
+    }
 
     /*
      * Specifying an incremental file means we're opening a duplicate backup cursor.
@@ -519,6 +532,30 @@ __backup_config(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb, const char *cfg[
         incremental_config = true;
     }
 
+    /*
+     * A parallel duplicate cursor takes its files from the primary backup cursor's list rather than
+     * being opened for a single file.
+     */
+    WT_RET(__wt_config_gets(session, cfg, "incremental.parallel", &cval));
+    if (cval.val) {
+        if (!is_dup)
+            WT_RET_MSG(session, EINVAL,
+              "Incremental parallel cursors can only be opened as duplicate backup cursors");
+        if (cb->incr_file != NULL)
+            WT_RET_MSG(session, EINVAL,
+              "Incremental parallel cursors cannot be configured with a file name");
+        F_SET(cb, WT_CURBACKUP_PARALLEL);
+        incremental_config = true;
+    }
+    WT_RET(__wt_config_gets(session, cfg, "incremental.return_data", &cval));
+    if (cval.val) {
+        if (cb->incr_file == NULL && !F_ISSET(cb, WT_CURBACKUP_PARALLEL))
+            WT_RET_MSG(session, EINVAL,
+              "Incremental data can only be returned by a file or parallel duplicate backup "
+              "cursor");
+        F_SET(cb, WT_CURBACKUP_RETURN_DATA);
+    }
+
     /*
      * See if we have a source identifier. We must process the source identifier before processing
      * the 'this' identifier. That will mark which source is in use so that we can use any slot that
@@ -731,6 +768,7 @@ __backup_start(
 
         /* We're the lock holder, we own cleanup. */
         F_SET(cb, WT_CURBACKUP_LOCKER);
+        WT_ERR(__wt_spin_init(session, &cb->incr_lock, "backup work queue"));
         /*
          * If we are a query backup cursor there are no configuration settings and it will set up
          * its own list of strings to return. We don't have to do any of the other processing. A
@@ -852,6 +890,7 @@ __backup_stop(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb)
     if (cb->incr_src != NULL)
         F_CLR(cb->incr_src, WT_BLKINCR_INUSE);
     WT_TRET(__backup_free(session, cb));
+    __wt_spin_destroy(session, &cb->incr_lock);
 
     /* Remove any backup specific file. */
     WT_TRET(__wt_backup_file_remove(session));
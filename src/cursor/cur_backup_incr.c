@@ -29,7 +29,7 @@ __wt_backup_load_incr(
  *     information with it.
  */
 static int
-__curbackup_incr_blkmod(WT_SESSION_IMPL *session, WT_BTREE *btree, WT_CURSOR_BACKUP *cb)
+__curbackup_incr_blkmod(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR_BACKUP *cb)
 {
     WT_CKPT ckpt;
     WT_CONFIG blkconf;
@@ -37,13 +37,11 @@ __curbackup_incr_blkmod(WT_SESSION_IMPL *session, WT_BTREE *btree, WT_CURSOR_BAC
     WT_DECL_RET;
     char *config;
 
-    WT_ASSERT(session, btree != NULL);
-    WT_ASSERT(session, btree->dhandle != NULL);
     WT_ASSERT(session, cb->incr_src != NULL);
 
-    WT_RET(__wt_metadata_search(session, btree->dhandle->name, &config));
+    WT_RET(__wt_metadata_search(session, uri, &config));
     /* Check if this is a file with no checkpointed content. */
-    ret = __wt_meta_checkpoint(session, btree->dhandle->name, 0, &ckpt);
+    ret = __wt_meta_checkpoint(session, uri, 0, &ckpt);
     if (ret == 0 && ckpt.addr.size == 0)
         F_SET(cb, WT_CURBACKUP_CKPT_FAKE);
     __wt_meta_checkpoint_free(session, &ckpt);
@@ -110,30 +108,22 @@ err:
 }
 
 /*
- * __curbackup_incr_next --
- *     WT_CURSOR->next method for the btree cursor type when configured with incremental_backup.
+ * __curbackup_incr_range --
+ *     Return the next range to copy from the backup cursor's current file.
  */
 static int
-__curbackup_incr_next(WT_CURSOR *cursor)
+__curbackup_incr_range(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb, uint64_t *offsetp,
+  uint64_t *sizep, uint64_t *typep)
 {
-    WT_BTREE *btree;
-    WT_CURSOR_BACKUP *cb;
     WT_DECL_ITEM(buf);
     WT_DECL_RET;
-    WT_SESSION_IMPL *session;
     wt_off_t size;
-    uint64_t start_bitoff, total_len, raw;
+    uint64_t start_bitoff, total_len;
     const char *file;
     bool found;
 
-    cb = (WT_CURSOR_BACKUP *)cursor;
-    btree = cb->incr_cursor == NULL ? NULL : CUR2BT(cb->incr_cursor);
-    raw = F_MASK(cursor, WT_CURSTD_RAW);
-    CURSOR_API_CALL(cursor, session, get_value, btree);
-    F_CLR(cursor, WT_CURSTD_RAW);
-
     if (!F_ISSET(cb, WT_CURBACKUP_INCR_INIT) &&
-      (btree == NULL || F_ISSET(cb, WT_CURBACKUP_FORCE_FULL | WT_CURBACKUP_RENAME))) {
+      F_ISSET(cb, WT_CURBACKUP_FORCE_FULL | WT_CURBACKUP_RENAME)) {
         /*
          * We don't have this object's incremental information or it's a forced file copy. If this
          * is a log file, use the full pathname that may include the log path.
@@ -156,7 +146,9 @@ __curbackup_incr_next(WT_CURSOR *cursor)
         F_SET(cb, WT_CURBACKUP_INCR_INIT);
         __wt_verbose_debug2(session, WT_VERB_BACKUP, "Set key WT_BACKUP_FILE %s size %" PRIuMAX,
           cb->incr_file, (uintmax_t)size);
-        __wt_cursor_set_key(cursor, 0, size, WT_BACKUP_FILE);
+        *offsetp = 0;
+        *sizep = (uint64_t)size;
+        *typep = WT_BACKUP_FILE;
     } else {
         if (!F_ISSET(cb, WT_CURBACKUP_INCR_INIT)) {
             /*
@@ -165,7 +157,9 @@ __curbackup_incr_next(WT_CURSOR *cursor)
              * the incremental identifier starting point. Walk the list looking for one with a
              * source of our id.
              */
-            WT_ERR(__curbackup_incr_blkmod(session, btree, cb));
+            WT_ERR(__wt_scr_alloc(session, 0, &buf));
+            WT_ERR(__wt_buf_fmt(session, buf, "file:%s", cb->incr_file));
+            WT_ERR(__curbackup_incr_blkmod(session, buf->data, cb));
             /*
              * There are several cases where we do not have block modification information for
              * the file. They are described and handled as follows:
@@ -185,7 +179,9 @@ __curbackup_incr_next(WT_CURSOR *cursor)
                     WT_ERR(__wt_fs_size(session, cb->incr_file, &size));
                     __wt_verbose_debug2(session, WT_VERB_BACKUP,
                       "Set key WT_BACKUP_FILE %s size %" PRIuMAX, cb->incr_file, (uintmax_t)size);
-                    __wt_cursor_set_key(cursor, 0, size, WT_BACKUP_FILE);
+                    *offsetp = 0;
+                    *sizep = (uint64_t)size;
+                    *typep = WT_BACKUP_FILE;
                     goto done;
                 }
                 WT_ERR(WT_NOTFOUND);
@@ -203,14 +199,19 @@ __curbackup_incr_next(WT_CURSOR *cursor)
                 found = true;
                 /*
                  * Care must be taken to leave the bit_offset field set to the next offset bit so
-                 * that the next call is set to the correct offset.
+                 * that the next call is set to the correct offset. A consolidated range stops at
+                 * the first unmodified chunk, or when adding another chunk would exceed the
+                 * configured maximum; the remaining chunks are returned by the next call.
                  */
                 start_bitoff = cb->bit_offset++;
-                if (F_ISSET(cb, WT_CURBACKUP_CONSOLIDATE)) {
-                    while (
-                      cb->bit_offset < cb->nbits && __bit_test(cb->bitstring.mem, cb->bit_offset++))
+                if (F_ISSET(cb, WT_CURBACKUP_CONSOLIDATE))
+                    while (cb->bit_offset < cb->nbits &&
+                      (cb->consolidate_max == 0 ||
+                        total_len + cb->granularity <= cb->consolidate_max) &&
+                      __bit_test(cb->bitstring.mem, cb->bit_offset)) {
                         total_len += cb->granularity;
-                }
+                        ++cb->bit_offset;
+                    }
                 break;
             } else
                 ++cb->bit_offset;
@@ -223,14 +224,256 @@ __curbackup_incr_next(WT_CURSOR *cursor)
         __wt_verbose_debug2(session, WT_VERB_BACKUP,
           "Set key WT_BACKUP_RANGE %s offset %" PRIu64 " length %" PRIu64, cb->incr_file,
           cb->offset + cb->granularity * start_bitoff, total_len);
-        __wt_cursor_set_key(
-          cursor, cb->offset + cb->granularity * start_bitoff, total_len, WT_BACKUP_RANGE);
+        *offsetp = cb->offset + cb->granularity * start_bitoff;
+        *sizep = total_len;
+        *typep = WT_BACKUP_RANGE;
     }
 
 done:
 err:
-    F_SET(cursor, raw);
     __wt_scr_free(session, &buf);
+    return (ret);
+}
+
+/*
+ * Ranges returned with their data are read in pieces of at most this size, a consolidated range or
+ * a single granularity chunk can be much larger.
+ */
+#define WT_BACKUP_INCR_READ_MAX (16 * WT_MEGABYTE)
+
+/*
+ * __curbackup_incr_range_next --
+ *     Return the next range to copy, first returning the remainder of a range split because it was
+ *     too large to read at once.
+ */
+static int
+__curbackup_incr_range_next(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb, bool capped,
+  uint64_t *offsetp, uint64_t *sizep, uint64_t *typep)
+{
+    if (cb->incr_rem_size != 0) {
+        *offsetp = cb->incr_rem_offset;
+        *sizep = cb->incr_rem_size;
+        *typep = WT_BACKUP_RANGE;
+    } else
+        WT_RET(__curbackup_incr_range(session, cb, offsetp, sizep, typep));
+
+    cb->incr_rem_size = 0;
+    if (capped && *typep == WT_BACKUP_RANGE && *sizep > WT_BACKUP_INCR_READ_MAX) {
+        cb->incr_rem_offset = *offsetp + WT_BACKUP_INCR_READ_MAX;
+        cb->incr_rem_size = *sizep - WT_BACKUP_INCR_READ_MAX;
+        *sizep = WT_BACKUP_INCR_READ_MAX;
+    }
+    return (0);
+}
+
+/*
+ * __curbackup_incr_read --
+ *     Read a range of a file into the cursor's value. Only block modification ranges are returned,
+ *     full file copies are left to the application.
+ */
+static int
+__curbackup_incr_read(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb, const char *file,
+  uint64_t offset, uint64_t size, uint64_t type)
+{
+    WT_CURSOR *cursor;
+    wt_off_t file_size;
+
+    cursor = &cb->iface;
+
+    if (type != WT_BACKUP_RANGE)
+        size = 0;
+    else {
+        /* Keep the handle open across ranges of the same file. */
+        if (cb->incr_fh != NULL && strcmp(cb->incr_fh->name, file) != 0)
+            WT_RET(__wt_close(session, &cb->incr_fh));
+        if (cb->incr_fh == NULL)
+            WT_RET(__wt_open(session, file, WT_FS_OPEN_FILE_TYPE_DATA, 0, &cb->incr_fh));
+
+        /*
+         * A range can extend past the current end of the file, the file may have shrunk since the
+         * block modifications were recorded. Missing data is ignored.
+         */
+        WT_RET(__wt_filesize(session, cb->incr_fh, &file_size));
+        if ((uint64_t)file_size <= offset)
+            size = 0;
+        else
+            size = WT_MIN(size, (uint64_t)file_size - offset);
+    }
+
+    /*
+     * Read straight into the cursor's buffer and return it without further copies. The buffer is
+     * aligned in case the file is configured for direct I/O.
+     */
+    F_SET(&cb->incr_data, WT_ITEM_ALIGNED);
+    WT_RET(__wt_buf_initsize(session, &cb->incr_data, (size_t)size));
+    if (size != 0)
+        WT_RET(__wt_read(session, cb->incr_fh, (wt_off_t)offset, (size_t)size, cb->incr_data.mem));
+
+    cursor->value.data = cb->incr_data.data;
+    cursor->value.size = cb->incr_data.size;
+    F_SET(cursor, WT_CURSTD_VALUE_INT);
+    return (0);
+}
+
+/*
+ * __curbackup_incr_next --
+ *     WT_CURSOR->next method for the btree cursor type when configured with incremental_backup.
+ */
+static int
+__curbackup_incr_next(WT_CURSOR *cursor)
+{
+    WT_BTREE *btree;
+    WT_CURSOR_BACKUP *cb;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    uint64_t offset, raw, size, type;
+
+    cb = (WT_CURSOR_BACKUP *)cursor;
+    btree = cb->incr_cursor == NULL ? NULL : CUR2BT(cb->incr_cursor);
+    raw = F_MASK(cursor, WT_CURSTD_RAW);
+    CURSOR_API_CALL(cursor, session, get_value, btree);
+    F_CLR(cursor, WT_CURSTD_RAW);
+    F_CLR(cursor, WT_CURSTD_VALUE_SET);
+
+    WT_ERR(__curbackup_incr_range_next(
+      session, cb, F_ISSET(cb, WT_CURBACKUP_RETURN_DATA), &offset, &size, &type));
+    if (F_ISSET(cb, WT_CURBACKUP_RETURN_DATA))
+        WT_ERR(__curbackup_incr_read(session, cb, cb->incr_file, offset, size, type));
+    __wt_cursor_set_key(cursor, offset, size, type);
+
+err:
+    F_SET(cursor, raw);
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curbackup_incr_open_file --
+ *     Open a file cursor on the backup cursor's current file, holding the tree open while its
+ *     blocks are copied.
+ */
+static int
+__curbackup_incr_open_file(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb, const char *cfg[])
+{
+    WT_DECL_ITEM(open_uri);
+    WT_DECL_RET;
+    uint64_t session_cache_flags;
+
+    WT_RET(__wt_scr_alloc(session, 0, &open_uri));
+    WT_ERR(__wt_buf_fmt(session, open_uri, "file:%s", cb->incr_file));
+    /*
+     * Incremental cursors use file cursors, but in a non-standard way. Turn off cursor caching as
+     * we open the cursor.
+     */
+    session_cache_flags = F_ISSET(session, WT_SESSION_CACHE_CURSORS);
+    F_CLR(session, WT_SESSION_CACHE_CURSORS);
+    ret = __wt_curfile_open(session, open_uri->data, NULL, cfg, &cb->incr_cursor);
+    F_SET(session, session_cache_flags);
+
+err:
+    __wt_scr_free(session, &open_uri);
+    return (ret);
+}
+
+/*
+ * __curbackup_incr_file_init --
+ *     Set up a backup cursor to return the information for a file.
+ */
+static void
+__curbackup_incr_file_init(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb)
+{
+    /* All WiredTiger owned files are full file copies. */
+    if (F_ISSET(cb->incr_src, WT_BLKINCR_FULL) || WT_PREFIX_MATCH(cb->incr_file, "WiredTiger")) {
+        __wt_verbose(session, WT_VERB_BACKUP, "Forcing full file copies for %s for id %s",
+          cb->incr_file, cb->incr_src->id_str);
+        F_SET(cb, WT_CURBACKUP_FORCE_FULL);
+    }
+}
+
+/*
+ * __curbackup_incr_next_parallel --
+ *     WT_CURSOR->next method for a parallel incremental backup cursor: take the next work unit from
+ *     the queue shared with the other parallel cursors.
+ */
+static int
+__curbackup_incr_next_parallel(WT_CURSOR *cursor)
+{
+    WT_CURSOR_BACKUP *cb, *pcb;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    uint64_t offset, raw, size, type;
+    const char *cfg[] = {NULL, NULL};
+    const char *file;
+    bool force_full, locked, new_file;
+
+    cb = (WT_CURSOR_BACKUP *)cursor;
+    pcb = cb->incr_primary;
+    locked = false;
+    raw = F_MASK(cursor, WT_CURSTD_RAW);
+    CURSOR_API_CALL(cursor, session, next, NULL);
+    F_CLR(cursor, WT_CURSTD_RAW);
+    F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+
+    /*
+     * The primary cursor tracks the file being split into ranges. Take ranges from it until it's
+     * done, then move it to the next file in the primary cursor's list.
+     */
+    __wt_spin_lock(session, &pcb->incr_lock);
+    locked = true;
+    for (;;) {
+        if (pcb->incr_file == NULL) {
+            if (pcb->list == NULL || (file = pcb->list[pcb->incr_next]) == NULL)
+                WT_ERR(WT_NOTFOUND);
+            ++pcb->incr_next;
+            WT_ERR(__wt_strdup(session, file, &pcb->incr_file));
+            F_CLR(pcb,
+              WT_CURBACKUP_CKPT_FAKE | WT_CURBACKUP_FORCE_FULL | WT_CURBACKUP_HAS_CB_INFO |
+                WT_CURBACKUP_INCR_INIT | WT_CURBACKUP_RENAME);
+            __curbackup_incr_file_init(session, pcb);
+        }
+        WT_ERR_NOTFOUND_OK(__curbackup_incr_range_next(session, pcb,
+                             F_ISSET(cb, WT_CURBACKUP_RETURN_DATA), &offset, &size, &type),
+          true);
+        if (ret == 0)
+            break;
+        ret = 0;
+        __wt_free(session, pcb->incr_file);
+        __wt_buf_free(session, &pcb->bitstring);
+    }
+
+    /* The key references the file name, keep our own copy, the primary's is shared. */
+    new_file = cb->incr_file == NULL || strcmp(cb->incr_file, pcb->incr_file) != 0;
+    if (new_file) {
+        __wt_free(session, cb->incr_file);
+        WT_ERR(__wt_strdup(session, pcb->incr_file, &cb->incr_file));
+    }
+    force_full = F_ISSET(pcb, WT_CURBACKUP_FORCE_FULL);
+    __wt_spin_unlock(session, &pcb->incr_lock);
+    locked = false;
+
+    /*
+     * Hold the file open while its blocks are copied, the same as a per-file duplicate cursor does
+     * for the lifetime of the cursor.
+     */
+    if (new_file) {
+        if (cb->incr_cursor != NULL) {
+            ret = cb->incr_cursor->close(cb->incr_cursor);
+            cb->incr_cursor = NULL;
+            WT_ERR(ret);
+        }
+        if (!force_full) {
+            cfg[0] = WT_CONFIG_BASE(session, WT_SESSION_open_cursor);
+            WT_ERR(__curbackup_incr_open_file(session, cb, cfg));
+        }
+    }
+
+    if (F_ISSET(cb, WT_CURBACKUP_RETURN_DATA))
+        WT_ERR(__curbackup_incr_read(session, cb, cb->incr_file, offset, size, type));
+    __wt_cursor_set_key(cursor, cb->incr_file, offset, size, type);
+
+err:
+    if (locked)
+        __wt_spin_unlock(session, &pcb->incr_lock);
+    F_SET(cursor, raw);
     API_END_RET(session, ret);
 }
 
@@ -247,6 +490,9 @@ __wt_curbackup_free_incr(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb)
     if (cb->incr_cursor != NULL)
         ret = cb->incr_cursor->close(cb->incr_cursor);
     __wt_buf_free(session, &cb->bitstring);
+    if (cb->incr_fh != NULL)
+        WT_TRET(__wt_close(session, &cb->incr_fh));
+    __wt_buf_free(session, &cb->incr_data);
 
     return (ret);
 }
@@ -260,9 +506,7 @@ __wt_curbackup_open_incr(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *o
   WT_CURSOR *cursor, const char *cfg[], WT_CURSOR **cursorp)
 {
     WT_CURSOR_BACKUP *cb, *other_cb;
-    WT_DECL_ITEM(open_uri);
     WT_DECL_RET;
-    uint64_t session_cache_flags;
 
     cb = (WT_CURSOR_BACKUP *)cursor;
     other_cb = (WT_CURSOR_BACKUP *)other;
@@ -279,39 +523,39 @@ __wt_curbackup_open_incr(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *o
     cursor->get_value = __wt_cursor_get_value_notsup;
     cb->incr_src = other_cb->incr_src;
 
-    /* All WiredTiger owned files are full file copies. */
-    if (F_ISSET(other_cb->incr_src, WT_BLKINCR_FULL) ||
-      WT_PREFIX_MATCH(cb->incr_file, "WiredTiger")) {
-        __wt_verbose(session, WT_VERB_BACKUP, "Forcing full file copies for %s for id %s",
-          cb->incr_file, other_cb->incr_src->id_str);
-        F_SET(cb, WT_CURBACKUP_FORCE_FULL);
+    if (F_ISSET(cb, WT_CURBACKUP_RETURN_DATA)) {
+        cursor->value_format = "u";
+        cursor->get_value = __wt_cursor_get_value;
     }
+
+    /*
+     * A parallel cursor takes its work from the primary cursor, which does the rest of the set up
+     * for each file in turn.
+     */
+    if (F_ISSET(cb, WT_CURBACKUP_PARALLEL)) {
+        cursor->key_format = WT_UNCHECKED_STRING(Sqqq);
+        cursor->next = __curbackup_incr_next_parallel;
+        cb->incr_primary = other_cb;
+        return (__wt_cursor_init(cursor, uri, NULL, cfg, cursorp));
+    }
+
+    __curbackup_incr_file_init(session, cb);
     if (F_ISSET(other_cb, WT_CURBACKUP_CONSOLIDATE))
         F_SET(cb, WT_CURBACKUP_CONSOLIDATE);
     else
         F_CLR(cb, WT_CURBACKUP_CONSOLIDATE);
+    cb->consolidate_max = other_cb->consolidate_max;
 
     /*
      * Set up the incremental backup information, if we are not forcing a full file copy. We need an
      * open cursor on the file. Open the backup checkpoint, confirming it exists.
      */
-    if (!F_ISSET(cb, WT_CURBACKUP_FORCE_FULL)) {
-        WT_ERR(__wt_scr_alloc(session, 0, &open_uri));
-        WT_ERR(__wt_buf_fmt(session, open_uri, "file:%s", cb->incr_file));
-        /*
-         * Incremental cursors use file cursors, but in a non-standard way. Turn off cursor caching
-         * as we open the cursor.
-         */
-        session_cache_flags = F_ISSET(session, WT_SESSION_CACHE_CURSORS);
-        F_CLR(session, WT_SESSION_CACHE_CURSORS);
-        WT_ERR(__wt_curfile_open(session, open_uri->data, NULL, cfg, &cb->incr_cursor));
-        F_SET(session, session_cache_flags);
-    }
+    if (!F_ISSET(cb, WT_CURBACKUP_FORCE_FULL))
+        WT_ERR(__curbackup_incr_open_file(session, cb, cfg));
     WT_ERR(__wt_cursor_init(cursor, uri, NULL, cfg, cursorp));
 
 err:
     if (ret != 0)
         WT_TRET(__wt_curbackup_free_incr(session, cb));
-    __wt_scr_free(session, &open_uri);
     return (ret);
 }
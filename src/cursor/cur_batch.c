@@ -0,0 +1,737 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * A batch cursor wraps a table cursor and returns its rows in batches, with the key and projected
+ * value columns decoded into per-column arrays. Each key column and each value column is returned
+ * as a WT_ITEM: fixed-width columns are arrays of 64-bit integers, variable-length columns are two
+ * items, an array of offsets (one more than the number of rows) followed by the concatenated column
+ * values. The key also includes the number of rows in the batch.
+ */
+
+/*
+ * __curbatch_key_format --
+ *     Return the format of the child cursor's packed keys.
+ */
+static inline const char *
+__curbatch_key_format(WT_CURSOR *child)
+{
+    /* Raw record numbers are packed as signed 64-bit integers. */
+    return (WT_CURSOR_RECNO(child) ? "q" : child->key_format);
+}
+
+/*
+ * __curbatch_cols_init --
+ *     Append the columns of a pack format to the batch, building the batch cursor's format.
+ */
+static int
+__curbatch_cols_init(
+  WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch, const char *fmt, WT_ITEM *batch_fmt)
+{
+    WT_CURSOR_BATCH_COL *col;
+    WT_DECL_PACK_VALUE(pv);
+    WT_DECL_RET;
+    WT_PACK pack;
+
+    WT_RET(__pack_init(session, &pack, fmt));
+    while ((ret = __pack_next(&pack, &pv)) == 0) {
+        if (pv.type == 'x')
+            continue;
+        WT_RET(
+          __wt_realloc_def(session, &cbatch->cols_allocated, cbatch->ncols + 1, &cbatch->cols));
+        col = &cbatch->cols[cbatch->ncols++];
+        col->type = pv.type;
+        col->var = pv.type == 's' || pv.type == 'S' || pv.type == 'u' || pv.type == 'U';
+        WT_RET(__wt_buf_catfmt(session, batch_fmt, col->var ? "uu" : "u"));
+    }
+    return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
+/*
+ * __curbatch_batch_init --
+ *     Prepare the column arrays for a new batch.
+ */
+static int
+__curbatch_batch_init(WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch)
+{
+    WT_CURSOR_BATCH_COL *col;
+    u_int i;
+
+    cbatch->nrows = 0;
+    for (i = 0, col = cbatch->cols; i < cbatch->ncols; ++i, ++col)
+        if (col->var) {
+            WT_RET(__wt_buf_initsize(
+              session, &col->offsets, ((size_t)cbatch->size + 1) * sizeof(uint64_t)));
+            ((uint64_t *)col->offsets.mem)[0] = 0;
+            WT_RET(__wt_buf_init(session, &col->data, 0));
+        } else
+            WT_RET(
+              __wt_buf_initsize(session, &col->data, (size_t)cbatch->size * sizeof(uint64_t)));
+    return (0);
+}
+
+/*
+ * __curbatch_batch_done --
+ *     Set the sizes of the column arrays once a batch is complete.
+ */
+static void
+__curbatch_batch_done(WT_CURSOR_BATCH *cbatch)
+{
+    WT_CURSOR_BATCH_COL *col;
+    u_int i;
+
+    for (i = 0, col = cbatch->cols; i < cbatch->ncols; ++i, ++col)
+        if (col->var)
+            col->offsets.size = ((size_t)cbatch->nrows + 1) * sizeof(uint64_t);
+        else
+            col->data.size = (size_t)cbatch->nrows * sizeof(uint64_t);
+}
+
+/*
+ * __curbatch_decode --
+ *     Unpack a key or value into the next row of the batch's column arrays.
+ */
+static int
+__curbatch_decode(WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch, const char *fmt,
+  WT_CURSOR_BATCH_COL *col, const void *data, size_t size)
+{
+    WT_DECL_PACK_VALUE(pv);
+    WT_DECL_RET;
+    WT_PACK pack;
+    size_t len;
+    const uint8_t *end, *nul, *p, *start;
+
+    p = data;
+    end = p + size;
+    WT_RET(__pack_init(session, &pack, fmt));
+    while ((ret = __pack_next(&pack, &pv)) == 0) {
+        start = p;
+        WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
+        if (pv.type == 'x')
+            continue;
+
+        /* Signed values are stored in the same bits as unsigned values. */
+        if (!col->var) {
+            ((uint64_t *)col->data.mem)[cbatch->nrows] = pv.u.u;
+            ++col;
+            continue;
+        }
+
+        if (pv.type == 'S' && !pv.havesize)
+            len = (size_t)(p - start) - 1;
+        else if (pv.type == 's' || pv.type == 'S') {
+            nul = memchr(pv.u.s, '\0', pv.size);
+            len = nul == NULL ? pv.size : (size_t)(nul - start);
+        } else {
+            start = pv.u.item.data;
+            len = pv.u.item.size;
+        }
+        WT_RET(__wt_buf_extend(session, &col->data, col->data.size + len));
+        if (len != 0)
+            memcpy((uint8_t *)col->data.mem + col->data.size, start, len);
+        col->data.size += len;
+        ((uint64_t *)col->offsets.mem)[cbatch->nrows + 1] = col->data.size;
+        ++col;
+    }
+    return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
+/*
+ * __curbatch_filter_value --
+ *     Unpack the filter column from a packed value.
+ */
+static int
+__curbatch_filter_value(
+  WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch, const uint8_t *p, size_t size, uint64_t *valp)
+{
+    WT_DECL_PACK_VALUE(pv);
+    WT_PACK pack;
+    const uint8_t *end;
+    int col;
+
+    end = p + size;
+    WT_RET(__pack_init(session, &pack, cbatch->child->value_format));
+    for (col = 0;;) {
+        WT_RET(__pack_next(&pack, &pv));
+        WT_RET(__unpack_read(session, &pv, &p, (size_t)(end - p)));
+        if (pv.type == 'x')
+            continue;
+        if (col++ == cbatch->filter_col) {
+            *valp = pv.u.u;
+            return (0);
+        }
+    }
+}
+
+/*
+ * __curbatch_filter --
+ *     Select the rows of a staged batch passing the filter, return the number selected. The
+ *     comparisons are done in a pass of their own, without branches, so the compiler can vectorize
+ *     them; the selected row numbers are then gathered in place.
+ */
+static uint32_t
+__curbatch_filter(WT_CURSOR_BATCH *cbatch, uint32_t n)
+{
+    const int64_t *svals;
+    const uint64_t *uvals;
+    uint32_t i, m, nsel, *sel;
+
+    sel = cbatch->filter_sel.mem;
+    if (cbatch->filter_unsigned) {
+        uint64_t umax, umin;
+
+        uvals = cbatch->filter_val.mem;
+        umin = cbatch->filter_umin;
+        umax = cbatch->filter_umax;
+        for (i = 0; i < n; ++i)
+            sel[i] = (uint32_t)((uvals[i] >= umin) & (uvals[i] <= umax));
+    } else {
+        int64_t smax, smin;
+
+        svals = cbatch->filter_val.mem;
+        smin = cbatch->filter_min;
+        smax = cbatch->filter_max;
+        for (i = 0; i < n; ++i)
+            sel[i] = (uint32_t)((svals[i] >= smin) & (svals[i] <= smax));
+    }
+
+    for (i = nsel = 0; i < n; ++i) {
+        m = sel[i];
+        sel[nsel] = i;
+        nsel += m;
+    }
+    return (nsel);
+}
+
+/*
+ * __curbatch_child_next --
+ *     Move the child cursor to the next row and return its packed key and value. Btree children are
+ *     read with the btree cursor's own iteration, inside the batch cursor's API call: the cursor
+ *     stays on its leaf page from one row to the next, and the key and value are returned from the
+ *     page (or the update) without being copied.
+ */
+static inline int
+__curbatch_child_next(WT_CURSOR_BATCH *cbatch, WT_ITEM *key, WT_ITEM *value)
+{
+    WT_CURSOR *child;
+    uint8_t *p;
+
+    child = cbatch->child;
+    if (cbatch->cbt == NULL) {
+        WT_RET(child->next(child));
+        WT_RET(__wt_cursor_get_raw_key(child, key));
+        return (__wt_cursor_get_raw_value(child, value));
+    }
+
+    WT_RET(__wt_btcur_next(cbatch->cbt, false));
+    if (WT_CURSOR_RECNO(child)) {
+        p = child->raw_recno_buf;
+        WT_RET(__wt_vpack_int(&p, sizeof(child->raw_recno_buf), (int64_t)child->recno));
+        key->data = child->raw_recno_buf;
+        key->size = WT_PTRDIFF(p, child->raw_recno_buf);
+    } else {
+        key->data = child->key.data;
+        key->size = child->key.size;
+    }
+    value->data = child->value.data;
+    value->size = child->value.size;
+    return (0);
+}
+
+/*
+ * __curbatch_fill --
+ *     Fill a batch with the next rows from the child cursor.
+ */
+static int
+__curbatch_fill(WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch)
+{
+    WT_CURSOR *child;
+    WT_DECL_RET;
+    WT_ITEM key, value;
+
+    child = cbatch->child;
+    while (cbatch->nrows < cbatch->size) {
+        if ((ret = __curbatch_child_next(cbatch, &key, &value)) == WT_NOTFOUND) {
+            /* Return the rows we have, the next call returns not-found. */
+            cbatch->eof = cbatch->nrows != 0;
+            return (cbatch->eof ? 0 : WT_NOTFOUND);
+        }
+        WT_RET(ret);
+        WT_RET(__curbatch_decode(
+          session, cbatch, __curbatch_key_format(child), cbatch->cols, key.data, key.size));
+        WT_RET(__curbatch_decode(session, cbatch, child->value_format,
+          cbatch->cols + cbatch->nkey_cols, value.data, value.size));
+        ++cbatch->nrows;
+    }
+    return (0);
+}
+
+/*
+ * __curbatch_fill_filter --
+ *     Fill a batch with the next rows from the child cursor that pass the filter. The rows are
+ *     staged in their packed form, the filter column is decoded and evaluated for all of them, and
+ *     only the selected rows are decoded into the column arrays.
+ */
+static int
+__curbatch_fill_filter(WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch)
+{
+    WT_CURSOR *child;
+    WT_DECL_RET;
+    WT_ITEM key, value;
+    uint64_t *off, *vals;
+    uint32_t i, n, nsel, row, *sel;
+    const uint8_t *stage;
+
+    child = cbatch->child;
+    WT_RET(__wt_buf_init(session, &cbatch->stage, 0));
+    WT_RET(__wt_buf_initsize(
+      session, &cbatch->stage_off, (2 * (size_t)cbatch->size + 1) * sizeof(uint64_t)));
+    off = cbatch->stage_off.mem;
+    for (n = 0; n < cbatch->size; ++n) {
+        if ((ret = __curbatch_child_next(cbatch, &key, &value)) == WT_NOTFOUND) {
+            cbatch->eof = true;
+            break;
+        }
+        WT_RET(ret);
+        WT_RET(
+          __wt_buf_extend(session, &cbatch->stage, cbatch->stage.size + key.size + value.size));
+        off[2 * n] = cbatch->stage.size;
+        memcpy((uint8_t *)cbatch->stage.mem + cbatch->stage.size, key.data, key.size);
+        cbatch->stage.size += key.size;
+        off[2 * n + 1] = cbatch->stage.size;
+        memcpy((uint8_t *)cbatch->stage.mem + cbatch->stage.size, value.data, value.size);
+        cbatch->stage.size += value.size;
+    }
+    off[2 * n] = cbatch->stage.size;
+    stage = cbatch->stage.mem;
+
+    WT_RET(__wt_buf_initsize(session, &cbatch->filter_val, (size_t)n * sizeof(uint64_t)));
+    WT_RET(__wt_buf_initsize(session, &cbatch->filter_sel, (size_t)n * sizeof(uint32_t)));
+    vals = cbatch->filter_val.mem;
+    for (i = 0; i < n; ++i)
+        WT_RET(__curbatch_filter_value(
+          session, cbatch, stage + off[2 * i + 1], off[2 * i + 2] - off[2 * i + 1], &vals[i]));
+    nsel = __curbatch_filter(cbatch, n);
+
+    sel = cbatch->filter_sel.mem;
+    for (i = 0; i < nsel; ++i) {
+        row = sel[i];
+        WT_RET(__curbatch_decode(session, cbatch, __curbatch_key_format(child), cbatch->cols,
+          stage + off[2 * row], off[2 * row + 1] - off[2 * row]));
+        WT_RET(__curbatch_decode(session, cbatch, child->value_format,
+          cbatch->cols + cbatch->nkey_cols, stage + off[2 * row + 1],
+          off[2 * row + 2] - off[2 * row + 1]));
+        ++cbatch->nrows;
+    }
+
+    /* If the table is done and nothing was selected, we're done. */
+    if (cbatch->eof && cbatch->nrows == 0) {
+        cbatch->eof = false;
+        return (WT_NOTFOUND);
+    }
+    return (0);
+}
+
+/*
+ * __curbatch_pack --
+ *     Pack the key or value of a batch for raw access.
+ */
+static int
+__curbatch_pack(WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch, const char *fmt,
+  WT_CURSOR_BATCH_COL *col, WT_ITEM *item)
+{
+    WT_CURSOR_BATCH_COL *c;
+    WT_DECL_PACK_VALUE(pv);
+    WT_DECL_RET;
+    WT_PACK pack;
+    size_t len, total;
+    uint8_t *end, *p;
+    int pass;
+    bool offsets;
+
+    /* The first pass sizes the buffer, the second packs into it. */
+    p = end = NULL;
+    for (pass = 0, total = 0; pass < 2; ++pass) {
+        WT_RET(__pack_init(session, &pack, fmt));
+        for (c = col, offsets = true; (ret = __pack_next(&pack, &pv)) == 0;) {
+            if (pv.type == 'Q')
+                pv.u.u = cbatch->nrows;
+            else if (c->var && offsets) {
+                pv.u.item.data = c->offsets.data;
+                pv.u.item.size = c->offsets.size;
+                offsets = false;
+            } else {
+                pv.u.item.data = c->data.data;
+                pv.u.item.size = c->data.size;
+                offsets = true;
+                ++c;
+            }
+            if (pass == 0) {
+                WT_RET(__pack_size(session, &pv, &len));
+                total += len;
+            } else
+                WT_RET(__pack_write(session, &pv, &p, (size_t)(end - p)));
+        }
+        WT_RET_NOTFOUND_OK(ret);
+        if (pass == 0) {
+            WT_RET(__wt_buf_initsize(session, &cbatch->raw, total));
+            p = cbatch->raw.mem;
+            end = p + total;
+        }
+    }
+    item->data = cbatch->raw.data;
+    item->size = cbatch->raw.size;
+    return (0);
+}
+
+/*
+ * __curbatch_get --
+ *     Return the key or value of a batch.
+ */
+static int
+__curbatch_get(WT_CURSOR *cursor, bool key, va_list ap)
+{
+    WT_CURSOR_BATCH *cbatch;
+    WT_CURSOR_BATCH_COL *col, *end;
+    WT_ITEM *item;
+
+    cbatch = (WT_CURSOR_BATCH *)cursor;
+
+    if (!F_ISSET(cursor, key ? WT_CURSTD_KEY_INT : WT_CURSTD_VALUE_INT))
+        return (__wt_cursor_kv_not_set(cursor, key));
+
+    col = key ? cbatch->cols : cbatch->cols + cbatch->nkey_cols;
+    end = key ? cbatch->cols + cbatch->nkey_cols : cbatch->cols + cbatch->ncols;
+    if (F_ISSET(cursor, WT_CURSTD_RAW))
+        return (__curbatch_pack(CUR2S(cursor), cbatch,
+          key ? cursor->key_format : cursor->value_format, col, va_arg(ap, WT_ITEM *)));
+
+    if (key)
+        *va_arg(ap, uint64_t *) = cbatch->nrows;
+    for (; col < end; ++col) {
+        item = va_arg(ap, WT_ITEM *);
+        if (col->var) {
+            item->data = col->offsets.data;
+            item->size = col->offsets.size;
+            item = va_arg(ap, WT_ITEM *);
+        }
+        item->data = col->data.data;
+        item->size = col->data.size;
+    }
+    return (0);
+}
+
+/*
+ * __curbatch_get_key --
+ *     WT_CURSOR->get_key for batch cursors.
+ */
+static int
+__curbatch_get_key(WT_CURSOR *cursor, ...)
+{
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    va_list ap;
+
+    CURSOR_API_CALL(cursor, session, get_key, NULL);
+    va_start(ap, cursor);
+    ret = __curbatch_get(cursor, true, ap);
+    va_end(ap);
+
+err:
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curbatch_get_value --
+ *     WT_CURSOR->get_value for batch cursors.
+ */
+static int
+__curbatch_get_value(WT_CURSOR *cursor, ...)
+{
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+    va_list ap;
+
+    CURSOR_API_CALL(cursor, session, get_value, NULL);
+    va_start(ap, cursor);
+    ret = __curbatch_get(cursor, false, ap);
+    va_end(ap);
+
+err:
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curbatch_next --
+ *     WT_CURSOR->next for batch cursors.
+ */
+static int
+__curbatch_next(WT_CURSOR *cursor)
+{
+    WT_CURSOR_BATCH *cbatch;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cbatch = (WT_CURSOR_BATCH *)cursor;
+    CURSOR_API_CALL(cursor, session, next, cbatch->cbt == NULL ? NULL : CUR2BT(cbatch->cbt));
+    F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+
+    /* The previous batch ended the scan. */
+    if (cbatch->eof) {
+        cbatch->eof = false;
+        WT_ERR(WT_NOTFOUND);
+    }
+
+    WT_ERR(__curbatch_batch_init(session, cbatch));
+    do {
+        ret = cbatch->filter_col == -1 ? __curbatch_fill(session, cbatch) :
+                                         __curbatch_fill_filter(session, cbatch);
+    } while (ret == 0 && cbatch->nrows == 0);
+    WT_ERR(ret);
+
+    __curbatch_batch_done(cbatch);
+    F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
+
+err:
+    if (ret != 0)
+        cbatch->nrows = 0;
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curbatch_reset --
+ *     WT_CURSOR->reset for batch cursors.
+ */
+static int
+__curbatch_reset(WT_CURSOR *cursor)
+{
+    WT_CURSOR *child;
+    WT_CURSOR_BATCH *cbatch;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cbatch = (WT_CURSOR_BATCH *)cursor;
+    child = cbatch->child;
+    CURSOR_API_CALL_PREPARE_ALLOWED(cursor, session, reset, NULL);
+
+    ret = child->reset(child);
+    cbatch->nrows = 0;
+    cbatch->eof = false;
+    F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+
+err:
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curbatch_free --
+ *     Free a batch cursor's memory, other than the cursor itself.
+ */
+static void
+__curbatch_free(WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch)
+{
+    u_int i;
+
+    for (i = 0; i < cbatch->ncols; ++i) {
+        __wt_buf_free(session, &cbatch->cols[i].data);
+        __wt_buf_free(session, &cbatch->cols[i].offsets);
+    }
+    __wt_free(session, cbatch->cols);
+    __wt_buf_free(session, &cbatch->raw);
+    __wt_buf_free(session, &cbatch->stage);
+    __wt_buf_free(session, &cbatch->stage_off);
+    __wt_buf_free(session, &cbatch->filter_val);
+    __wt_buf_free(session, &cbatch->filter_sel);
+    __wt_free(session, cbatch->iface.key_format);
+    __wt_free(session, cbatch->iface.value_format);
+}
+
+/*
+ * __curbatch_close --
+ *     WT_CURSOR->close for batch cursors.
+ */
+static int
+__curbatch_close(WT_CURSOR *cursor)
+{
+    WT_CURSOR *child;
+    WT_CURSOR_BATCH *cbatch;
+    WT_DECL_RET;
+    WT_SESSION_IMPL *session;
+
+    cbatch = (WT_CURSOR_BATCH *)cursor;
+    child = cbatch->child;
+    CURSOR_API_CALL_PREPARE_ALLOWED(cursor, session, close, NULL);
+err:
+
+    if (child != NULL)
+        WT_TRET(child->close(child));
+    __curbatch_free(session, cbatch);
+    /* We shared the child's URI. */
+    cursor->internal_uri = NULL;
+    __wt_cursor_close(cursor);
+
+    API_END_RET(session, ret);
+}
+
+/*
+ * __curbatch_filter_config --
+ *     Configure the batch cursor's filter.
+ */
+static int
+__curbatch_filter_config(WT_SESSION_IMPL *session, WT_CURSOR_BATCH *cbatch, WT_TABLE *table,
+  const char *columns, const char *cfg[])
+{
+    WT_CONFIG conf;
+    WT_CONFIG_ITEM cval, k, max, min, v;
+    WT_CURSOR_BATCH_COL *col;
+    WT_DECL_RET;
+    u_int i;
+
+    cbatch->filter_col = -1;
+    WT_RET(__wt_config_gets_def(session, cfg, "batch.filter", 0, &cval));
+    if (cval.len == 0)
+        return (0);
+    if (table->is_simple)
+        WT_RET_MSG(session, EINVAL, "batch filters require a table with named columns");
+
+    /*
+     * Find the filter column in the projection, or if there isn't one, in the table's value
+     * columns.
+     */
+    if (columns != NULL)
+        __wt_config_init(session, &conf, columns);
+    else {
+        __wt_config_subinit(session, &conf, &table->colconf);
+        for (i = 0; i < table->nkey_columns; ++i)
+            WT_RET_NOTFOUND_OK(__wt_config_next(&conf, &k, &v));
+    }
+    for (i = 0; (ret = __wt_config_next(&conf, &k, &v)) == 0; ++i)
+        if (k.len == cval.len && memcmp(k.str, cval.str, k.len) == 0)
+            break;
+    if (ret == WT_NOTFOUND || i >= cbatch->ncols - cbatch->nkey_cols)
+        WT_RET_MSG(session, EINVAL, "batch filter column '%.*s' not found in the cursor's values",
+          (int)cval.len, cval.str);
+    WT_RET(ret);
+
+    col = &cbatch->cols[cbatch->nkey_cols + i];
+    if (col->var)
+        WT_RET_MSG(session, EINVAL, "batch filter column '%.*s' is not a fixed-width column",
+          (int)cval.len, cval.str);
+    cbatch->filter_col = (int)i;
+
+    WT_RET(__wt_config_gets_def(session, cfg, "batch.filter_min", 0, &min));
+    WT_RET(__wt_config_gets_def(session, cfg, "batch.filter_max", 0, &max));
+    if ((min.len != 0 && min.type != WT_CONFIG_ITEM_NUM) ||
+      (max.len != 0 && max.type != WT_CONFIG_ITEM_NUM))
+        WT_RET_MSG(session, EINVAL, "batch filter limits must be numbers");
+
+    /* Signed and unsigned columns are compared in their own types. */
+    cbatch->filter_min = min.len == 0 ? INT64_MIN : min.val;
+    cbatch->filter_max = max.len == 0 ? INT64_MAX : max.val;
+    cbatch->filter_unsigned = strchr("BHILQrt", col->type) != NULL;
+    cbatch->filter_umin = min.len == 0 || min.val < 0 ? 0 : (uint64_t)min.val;
+    cbatch->filter_umax = max.len == 0 ? UINT64_MAX : (uint64_t)max.val;
+    if (max.len != 0 && max.val < 0) {
+        cbatch->filter_umin = 1;
+        cbatch->filter_umax = 0;
+    }
+    return (0);
+}
+
+/*
+ * __wt_curbatch_create --
+ *     Wrap a table cursor, or for simple tables the underlying data source cursor, in a batch
+ *     cursor.
+ */
+int
+__wt_curbatch_create(WT_SESSION_IMPL *session, WT_TABLE *table, WT_CURSOR *child,
+  const char *columns, const char *cfg[], WT_CURSOR **cursorp)
+{
+    WT_CURSOR_STATIC_INIT(iface, __curbatch_get_key, /* get-key */
+      __curbatch_get_value,                          /* get-value */
+      __wt_cursor_get_raw_key_value_notsup,          /* get-raw-key-value */
+      __wt_cursor_set_key_notsup,                    /* set-key */
+      __wt_cursor_set_value_notsup,                  /* set-value */
+      __wt_cursor_compare_notsup,                    /* compare */
+      __wt_cursor_equals_notsup,                     /* equals */
+      __curbatch_next,                               /* next */
+      __wt_cursor_notsup,                            /* prev */
+      __curbatch_reset,                              /* reset */
+      __wt_cursor_notsup,                            /* search */
+      __wt_cursor_search_near_notsup,                /* search-near */
+      __wt_cursor_notsup,                            /* insert */
+      __wt_cursor_modify_notsup,                     /* modify */
+      __wt_cursor_notsup,                            /* update */
+      __wt_cursor_notsup,                            /* remove */
+      __wt_cursor_notsup,                            /* reserve */
+      __wt_cursor_config_notsup,                     /* reconfigure */
+      __wt_cursor_notsup,                            /* largest_key */
+      __wt_cursor_config_notsup,                     /* bound */
+      __wt_cursor_notsup,                            /* cache */
+      __wt_cursor_reopen_notsup,                     /* reopen */
+      __wt_cursor_checkpoint_id,                     /* checkpoint ID */
+      __curbatch_close);                             /* close */
+    WT_CONFIG_ITEM cval;
+    WT_CURSOR *cursor;
+    WT_CURSOR_BATCH *cbatch;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    const char *base_cfg[2];
+
+    WT_STATIC_ASSERT(offsetof(WT_CURSOR_BATCH, iface) == 0);
+
+    WT_RET(__wt_config_gets_def(session, cfg, "batch.size", 0, &cval));
+
+    WT_RET(__wt_calloc_one(session, &cbatch));
+    cursor = (WT_CURSOR *)cbatch;
+    *cursor = iface;
+    cursor->session = child->session;
+    cursor->internal_uri = child->internal_uri;
+    cbatch->child = child;
+    cbatch->size = (uint32_t)cval.val;
+
+    /*
+     * Read btree children directly, other than checkpoint cursors, which must switch to the
+     * checkpoint's transaction for each read.
+     */
+    if (WT_BTREE_PREFIX(child->internal_uri) &&
+      ((WT_CURSOR_BTREE *)child)->checkpoint_txn == NULL)
+        cbatch->cbt = (WT_CURSOR_BTREE *)child;
+
+    /* The key is the number of rows in the batch followed by the key columns. */
+    WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+    WT_ERR(__wt_buf_set(session, tmp, "Q", 1));
+    WT_ERR(__curbatch_cols_init(session, cbatch, __curbatch_key_format(child), tmp));
+    if (WT_CURSOR_RECNO(child))
+        cbatch->cols[0].type = 'r';
+    cbatch->nkey_cols = cbatch->ncols;
+    WT_ERR(__wt_strndup(session, tmp->data, tmp->size, &cursor->key_format));
+    WT_ERR(__wt_buf_set(session, tmp, "", 0));
+    WT_ERR(__curbatch_cols_init(session, cbatch, child->value_format, tmp));
+    WT_ERR(__wt_strndup(session, tmp->data, tmp->size, &cursor->value_format));
+
+    WT_ERR(__curbatch_filter_config(session, cbatch, table, columns, cfg));
+
+    /* Batch cursors are never cached, nor is their child. */
+    F_CLR(child, WT_CURSTD_CACHEABLE);
+    F_SET(cursor, F_MASK(child, WT_CURSTD_RAW));
+    base_cfg[0] = WT_CONFIG_BASE(session, WT_SESSION_open_cursor);
+    base_cfg[1] = NULL;
+    WT_ERR(__wt_cursor_init(cursor, NULL, NULL, base_cfg, cursorp));
+
+    if (0) {
+err:
+        /* The caller closes the child. */
+        __curbatch_free(session, cbatch);
+        __wt_free(session, cbatch);
+    }
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
@@ -303,6 +303,7 @@ err:
 static int
 __curfile_search(WT_CURSOR *cursor)
 {
+    WT_CAPTURE_RECORD capture;
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
@@ -317,11 +318,15 @@ __curfile_search(WT_CURSOR *cursor)
 
     WT_ERR(__curfile_check_cbt_txn(session, cbt));
 
+    WT_CAPTURE_BEGIN(session, cursor, &capture);
     time_start = __wt_clock(session);
     WT_WITH_CHECKPOINT(session, cbt, ret = __wt_btcur_search(cbt));
+    WT_CAPTURE_END(session, cursor, &capture, WT_CAPTURE_SEARCH, ret);
     WT_ERR(ret);
     time_stop = __wt_clock(session);
     __wt_stat_usecs_hist_incr_opread(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_LATENCY_RECORD(session, cbt->dhandle, WT_LATENCY_CURSOR_SEARCH,
+      WT_CLOCKDIFF_NS(time_stop, time_start));
 
     /* Search maintains a position, key and value. */
     WT_ASSERT(session,
@@ -341,6 +346,7 @@ err:
 static int
 __curfile_search_near(WT_CURSOR *cursor, int *exact)
 {
+    WT_CAPTURE_RECORD capture;
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
@@ -355,11 +361,15 @@ __curfile_search_near(WT_CURSOR *cursor, int *exact)
 
     WT_ERR(__curfile_check_cbt_txn(session, cbt));
 
+    WT_CAPTURE_BEGIN(session, cursor, &capture);
     time_start = __wt_clock(session);
     WT_WITH_CHECKPOINT(session, cbt, ret = __wt_btcur_search_near(cbt, exact));
+    WT_CAPTURE_END(session, cursor, &capture, WT_CAPTURE_SEARCH_NEAR, ret);
     WT_ERR(ret);
     time_stop = __wt_clock(session);
     __wt_stat_usecs_hist_incr_opread(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_LATENCY_RECORD(session, cbt->dhandle, WT_LATENCY_CURSOR_SEARCH,
+      WT_CLOCKDIFF_NS(time_stop, time_start));
 
     /* Search-near maintains a position, key and value. */
     WT_ASSERT(session,
@@ -379,6 +389,7 @@ err:
 static int
 __curfile_insert(WT_CURSOR *cursor)
 {
+    WT_CAPTURE_RECORD capture;
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
@@ -392,10 +403,15 @@ __curfile_insert(WT_CURSOR *cursor)
         WT_ERR(__cursor_checkkey(cursor));
     WT_ERR(__cursor_checkvalue(cursor));
 
+    WT_CAPTURE_BEGIN(session, cursor, &capture);
     time_start = __wt_clock(session);
-    WT_ERR(__wt_btcur_insert(cbt));
+    ret = __wt_btcur_insert(cbt);
+    WT_CAPTURE_END(session, cursor, &capture, WT_CAPTURE_INSERT, ret);
+    WT_ERR(ret);
     time_stop = __wt_clock(session);
     __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_LATENCY_RECORD(session, cbt->dhandle, WT_LATENCY_CURSOR_INSERT,
+      WT_CLOCKDIFF_NS(time_stop, time_start));
 
     /*
      * Insert maintains no position, key or value (except for column-store appends, where we are
@@ -449,6 +465,7 @@ err:
 static int
 __curfile_modify(WT_CURSOR *cursor, WT_MODIFY *entries, int nentries)
 {
+    WT_CAPTURE_RECORD capture;
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
@@ -462,7 +479,10 @@ __curfile_modify(WT_CURSOR *cursor, WT_MODIFY *entries, int nentries)
     if (nentries <= 0)
         WT_ERR_MSG(session, EINVAL, "Illegal modify vector with %d entries", nentries);
 
-    WT_ERR(__wt_btcur_modify(cbt, entries, nentries));
+    WT_CAPTURE_BEGIN(session, cursor, &capture);
+    ret = __wt_btcur_modify(cbt, entries, nentries);
+    WT_CAPTURE_END(session, cursor, &capture, WT_CAPTURE_MODIFY, ret);
+    WT_ERR(ret);
 
     /*
      * Modify maintains a position, key and value. Unlike update, it's not always an internal value.
@@ -483,6 +503,7 @@ err:
 static int
 __curfile_update(WT_CURSOR *cursor)
 {
+    WT_CAPTURE_RECORD capture;
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
@@ -494,10 +515,15 @@ __curfile_update(WT_CURSOR *cursor)
     WT_ERR(__cursor_checkkey(cursor));
     WT_ERR(__cursor_checkvalue(cursor));
 
+    WT_CAPTURE_BEGIN(session, cursor, &capture);
     time_start = __wt_clock(session);
-    WT_ERR(__wt_btcur_update(cbt));
+    ret = __wt_btcur_update(cbt);
+    WT_CAPTURE_END(session, cursor, &capture, WT_CAPTURE_UPDATE, ret);
+    WT_ERR(ret);
     time_stop = __wt_clock(session);
     __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_LATENCY_RECORD(session, cbt->dhandle, WT_LATENCY_CURSOR_UPDATE,
+      WT_CLOCKDIFF_NS(time_stop, time_start));
 
     /* Update maintains a position, key and value. */
     WT_ASSERT(session,
@@ -516,6 +542,7 @@ err:
 static int
 __curfile_remove(WT_CURSOR *cursor)
 {
+    WT_CAPTURE_RECORD capture;
     WT_CURSOR_BTREE *cbt;
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
@@ -536,10 +563,15 @@ __curfile_remove(WT_CURSOR *cursor)
     WT_ERR(__cursor_copy_release(cursor));
     WT_ERR(__cursor_checkkey(cursor));
 
+    WT_CAPTURE_BEGIN(session, cursor, &capture);
     time_start = __wt_clock(session);
-    WT_ERR(__wt_btcur_remove(cbt, positioned));
+    ret = __wt_btcur_remove(cbt, positioned);
+    WT_CAPTURE_END(session, cursor, &capture, WT_CAPTURE_REMOVE, ret);
+    WT_ERR(ret);
     time_stop = __wt_clock(session);
     __wt_stat_usecs_hist_incr_opwrite(session, WT_CLOCKDIFF_US(time_stop, time_start));
+    WT_LATENCY_RECORD(session, cbt->dhandle, WT_LATENCY_CURSOR_REMOVE,
+      WT_CLOCKDIFF_NS(time_stop, time_start));
 
     /* If we've lost an initial position, we must fail. */
     if (positioned && !F_ISSET(cursor, WT_CURSTD_KEY_INT)) {
@@ -933,6 +965,88 @@ err:
     return (ret);
 }
 
+/*
+ * __curfile_filter_config --
+ *     Configure a row-store cursor's iteration filter.
+ */
+static int
+__curfile_filter_config(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, const char *cfg[])
+{
+    WT_BTREE *btree;
+    WT_CONFIG_ITEM field, max, min, prefix, suffix;
+    WT_CURSOR *cursor;
+    WT_CURSOR_FILTER *filter;
+    WT_DECL_PACK_VALUE(pv);
+    WT_DECL_RET;
+    WT_PACK pack;
+    int64_t i;
+
+    cursor = &cbt->iface;
+
+    WT_RET(__wt_config_gets_def(session, cfg, "filter.key_prefix", 0, &prefix));
+    WT_RET(__wt_config_gets_def(session, cfg, "filter.key_suffix", 0, &suffix));
+    WT_RET(__wt_config_gets_def(session, cfg, "filter.value_field", -1, &field));
+    if (prefix.len == 0 && suffix.len == 0 && field.val == -1)
+        return (0);
+
+    /* Of the column-stores, only fixed_width objects have values that can be filtered. */
+    btree = CUR2BT(cbt);
+    if (btree->type != BTREE_ROW && (btree->type != BTREE_COL_FIX || btree->bitcnt <= 8))
+        WT_RET_MSG(session, ENOTSUP,
+          "filter configuration not supported for column-store objects other than fixed_width "
+          "objects");
+    if ((prefix.len != 0 || suffix.len != 0) && !WT_STREQ(cursor->key_format, "S") &&
+      !WT_STREQ(cursor->key_format, "u"))
+        WT_RET_MSG(session, EINVAL, "filter key patterns require a key_format of S or u");
+
+    WT_RET(__wt_calloc_one(session, &cbt->filter));
+    filter = cbt->filter;
+
+    /* String keys are packed with a trailing nul byte, a suffix matches the bytes before it. */
+    WT_RET(__wt_buf_set(session, &filter->key_prefix, prefix.str, prefix.len));
+    WT_RET(__wt_buf_set(session, &filter->key_suffix, suffix.str, suffix.len));
+    if (suffix.len != 0 && WT_STREQ(cursor->key_format, "S")) {
+        WT_RET(__wt_buf_grow(session, &filter->key_suffix, suffix.len + 1));
+        ((uint8_t *)filter->key_suffix.mem)[suffix.len] = '\0';
+        filter->key_suffix.size = suffix.len + 1;
+    }
+
+    filter->value_field = (int)field.val;
+    if (field.val == -1)
+        return (0);
+
+    WT_RET(__pack_init(session, &pack, cursor->value_format));
+    for (i = 0;;) {
+        if ((ret = __pack_next(&pack, &pv)) == WT_NOTFOUND)
+            WT_RET_MSG(session, EINVAL, "filter value_field %" PRId64 " not in value format %s",
+              field.val, cursor->value_format);
+        WT_RET(ret);
+        if (pv.type != 'x' && i++ == field.val)
+            break;
+    }
+    if (strchr("bhilqBHILQr", pv.type) == NULL)
+        WT_RET_MSG(session, EINVAL, "filter value_field %" PRId64 " is not an integer field",
+          field.val);
+
+    WT_RET(__wt_config_gets_def(session, cfg, "filter.value_min", 0, &min));
+    WT_RET(__wt_config_gets_def(session, cfg, "filter.value_max", 0, &max));
+    if ((min.len != 0 && min.type != WT_CONFIG_ITEM_NUM) ||
+      (max.len != 0 && max.type != WT_CONFIG_ITEM_NUM))
+        WT_RET_MSG(session, EINVAL, "filter value limits must be numbers");
+
+    /* Signed and unsigned fields are compared in their own types. */
+    filter->value_unsigned = strchr("BHILQr", pv.type) != NULL;
+    filter->value_min = min.len == 0 ? INT64_MIN : min.val;
+    filter->value_max = max.len == 0 ? INT64_MAX : max.val;
+    filter->value_umin = min.len == 0 || min.val < 0 ? 0 : (uint64_t)min.val;
+    filter->value_umax = max.len == 0 ? UINT64_MAX : (uint64_t)max.val;
+    if (max.len != 0 && max.val < 0) {
+        filter->value_umin = 1;
+        filter->value_umax = 0;
+    }
+    return (0);
+}
+
 /*
  * __curfile_create --
  *     Open a cursor for a given btree handle.
@@ -1014,6 +1128,10 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
 
         cbulk = (WT_CURSOR_BULK *)cbt;
 
+        /* Optionally offload writing completed pages to other threads. */
+        WT_ERR(__wt_config_gets_def(session, cfg, "bulk_write_threads", 0, &cval));
+        cbulk->nthreads = (u_int)cval.val;
+
         /* Optionally skip the validation of each bulk-loaded key. */
         WT_ERR(__wt_config_gets_def(session, cfg, "skip_sort_check", 0, &cval));
         WT_ERR(__wt_curbulk_init(session, cbulk, bitmap, cval.val == 0 ? 0 : 1));
@@ -1042,6 +1160,16 @@ __curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[],
     if (cval.val != 0)
         F_SET(cbt, WT_CBT_READ_ONCE);
 
+    /*
+     * Iteration filters are only configured on top-level cursors, cursors opened as part of table
+     * and index cursors ignore them. Filtered cursors are not cached.
+     */
+    if (owner == NULL) {
+        WT_ERR(__curfile_filter_config(session, cbt, cfg));
+        if (cbt->filter != NULL)
+            cacheable = false;
+    }
+
     /* Underlying btree initialization. */
     __wt_btcur_open(cbt);
 
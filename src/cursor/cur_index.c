@@ -590,9 +590,14 @@ __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
     WT_DECL_RET;
     WT_INDEX *idx;
     WT_TABLE *table;
+    WT_CONFIG_ITEM cval;
     const char *columns, *idxname, *tablename;
     size_t namesize;
 
+    WT_RET(__wt_config_gets_def(session, cfg, "filter", 0, &cval));
+    if (cval.len != 0)
+        WT_RET_MSG(session, ENOTSUP, "filter configuration not supported for index cursors");
+
     tablename = uri;
     if (!WT_PREFIX_SKIP(tablename, "index:") || (idxname = strchr(tablename, ':')) == NULL)
         WT_RET_MSG(session, EINVAL, "Invalid cursor URI: '%s'", uri);
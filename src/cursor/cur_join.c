@@ -21,6 +21,8 @@ static int __curjoin_iter_close_all(WT_CURSOR_JOIN_ITER *);
 static bool __curjoin_iter_ready(WT_CURSOR_JOIN_ITER *);
 static int __curjoin_iter_set_entry(WT_CURSOR_JOIN_ITER *, u_int);
 static int __curjoin_pack_recno(WT_SESSION_IMPL *, uint64_t, uint8_t *, size_t, WT_ITEM *);
+static bool __curjoin_positioned(WT_CURSOR_JOIN *);
+static void __curjoin_set_free(WT_SESSION_IMPL *, WT_CURSOR_JOIN_SET **);
 static int __curjoin_split_key(
   WT_SESSION_IMPL *, WT_CURSOR_JOIN *, WT_ITEM *, WT_CURSOR *, WT_CURSOR *, const char *, bool);
 
@@ -343,6 +345,7 @@ err:
 
     if (cjoin->iter != NULL)
         WT_TRET(__curjoin_iter_close_all(cjoin->iter));
+    __curjoin_set_free(session, &cjoin->set);
     if (cjoin->main != NULL)
         WT_TRET(cjoin->main->close(cjoin->main));
 
@@ -675,6 +678,297 @@ err:
     return (ret);
 }
 
+/*
+ * __curjoin_set_alloc --
+ *     Allocate a set of primary keys.
+ */
+static int
+__curjoin_set_alloc(WT_SESSION_IMPL *session, WT_COLLATOR *collator, size_t bufsize, size_t nkeys,
+  WT_CURSOR_JOIN_SET **setp)
+{
+    WT_CURSOR_JOIN_SET *set;
+    WT_DECL_RET;
+
+    WT_RET(__wt_calloc_one(session, &set));
+    set->collator = collator;
+    WT_ERR(__wt_buf_init(session, &set->buf, WT_MAX(bufsize, 1024)));
+    if (nkeys != 0)
+        WT_ERR(__wt_realloc_def(session, &set->keys_allocated, nkeys, &set->keys));
+    *setp = set;
+    return (0);
+
+err:
+    __wt_buf_free(session, &set->buf);
+    __wt_free(session, set);
+    return (ret);
+}
+
+/*
+ * __curjoin_set_footprint --
+ *     Return the memory used by a set.
+ */
+static uint64_t
+__curjoin_set_footprint(WT_CURSOR_JOIN_SET *set)
+{
+    if (set == NULL)
+        return (0);
+    return ((uint64_t)set->buf.memsize + (uint64_t)set->keys_allocated * sizeof(WT_ITEM));
+}
+
+/*
+ * __curjoin_set_free --
+ *     Free a set of primary keys.
+ */
+static void
+__curjoin_set_free(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_SET **setp)
+{
+    WT_CURSOR_JOIN_SET *set;
+
+    if ((set = *setp) == NULL)
+        return;
+    __wt_buf_free(session, &set->buf);
+    __wt_free(session, set->keys);
+    __wt_free(session, *setp);
+}
+
+/*
+ * __curjoin_set_insert --
+ *     Append a key to a set. The buffer may move as it grows, the keys are pointed into it by
+ *     __curjoin_set_finish once all keys have been appended.
+ */
+static int
+__curjoin_set_insert(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_SET *set, const WT_ITEM *key)
+{
+    WT_RET(__wt_realloc_def(session, &set->keys_allocated, set->count + 1, &set->keys));
+    WT_RET(__wt_buf_extend(session, &set->buf, set->buf.size + key->size));
+    if (key->size != 0)
+        memcpy((uint8_t *)set->buf.mem + set->buf.size, key->data, key->size);
+    set->buf.size += key->size;
+    set->keys[set->count].data = NULL;
+    set->keys[set->count].size = key->size;
+    ++set->count;
+    return (0);
+}
+
+/*
+ * __curjoin_set_compare --
+ *     Qsort function: sort keys in a set when the main table has no collator. Primary keys are raw
+ *     and packed, and the packed formats WiredTiger uses for record numbers are order-preserving,
+ *     so a byte-wise comparison gives primary key order.
+ */
+static int WT_CDECL
+__curjoin_set_compare(const void *a, const void *b)
+{
+    return (__wt_lex_compare((const WT_ITEM *)a, (const WT_ITEM *)b));
+}
+
+/*
+ * __curjoin_set_sort --
+ *     Sort the keys of a set into primary key order. A custom collator needs the session and can
+ *     fail, it can't be called from qsort: use a merge sort instead.
+ */
+static int
+__curjoin_set_sort(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_SET *set)
+{
+    WT_DECL_RET;
+    WT_ITEM *buf, *dst, *src, *swap;
+    size_t hi, i, j, k, lo, mid, width;
+    int cmp;
+
+    if (set->collator == NULL) {
+        __wt_qsort(set->keys, set->count, sizeof(WT_ITEM), __curjoin_set_compare);
+        return (0);
+    }
+
+    /* Merge runs of doubling width, alternating between the keys and a buffer of the same size. */
+    WT_RET(__wt_calloc_def(session, set->count, &buf));
+    src = set->keys;
+    dst = buf;
+    for (width = 1; width < set->count; width *= 2) {
+        for (lo = 0; lo < set->count; lo += 2 * width) {
+            mid = WT_MIN(lo + width, set->count);
+            hi = WT_MIN(lo + 2 * width, set->count);
+            for (i = j = lo, k = mid; i < hi; ++i) {
+                if (j == mid)
+                    cmp = 1;
+                else if (k == hi)
+                    cmp = -1;
+                else
+                    WT_ERR(__wt_compare(session, set->collator, &src[j], &src[k], &cmp));
+                dst[i] = cmp <= 0 ? src[j++] : src[k++];
+            }
+        }
+        swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != set->keys)
+        memcpy(set->keys, src, set->count * sizeof(WT_ITEM));
+
+err:
+    __wt_free(session, buf);
+    return (ret);
+}
+
+/*
+ * __curjoin_set_finish --
+ *     Point the keys of a set into its buffer. Optionally sort the keys and discard duplicates, an
+ *     index with a custom extractor can produce the same primary key more than once.
+ */
+static int
+__curjoin_set_finish(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_SET *set, bool sort)
+{
+    size_t i, j;
+    int cmp;
+    const uint8_t *p;
+
+    for (p = set->buf.mem, i = 0; i < set->count; ++i) {
+        set->keys[i].data = p;
+        p += set->keys[i].size;
+    }
+    if (!sort || set->count < 2)
+        return (0);
+
+    WT_RET(__curjoin_set_sort(session, set));
+    for (i = 1, j = 1; i < set->count; ++i) {
+        WT_RET(__wt_compare(session, set->collator, &set->keys[j - 1], &set->keys[i], &cmp));
+        if (cmp != 0)
+            set->keys[j++] = set->keys[i];
+    }
+    set->count = j;
+    return (0);
+}
+
+/*
+ * __curjoin_set_intersect --
+ *     Intersect two sets into a new set. Walk the smaller set and search forward in the larger one;
+ *     when the sizes are skewed, gallop through the larger set instead of stepping over every key.
+ */
+static int
+__curjoin_set_intersect(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_SET *a, WT_CURSOR_JOIN_SET *b,
+  WT_CURSOR_JOIN_SET **resultp)
+{
+    WT_COLLATOR *collator;
+    WT_CURSOR_JOIN_SET *large, *result, *small;
+    WT_DECL_RET;
+    WT_ITEM *key;
+    size_t hi, i, lo, mid, step;
+    int cmp;
+    bool gallop;
+
+    *resultp = NULL;
+
+    if (a->count <= b->count) {
+        small = a;
+        large = b;
+    } else {
+        small = b;
+        large = a;
+    }
+    collator = small->collator;
+    gallop = small->count * 8 < large->count;
+    WT_RET(__curjoin_set_alloc(session, collator, small->buf.size, small->count, &result));
+
+    for (i = lo = 0; i < small->count && lo < large->count; ++i) {
+        key = &small->keys[i];
+        if (gallop) {
+            /*
+             * Double the step until we pass the key, then binary search the last step: all keys
+             * before lo are smaller than the key, the key at hi (if any) is not.
+             */
+            for (hi = lo, step = 1; hi < large->count; step *= 2) {
+                WT_ERR(__wt_compare(session, collator, &large->keys[hi], key, &cmp));
+                if (cmp >= 0)
+                    break;
+                lo = hi + 1;
+                hi += step;
+            }
+            hi = WT_MIN(hi, large->count);
+            while (lo < hi) {
+                mid = lo + (hi - lo) / 2;
+                WT_ERR(__wt_compare(session, collator, &large->keys[mid], key, &cmp));
+                if (cmp < 0)
+                    lo = mid + 1;
+                else
+                    hi = mid;
+            }
+        } else
+            for (; lo < large->count; ++lo) {
+                WT_ERR(__wt_compare(session, collator, &large->keys[lo], key, &cmp));
+                if (cmp >= 0)
+                    break;
+            }
+        if (lo == large->count)
+            break;
+        WT_ERR(__wt_compare(session, collator, &large->keys[lo], key, &cmp));
+        if (cmp == 0) {
+            WT_ERR(__curjoin_set_insert(session, result, key));
+            ++lo;
+        }
+    }
+    WT_ERR(__curjoin_set_finish(session, result, false));
+    *resultp = result;
+    return (0);
+
+err:
+    __curjoin_set_free(session, &result);
+    return (ret);
+}
+
+/*
+ * __curjoin_set_union --
+ *     Merge two sets into a new set, discarding duplicates.
+ */
+static int
+__curjoin_set_union(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_SET *a, WT_CURSOR_JOIN_SET *b,
+  WT_CURSOR_JOIN_SET **resultp)
+{
+    WT_CURSOR_JOIN_SET *result;
+    WT_DECL_RET;
+    size_t i, j;
+    int cmp;
+
+    *resultp = NULL;
+
+    WT_RET(__curjoin_set_alloc(
+      session, a->collator, a->buf.size + b->buf.size, a->count + b->count, &result));
+    for (i = j = 0; i < a->count || j < b->count;) {
+        if (i == a->count)
+            cmp = 1;
+        else if (j == b->count)
+            cmp = -1;
+        else
+            WT_ERR(__wt_compare(session, a->collator, &a->keys[i], &b->keys[j], &cmp));
+        if (cmp <= 0) {
+            WT_ERR(__curjoin_set_insert(session, result, &a->keys[i++]));
+            if (cmp == 0)
+                ++j;
+        } else
+            WT_ERR(__curjoin_set_insert(session, result, &b->keys[j++]));
+    }
+    WT_ERR(__curjoin_set_finish(session, result, false));
+    *resultp = result;
+    return (0);
+
+err:
+    __curjoin_set_free(session, &result);
+    return (ret);
+}
+
+/*
+ * __curjoin_positioned --
+ *     Return if the join cursor is positioned on a key.
+ */
+static bool
+__curjoin_positioned(WT_CURSOR_JOIN *cjoin)
+{
+    if (!F_ISSET(cjoin, WT_CURJOIN_INITIALIZED))
+        return (false);
+    if (F_ISSET(cjoin, WT_CURJOIN_SET))
+        return (cjoin->set != NULL && cjoin->set->positioned);
+    return (cjoin->iter != NULL && cjoin->iter->positioned);
+}
+
 /*
  * __curjoin_get_key --
  *     WT_CURSOR->get_key for join cursors.
@@ -691,7 +985,7 @@ __curjoin_get_key(WT_CURSOR *cursor, ...)
 
     JOINABLE_CURSOR_API_CALL(cursor, session, get_key, NULL);
 
-    if (!F_ISSET(cjoin, WT_CURJOIN_INITIALIZED) || !cjoin->iter->positioned)
+    if (!__curjoin_positioned(cjoin))
         WT_ERR_MSG(session, EINVAL, "join cursor must be advanced with next()");
     va_start(ap, cursor);
     ret = __wt_cursor_get_keyv(cursor, cursor->flags, ap);
@@ -717,7 +1011,7 @@ __curjoin_get_value(WT_CURSOR *cursor, ...)
 
     JOINABLE_CURSOR_API_CALL(cursor, session, get_value, NULL);
 
-    if (!F_ISSET(cjoin, WT_CURJOIN_INITIALIZED) || !cjoin->iter->positioned)
+    if (!__curjoin_positioned(cjoin))
         WT_ERR_MSG(session, EINVAL, "join cursor must be advanced with next()");
 
     va_start(ap, cursor);
@@ -729,12 +1023,13 @@ err:
 }
 
 /*
- * __curjoin_init_bloom --
- *     Populate Bloom filters
+ * __curjoin_init_scan --
+ *     Scan the range of a join entry, inserting the matching primary keys into a Bloom filter or a
+ *     set.
  */
 static int
-__curjoin_init_bloom(
-  WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, WT_CURSOR_JOIN_ENTRY *entry, WT_BLOOM *bloom)
+__curjoin_init_scan(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, WT_CURSOR_JOIN_ENTRY *entry,
+  WT_BLOOM *bloom, WT_CURSOR_JOIN_SET *set)
 {
     WT_COLLATOR *collator;
     WT_CURSOR *c;
@@ -840,9 +1135,10 @@ __curjoin_init_bloom(
         }
         /*
          * Either it's a disjunction that hasn't satisfied any condition, or it's a conjunction that
-         * has satisfied all conditions.
+         * has satisfied all conditions. A disjunction that skipped conditions already satisfied by
+         * every remaining key has satisfied a condition.
          */
-        if (F_ISSET(entry, WT_CURJOIN_ENTRY_DISJUNCTION))
+        if (F_ISSET(entry, WT_CURJOIN_ENTRY_DISJUNCTION) && skip == 0)
             goto advance;
 insert:
         if (entry->index != NULL) {
@@ -851,8 +1147,18 @@ insert:
             curvalue.size = c->key.size - curkey.size;
         } else
             WT_ERR(c->get_key(c, &curvalue));
-        __wt_bloom_insert(bloom, &curvalue);
-        entry->stats.bloom_insert++;
+        if (bloom != NULL) {
+            __wt_bloom_insert(bloom, &curvalue);
+            entry->stats.bloom_insert++;
+        } else {
+            WT_ERR(__curjoin_set_insert(session, set, &curvalue));
+            entry->stats.set_insert++;
+            if (__curjoin_set_footprint(set) + __curjoin_set_footprint(cjoin->set) >
+              cjoin->set_max) {
+                set->full = true;
+                goto done;
+            }
+        }
 advance:
         if ((ret = c->next(c)) == WT_NOTFOUND)
             break;
@@ -867,6 +1173,85 @@ err:
     return (ret);
 }
 
+/*
+ * __curjoin_main_collator --
+ *     Find the collator ordering the main table's primary keys. Return false if the main table
+ *     isn't stored in a file and the collator isn't known.
+ */
+static bool
+__curjoin_main_collator(WT_CURSOR_JOIN *cjoin, WT_COLLATOR **collatorp)
+{
+    WT_CURSOR *c;
+
+    c = cjoin->main;
+    if (WT_PREFIX_MATCH(c->uri, "table:"))
+        c = WT_CURSOR_PRIMARY(c);
+    if (!WT_PREFIX_MATCH(c->uri, "file:"))
+        return (false);
+    *collatorp = CUR2BT(c)->collator;
+    return (true);
+}
+
+/*
+ * __curjoin_init_set --
+ *     Collect the primary keys matching a join entry into a set and combine it with the set built
+ *     from the previous entries. Set the fallback flag if the sets can't be used, they would use
+ *     too much memory or the primary key order isn't known.
+ */
+static int
+__curjoin_init_set(
+  WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, WT_CURSOR_JOIN_ENTRY *entry, bool *fallbackp)
+{
+    WT_COLLATOR *collator;
+    WT_CURSOR_JOIN_SET *result, *set;
+    WT_DECL_RET;
+
+    result = set = NULL;
+    *fallbackp = false;
+
+    /* Once a conjunction is empty, there's no reason to scan the remaining entries. */
+    if (cjoin->set != NULL && cjoin->set->count == 0 && !F_ISSET(cjoin, WT_CURJOIN_DISJUNCTION)) {
+        entry->stats.set_result = 0;
+        return (0);
+    }
+
+    if (!__curjoin_main_collator(cjoin, &collator)) {
+        *fallbackp = true;
+        return (0);
+    }
+
+    /* The count is an estimate, don't let it allocate an unreasonable amount of memory. */
+    WT_RET(
+      __curjoin_set_alloc(session, collator, 0, (size_t)WT_MIN(entry->count, WT_MILLION), &set));
+    WT_ERR(__curjoin_init_scan(session, cjoin, entry, NULL, set));
+    if (set->full) {
+        *fallbackp = true;
+        goto err;
+    }
+    WT_ERR(__curjoin_set_finish(session, set, true));
+
+    if (cjoin->set == NULL) {
+        cjoin->set = set;
+        set = NULL;
+    } else {
+        if (F_ISSET(cjoin, WT_CURJOIN_DISJUNCTION))
+            WT_ERR(__curjoin_set_union(session, cjoin->set, set, &result));
+        else
+            WT_ERR(__curjoin_set_intersect(session, cjoin->set, set, &result));
+        __curjoin_set_free(session, &cjoin->set);
+        cjoin->set = result;
+        if (__curjoin_set_footprint(cjoin->set) > cjoin->set_max) {
+            *fallbackp = true;
+            goto err;
+        }
+    }
+    entry->stats.set_result = (int64_t)cjoin->set->count;
+
+err:
+    __curjoin_set_free(session, &set);
+    return (ret);
+}
+
 /*
  * __curjoin_init_next --
  *     Initialize the cursor join when the next function is first called.
@@ -885,8 +1270,10 @@ __curjoin_init_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterab
     const char **config, *proj, *urimain;
     const char *def_cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), NULL};
     const char *raw_cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), "raw", NULL};
+    bool fallback;
 
     mainbuf = NULL;
+    fallback = false;
     if (cjoin->entries_next == 0)
         WT_RET_MSG(session, EINVAL, "join cursor has not yet been joined with any other cursors");
 
@@ -954,7 +1341,7 @@ __curjoin_init_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterab
                 je->bloom_hash_count = k;
                 WT_ERR(__wt_bloom_create(session, NULL, NULL, je->count, f, k, &je->bloom));
                 F_SET(je, WT_CURJOIN_ENTRY_OWN_BLOOM);
-                WT_ERR(__curjoin_init_bloom(session, cjoin, je, je->bloom));
+                WT_ERR(__curjoin_init_scan(session, cjoin, je, je->bloom, NULL));
                 /*
                  * Share the Bloom filter, making all config info consistent.
                  */
@@ -972,15 +1359,43 @@ __curjoin_init_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, bool iterab
                  */
                 WT_ERR(__wt_bloom_create(session, NULL, NULL, je->count, je->bloom_bit_count,
                   je->bloom_hash_count, &bloom));
-                WT_ERR(__curjoin_init_bloom(session, cjoin, je, bloom));
+                WT_ERR(__curjoin_init_scan(session, cjoin, je, bloom, NULL));
                 WT_ERR(__wt_bloom_intersection(je->bloom, bloom));
                 WT_ERR(__wt_bloom_close(bloom));
             }
         }
+
+        /*
+         * Sets are built for every entry, the combined set is iterated rather than any of the
+         * entries.
+         */
+        if (F_ISSET(je, WT_CURJOIN_ENTRY_SET)) {
+            if (session->txn->isolation == WT_ISO_READ_UNCOMMITTED)
+                WT_ERR_MSG(session, EINVAL,
+                  "join cursors with sets cannot be used with read-uncommitted isolation");
+            WT_ERR(__curjoin_init_set(session, cjoin, je, &fallback));
+            if (fallback)
+                break;
+        }
         if (!F_ISSET(cjoin, WT_CURJOIN_DISJUNCTION))
             iterable = false;
     }
-    F_SET(cjoin, WT_CURJOIN_INITIALIZED);
+
+    /*
+     * If the sets can't be used, discard them and start again, evaluating the join the default way:
+     * iterating the first entry and checking each key against the others.
+     */
+    if (fallback) {
+        __curjoin_set_free(session, &cjoin->set);
+        F_CLR(cjoin, WT_CURJOIN_SET);
+        for (je = cjoin->entries; je < jeend; je++)
+            F_CLR(je, WT_CURJOIN_ENTRY_SET);
+        ret = cjoin->main->close(cjoin->main);
+        cjoin->main = NULL;
+        WT_ERR(ret);
+        WT_ERR(__curjoin_init_next(session, cjoin, true));
+    } else
+        F_SET(cjoin, WT_CURJOIN_INITIALIZED);
 
 err:
     __wt_free(session, mainbuf);
@@ -1007,6 +1422,52 @@ __curjoin_insert_endpoint(WT_SESSION_IMPL *session, WT_CURSOR_JOIN_ENTRY *entry,
     return (0);
 }
 
+/*
+ * __curjoin_set_next --
+ *     Return the next key from the join's combined set. The keys are in primary key order, so the
+ *     main table is read sequentially.
+ */
+static int
+__curjoin_set_next(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin)
+{
+    WT_CURSOR *c, *cursor;
+    WT_CURSOR_JOIN_SET *set;
+    WT_DECL_RET;
+    const uint8_t *p;
+
+    cursor = &cjoin->iface;
+    set = cjoin->set;
+    set->positioned = false;
+
+    /* Like other cursors, the next call after reaching the end restarts the iteration. */
+    if (set->pos >= set->count) {
+        set->pos = 0;
+        return (WT_NOTFOUND);
+    }
+
+    WT_ITEM_SET(cursor->key, set->keys[set->pos]);
+    ++set->pos;
+    if (WT_CURSOR_RECNO(cursor)) {
+        p = (const uint8_t *)cursor->key.data;
+        WT_RET(__wt_vunpack_uint(&p, cursor->key.size, &cursor->recno));
+    } else
+        cursor->recno = 0;
+
+    /* A failed search is not expected, convert WT_NOTFOUND into a generic error. */
+    c = cjoin->main;
+    __wt_cursor_set_raw_key(c, &cursor->key);
+    cjoin->entries[0].stats.main_access++;
+    if ((ret = c->search(c)) != 0) {
+        if (ret == WT_NOTFOUND)
+            ret = WT_ERROR;
+        WT_RET_MSG(session, ret, "join cursor failed search");
+    }
+
+    set->positioned = true;
+    F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
+    return (0);
+}
+
 /*
  * __curjoin_next --
  *     WT_CURSOR::next for join cursors.
@@ -1028,7 +1489,12 @@ __curjoin_next(WT_CURSOR *cursor)
     if (F_ISSET(cjoin, WT_CURJOIN_ERROR))
         WT_ERR_MSG(session, WT_ERROR, "join cursor encountered previous error");
     if (!F_ISSET(cjoin, WT_CURJOIN_INITIALIZED))
-        WT_ERR(__curjoin_init_next(session, cjoin, true));
+        WT_ERR(__curjoin_init_next(session, cjoin, !F_ISSET(cjoin, WT_CURJOIN_SET)));
+    if (F_ISSET(cjoin, WT_CURJOIN_SET)) {
+        F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+        WT_ERR_NOTFOUND_OK(__curjoin_set_next(session, cjoin), true);
+        goto done;
+    }
     if (cjoin->iter == NULL)
         WT_ERR(__curjoin_iter_init(session, cjoin, &cjoin->iter));
     iter = cjoin->iter;
@@ -1063,6 +1529,7 @@ __curjoin_next(WT_CURSOR *cursor)
     } else if (ret == WT_NOTFOUND && (tret = __curjoin_iter_close_all(iter)) != 0)
         WT_ERR(tret);
 
+done:
     if (0) {
 err:
         F_SET(cjoin, WT_CURJOIN_ERROR);
@@ -1148,6 +1615,10 @@ __curjoin_reset(WT_CURSOR *cursor)
 
     if (cjoin->iter != NULL)
         WT_ERR(__curjoin_iter_reset(cjoin->iter));
+    if (cjoin->set != NULL) {
+        cjoin->set->pos = 0;
+        cjoin->set->positioned = false;
+    }
 
 err:
     API_END_RET(session, ret);
@@ -1293,7 +1764,7 @@ err:
 int
 __wt_curjoin_join(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, WT_INDEX *idx,
   WT_CURSOR *ref_cursor, uint8_t flags, uint8_t range, uint64_t count, uint32_t bloom_bit_count,
-  uint32_t bloom_hash_count)
+  uint32_t bloom_hash_count, uint64_t set_max)
 {
     WT_CURSOR_INDEX *cindex;
     WT_CURSOR_JOIN *child;
@@ -1317,6 +1788,20 @@ __wt_curjoin_join(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin, WT_INDEX *idx
         WT_RET_MSG(session, EINVAL, "operation=and does not match previous operation=or");
 
     nested = WT_PREFIX_MATCH(ref_cursor->uri, "join:");
+    if (nested &&
+      (F_ISSET(cjoin, WT_CURJOIN_SET) || F_ISSET((WT_CURSOR_JOIN *)ref_cursor, WT_CURJOIN_SET)))
+        WT_RET_MSG(session, EINVAL, "strategy=set cannot be used with subjoins");
+    if (LF_ISSET(WT_CURJOIN_ENTRY_SET) && cjoin->parent != NULL)
+        WT_RET_MSG(session, EINVAL, "strategy=set cannot be used with subjoins");
+    if (cjoin->entries_next == 0) {
+        if (LF_ISSET(WT_CURJOIN_ENTRY_SET))
+            F_SET(cjoin, WT_CURJOIN_SET);
+    } else if (LF_ISSET(WT_CURJOIN_ENTRY_SET) != F_ISSET(cjoin, WT_CURJOIN_SET))
+        WT_RET_MSG(session, EINVAL,
+          "strategy=set must be used for all cursors joined to a join cursor, or none of them");
+    if (LF_ISSET(WT_CURJOIN_ENTRY_SET) && (cjoin->entries_next == 0 || set_max < cjoin->set_max))
+        cjoin->set_max = set_max;
+
     if (!nested)
         for (i = 0; i < cjoin->entries_next; i++) {
             if (cjoin->entries[i].index == idx && cjoin->entries[i].subjoin == NULL) {
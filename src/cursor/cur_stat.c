@@ -348,6 +348,8 @@ err:
 
     __wt_buf_free(session, &cst->pv);
     __wt_free(session, cst->desc_buf);
+    if (cst->stats_base == WT_SESSION_WAITS_STATS_BASE)
+        __wt_free(session, cst->u.session_waits_group.entries);
 
     __wt_cursor_close(cursor);
 
@@ -372,8 +374,10 @@ __curstat_conn_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
     __wt_conn_stat_init(session);
     __wt_stat_connection_init_single(&cst->u.conn_stats);
     __wt_stat_connection_aggregate(conn->stats, &cst->u.conn_stats);
-    if (F_ISSET(cst, WT_STAT_CLEAR))
+    if (F_ISSET(cst, WT_STAT_CLEAR)) {
         __wt_stat_connection_clear_all(conn->stats);
+        __wt_latency_clear(session, NULL);
+    }
 
     cst->stats = (int64_t *)&cst->u.conn_stats;
     cst->stats_base = WT_CONNECTION_STATS_BASE;
@@ -418,8 +422,10 @@ __curstat_file_init(
     if ((ret = __wt_btree_stat_init(session, cst)) == 0) {
         __wt_stat_dsrc_init_single(&cst->u.dsrc_stats);
         __wt_stat_dsrc_aggregate(dhandle->stats, &cst->u.dsrc_stats);
-        if (F_ISSET(cst, WT_STAT_CLEAR))
+        if (F_ISSET(cst, WT_STAT_CLEAR)) {
             __wt_stat_dsrc_clear_all(dhandle->stats);
+            __wt_latency_clear(session, dhandle);
+        }
         __wt_curstat_dsrc_final(cst);
     }
 
@@ -550,6 +556,135 @@ __curstat_session_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
     cst->stats_desc = __wt_stat_session_desc;
 }
 
+/*
+ * __curstat_session_waits_next_set --
+ *     Advance to another session to give another set of statistics.
+ */
+static int
+__curstat_session_waits_next_set(
+  WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst, bool forw, bool init)
+{
+    WT_SESSION_WAITS_STATS_GROUP *wait_group;
+    ssize_t pos;
+
+    WT_UNUSED(session);
+
+    wait_group = &cst->u.session_waits_group;
+    if (init)
+        pos = forw ? 0 : (ssize_t)wait_group->entries_next - 1;
+    else
+        pos = wait_group->entry + (forw ? 1 : -1);
+    if (pos < 0 || (size_t)pos >= wait_group->entries_next)
+        return (WT_NOTFOUND);
+
+    wait_group->entry = pos;
+    cst->stats = (int64_t *)&wait_group->entries[pos].stats;
+    if (!init)
+        cst->key = forw ? WT_STAT_KEY_MIN(cst) : WT_STAT_KEY_MAX(cst);
+    return (0);
+}
+
+/*
+ * __curstat_session_waits_desc --
+ *     Assemble the description field based on current session and statistic.
+ */
+static int
+__curstat_session_waits_desc(WT_CURSOR_STAT *cst, int slot, const char **resultp)
+{
+    WT_SESSION_IMPL *session;
+    WT_SESSION_WAITS_STATS_GROUP *wait_group;
+    size_t len;
+    const char *static_desc;
+
+    session = CUR2S(cst);
+    wait_group = &cst->u.session_waits_group;
+    WT_RET(__wt_stat_session_waits_desc(cst, slot, &static_desc));
+
+    /* Insert the session ID between the "session-wait: " and the following description. */
+    WT_PREFIX_SKIP_REQUIRED(session, static_desc, "session-wait: ");
+    len = strlen("session-wait: session : ") + 10 + strlen(static_desc) + 1;
+    WT_RET(__wt_realloc_noclear(session, NULL, len, &cst->desc_buf));
+    WT_RET(__wt_snprintf(cst->desc_buf, len, "session-wait: session %" PRIu32 ": %s",
+      wait_group->entries[wait_group->entry].id, static_desc));
+    *resultp = cst->desc_buf;
+    return (0);
+}
+
+/*
+ * __curstat_session_waits_snapshot --
+ *     Copy a session's wait events into a set of statistics, optionally clearing them.
+ */
+static void
+__curstat_session_waits_snapshot(WT_SESSION_IMPL *s, bool clear, WT_SESSION_WAITS_STATS *stats)
+{
+    uint64_t current, start;
+    uint32_t event;
+
+    /* The start time is set before the event, read them in the opposite order. */
+    WT_ORDERED_READ(event, s->wait_event);
+    WT_ORDERED_READ(start, s->wait_start);
+    current = event == WT_WAIT_NONE ? 0 : WT_CLOCKDIFF_US(__wt_clock(s), start);
+
+#define WT_SESSION_WAITS_SET(name, id)                                \
+    do {                                                              \
+        stats->name##_count = (int64_t)s->wait_count[id];             \
+        stats->name##_time = (int64_t)s->wait_time[id];               \
+        stats->name##_current = event == (id) ? (int64_t)current : 0; \
+    } while (0)
+    WT_SESSION_WAITS_SET(cache_eviction, WT_WAIT_CACHE_EVICTION);
+    WT_SESSION_WAITS_SET(capacity, WT_WAIT_CAPACITY);
+    WT_SESSION_WAITS_SET(checkpoint_gather, WT_WAIT_CHECKPOINT_GATHER);
+    WT_SESSION_WAITS_SET(dhandle_lock, WT_WAIT_DHANDLE_LOCK);
+    WT_SESSION_WAITS_SET(log_slot, WT_WAIT_LOG_SLOT);
+    WT_SESSION_WAITS_SET(page_lock, WT_WAIT_PAGE_LOCK);
+#undef WT_SESSION_WAITS_SET
+
+    /* Clearing races with the session's own updates, the same as clearing statistics. */
+    if (clear) {
+        memset(s->wait_count, 0, sizeof(s->wait_count));
+        memset(s->wait_time, 0, sizeof(s->wait_time));
+    }
+}
+
+/*
+ * __curstat_session_waits_init --
+ *     Initialize the wait event statistics for the active sessions.
+ */
+static int
+__curstat_session_waits_init(WT_SESSION_IMPL *session, WT_CURSOR_STAT *cst)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_SESSION_IMPL *s;
+    WT_SESSION_WAITS_STATS_GROUP *wait_group;
+    uint32_t i, session_cnt;
+
+    conn = S2C(session);
+    wait_group = &cst->u.session_waits_group;
+
+    /* Discard any previous snapshot, the cursor is re-initialized each time it's reset. */
+    __wt_free(session, wait_group->entries);
+    memset(wait_group, 0, sizeof(*wait_group));
+
+    /* Sessions can open while we walk the array, only the ones counted here are reported. */
+    WT_ORDERED_READ(session_cnt, conn->session_cnt);
+    WT_RET(__wt_calloc_def(session, session_cnt, &wait_group->entries));
+    for (s = conn->sessions, i = 0; i < session_cnt; ++s, ++i) {
+        if (!s->active)
+            continue;
+        wait_group->entries[wait_group->entries_next].id = s->id;
+        __curstat_session_waits_snapshot(
+          s, F_ISSET(cst, WT_STAT_CLEAR), &wait_group->entries[wait_group->entries_next].stats);
+        ++wait_group->entries_next;
+    }
+
+    cst->stats = (int64_t *)&wait_group->entries[0].stats;
+    cst->stats_base = WT_SESSION_WAITS_STATS_BASE;
+    cst->stats_count = sizeof(WT_SESSION_WAITS_STATS) / sizeof(int64_t);
+    cst->stats_desc = __curstat_session_waits_desc;
+    cst->next_set = __curstat_session_waits_next_set;
+    return (0);
+}
+
 /*
  * __wt_curstat_init --
  *     Initialize a statistics cursor.
@@ -574,7 +709,9 @@ __wt_curstat_init(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *curjoin,
     else if (strcmp(dsrc_uri, "session") == 0) {
         __curstat_session_init(session, cst);
         return (0);
-    } else if (WT_PREFIX_MATCH(dsrc_uri, "colgroup:"))
+    } else if (strcmp(dsrc_uri, "session_waits") == 0)
+        WT_RET(__curstat_session_waits_init(session, cst));
+    else if (WT_PREFIX_MATCH(dsrc_uri, "colgroup:"))
         WT_RET(__wt_curstat_colgroup_init(session, dsrc_uri, cfg, cst));
     else if (WT_PREFIX_MATCH(dsrc_uri, "file:"))
         WT_RET(__curstat_file_init(session, dsrc_uri, cfg, cst));
@@ -884,6 +884,10 @@ __wt_cursor_cache_get(WT_SESSION_IMPL *session, const char *uri, uint64_t hash_v
          * for configurations that only differ by a cursor flag, which we can patch up if we find a
          * matching cursor.
          */
+        WT_RET(__wt_config_gets_def(session, cfg, "batch.size", 0, &cval));
+        if (cval.val != 0)
+            return (WT_NOTFOUND);
+
         WT_RET(__wt_config_gets_def(session, cfg, "bulk", 0, &cval));
         if (cval.val)
             return (WT_NOTFOUND);
@@ -896,6 +900,10 @@ __wt_cursor_cache_get(WT_SESSION_IMPL *session, const char *uri, uint64_t hash_v
         if (cval.len != 0)
             return (WT_NOTFOUND);
 
+        WT_RET(__wt_config_gets_def(session, cfg, "filter", 0, &cval));
+        if (cval.len != 0)
+            return (WT_NOTFOUND);
+
         WT_RET(__wt_config_gets_def(session, cfg, "next_random", 0, &cval));
         if (cval.val != 0)
             return (WT_NOTFOUND);
@@ -8,6 +8,7 @@
 
 #include "wt_internal.h"
 
+static int __curtable_close(WT_CURSOR *cursor);
 static int __curtable_open_indices(WT_CURSOR_TABLE *ctable);
 static int __curtable_update(WT_CURSOR *cursor);
 
@@ -140,6 +141,212 @@ __wt_apply_single_idx(WT_SESSION_IMPL *session, WT_INDEX *idx, WT_CURSOR *cur,
     return (0);
 }
 
+/*
+ * __curtable_idx_batch_add --
+ *     Buffer an update to an index.
+ */
+static int
+__curtable_idx_batch_add(
+  WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable, u_int slot, const WT_ITEM *key, bool remove)
+{
+    WT_CURSOR_TABLE_IDX_BATCH *batch;
+    WT_CURSOR_TABLE_IDX_OP *op;
+
+    batch = &ctable->idx_batch[slot];
+    WT_RET(__wt_realloc_def(session, &batch->ops_allocated, batch->count + 1, &batch->ops));
+    WT_RET(__wt_buf_extend(session, &batch->buf, batch->buf.size + key->size));
+    memcpy((uint8_t *)batch->buf.mem + batch->buf.size, key->data, key->size);
+    batch->buf.size += key->size;
+
+    op = &batch->ops[batch->count++];
+    op->key.data = NULL;
+    op->key.size = key->size;
+    op->seq = ctable->idx_batch_seq++;
+    op->remove = remove;
+
+    if (ctable->idx_batch_ops++ == 0)
+        ++session->idx_batch_cursors;
+    WT_STAT_CONN_INCR(session, cursor_index_batch_ops);
+    return (0);
+}
+
+/*
+ * __curtable_idx_batch_discard --
+ *     Discard buffered index updates.
+ */
+static void
+__curtable_idx_batch_discard(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable)
+{
+    u_int i;
+
+    if (ctable->idx_batch_ops == 0)
+        return;
+
+    for (i = 0; i < ctable->table->nindices; i++) {
+        ctable->idx_batch[i].buf.size = 0;
+        ctable->idx_batch[i].count = 0;
+    }
+    ctable->idx_batch_ops = 0;
+    --session->idx_batch_cursors;
+}
+
+/*
+ * __curtable_idx_op_compare --
+ *     Qsort function: sort buffered index updates by key, then by the order they were made.
+ */
+static int WT_CDECL
+__curtable_idx_op_compare(const void *a, const void *b)
+{
+    const WT_CURSOR_TABLE_IDX_OP *aop, *bop;
+    int cmp;
+
+    aop = (const WT_CURSOR_TABLE_IDX_OP *)a;
+    bop = (const WT_CURSOR_TABLE_IDX_OP *)b;
+    if ((cmp = __wt_lex_compare(&aop->key, &bop->key)) != 0)
+        return (cmp);
+    return (aop->seq < bop->seq ? -1 : 1);
+}
+
+/*
+ * __curtable_idx_batch_apply --
+ *     Apply buffered index updates. The updates to each index are sorted by key so the index is
+ *     walked in order rather than searched at random, updates to the same key are applied in the
+ *     order they were made. Removing an index entry immediately followed by inserting it again (an
+ *     update that didn't change the indexed columns) cancel out.
+ */
+static int
+__curtable_idx_batch_apply(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable)
+{
+    WT_CURSOR *cur;
+    WT_CURSOR_TABLE_IDX_BATCH *batch;
+    WT_CURSOR_TABLE_IDX_OP *op, *opend;
+    WT_DECL_RET;
+    u_int i;
+    const uint8_t *p;
+
+    cur = NULL;
+
+    if (ctable->idx_batch_ops == 0)
+        return (0);
+    WT_STAT_CONN_INCR(session, cursor_index_batch_apply);
+
+    for (i = 0; i < ctable->table->nindices; i++) {
+        batch = &ctable->idx_batch[i];
+        if (batch->count == 0)
+            continue;
+
+        opend = batch->ops + batch->count;
+        for (p = batch->buf.mem, op = batch->ops; op < opend; ++op) {
+            op->key.data = p;
+            p += op->key.size;
+        }
+
+        /* A custom collator may consider keys equal that aren't byte-wise equal, don't reorder. */
+        if (ctable->table->indices[i]->collator == NULL)
+            __wt_qsort(
+              batch->ops, batch->count, sizeof(WT_CURSOR_TABLE_IDX_OP), __curtable_idx_op_compare);
+
+        cur = ctable->idx_cursors[i];
+        for (op = batch->ops; op < opend; ++op) {
+            if (op->remove && op + 1 < opend && !op[1].remove &&
+              __wt_lex_compare(&op->key, &op[1].key) == 0) {
+                WT_STAT_CONN_INCRV(session, cursor_index_batch_cancel, 2);
+                ++op;
+                continue;
+            }
+
+            /* The index key is set and the value is empty (it starts clear and is never set). */
+            WT_ITEM_SET(cur->key, op->key);
+            F_SET(cur, WT_CURSTD_KEY_EXT | WT_CURSTD_VALUE_EXT);
+
+            /*
+             * Updates anticipate the index entries of a previously removed value not existing, see
+             * __curtable_update.
+             */
+            if (op->remove)
+                WT_ERR_NOTFOUND_OK(cur->remove(cur), false);
+            else
+                WT_ERR(cur->insert(cur));
+        }
+        WT_ERR(cur->reset(cur));
+    }
+
+err:
+    /* On error the transaction must roll back, the remaining updates are discarded. */
+    if (ret != 0 && cur != NULL)
+        WT_TRET(cur->reset(cur));
+    __curtable_idx_batch_discard(session, ctable);
+    return (ret);
+}
+
+/*
+ * __curtable_idx_batch_flush --
+ *     Apply the cursor's buffered index updates if its transaction can still commit, otherwise
+ *     discard them.
+ */
+static int
+__curtable_idx_batch_flush(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable)
+{
+    if (F_ISSET(session->txn, WT_TXN_RUNNING) && !F_ISSET(session->txn, WT_TXN_ERROR))
+        return (__curtable_idx_batch_apply(session, ctable));
+    __curtable_idx_batch_discard(session, ctable);
+    return (0);
+}
+
+/*
+ * __curtable_idx_batch_resolve --
+ *     Apply or discard the index updates buffered by the session's table cursors, optionally
+ *     skipping one cursor.
+ */
+static int
+__curtable_idx_batch_resolve(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *skip, bool apply)
+{
+    WT_CURSOR *cursor;
+    WT_CURSOR_TABLE *ctable;
+    WT_DECL_RET;
+
+    if (session->idx_batch_cursors == 0)
+        return (0);
+
+    TAILQ_FOREACH (cursor, &session->cursors, q) {
+        if (cursor->close != __curtable_close || cursor == (WT_CURSOR *)skip)
+            continue;
+        ctable = (WT_CURSOR_TABLE *)cursor;
+        ctable->idx_batching = false;
+
+        /* After a failure the transaction must roll back, discard the remaining updates. */
+        if (apply && ret == 0)
+            WT_TRET(__curtable_idx_batch_apply(session, ctable));
+        else
+            __curtable_idx_batch_discard(session, ctable);
+    }
+    return (ret);
+}
+
+/*
+ * __curtable_idx_batch_check --
+ *     Decide if the index updates of a cursor operation are buffered. Only operations in an
+ *     explicit transaction are buffered, an auto-commit transaction commits before the operation
+ *     returns. Nested calls (an overwriting insert updating the existing record) inherit the
+ *     decision.
+ */
+static int
+__curtable_idx_batch_check(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable)
+{
+    if (session->api_call_counter != 1)
+        return (0);
+
+    /*
+     * Index updates must be applied in the order they were made: only one cursor in a session has
+     * updates buffered at a time, any other cursor's updates are applied first.
+     */
+    if (session->idx_batch_cursors > (ctable->idx_batch_ops == 0 ? 0U : 1U))
+        WT_RET(__curtable_idx_batch_resolve(session, ctable, true));
+
+    ctable->idx_batching = ctable->idx_batch != NULL && F_ISSET(session->txn, WT_TXN_RUNNING);
+    return (0);
+}
+
 /*
  * __apply_idx --
  *     Apply an operation to all indices of a table.
@@ -148,6 +355,8 @@ static int
 __apply_idx(WT_CURSOR_TABLE *ctable, size_t func_off, bool skip_immutable)
 {
     WT_CURSOR **cp;
+    WT_DECL_ITEM(key);
+    WT_DECL_RET;
     WT_INDEX *idx;
     WT_SESSION_IMPL *session;
     u_int i;
@@ -161,12 +370,31 @@ __apply_idx(WT_CURSOR_TABLE *ctable, size_t func_off, bool skip_immutable)
         if (skip_immutable && F_ISSET(idx, WT_INDEX_IMMUTABLE))
             continue;
 
+        /*
+         * Buffer the update if the operation is batched. Custom extractors can produce any number
+         * of keys, those indices are always updated immediately.
+         */
+        if (ctable->idx_batching && idx->extractor == NULL) {
+            if (key == NULL)
+                WT_ERR(__wt_scr_alloc(session, 0, &key));
+            WT_ERR(__wt_schema_project_merge(
+              session, ctable->cg_cursors, idx->key_plan, idx->key_format, key));
+            WT_ERR(__curtable_idx_batch_add(
+              session, ctable, i, key, func_off == offsetof(WT_CURSOR, remove)));
+            continue;
+        }
+
         f = *(int (**)(WT_CURSOR *))((uint8_t *)*cp + func_off);
-        WT_RET(__wt_apply_single_idx(session, idx, *cp, ctable, f));
-        WT_RET((*cp)->reset(*cp));
+        WT_ERR(__wt_apply_single_idx(session, idx, *cp, ctable, f));
+        WT_ERR((*cp)->reset(*cp));
     }
 
-    return (0);
+    if (ctable->idx_batching && ctable->idx_batch_ops >= ctable->idx_batch_max)
+        WT_ERR(__curtable_idx_batch_apply(session, ctable));
+
+err:
+    __wt_scr_free(session, &key);
+    return (ret);
 }
 
 /*
@@ -448,6 +676,13 @@ __curtable_reset(WT_CURSOR *cursor)
 
     JOINABLE_CURSOR_API_CALL_PREPARE_ALLOWED(cursor, session, reset, NULL);
 
+    /*
+     * An application reset applies any buffered index updates. Resets from inside the library, for
+     * example when a transaction resolves, leave them for the transaction to handle.
+     */
+    if (API_USER_ENTRY(session))
+        WT_ERR(__curtable_idx_batch_flush(session, ctable));
+
     APPLY_CG(ctable, reset);
 
     /*
@@ -541,6 +776,7 @@ __curtable_insert(WT_CURSOR *cursor)
     ctable = (WT_CURSOR_TABLE *)cursor;
     JOINABLE_CURSOR_UPDATE_API_CALL(cursor, session, insert);
     WT_ERR(__curtable_open_indices(ctable));
+    WT_ERR(__curtable_idx_batch_check(session, ctable));
 
     cp = ctable->cg_cursors;
     primary = *cp++;
@@ -619,6 +855,7 @@ __curtable_update(WT_CURSOR *cursor)
     ctable = (WT_CURSOR_TABLE *)cursor;
     JOINABLE_CURSOR_UPDATE_API_CALL(cursor, session, update);
     WT_ERR(__curtable_open_indices(ctable));
+    WT_ERR(__curtable_idx_batch_check(session, ctable));
 
     /*
      * If the table has indices, first delete any old index keys, then update the primary, then
@@ -671,6 +908,7 @@ __curtable_remove(WT_CURSOR *cursor)
     ctable = (WT_CURSOR_TABLE *)cursor;
     JOINABLE_CURSOR_REMOVE_API_CALL(cursor, session, NULL);
     WT_ERR(__curtable_open_indices(ctable));
+    WT_ERR(__curtable_idx_batch_check(session, ctable));
 
     /* Check if the cursor was positioned. */
     primary = *ctable->cg_cursors;
@@ -764,8 +1002,9 @@ __wt_table_range_truncate(WT_CURSOR_TABLE *start, WT_CURSOR_TABLE *stop)
     wt_start = start == NULL ? NULL : &start->iface;
     wt_stop = stop == NULL ? NULL : &stop->iface;
 
-    /* Open any indices. */
+    /* Open any indices, and apply any buffered index updates, the truncate follows them. */
     WT_RET(__curtable_open_indices(ctable));
+    WT_RET(__curtable_idx_batch_resolve(session, NULL, true));
     WT_RET(__wt_scr_alloc(session, 128, &key));
     WT_STAT_DATA_INCR(session, cursor_truncate);
 
@@ -899,6 +1138,15 @@ __curtable_close(WT_CURSOR *cursor)
     JOINABLE_CURSOR_API_CALL_PREPARE_ALLOWED(cursor, session, close, NULL);
 err:
 
+    if (ctable->idx_batch != NULL) {
+        WT_TRET(__curtable_idx_batch_flush(session, ctable));
+        for (i = 0; i < ctable->table->nindices; i++) {
+            __wt_buf_free(session, &ctable->idx_batch[i].buf);
+            __wt_free(session, ctable->idx_batch[i].ops);
+        }
+        __wt_free(session, ctable->idx_batch);
+    }
+
     if (ctable->cg_cursors != NULL)
         for (i = 0, cp = ctable->cg_cursors; i < WT_COLGROUPS(ctable->table); i++, cp++)
             if (*cp != NULL) {
@@ -934,6 +1182,17 @@ err:
     API_END_RET(session, ret);
 }
 
+/*
+ * __wt_curtable_idx_batch_resolve --
+ *     Apply or discard the index updates buffered by the session's table cursors when the
+ *     transaction commits, is prepared or rolls back.
+ */
+int
+__wt_curtable_idx_batch_resolve(WT_SESSION_IMPL *session, bool apply)
+{
+    return (__curtable_idx_batch_resolve(session, NULL, apply));
+}
+
 /*
  * __curtable_complete --
  *     Return failure if the table is not yet fully created.
@@ -1015,6 +1274,8 @@ __curtable_open_indices(WT_CURSOR_TABLE *ctable)
     for (i = 0, cp = ctable->idx_cursors; i < table->nindices; i++, cp++)
         WT_ERR(
           __wt_open_cursor(session, table->indices[i]->source, &ctable->iface, ctable->cfg, cp));
+    if (ctable->idx_batch_max != 0)
+        WT_ERR(__wt_calloc_def(session, table->nindices, &ctable->idx_batch));
 
     if (0) {
 err:
@@ -1078,9 +1339,22 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
     size_t size;
     int cfg_cnt;
     const char *tablename, *columns;
+    bool batch;
 
     WT_STATIC_ASSERT(offsetof(WT_CURSOR_TABLE, iface) == 0);
 
+    /* Batch cursors wrap the table cursor, they can't also be dump or random cursors. */
+    WT_RET(__wt_config_gets_def(session, cfg, "batch.size", 0, &cval));
+    batch = cval.val != 0;
+    if (batch) {
+        WT_RET(__wt_config_gets_def(session, cfg, "next_random", 0, &cval));
+        if (cval.val != 0)
+            WT_RET_MSG(session, EINVAL, "batch cursors cannot be configured with next_random");
+        WT_RET(__wt_config_gets_def(session, cfg, "dump", 0, &cval));
+        if (cval.len != 0)
+            WT_RET_MSG(session, EINVAL, "batch cursors cannot be configured with dump");
+    }
+
     tablename = uri;
     WT_PREFIX_SKIP_REQUIRED(session, tablename, "table:");
     columns = strchr(tablename, '(');
@@ -1093,9 +1367,24 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
 
     WT_RET(__curtable_complete(session, table)); /* completeness check */
 
+    /* Iteration filters are evaluated by the underlying data source, tables must be simple. */
+    WT_RET(__wt_config_gets_def(session, cfg, "filter", 0, &cval));
+    if (cval.len != 0 && !table->is_simple) {
+        WT_RET(__wt_schema_release_table(session, &table));
+        WT_RET_MSG(
+          session, ENOTSUP, "filter configuration not supported for tables with named columns");
+    }
+
     if (table->is_simple) {
         /* Just return a cursor on the underlying data source. */
         ret = __wt_open_cursor(session, table->cgroups[0]->source, NULL, cfg, cursorp);
+        if (ret == 0 && batch) {
+            cursor = *cursorp;
+            if ((ret = __wt_curbatch_create(session, table, cursor, NULL, cfg, cursorp)) != 0) {
+                WT_TRET(cursor->close(cursor));
+                *cursorp = NULL;
+            }
+        }
 
         WT_TRET(__wt_schema_release_table(session, &table));
         if (ret == 0) {
@@ -1139,6 +1428,9 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
         cursor->reset = __curtable_reset;
     }
 
+    WT_ERR(__wt_config_gets_def(session, cfg, "index_batch", 0, &cval));
+    ctable->idx_batch_max = (uint64_t)cval.val;
+
     WT_ERR(__wt_cursor_init(cursor, cursor->internal_uri, owner, cfg, cursorp));
 
     if (F_ISSET(cursor, WT_CURSTD_DUMP_JSON))
@@ -1176,6 +1468,9 @@ __wt_curtable_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner,
     WT_ERR(__wt_buf_catfmt(session, tmp, "dump=\"\",readonly=0"));
     WT_ERR(__wt_strdup(session, tmp->data, &ctable->cfg[1]));
 
+    if (batch)
+        WT_ERR(__wt_curbatch_create(session, table, cursor, columns, cfg, cursorp));
+
     if (0) {
 err:
         if (*cursorp != NULL) {
@@ -2335,6 +2335,8 @@ __evict_page(WT_SESSION_IMPL *session, bool is_server)
     if (time_start != 0) {
         time_stop = __wt_clock(session);
         WT_STAT_CONN_INCRV(session, application_evict_time, WT_CLOCKDIFF_US(time_stop, time_start));
+        WT_LATENCY_RECORD(session, btree->dhandle, WT_LATENCY_EVICT_APP,
+          WT_CLOCKDIFF_NS(time_stop, time_start));
     }
     WT_TRACK_OP_END(session);
     return (ret);
@@ -2392,6 +2394,7 @@ __wt_cache_eviction_worker(WT_SESSION_IMPL *session, bool busy, bool readonly, d
     app_thread = !F_ISSET(session, WT_SESSION_INTERNAL);
     if (app_thread)
         time_start = __wt_clock(session);
+    __wt_wait_start(session, WT_WAIT_CACHE_EVICTION);
 
     for (initial_progress = cache->eviction_progress;; ret = 0) {
         /*
@@ -2462,6 +2465,7 @@ __wt_cache_eviction_worker(WT_SESSION_IMPL *session, bool busy, bool readonly, d
     }
 
 err:
+    __wt_wait_end(session, WT_WAIT_CACHE_EVICTION);
     if (time_start != 0) {
         time_stop = __wt_clock(session);
         elapsed = WT_CLOCKDIFF_US(time_stop, time_start);
@@ -54,6 +54,7 @@ __wt_page_release_evict(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
 {
     WT_BTREE *btree;
     WT_DECL_RET;
+    uint64_t time_start;
     uint32_t evict_flags;
     uint8_t previous_state;
     bool locked;
@@ -87,9 +88,16 @@ __wt_page_release_evict(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
         WT_ASSERT(session, !WT_READING_CHECKPOINT(session));
         WT_RET(__wt_curhs_cache(session));
     }
+    /* Application threads forcing eviction of a page are included in eviction latencies. */
+    time_start = 0;
+    if (!F_ISSET(session, WT_SESSION_INTERNAL) && WT_STAT_ENABLED(session))
+        time_start = __wt_clock(session);
     (void)__wt_atomic_addv32(&btree->evict_busy, 1);
     ret = __wt_evict(session, ref, previous_state, evict_flags);
     (void)__wt_atomic_subv32(&btree->evict_busy, 1);
+    if (time_start != 0)
+        WT_LATENCY_RECORD(session, btree->dhandle, WT_LATENCY_EVICT_APP,
+          WT_CLOCKDIFF_NS(__wt_clock(session), time_start));
 
     return (ret);
 }
@@ -131,6 +139,7 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, uint8_t previous_state, uint32
     WT_CLEAR(session->reconcile_timeline);
     WT_CLEAR(session->evict_timeline);
     session->evict_timeline.evict_start = __wt_clock(session);
+    WT_EVENT_TRACE_BEGIN_OP(session, WT_EVENT_TRACE_EVICT);
     /*
      * Immediately increment the forcible eviction counter, we might do an in-memory split and not
      * an eviction, which skips the other statistics.
@@ -280,6 +289,8 @@ done:
             session->reconcile_timeline.image_build_start),
           WT_CLOCKDIFF_US(session->reconcile_timeline.hs_wrapup_finish,
             session->reconcile_timeline.hs_wrapup_start));
+    WT_EVENT_TRACE_END_OP(session, WT_EVENT_TRACE_EVICT, ret);
+
     /* Leave any local eviction generation. */
     WT_LEAVE_GENERATION(session, WT_GEN_SPLIT);
     WT_LEAVE_GENERATION(session, WT_GEN_EVICT);
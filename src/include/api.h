@@ -59,6 +59,7 @@
     WT_ERR(WT_SESSION_CHECK_PANIC(s));                                  \
     WT_SINGLE_THREAD_CHECK_START(s);                                    \
     WT_TRACK_OP_INIT(s);                                                \
+    WT_EVENT_TRACE_API_BEGIN(s);                                        \
     if ((s)->api_call_counter == 1 && !F_ISSET(s, WT_SESSION_INTERNAL)) \
         __wt_op_timer_start(s);                                         \
     /* Reset wait time if this isn't an API reentry. */                 \
@@ -80,6 +81,7 @@
 #define API_END(s, ret)                                                                    \
     if ((s) != NULL) {                                                                     \
         WT_TRACK_OP_END(s);                                                                \
+        WT_EVENT_TRACE_API_END(s, ret);                                                    \
         WT_SINGLE_THREAD_CHECK_STOP(s);                                                    \
         if ((ret) != 0)                                                                    \
             __wt_txn_err_set(s, ret);                                                      \
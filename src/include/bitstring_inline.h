@@ -222,10 +222,11 @@ __bit_ffs(uint8_t *bitf, uint64_t nbits, uint64_t *retp)
  * __bit_getv --
  *	Return a fixed-length column store bit-field value.
  */
-static inline uint8_t
+static inline uint64_t
 __bit_getv(uint8_t *bitf, uint64_t entry, uint8_t width)
 {
-	uint64_t bit;
+	uint64_t bit, v64;
+	uint32_t v32;
 	uint8_t value;
 
 	value = 0;
@@ -242,6 +243,19 @@ __bit_getv(uint8_t *bitf, uint64_t entry, uint8_t width)
 	 * fallthrough comments in macros.
 	 */
 	switch (width) {
+	case 64:
+		/* Wide values are stored as aligned, little-endian integers. */
+		memcpy(&v64, bitf + entry * sizeof(uint64_t), sizeof(uint64_t));
+#ifdef WORDS_BIGENDIAN
+		v64 = __wt_bswap64(v64);
+#endif
+		return (v64);
+	case 32:
+		memcpy(&v32, bitf + entry * sizeof(uint32_t), sizeof(uint32_t));
+#ifdef WORDS_BIGENDIAN
+		v32 = __wt_bswap32(v32);
+#endif
+		return (v32);
 	case 8:
 		return (bitf[__bit_byte(bit)]);
 	case 7:
@@ -287,7 +301,7 @@ __bit_getv(uint8_t *bitf, uint64_t entry, uint8_t width)
  * __bit_getv_recno --
  *	Return a record number's bit-field value.
  */
-static inline uint8_t
+static inline uint64_t
 __bit_getv_recno(WT_REF *ref, uint64_t recno, uint8_t width)
 {
 	return (__bit_getv(
@@ -299,9 +313,10 @@ __bit_getv_recno(WT_REF *ref, uint64_t recno, uint8_t width)
  *	Set a fixed-length column store bit-field value.
  */
 static inline void
-__bit_setv(uint8_t *bitf, uint64_t entry, uint8_t width, uint8_t value)
+__bit_setv(uint8_t *bitf, uint64_t entry, uint8_t width, uint64_t value)
 {
-	uint64_t bit;
+	uint64_t bit, v64;
+	uint32_t v32;
 
 	bit = entry * width;
 
@@ -316,8 +331,22 @@ __bit_setv(uint8_t *bitf, uint64_t entry, uint8_t width, uint8_t value)
 	 * fallthrough comments in macros.
 	 */
 	switch (width) {
+	case 64:
+		v64 = value;
+#ifdef WORDS_BIGENDIAN
+		v64 = __wt_bswap64(v64);
+#endif
+		memcpy(bitf + entry * sizeof(uint64_t), &v64, sizeof(uint64_t));
+		return;
+	case 32:
+		v32 = (uint32_t)value;
+#ifdef WORDS_BIGENDIAN
+		v32 = __wt_bswap32(v32);
+#endif
+		memcpy(bitf + entry * sizeof(uint32_t), &v32, sizeof(uint32_t));
+		return;
 	case 8:
-		bitf[__bit_byte(bit)] = value;
+		bitf[__bit_byte(bit)] = (uint8_t)value;
 		return;
 	case 7:
 		if (value & 0x40)
@@ -193,6 +193,7 @@ struct __wt_bm {
     int (*read)(WT_BM *, WT_SESSION_IMPL *, WT_ITEM *, const uint8_t *, size_t);
     int (*salvage_end)(WT_BM *, WT_SESSION_IMPL *);
     int (*salvage_next)(WT_BM *, WT_SESSION_IMPL *, uint8_t *, size_t *, bool *);
+    int (*salvage_peek)(WT_BM *, WT_SESSION_IMPL *, wt_off_t *, uint8_t *, size_t *, bool *);
     int (*salvage_start)(WT_BM *, WT_SESSION_IMPL *);
     int (*salvage_valid)(WT_BM *, WT_SESSION_IMPL *, uint8_t *, size_t, bool);
     int (*size)(WT_BM *, WT_SESSION_IMPL *, wt_off_t *);
@@ -270,6 +271,7 @@ struct __wt_block {
 
     /* Compaction support */
     int compact_pct_tenths;           /* Percent to compact */
+    uint64_t compact_bytes_rewritten; /* Bytes rewritten */
     uint64_t compact_pages_rewritten; /* Pages rewritten */
     uint64_t compact_pages_reviewed;  /* Pages reviewed */
     uint64_t compact_pages_skipped;   /* Pages skipped */
@@ -469,7 +469,7 @@ struct __wt_page_modify {
     bool instantiated;        /* True if this is a newly instantiated page. */
     WT_UPDATE **inst_updates; /* Update list for instantiated page with unresolved truncate. */
 
-#define WT_PAGE_LOCK(s, p) __wt_spin_lock((s), &(p)->modify->page_lock)
+#define WT_PAGE_LOCK(s, p) __wt_spin_lock_wait((s), &(p)->modify->page_lock, WT_WAIT_PAGE_LOCK)
 #define WT_PAGE_TRYLOCK(s, p) __wt_spin_trylock((s), &(p)->modify->page_lock)
 #define WT_PAGE_UNLOCK(s, p) __wt_spin_unlock((s), &(p)->modify->page_lock)
     WT_SPINLOCK page_lock; /* Page's spinlock */
@@ -1362,12 +1362,13 @@ struct __wt_update_value {
  *
  * A helper macro to use for calling read functions when we're checking for the existence of a given
  * key. This means that read functions can avoid the performance penalty of reconstructing modifies.
+ * Trees whose records expire based on a value field need the value to decide if the key exists.
  */
-#define WT_WITH_UPDATE_VALUE_SKIP_BUF(op) \
-    do {                                  \
-        cbt->upd_value->skip_buf = true;  \
-        op;                               \
-        cbt->upd_value->skip_buf = false; \
+#define WT_WITH_UPDATE_VALUE_SKIP_BUF(op)                        \
+    do {                                                         \
+        cbt->upd_value->skip_buf = CUR2BT(cbt)->ttl_field == -1; \
+        op;                                                      \
+        cbt->upd_value->skip_buf = false;                        \
     } while (0)
 
 /*
@@ -1473,6 +1474,42 @@ struct __wt_insert {
         }                                                                    \
     } while (0)
 
+/*
+ * WT_INSERT_INDEX --
+ *	A hash index over a large row-store insert list.
+ *
+ * Searching a long skiplist chases a pointer and compares a key at every step, which dominates
+ * update-heavy workloads on pages that stay in memory for a long time. Once a row-store insert list
+ * grows past WT_INSERT_INDEX_MIN entries, an open-addressing hash table of its WT_INSERT items is
+ * built, and exact-match searches probe the table before walking the skiplist.
+ *
+ * The skiplist remains the authoritative structure: cursor traversal, reconciliation and all
+ * inserts use it unchanged. The index is a hint: new items are added to it lock-free after they're
+ * linked into the skiplist, but an item may be missing (for example, if it was inserted while the
+ * index was being rebuilt), and a miss falls back to a skiplist search. Slots are only ever filled,
+ * never cleared, so readers need no locking; the table is replaced when the insert list doubles in
+ * size, and replaced tables are freed using the split generation.
+ *
+ * Column-store insert lists never have an index, and most row-store insert lists never grow large
+ * enough for one, so the insert head has a single word for it: until the index is built, it counts
+ * the items inserted into the list. Allocated memory has clear low-order bits, so the count is
+ * shifted left and marked with the low-order bit, otherwise the word references the index.
+ */
+#define WT_INSERT_INDEX_MIN 128
+struct __wt_insert_index {
+    uint32_t count;       /* Insert list size */
+    uint32_t build_count; /* Insert list size when built */
+    uint32_t mask;        /* Slot count - 1 */
+
+    WT_INSERT *slot[0]; /* Open-addressing hash table */
+};
+#define WT_INSERT_INDEX_COUNT_FLAG 0x01
+#define WT_INSERT_INDEX_ENCODE_COUNT(v) \
+    ((void *)(((uintptr_t)(v) << 1) | WT_INSERT_INDEX_COUNT_FLAG))
+#define WT_INSERT_INDEX_DECODE_COUNT(v) ((uint32_t)((uintptr_t)(v) >> 1))
+#define WT_INSERT_INDEX_PTR(v) \
+    (((uintptr_t)(v)&WT_INSERT_INDEX_COUNT_FLAG) != 0 ? NULL : (WT_INSERT_INDEX *)(v))
+
 /*
  * WT_INSERT_HEAD --
  * 	The head of a skiplist of WT_INSERT items.
@@ -1480,6 +1517,8 @@ struct __wt_insert {
 struct __wt_insert_head {
     WT_INSERT *head[WT_SKIP_MAXDEPTH]; /* first item on skiplists */
     WT_INSERT *tail[WT_SKIP_MAXDEPTH]; /* last item on skiplists */
+
+    void *index; /* Row-store search index, or items inserted */
 };
 
 /*
@@ -103,6 +103,7 @@ struct __wt_btree {
     const char *key_format;   /* Key format */
     const char *value_format; /* Value format */
     uint8_t bitcnt;           /* Fixed-length field size in bits */
+    bool bitsigned;           /* Fixed-length field values are signed integers */
 
     WT_COLLATOR *collator; /* Row-store comparator */
     int collator_owned;    /* The collator needs to be freed */
@@ -136,6 +137,11 @@ struct __wt_btree {
     u_int split_deepen_per_child; /* Entries per child when deepened */
     int split_pct;                /* Split page percent */
 
+#define WT_BTREE_TTL(btree) ((btree)->ttl_duration != 0 || (btree)->ttl_field != -1)
+    uint64_t ttl_duration; /* Time-to-live after the commit timestamp */
+    int ttl_field;         /* Time-to-live expiry value field, -1 if none */
+    bool ttl_unsigned;     /* Time-to-live expiry value field is unsigned */
+
     WT_COMPRESSOR *compressor;    /* Page compressor */
                                   /*
                                    * When doing compression, the pre-compression in-memory byte size
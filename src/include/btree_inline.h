@@ -2239,6 +2239,53 @@ __wt_btcur_bounds_early_exit(
     return (0);
 }
 
+/*
+ * __wt_btcur_filter_key --
+ *     Return if the cursor's key matches the key patterns of the cursor's iteration filter.
+ */
+static inline bool
+__wt_btcur_filter_key(WT_CURSOR_BTREE *cbt)
+{
+    WT_CURSOR_FILTER *filter;
+    WT_ITEM *key;
+
+    if ((filter = cbt->filter) == NULL)
+        return (true);
+
+    key = &cbt->iface.key;
+    if (filter->key_prefix.size != 0 &&
+      (key->size < filter->key_prefix.size ||
+        memcmp(key->data, filter->key_prefix.data, filter->key_prefix.size) != 0))
+        goto skip;
+    if (filter->key_suffix.size != 0 &&
+      (key->size < filter->key_suffix.size ||
+        memcmp((uint8_t *)key->data + (key->size - filter->key_suffix.size),
+          filter->key_suffix.data, filter->key_suffix.size) != 0))
+        goto skip;
+    return (true);
+
+skip:
+    ++cbt->filter_key_skipped;
+    return (false);
+}
+
+/*
+ * __wt_btcur_filter_value --
+ *     Return if the cursor's value matches the value range of the cursor's iteration filter.
+ */
+static inline int
+__wt_btcur_filter_value(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, bool *matchp)
+{
+    *matchp = true;
+    if (cbt->filter == NULL || cbt->filter->value_field == -1)
+        return (0);
+
+    WT_RET(__wt_btcur_filter_value_range(session, cbt, matchp));
+    if (!*matchp)
+        ++cbt->filter_value_skipped;
+    return (0);
+}
+
 /*
  * __wt_btcur_skip_page --
  *     Return if the cursor is pointing to a page with deleted records and can be skipped for cursor
@@ -7,10 +7,11 @@
  */
 
 typedef enum {
-    WT_THROTTLE_CKPT,  /* Checkpoint throttle */
-    WT_THROTTLE_EVICT, /* Eviction throttle */
-    WT_THROTTLE_LOG,   /* Logging throttle */
-    WT_THROTTLE_READ   /* Read throttle */
+    WT_THROTTLE_CKPT,    /* Checkpoint throttle */
+    WT_THROTTLE_COMPACT, /* Compaction throttle */
+    WT_THROTTLE_EVICT,   /* Eviction throttle */
+    WT_THROTTLE_LOG,     /* Logging throttle */
+    WT_THROTTLE_READ     /* Read throttle */
 } WT_THROTTLE_TYPE;
 
 #define WT_THROTTLE_MIN WT_MEGABYTE /* Config minimum size */
@@ -39,12 +40,14 @@ typedef enum {
  */
 #define WT_CAPACITY_SYS(total, pct) ((total) * (pct) / 100)
 #define WT_CAP_CKPT 5
+#define WT_CAP_COMPACT 5
 #define WT_CAP_EVICT 50
 #define WT_CAP_LOG 30
 #define WT_CAP_READ 55
 
 struct __wt_capacity {
     uint64_t ckpt;      /* Bytes/sec checkpoint capacity */
+    uint64_t compact;   /* Bytes/sec compaction capacity */
     uint64_t evict;     /* Bytes/sec eviction capacity */
     uint64_t log;       /* Bytes/sec logging capacity */
     uint64_t read;      /* Bytes/sec read capacity */
@@ -61,9 +64,10 @@ struct __wt_capacity {
      * that time; getting a reservation with a past time implies that the operation can be done
      * immediately.
      */
-    uint64_t reservation_ckpt;  /* Atomic: next checkpoint write */
-    uint64_t reservation_evict; /* Atomic: next eviction write */
-    uint64_t reservation_log;   /* Atomic: next logging write */
-    uint64_t reservation_read;  /* Atomic: next read */
-    uint64_t reservation_total; /* Atomic: next operation of any kind */
+    uint64_t reservation_ckpt;    /* Atomic: next checkpoint write */
+    uint64_t reservation_compact; /* Atomic: next compaction write */
+    uint64_t reservation_evict;   /* Atomic: next eviction write */
+    uint64_t reservation_log;     /* Atomic: next logging write */
+    uint64_t reservation_read;    /* Atomic: next read */
+    uint64_t reservation_total;   /* Atomic: next operation of any kind */
 };
@@ -0,0 +1,80 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+/*
+ * Operation capture: application cursor operations on files and simple tables are recorded into
+ * per-session buffers and appended to a per-session file when the buffer fills or the session
+ * closes. Keys and values aren't captured, only a hash of the key and the sizes, enough for workgen
+ * to replay the access pattern.
+ */
+#define WT_CAPTURE_VERSION 1
+#define WT_CAPTURE_MAXRECS 1024
+
+/* Captured cursor operations. */
+#define WT_CAPTURE_INSERT 1
+#define WT_CAPTURE_MODIFY 2
+#define WT_CAPTURE_REMOVE 3
+#define WT_CAPTURE_SEARCH 4
+#define WT_CAPTURE_SEARCH_NEAR 5
+#define WT_CAPTURE_UPDATE 6
+
+/*
+ * WT_CAPTURE_HEADER --
+ *     The header of an operation capture file, followed by the session's records in the order the
+ *     operations started. Table IDs are translated to URIs by the capture map file, which has a
+ *     line per table: the ID followed by a space and the URI.
+ */
+struct __wt_capture_header {
+    uint32_t version;    /* WT_CAPTURE_VERSION */
+    uint32_t session_id; /* Session ID */
+    uint64_t epoch_nsec; /* Wall clock time of record timestamp 0 */
+};
+
+/*
+ * WT_CAPTURE_RECORD --
+ *     A captured cursor operation. Record number keys are captured as the record number with a key
+ *     size of 0. The gap between the end of one operation and the start of the session's next
+ *     operation is the application's think time.
+ */
+struct __wt_capture_record {
+    uint64_t timestamp;  /* Start time (nanoseconds since capture started) */
+    uint64_t key_hash;   /* Hash of the key, or the record number */
+    uint32_t duration;   /* Elapsed time (nanoseconds, saturating) */
+    uint32_t key_size;   /* Key bytes */
+    uint32_t value_size; /* Value bytes written, or read by searches */
+    uint32_t table;      /* Table ID */
+    int32_t ret;         /* Return value */
+    uint8_t op;          /* Cursor operation */
+    uint8_t padding[3];
+};
+
+/*
+ * WT_CAPTURE_ENABLED --
+ *     Return if the session's cursor operations are captured: only outermost application calls
+ *     are captured, operations a call makes on other cursors aren't.
+ */
+#define WT_CAPTURE_ENABLED(s)                                                          \
+    (F_ISSET(S2C(s), WT_CONN_CAPTURE) && (s)->api_call_counter == 1 && (s)->id != 0 && \
+      !F_ISSET(s, WT_SESSION_INTERNAL))
+
+/*
+ * Capture a cursor operation: begin before the key and value are consumed by the operation, end
+ * once the operation's return value is known. A zero start time means the operation isn't being
+ * captured.
+ */
+#define WT_CAPTURE_BEGIN(s, cursor, rec)        \
+    do {                                        \
+        (rec)->timestamp = 0;                   \
+        if (WT_CAPTURE_ENABLED(s))              \
+            __wt_capture_begin(s, cursor, rec); \
+    } while (0)
+#define WT_CAPTURE_END(s, cursor, rec, type, ret)        \
+    do {                                                 \
+        if ((rec)->timestamp != 0)                       \
+            __wt_capture_end(s, cursor, rec, type, ret); \
+    } while (0)
@@ -385,3 +385,142 @@ __col_var_search(WT_REF *ref, uint64_t recno, uint64_t *start_recnop)
 
     return (page->pg_var + start_indx + (uint32_t)(recno - start_recno));
 }
+
+/*
+ * __col_fix_value_pack --
+ *     Pack a fixed-length column-store value into the form held by cursors and updates: a single
+ *     byte for bit-field values, a packed integer for 32 and 64-bit values. Return the packed size.
+ */
+static inline size_t
+__col_fix_value_pack(WT_BTREE *btree, uint64_t v, uint8_t *buf)
+{
+    uint8_t *p;
+
+    if (btree->bitcnt <= 8) {
+        buf[0] = (uint8_t)v;
+        return (1);
+    }
+
+    /* The buffer is WT_INTPACK64_MAXSIZE bytes, packing can't fail. */
+    p = buf;
+    if (btree->bitsigned)
+        WT_IGNORE_RET(__wt_vpack_int(&p, WT_INTPACK64_MAXSIZE,
+          btree->bitcnt == 32 ? (int64_t)(int32_t)(uint32_t)v : (int64_t)v));
+    else
+        WT_IGNORE_RET(__wt_vpack_uint(&p, WT_INTPACK64_MAXSIZE, v));
+    return (WT_PTRDIFF(p, buf));
+}
+
+/*
+ * __col_fix_value_unpack --
+ *     Unpack a fixed-length column-store value from the form held by cursors and updates, checking
+ *     it fits the field.
+ */
+static inline int
+__col_fix_value_unpack(
+  WT_SESSION_IMPL *session, WT_BTREE *btree, const void *data, size_t size, uint64_t *vp)
+{
+    int64_t i;
+    const uint8_t *p;
+
+    if (btree->bitcnt <= 8) {
+        /* Bit-field values take a single byte. */
+        if (size != 1)
+            WT_RET_MSG(session, EINVAL,
+              "item size of %" WT_SIZET_FMT
+              " does not match fixed-length file requirement of 1 byte",
+              size);
+        *vp = *(const uint8_t *)data;
+        return (0);
+    }
+
+    p = (const uint8_t *)data;
+    if (btree->bitsigned) {
+        if (__wt_vunpack_int(&p, size, &i) != 0 || WT_PTRDIFF(p, data) != size ||
+          (btree->bitcnt == 32 && (i < INT32_MIN || i > INT32_MAX)))
+            goto err;
+        *vp = (uint64_t)i;
+    } else if (__wt_vunpack_uint(&p, size, vp) != 0 || WT_PTRDIFF(p, data) != size ||
+      (btree->bitcnt == 32 && *vp > UINT32_MAX))
+        goto err;
+    return (0);
+
+err:
+    WT_RET_MSG(session, EINVAL, "value is not a %" PRIu8 "-bit %s integer", btree->bitcnt,
+      btree->bitsigned ? "signed" : "unsigned");
+}
+
+/*
+ * __col_fix_value_set --
+ *     Set an item to a fixed-length column-store value, packed into the cursor's buffer.
+ */
+static inline void
+__col_fix_value_set(WT_CURSOR_BTREE *cbt, WT_ITEM *item, uint64_t v)
+{
+    item->size = __col_fix_value_pack(CUR2BT(cbt), v, cbt->v);
+    item->data = cbt->v;
+}
+
+/*
+ * __col_fix_filter_skip --
+ *     Return how many of a 32 or 64-bit fixed-length page's entries, starting at an entry and
+ *     moving forward or backward, fall outside the cursor's filter value range. Entries are
+ *     compared a block at a time without branches, so the compiler can vectorize the comparisons,
+ *     and only a block with a match is searched entry by entry.
+ */
+static inline uint64_t
+__col_fix_filter_skip(WT_CURSOR_BTREE *cbt, uint8_t *bitf, uint64_t entry, uint64_t n, bool next)
+{
+#define WT_COL_FIX_FILTER_BLOCK 32
+    WT_BTREE *btree;
+    WT_CURSOR_FILTER *filter;
+    int64_t max, min;
+    uint64_t bias, block, first, hi, hits, i, lo, mask, skipped, v;
+    uint8_t width;
+
+    btree = CUR2BT(cbt);
+    filter = cbt->filter;
+    width = btree->bitcnt;
+    mask = width == 64 ? UINT64_MAX : UINT32_MAX;
+
+    /*
+     * Compare signed values as unsigned by flipping their sign bits, after clamping the limits to
+     * the field's width. If no value of the field's width can match, every entry is skipped.
+     */
+    if (btree->bitsigned) {
+        min = filter->value_min;
+        max = filter->value_max;
+        if (width == 32) {
+            min = WT_MAX(min, INT32_MIN);
+            max = WT_MIN(max, INT32_MAX);
+        }
+        if (min > max)
+            return (n);
+        bias = (uint64_t)1 << (width - 1);
+        lo = ((uint64_t)min & mask) ^ bias;
+        hi = ((uint64_t)max & mask) ^ bias;
+    } else {
+        bias = 0;
+        lo = filter->value_umin;
+        hi = WT_MIN(filter->value_umax, mask);
+        if (lo > hi)
+            return (n);
+    }
+
+    for (skipped = 0; skipped < n; skipped += block) {
+        block = WT_MIN(n - skipped, WT_COL_FIX_FILTER_BLOCK);
+        first = next ? entry + skipped : entry - skipped - (block - 1);
+        for (hits = 0, i = 0; i < block; ++i) {
+            v = __bit_getv(bitf, first + i, width) ^ bias;
+            hits += (uint64_t)((v >= lo) & (v <= hi));
+        }
+        if (hits != 0)
+            break;
+    }
+    for (; skipped < n; ++skipped) {
+        v = __bit_getv(bitf, next ? entry + skipped : entry - skipped, width) ^ bias;
+        if (v >= lo && v <= hi)
+            break;
+    }
+    return (skipped);
+}
@@ -11,5 +11,8 @@ struct __wt_compact_state {
     uint32_t file_count; /* Number of files seen */
     uint64_t max_time;   /* Configured timeout */
 
+    uint64_t free_space_target; /* Minimum recoverable bytes */
+    bool background;            /* Running in the background server */
+
     struct timespec begin; /* Starting time */
 };
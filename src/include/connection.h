@@ -51,6 +51,8 @@ struct __wt_bucket_storage {
     const char *bucket;                /* Bucket name */
     const char *bucket_prefix;         /* Bucket prefix */
     const char *cache_directory;       /* Locally cached file location */
+    uint64_t cache_chunk_size;         /* Size of ranges cached on demand, 0 for whole objects */
+    uint64_t cache_prefetch;           /* Ranges read ahead when caching on demand */
     int owned;                         /* Storage needs to be terminated */
     uint64_t retain_secs;              /* Tiered period */
     const char *auth_token;            /* Tiered authentication cookie */
@@ -176,23 +178,32 @@ struct __wt_name_flag {
 #define WT_SESSION_CHECK_PANIC(session) WT_CONN_CHECK_PANIC(S2C(session))
 
 /*
- * Macros to ensure the dhandle is inserted or removed from both the main queue and the hashed
- * queue.
+ * Macros to ensure the dhandle is inserted or removed from the main queue, the hashed queue and the
+ * lock-free hash chain. The lock-free chain is only modified while holding the handle list write
+ * lock, and entries are published so readers walking it without the lock never see a partially
+ * linked handle. A removed handle's chain pointer is left intact so readers positioned on it can
+ * continue their walk; the handle is not freed until the data handle generation drains.
  */
 #define WT_CONN_DHANDLE_INSERT(conn, dhandle, bucket)                                            \
     do {                                                                                         \
         WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE)); \
         TAILQ_INSERT_HEAD(&(conn)->dhqh, dhandle, q);                                            \
         TAILQ_INSERT_HEAD(&(conn)->dhhash[bucket], dhandle, hashq);                              \
+        (dhandle)->hashq_lf = (conn)->dhhash_lf[bucket];                                         \
+        WT_PUBLISH((conn)->dhhash_lf[bucket], dhandle);                                          \
         ++(conn)->dh_bucket_count[bucket];                                                       \
         ++(conn)->dhandle_count;                                                                 \
     } while (0)
 
 #define WT_CONN_DHANDLE_REMOVE(conn, dhandle, bucket)                                            \
     do {                                                                                         \
+        WT_DATA_HANDLE **__dhp;                                                                  \
         WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE)); \
         TAILQ_REMOVE(&(conn)->dhqh, dhandle, q);                                                 \
         TAILQ_REMOVE(&(conn)->dhhash[bucket], dhandle, hashq);                                   \
+        for (__dhp = &(conn)->dhhash_lf[bucket]; *__dhp != (dhandle);)                           \
+            __dhp = &(*__dhp)->hashq_lf;                                                         \
+        WT_PUBLISH(*__dhp, (dhandle)->hashq_lf);                                                 \
         --(conn)->dh_bucket_count[bucket];                                                       \
         --(conn)->dhandle_count;                                                                 \
     } while (0)
@@ -292,6 +303,19 @@ struct __wt_connection_impl {
     WT_SPINLOCK optrack_map_spinlock; /* Translation file spinlock. */
     uintmax_t optrack_pid;            /* Cache the process ID. */
 
+    const char *event_trace_path;   /* Directory for event trace files */
+    uint64_t event_trace_records;   /* Records per session buffer */
+    uint64_t event_trace_threshold; /* Latency triggering a dump (nsecs) */
+    uint64_t event_trace_last_dump; /* Time of the last triggered dump (secs) */
+    uint32_t event_trace_dump_id;   /* Count of files written */
+
+    const char *capture_path;         /* Directory for operation capture files */
+    WT_FH *capture_map_fh;            /* Table name to ID translation file */
+    WT_SPINLOCK capture_map_spinlock; /* Translation file spinlock */
+    uint32_t capture_table_next;      /* Last table ID allocated */
+    uint64_t capture_start;           /* Clock ticks when capture was first enabled */
+    uint64_t capture_epoch_nsec;      /* Wall clock time when capture was first enabled */
+
 #ifdef HAVE_CALL_LOG
     /* File stream used for writing to the call log. */
     WT_FSTREAM *call_log_fst;
@@ -310,8 +334,12 @@ struct __wt_connection_impl {
      */
     /* Locked: data handle hash array */
     TAILQ_HEAD(__wt_dhhash, __wt_data_handle) * dhhash;
+    /* Lock-free reads, locked writes: data handle hash chains */
+    WT_DATA_HANDLE **dhhash_lf;
     /* Locked: data handle list */
     TAILQ_HEAD(__wt_dhandle_qh, __wt_data_handle) dhqh;
+    /* Locked: data handles removed from the list and waiting to be destroyed */
+    struct __wt_dhandle_qh dhdiscardqh;
     /* Locked: dynamic library handle list */
     TAILQ_HEAD(__wt_dlh_qh, __wt_dlh) dlhqh;
     /* Locked: file list */
@@ -321,6 +349,8 @@ struct __wt_connection_impl {
     TAILQ_HEAD(__wt_lsm_qh, __wt_lsm_tree) lsmqh;
     /* Locked: Tiered system work queue. */
     TAILQ_HEAD(__wt_tiered_qh, __wt_tiered_work_unit) tieredqh;
+    /* Locked: Tiered multipart flushes in progress, protected by the tiered work queue lock. */
+    TAILQ_HEAD(__wt_tiered_upload_qh, __wt_tiered_upload) tiered_uploadqh;
 
     WT_SPINLOCK block_lock; /* Locked: block manager list */
     TAILQ_HEAD(__wt_blockhash, __wt_block) * blockhash;
@@ -422,6 +452,7 @@ struct __wt_connection_impl {
     uint64_t rec_maximum_seconds;             /* Maximum seconds reconciliation took. */
     WT_CONNECTION_STATS *stats[WT_COUNTER_SLOTS];
     WT_CONNECTION_STATS *stat_array;
+    WT_LATENCY_HIST *latency_hist[WT_LATENCY_SLOTS]; /* Per-slot latency histograms */
 
     WT_CAPACITY capacity;              /* Capacity structure */
     WT_SESSION_IMPL *capacity_session; /* Capacity thread session */
@@ -429,6 +460,14 @@ struct __wt_connection_impl {
     bool capacity_tid_set;             /* Capacity thread set */
     WT_CONDVAR *capacity_cond;         /* Capacity wait mutex */
 
+    WT_SESSION_IMPL *compact_session;   /* Background compaction session */
+    wt_thread_t compact_tid;            /* Background compaction thread */
+    bool compact_tid_set;               /* Background compaction thread set */
+    WT_CONDVAR *compact_cond;           /* Background compaction wait mutex */
+    char **compact_exclude;             /* Tables the server doesn't compact */
+    uint64_t compact_free_space_target; /* Minimum recoverable bytes */
+    uint64_t compact_wait;              /* Seconds between server passes */
+
     WT_LSM_MANAGER lsm_manager; /* LSM worker thread information */
 
     WT_BUCKET_STORAGE *bstorage;     /* Bucket storage for the connection */
@@ -462,12 +501,16 @@ struct __wt_connection_impl {
     WT_CONDVAR *flush_cond;          /* Flush wait mutex */
     WT_CONDVAR *tiered_cond;         /* Tiered wait mutex */
     uint64_t tiered_interval;        /* Tiered work interval */
+    uint64_t tiered_part_size;       /* Tiered multipart flush part size */
+    uint32_t tiered_flush_workers;   /* Tiered flush thread count */
     bool tiered_server_running;      /* Internal tiered server operating */
     bool flush_ckpt_complete;        /* Checkpoint after flush completed */
     uint64_t flush_most_recent;      /* Clock value of last flush_tier */
     uint32_t flush_state;            /* State of last flush tier */
     wt_timestamp_t flush_ts;         /* Timestamp of most recent flush_tier */
 
+    WT_THREAD_GROUP tiered_flush_threads; /* Tiered flush threads */
+
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CONN_LOG_CONFIG_ENABLED 0x001u  /* Logging is configured */
 #define WT_CONN_LOG_DOWNGRADED 0x002u      /* Running older version */
@@ -559,10 +602,18 @@ struct __wt_connection_impl {
 #define WT_DIRECT_IO_CHECKPOINT 0x1u /* Checkpoints */
 #define WT_DIRECT_IO_DATA 0x2u       /* Data files */
 #define WT_DIRECT_IO_LOG 0x4u        /* Log files */
+#define WT_DIRECT_IO_READ 0x8u       /* Data file reads */
                                      /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t direct_io;              /* O_DIRECT, FILE_FLAG_NO_BUFFERING */
     uint64_t write_through;          /* FILE_FLAG_WRITE_THROUGH */
 
+/* AUTOMATIC FLAG VALUE GENERATION START 0 */
+#define WT_RWLOCK_SCALABLE_DHANDLE 0x1u    /* Data handle list lock */
+#define WT_RWLOCK_SCALABLE_TABLE 0x2u      /* Table list lock */
+#define WT_RWLOCK_SCALABLE_TXN_GLOBAL 0x4u /* Global transaction lock */
+                                           /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
+    uint8_t rwlock_scalable;               /* Reader-scalable read/write locks */
+
     bool mmap;     /* use mmap when reading checkpoints */
     bool mmap_all; /* use mmap for all I/O on data files */
     int page_size; /* OS page size for mmap alignment */
@@ -658,43 +709,46 @@ struct __wt_connection_impl {
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CONN_SERVER_CAPACITY 0x01u
 #define WT_CONN_SERVER_CHECKPOINT 0x02u
-#define WT_CONN_SERVER_LOG 0x04u
-#define WT_CONN_SERVER_LSM 0x08u
-#define WT_CONN_SERVER_STATISTICS 0x10u
-#define WT_CONN_SERVER_SWEEP 0x20u
-#define WT_CONN_SERVER_TIERED 0x40u
+#define WT_CONN_SERVER_COMPACT 0x04u
+#define WT_CONN_SERVER_LOG 0x08u
+#define WT_CONN_SERVER_LSM 0x10u
+#define WT_CONN_SERVER_STATISTICS 0x20u
+#define WT_CONN_SERVER_SWEEP 0x40u
+#define WT_CONN_SERVER_TIERED 0x80u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t server_flags;
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_CONN_BACKUP_PARTIAL_RESTORE 0x0000001u
-#define WT_CONN_CACHE_CURSORS 0x0000002u
-#define WT_CONN_CACHE_POOL 0x0000004u
-#define WT_CONN_CALL_LOG_ENABLED 0x0000008u
-#define WT_CONN_CKPT_GATHER 0x0000010u
-#define WT_CONN_CKPT_SYNC 0x0000020u
-#define WT_CONN_CLOSING 0x0000040u
-#define WT_CONN_CLOSING_CHECKPOINT 0x0000080u
-#define WT_CONN_CLOSING_NO_MORE_OPENS 0x0000100u
-#define WT_CONN_COMPATIBILITY 0x0000200u
-#define WT_CONN_DATA_CORRUPTION 0x0000400u
-#define WT_CONN_EVICTION_RUN 0x0000800u
-#define WT_CONN_HS_OPEN 0x0001000u
-#define WT_CONN_INCR_BACKUP 0x0002000u
-#define WT_CONN_IN_MEMORY 0x0004000u
-#define WT_CONN_LEAK_MEMORY 0x0008000u
-#define WT_CONN_LSM_MERGE 0x0010000u
-#define WT_CONN_MINIMAL 0x0020000u
-#define WT_CONN_OPTRACK 0x0040000u
-#define WT_CONN_PANIC 0x0080000u
-#define WT_CONN_READONLY 0x0100000u
-#define WT_CONN_READY 0x0200000u
-#define WT_CONN_RECONFIGURING 0x0400000u
-#define WT_CONN_RECOVERING 0x0800000u
-#define WT_CONN_RECOVERY_COMPLETE 0x1000000u
-#define WT_CONN_SALVAGE 0x2000000u
-#define WT_CONN_TIERED_FIRST_FLUSH 0x4000000u
-#define WT_CONN_WAS_BACKUP 0x8000000u
+#define WT_CONN_BACKUP_PARTIAL_RESTORE 0x00000001u
+#define WT_CONN_CACHE_CURSORS 0x00000002u
+#define WT_CONN_CACHE_POOL 0x00000004u
+#define WT_CONN_CALL_LOG_ENABLED 0x00000008u
+#define WT_CONN_CAPTURE 0x00000010u
+#define WT_CONN_CKPT_GATHER 0x00000020u
+#define WT_CONN_CKPT_SYNC 0x00000040u
+#define WT_CONN_CLOSING 0x00000080u
+#define WT_CONN_CLOSING_CHECKPOINT 0x00000100u
+#define WT_CONN_CLOSING_NO_MORE_OPENS 0x00000200u
+#define WT_CONN_COMPATIBILITY 0x00000400u
+#define WT_CONN_DATA_CORRUPTION 0x00000800u
+#define WT_CONN_EVENT_TRACE 0x00001000u
+#define WT_CONN_EVICTION_RUN 0x00002000u
+#define WT_CONN_HS_OPEN 0x00004000u
+#define WT_CONN_INCR_BACKUP 0x00008000u
+#define WT_CONN_IN_MEMORY 0x00010000u
+#define WT_CONN_LEAK_MEMORY 0x00020000u
+#define WT_CONN_LSM_MERGE 0x00040000u
+#define WT_CONN_MINIMAL 0x00080000u
+#define WT_CONN_OPTRACK 0x00100000u
+#define WT_CONN_PANIC 0x00200000u
+#define WT_CONN_READONLY 0x00400000u
+#define WT_CONN_READY 0x00800000u
+#define WT_CONN_RECONFIGURING 0x01000000u
+#define WT_CONN_RECOVERING 0x02000000u
+#define WT_CONN_RECOVERY_COMPLETE 0x04000000u
+#define WT_CONN_SALVAGE 0x08000000u
+#define WT_CONN_TIERED_FIRST_FLUSH 0x10000000u
+#define WT_CONN_WAS_BACKUP 0x20000000u
     /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 };
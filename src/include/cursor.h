@@ -72,20 +72,38 @@ struct __wt_cursor_backup {
     uint64_t bit_offset;  /* Current offset */
     uint64_t granularity; /* Length, transfer size */
 
+    uint64_t consolidate_max; /* Maximum consolidated length */
+
+    /*
+     * Parallel incremental backup: the primary cursor's file list is a queue of work shared by the
+     * parallel duplicate cursors, the file being split into ranges is tracked by the primary.
+     */
+    WT_SPINLOCK incr_lock;          /* Work queue lock */
+    size_t incr_next;               /* Next file in the work queue */
+    WT_CURSOR_BACKUP *incr_primary; /* Primary cursor owning the queue */
+
+    WT_FH *incr_fh;    /* Handle for returning range data */
+    WT_ITEM incr_data; /* Range data */
+
+    uint64_t incr_rem_offset; /* Remainder of a range too large to read at once */
+    uint64_t incr_rem_size;
+
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
-#define WT_CURBACKUP_CKPT_FAKE 0x001u   /* Object has fake checkpoint */
-#define WT_CURBACKUP_CONSOLIDATE 0x002u /* Consolidate returned info on this object */
-#define WT_CURBACKUP_DUP 0x004u         /* Duplicated backup cursor */
-#define WT_CURBACKUP_EXPORT 0x008u      /* Special backup cursor for export operation */
-#define WT_CURBACKUP_FORCE_FULL 0x010u  /* Force full file copy for this cursor */
-#define WT_CURBACKUP_FORCE_STOP 0x020u  /* Force stop incremental backup */
-#define WT_CURBACKUP_HAS_CB_INFO 0x040u /* Object has checkpoint backup info */
-#define WT_CURBACKUP_INCR 0x080u        /* Incremental backup cursor */
-#define WT_CURBACKUP_INCR_INIT 0x100u   /* Cursor traversal initialized */
-#define WT_CURBACKUP_LOCKER 0x200u      /* Hot-backup started */
-#define WT_CURBACKUP_QUERYID 0x400u     /* Backup cursor for incremental ids */
-#define WT_CURBACKUP_RENAME 0x800u      /* Object had a rename */
-                                        /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
+#define WT_CURBACKUP_CKPT_FAKE 0x0001u   /* Object has fake checkpoint */
+#define WT_CURBACKUP_CONSOLIDATE 0x0002u /* Consolidate returned info on this object */
+#define WT_CURBACKUP_DUP 0x0004u         /* Duplicated backup cursor */
+#define WT_CURBACKUP_EXPORT 0x0008u      /* Special backup cursor for export operation */
+#define WT_CURBACKUP_FORCE_FULL 0x0010u  /* Force full file copy for this cursor */
+#define WT_CURBACKUP_FORCE_STOP 0x0020u  /* Force stop incremental backup */
+#define WT_CURBACKUP_HAS_CB_INFO 0x0040u /* Object has checkpoint backup info */
+#define WT_CURBACKUP_INCR 0x0080u        /* Incremental backup cursor */
+#define WT_CURBACKUP_INCR_INIT 0x0100u   /* Cursor traversal initialized */
+#define WT_CURBACKUP_LOCKER 0x0200u      /* Hot-backup started */
+#define WT_CURBACKUP_PARALLEL 0x0400u    /* Parallel incremental cursor */
+#define WT_CURBACKUP_QUERYID 0x0800u     /* Backup cursor for incremental ids */
+#define WT_CURBACKUP_RENAME 0x1000u      /* Object had a rename */
+#define WT_CURBACKUP_RETURN_DATA 0x2000u /* Return range data as the value */
+                                         /* AUTOMATIC FLAG VALUE GENERATION STOP 32 */
     uint32_t flags;
 };
 
@@ -95,6 +113,62 @@ struct __wt_cursor_backup {
         NULL :                                   \
         (WT_BTREE *)((WT_CURSOR_BTREE *)(c))->dhandle->handle)
 
+/*
+ * A batch cursor column: fixed-width columns are arrays of 64-bit integers, variable-length columns
+ * are the concatenated column values plus an array of offsets into them.
+ */
+struct __wt_cursor_batch_col {
+    WT_ITEM data;    /* Values */
+    WT_ITEM offsets; /* Variable-length value offsets */
+
+    char type; /* Pack type */
+    bool var;  /* Variable-length column */
+};
+
+struct __wt_cursor_batch {
+    WT_CURSOR iface;
+
+    WT_CURSOR *child;      /* Table cursor */
+    WT_CURSOR_BTREE *cbt; /* Child btree cursor read directly, or NULL */
+
+    uint32_t size;  /* Maximum rows in a batch */
+    uint32_t nrows; /* Rows in the current batch */
+
+    WT_CURSOR_BATCH_COL *cols; /* Key columns, then value columns */
+    size_t cols_allocated;
+    u_int nkey_cols, ncols;
+
+    bool eof; /* The last batch ended the scan */
+
+    WT_ITEM raw; /* Batch packed for raw access */
+
+    /* Rows are staged in their packed form while a filter is evaluated. */
+    WT_ITEM stage;      /* Packed keys and values */
+    WT_ITEM stage_off;  /* Offsets of packed keys and values */
+    WT_ITEM filter_val; /* Filter column values */
+    WT_ITEM filter_sel; /* Rows selected by the filter */
+
+    int filter_col; /* Filter value column, -1 if none */
+    int64_t filter_min, filter_max;
+    uint64_t filter_umin, filter_umax;
+    bool filter_unsigned; /* Filter column is unsigned */
+};
+
+/*
+ * A predicate evaluated by row-store cursor iteration. Key patterns are tested on the key built
+ * from the page, before the entry's visibility is checked; the value range is tested on the visible
+ * value, before it's returned.
+ */
+struct __wt_cursor_filter {
+    WT_ITEM key_prefix; /* Key prefix pattern */
+    WT_ITEM key_suffix; /* Key suffix pattern */
+
+    int value_field;     /* Value field tested, -1 if none */
+    bool value_unsigned; /* Value field is unsigned */
+    int64_t value_min, value_max;
+    uint64_t value_umin, value_umax;
+};
+
 struct __wt_cursor_btree {
     WT_CURSOR iface;
 
@@ -129,6 +203,10 @@ struct __wt_cursor_btree {
     uint64_t next_random_leaf_skip;
     u_int next_random_sample_size;
 
+    /* Row-store iteration filter, and the number of entries it skipped. */
+    WT_CURSOR_FILTER *filter;
+    uint64_t filter_key_skipped, filter_value_skipped;
+
     /*
      * The search function sets compare to:
      *	< 1 if the found key is less than the specified key
@@ -223,10 +301,11 @@ struct __wt_cursor_btree {
     uint64_t checkpoint_id;
 
     /*
-     * Fixed-length column-store items are a single byte, and it's simpler and cheaper to allocate
-     * the space for it now than keep checking to see if we need to grow the buffer.
+     * Fixed-length column-store items are a single byte or a packed 32 or 64-bit integer, and it's
+     * simpler and cheaper to allocate the space for it now than keep checking to see if we need to
+     * grow the buffer.
      */
-    uint8_t v; /* Fixed-length return value */
+    uint8_t v[WT_INTPACK64_MAXSIZE]; /* Fixed-length return value */
 
     uint8_t append_tree; /* Cursor appended to the tree */
 
@@ -292,6 +371,8 @@ struct __wt_cursor_bulk {
     uint32_t entry; /* Entry count */
     uint32_t nrecs; /* Max records per chunk */
 
+    u_int nthreads; /* Threads page writes are offloaded to */
+
     void *reconcile; /* Reconciliation support */
     WT_REF *ref;     /* The leaf page */
     WT_PAGE *leaf;
@@ -408,6 +489,23 @@ struct __wt_cursor_join_endpoint {
 #define WT_CURJOIN_END_RANGE(endp) \
     ((endp)->flags & (WT_CURJOIN_END_GT | WT_CURJOIN_END_EQ | WT_CURJOIN_END_LT))
 
+/*
+ * A join set is a sorted, duplicate-free run of raw primary keys, built for joins configured with
+ * "strategy=set". The key bytes are packed back-to-back in a single buffer; the keys array is only
+ * pointed into the buffer once it has stopped growing.
+ */
+struct __wt_cursor_join_set {
+    WT_ITEM buf;   /* key bytes */
+    WT_ITEM *keys; /* keys referencing the buffer */
+    size_t keys_allocated;
+    size_t count; /* number of keys */
+    size_t pos;   /* iteration position */
+    bool positioned;
+
+    WT_COLLATOR *collator; /* primary key collator */
+    bool full;             /* the join's memory limit was reached */
+};
+
 /*
  * Each join entry typically represents an index's participation in a join. For example, if 'k' is
  * an index, then "t.k > 10 && t.k < 20" would be represented by a single entry, with two endpoints.
@@ -429,6 +527,7 @@ struct __wt_cursor_join_entry {
 #define WT_CURJOIN_ENTRY_DISJUNCTION 0x2u     /* endpoints are or-ed */
 #define WT_CURJOIN_ENTRY_FALSE_POSITIVES 0x4u /* don't filter false pos */
 #define WT_CURJOIN_ENTRY_OWN_BLOOM 0x8u       /* this entry owns the bloom */
+#define WT_CURJOIN_ENTRY_SET 0x10u            /* collect keys into a set */
                                               /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
     uint8_t flags;
 
@@ -450,12 +549,15 @@ struct __wt_cursor_join {
     WT_CURSOR_JOIN_ENTRY *entries;
     size_t entries_allocated;
     u_int entries_next;
-    uint8_t recno_buf[10]; /* holds packed recno */
+    WT_CURSOR_JOIN_SET *set; /* combined set of primary keys */
+    uint64_t set_max;        /* memory limit for sets */
+    uint8_t recno_buf[10];   /* holds packed recno */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_CURJOIN_DISJUNCTION 0x1u /* Entries are or-ed */
 #define WT_CURJOIN_ERROR 0x2u       /* Error in initialization */
 #define WT_CURJOIN_INITIALIZED 0x4u /* Successful initialization */
+#define WT_CURJOIN_SET 0x8u         /* Entries are evaluated as sets */
                                     /* AUTOMATIC FLAG VALUE GENERATION STOP 8 */
     uint8_t flags;
 };
@@ -508,6 +610,21 @@ struct __wt_join_stats_group {
     WT_JOIN_STATS join_stats;
 };
 
+/*
+ * A statistics cursor on session wait events returns a set of statistics for each session that was
+ * active when the cursor was positioned, the sets are snapshots taken at that time.
+ */
+struct __wt_session_waits_entry {
+    uint32_t id; /* Session ID */
+    WT_SESSION_WAITS_STATS stats;
+};
+
+struct __wt_session_waits_stats_group {
+    WT_SESSION_WAITS_ENTRY *entries; /* Session snapshots */
+    u_int entries_next;              /* Count of snapshots */
+    ssize_t entry;                   /* Position in entries */
+};
+
 struct __wt_cursor_stat {
     WT_CURSOR iface;
 
@@ -526,6 +643,7 @@ struct __wt_cursor_stat {
         WT_CONNECTION_STATS conn_stats;
         WT_JOIN_STATS_GROUP join_stats_group;
         WT_SESSION_STATS session_stats;
+        WT_SESSION_WAITS_STATS_GROUP session_waits_group;
     } u;
 
     const char **cfg; /* Original cursor configuration */
@@ -545,6 +663,24 @@ struct __wt_cursor_stat {
  */
 #define WT_CURSOR_STATS(cursor) (((WT_CURSOR_STAT *)(cursor))->stats)
 
+/*
+ * Index updates buffered by a table cursor configured with "index_batch". The keys of an index's
+ * operations are packed back-to-back in a single buffer and only pointed into it when the batch is
+ * applied, the buffer may move as it grows.
+ */
+struct __wt_cursor_table_idx_op {
+    WT_ITEM key;  /* Index key */
+    uint64_t seq; /* Operation order */
+    bool remove;  /* Remove rather than insert */
+};
+
+struct __wt_cursor_table_idx_batch {
+    WT_ITEM buf; /* Key bytes */
+    WT_CURSOR_TABLE_IDX_OP *ops;
+    size_t ops_allocated;
+    size_t count;
+};
+
 struct __wt_cursor_table {
     WT_CURSOR iface;
 
@@ -559,6 +695,12 @@ struct __wt_cursor_table {
                           * overlapping set_value calls.
                           */
     WT_CURSOR **idx_cursors;
+
+    WT_CURSOR_TABLE_IDX_BATCH *idx_batch; /* Buffered index updates, one per index */
+    uint64_t idx_batch_max;               /* Index updates buffered before applying */
+    uint64_t idx_batch_ops;               /* Index updates buffered */
+    uint64_t idx_batch_seq;               /* Operation sequence */
+    bool idx_batching;                    /* Current operation is buffered */
 };
 
 struct __wt_cursor_version {
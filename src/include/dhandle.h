@@ -42,6 +42,12 @@
 
 #define WT_DHANDLE_RELEASE(dhandle) (void)__wt_atomic_sub32(&(dhandle)->session_ref, 1)
 
+/*
+ * A handle being removed from the connection has its reference count swapped to this value, so
+ * lock-free lookups racing with the removal fail to acquire it and fall back to the locked path.
+ */
+#define WT_DHANDLE_REF_REMOVED UINT32_MAX
+
 #define WT_DHANDLE_NEXT(session, dhandle, head, field)                                     \
     do {                                                                                   \
         WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST)); \
@@ -78,6 +84,7 @@ struct __wt_data_handle {
     WT_RWLOCK rwlock; /* Lock for shared/exclusive ops */
     TAILQ_ENTRY(__wt_data_handle) q;
     TAILQ_ENTRY(__wt_data_handle) hashq;
+    WT_DATA_HANDLE *hashq_lf; /* Lock-free hash chain */
 
     const char *name;         /* Object name as a URI */
     uint64_t name_hash;       /* Hash of name */
@@ -125,6 +132,9 @@ struct __wt_data_handle {
     /* Data-source statistics */
     WT_DSRC_STATS *stats[WT_COUNTER_SLOTS];
     WT_DSRC_STATS *stat_array;
+    WT_LATENCY_HIST *latency_hist[WT_LATENCY_SLOTS]; /* Per-slot latency histograms */
+
+    uint32_t capture_id; /* Operation capture table ID, 0 if none */
 
 /*
  * Flags values over 0xfff are reserved for WT_BTREE_*. This lets us combine the dhandle and btree
@@ -0,0 +1,111 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+/*
+ * Event tracing: each session records performance-critical events into its own ring buffer of
+ * fixed-size records, overwriting the oldest records. The buffers are only read when they are
+ * written to a file, on demand or when an API call is slow, and an offline tool converts the files
+ * for trace viewers.
+ *
+ * Only the thread using a session writes the session's records, there is no locking. The record is
+ * written before the count of records is published, a reader copying a buffer discards records that
+ * may have been overwritten while it was copying them.
+ */
+#define WT_EVENT_TRACE_VERSION 1
+
+/* Event types: also the first entries in a trace file's name table. */
+#define WT_EVENT_TRACE_API 0        /* Outermost API call */
+#define WT_EVENT_TRACE_CHECKPOINT 1 /* Checkpoint */
+#define WT_EVENT_TRACE_EVICT 2      /* Page eviction */
+#define WT_EVENT_TRACE_LOG_WRITE 3  /* Log file write */
+#define WT_EVENT_TRACE_PAGE_READ 4  /* Page read */
+#define WT_EVENT_TRACE_RECONCILE 5  /* Page reconciliation */
+#define WT_EVENT_TRACE_TRIGGER 6    /* Slow API call triggered a dump */
+#define WT_EVENT_TRACE_TYPES 7
+
+/* Event phases, matching the Chrome trace event format. */
+#define WT_EVENT_TRACE_BEGIN 'B'
+#define WT_EVENT_TRACE_END 'E'
+#define WT_EVENT_TRACE_INSTANT 'i'
+
+/*
+ * WT_EVENT_TRACE_RECORD --
+ *     An event in a session's ring buffer. The name is a static string, if it's NULL the event is
+ *     named by its type.
+ */
+struct __wt_event_trace_record {
+    uint64_t timestamp; /* Clock ticks */
+    const char *name;   /* Event name */
+    uint64_t arg;       /* Event argument: bytes, return value */
+    uint16_t type;      /* Event type */
+    uint8_t phase;      /* Begin, end or instant */
+    uint8_t padding[5];
+};
+
+/*
+ * WT_EVENT_TRACE_HEADER --
+ *     The header of an event trace file. The header is followed by a section per session: a
+ *     WT_EVENT_TRACE_SESSION structure followed by the session's records, oldest first, and then
+ *     by the name table: each name is a 32-bit length followed by the name's bytes. Records in the
+ *     file are WT_EVENT_TRACE_FILE_RECORD structures, with names replaced by name table indexes.
+ */
+struct __wt_event_trace_header {
+    uint32_t version;        /* WT_EVENT_TRACE_VERSION */
+    uint32_t tsc_nsec_ratio; /* Clock ticks per nanosecond, times 1000 */
+    uint64_t epoch_nsec;     /* Wall clock time when written (nanoseconds) */
+    uint64_t epoch_ticks;    /* Clock ticks when written */
+    uint64_t names_offset;   /* File offset of the name table */
+    uint32_t names;          /* Count of names */
+    uint32_t sessions;       /* Count of sessions */
+};
+
+struct __wt_event_trace_session {
+    uint32_t id;       /* Session ID */
+    uint32_t internal; /* Internal session */
+    uint64_t records;  /* Count of records */
+};
+
+struct __wt_event_trace_file_record {
+    uint64_t timestamp; /* Clock ticks */
+    uint64_t arg;       /* Event argument */
+    uint32_t name;      /* Index in the name table */
+    uint16_t type;      /* Event type */
+    uint8_t phase;      /* Begin, end or instant */
+    uint8_t padding;
+};
+
+/*
+ * WT_EVENT_TRACE_ENABLED --
+ *     Return if events are recorded for the session. Skip the default session (ID 0), it can be
+ *     used by multiple threads.
+ */
+#define WT_EVENT_TRACE_ENABLED(s) (F_ISSET(S2C(s), WT_CONN_EVENT_TRACE) && (s)->id != 0)
+
+/* Trace the beginning and end of an internal operation, named by its type. */
+#define WT_EVENT_TRACE_BEGIN_OP(s, type)                                     \
+    do {                                                                     \
+        if (WT_EVENT_TRACE_ENABLED(s))                                       \
+            __wt_event_trace_record(s, type, WT_EVENT_TRACE_BEGIN, NULL, 0); \
+    } while (0)
+#define WT_EVENT_TRACE_END_OP(s, type, arg)                                              \
+    do {                                                                                 \
+        if (WT_EVENT_TRACE_ENABLED(s))                                                   \
+            __wt_event_trace_record(s, type, WT_EVENT_TRACE_END, NULL, (uint64_t)(arg)); \
+    } while (0)
+
+/* Trace the outermost API call. */
+#define WT_EVENT_TRACE_API_BEGIN(s)                                  \
+    do {                                                             \
+        if ((s)->api_call_counter == 1 && WT_EVENT_TRACE_ENABLED(s)) \
+            __wt_event_trace_api_begin(s);                           \
+    } while (0)
+#define WT_EVENT_TRACE_API_END(s, ret)                               \
+    do {                                                             \
+        if ((s)->api_call_counter == 1 && WT_EVENT_TRACE_ENABLED(s)) \
+            __wt_event_trace_api_end(s, ret);                        \
+    } while (0)
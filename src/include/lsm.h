@@ -88,6 +88,7 @@ struct __wt_lsm_chunk {
     const char *uri;             /* Data source for this chunk */
     const char *bloom_uri;       /* URI of Bloom filter, if any */
     struct timespec create_time; /* Creation time (for rate limiting) */
+    uint64_t create_secs;        /* Creation time of the oldest data, in seconds */
     uint64_t count;              /* Approximate count of records */
     uint64_t size;               /* Final chunk size */
 
@@ -197,6 +198,9 @@ struct __wt_lsm_manager {
  */
 #define WT_LSM_AGGRESSIVE_THRESHOLD 2
 
+/* The default time window for time-windowed merges, one hour. */
+#define WT_LSM_MERGE_TIME_WINDOW_DEFAULT 3600
+
 /*
  * The minimum size for opening a tree: three chunks, plus one page for each participant in up to
  * three concurrent merges.
@@ -204,6 +208,40 @@ struct __wt_lsm_manager {
 #define WT_LSM_TREE_MINIMUM_SIZE(chunk_size, merge_max, maxleafpage) \
     (3 * (chunk_size) + 3 * ((merge_max) * (maxleafpage)))
 
+/*
+ * WT_LSM_MERGE_STRATEGY --
+ *	The policy used to choose the chunks an LSM merge combines.
+ */
+typedef enum {
+    WT_LSM_MERGE_GENERATIONAL, /* Chunks of similar merge generation (default) */
+    WT_LSM_MERGE_LEVELED,      /* Fold new chunks into the youngest larger chunk */
+    WT_LSM_MERGE_SIZE_TIERED,  /* Runs of chunks of similar size */
+    WT_LSM_MERGE_TIME_WINDOWED /* Chunks created in the same time window */
+} WT_LSM_MERGE_STRATEGY;
+
+/*
+ * WT_LSM_MERGE_PART --
+ *	One key range of a partitioned merge, written to its own chunk.
+ */
+struct __wt_lsm_merge_part {
+    WT_LSM_TREE *lsm_tree;
+    WT_SESSION_IMPL *session; /* Helper session, NULL for the merging thread */
+
+    wt_thread_t tid; /* Helper thread */
+    bool tid_set;
+
+    WT_ITEM start, stop; /* Key range: start inclusive, stop exclusive, empty is unbounded */
+
+    u_int start_chunk, nchunks; /* Chunks being merged */
+    uint32_t start_id;
+    bool create_bloom;
+    uint64_t record_count; /* Bloom filter sizing estimate */
+
+    WT_LSM_CHUNK *chunk;   /* Output chunk */
+    uint64_t insert_count; /* Rows written */
+    int ret;               /* Result */
+};
+
 /*
  * WT_LSM_TREE --
  *	An LSM tree.
@@ -251,6 +289,9 @@ struct __wt_lsm_tree {
     uint64_t chunk_size;
     uint64_t chunk_max; /* Maximum chunk a merge creates */
     u_int merge_min, merge_max;
+    u_int merge_partitions;               /* Maximum key ranges per merge */
+    WT_LSM_MERGE_STRATEGY merge_strategy; /* Policy choosing chunks to merge */
+    uint64_t merge_time_window;           /* Window for time-windowed merges, seconds */
 
 /* AUTOMATIC FLAG VALUE GENERATION START 0 */
 #define WT_LSM_BLOOM_MERGED 0x1u
@@ -290,7 +331,14 @@ struct __wt_lsm_tree {
     int64_t bloom_miss;
     int64_t lsm_checkpoint_throttle;
     int64_t lsm_lookup_no_bloom;
+    int64_t lsm_merge_bytes_flushed;
+    int64_t lsm_merge_bytes_read;
+    int64_t lsm_merge_bytes_written;
+    int64_t lsm_merge_count;
+    int64_t lsm_merge_partitions;
+    int64_t lsm_merge_rows;
     int64_t lsm_merge_throttle;
+    int64_t lsm_merge_time;
 
     /*
      * Following fields used to be flags but are susceptible to races. Don't merge them with flags.
@@ -256,6 +256,41 @@ __wt_failpoint(WT_SESSION_IMPL *session, uint64_t conn_flag, u_int probability)
     return (__wt_random(&session->rnd) % (10 * WT_THOUSAND) <= probability);
 }
 
+/*
+ * __wt_wait_start --
+ *     Note the session is about to block on a wait event. Waits nest, time is attributed to the
+ *     outermost event.
+ */
+static inline void
+__wt_wait_start(WT_SESSION_IMPL *session, uint32_t event)
+{
+    if (!WT_STAT_ENABLED(session) || session->wait_event != WT_WAIT_NONE)
+        return;
+
+    /* Set the start time before the event, threads reading the event expect a valid start time. */
+    session->wait_start = __wt_clock(session);
+    WT_WRITE_BARRIER();
+    session->wait_event = event;
+}
+
+/*
+ * __wt_wait_end --
+ *     Note the session has stopped blocking on a wait event.
+ */
+static inline void
+__wt_wait_end(WT_SESSION_IMPL *session, uint32_t event)
+{
+    uint64_t now;
+
+    if (session->wait_event != event)
+        return;
+
+    now = __wt_clock(session);
+    ++session->wait_count[event];
+    session->wait_time[event] += WT_CLOCKDIFF_US(now, session->wait_start);
+    session->wait_event = WT_WAIT_NONE;
+}
+
 /*
  * The hardware-accelerated checksum code that originally shipped on Windows did not correctly
  * handle memory that wasn't 8B aligned and a multiple of 8B. It's likely that calculations were
@@ -28,6 +28,18 @@ struct __wt_condvar {
     uint64_t prev_wait; /* Wait duration used last time */
 };
 
+/*
+ * WT_RWLOCK_READER --
+ *	A reader indicator for a reader-scalable read/write lock, padded so readers in different slots
+ *	don't share a cache line.
+ */
+#define WT_RWLOCK_READER_SLOTS 32
+struct __wt_rwlock_reader {
+    WT_CACHE_LINE_PAD_BEGIN
+    volatile uint32_t readers; /* Count of active readers */
+    WT_CACHE_LINE_PAD_END
+};
+
 /*
  * Read/write locks:
  *
@@ -56,6 +68,13 @@ struct __wt_rwlock { /* Read/write lock */
 
     WT_CONDVAR *cond_readers; /* Blocking readers */
     WT_CONDVAR *cond_writers; /* Blocking writers */
+
+    /*
+     * Reader-scalable locks: readers announce themselves in a per-session slot and only fall back
+     * to the ticket lock when a writer is active.
+     */
+    WT_RWLOCK_READER *reader_slots; /* Reader indicators, or NULL */
+    volatile bool writer_active;    /* Writer holds or waits for the lock */
 };
 
 /*
@@ -342,3 +342,49 @@ __wt_spin_trylock_track(WT_SESSION_IMPL *session, WT_SPINLOCK *t)
     }
     return (__wt_spin_trylock(session, t));
 }
+
+/*
+ * __wt_spin_lock_wait --
+ *     Spinlock acquisition, attributing time spent blocked to a wait event.
+ */
+static inline void
+__wt_spin_lock_wait(WT_SESSION_IMPL *session, WT_SPINLOCK *t, uint32_t event)
+{
+    /* Only contended acquisitions wait. */
+    if (__wt_spin_trylock(session, t) == 0)
+        return;
+
+    __wt_wait_start(session, event);
+    __wt_spin_lock(session, t);
+    __wt_wait_end(session, event);
+}
+
+/*
+ * __wt_readlock_wait --
+ *     Get a shared lock, attributing time spent blocked to a wait event.
+ */
+static inline void
+__wt_readlock_wait(WT_SESSION_IMPL *session, WT_RWLOCK *l, uint32_t event)
+{
+    if (__wt_try_readlock(session, l) == 0)
+        return;
+
+    __wt_wait_start(session, event);
+    __wt_readlock(session, l);
+    __wt_wait_end(session, event);
+}
+
+/*
+ * __wt_writelock_wait --
+ *     Get an exclusive lock, attributing time spent blocked to a wait event.
+ */
+static inline void
+__wt_writelock_wait(WT_SESSION_IMPL *session, WT_RWLOCK *l, uint32_t event)
+{
+    if (__wt_try_writelock(session, l) == 0)
+        return;
+
+    __wt_wait_start(session, event);
+    __wt_writelock(session, l);
+    __wt_wait_end(session, event);
+}
@@ -136,7 +136,8 @@ struct __wt_file_handle_posix {
     /*
      * POSIX specific file handle fields
      */
-    int fd; /* POSIX file handle */
+    int fd;        /* POSIX file handle */
+    int fd_direct; /* POSIX file handle for direct I/O reads */
 
     bool direct_io; /* O_DIRECT configured */
 
@@ -77,6 +77,62 @@ struct __wt_delete_hs_upd {
     WT_UPDATE *tombstone;
 };
 
+/*
+ * WT_REC_BULK_JOB --
+ *	A bulk-load page image queued for a write offload thread to write.
+ */
+struct __wt_rec_bulk_job {
+    WT_ITEM image;       /* Disk image, recycled once written */
+    uint32_t multi_slot; /* Slot in the reconciliation's multi-block array */
+    bool checkpoint_io;  /* Write is part of a checkpoint */
+    bool last_block;     /* Last page of the load */
+
+    uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE]; /* Written block address */
+    size_t addr_size;
+    size_t compressed_size;
+};
+
+/*
+ * WT_REC_BULK_THREAD --
+ *	A bulk-load write offload thread.
+ */
+struct __wt_rec_bulk_thread {
+    WT_REC_BULK *bulk;        /* Owning bulk-load */
+    WT_SESSION_IMPL *session; /* Offload thread session */
+    wt_thread_t tid;          /* Offload thread ID */
+};
+
+/*
+ * WT_REC_BULK --
+ *	Bulk-load write offload: building leaf pages from sorted input is cheap, compressing,
+ * checksumming and writing them is not. The bulk-load thread still builds every page itself, it
+ * hands completed page images to offload threads, taking a written image's buffer in exchange to
+ * build the next page, and collects the block addresses when the load completes.
+ */
+struct __wt_rec_bulk {
+    WT_SPINLOCK lock;      /* Queue lock */
+    WT_CONDVAR *work_cond; /* Wake offload threads */
+    WT_CONDVAR *done_cond; /* Wake the bulk-load thread */
+
+    WT_DATA_HANDLE *dhandle; /* Tree being loaded */
+
+    WT_REC_BULK_JOB **jobs; /* Queued and completed jobs */
+    size_t jobs_allocated;
+    uint32_t jobs_cnt;  /* Jobs queued */
+    uint32_t jobs_next; /* Next job to hand out */
+    uint32_t jobs_done; /* Jobs completed */
+    int ret;            /* First offload thread error */
+
+    WT_ITEM *spares;     /* Buffers of written images */
+    uint32_t spares_cnt; /* Buffers available */
+    uint32_t spares_max; /* Buffers retained */
+
+    volatile bool running; /* Offload threads should keep running */
+
+    u_int nthreads;              /* Offload threads */
+    WT_REC_BULK_THREAD *threads; /* Offload thread sessions and IDs */
+};
+
 /*
  * Reconciliation is the process of taking an in-memory page, walking each entry
  * in the page, building a backing disk image in a temporary buffer representing
@@ -294,6 +350,7 @@ struct __wt_reconcile {
     bool key_sfx_compress_conf; /* If suffix compression configured */
 
     bool is_bulk_load; /* If it's a bulk load */
+    WT_REC_BULK *bulk; /* Bulk-load write offload */
 
     WT_SALVAGE_COOKIE *salvage; /* If it's a salvage operation */
 
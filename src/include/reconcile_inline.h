@@ -522,7 +522,14 @@ __wt_rec_time_window_clear_obsolete(
             /* The durable timestamp should never be less than the start timestamp. */
             WT_ASSERT(session, tw->start_ts <= tw->durable_start_ts);
 
-            tw->start_ts = tw->durable_start_ts = WT_TS_NONE;
+            /*
+             * Records expiring a duration after their commit timestamp must keep the timestamp,
+             * only the transaction ID is obsolete.
+             */
+            if (S2BT(session)->ttl_duration == 0)
+                tw->start_ts = tw->durable_start_ts = WT_TS_NONE;
+            else if (tw->start_txn == WT_TXN_NONE)
+                return;
             tw->start_txn = WT_TXN_NONE;
 
             /* Mark the cell with time window cleared flag to let the cell to be rebuild again. */
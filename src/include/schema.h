@@ -154,6 +154,16 @@ struct __wt_import_list {
     WT_WITH_LOCK_NOWAIT(                                 \
       session, ret, &S2C(session)->checkpoint_lock, WT_SESSION_LOCKED_CHECKPOINT, op)
 
+/*
+ * WT_DHANDLE_WAIT_EVENT --
+ *	The wait event for blocking on a data handle or the handle list lock:
+ *	while a checkpoint gathers handles, it holds locks application threads
+ *	need, attribute the wait to the checkpoint.
+ */
+#define WT_DHANDLE_WAIT_EVENT(session)                                        \
+    (F_ISSET(S2C(session), WT_CONN_CKPT_GATHER) ? WT_WAIT_CHECKPOINT_GATHER : \
+                                                  WT_WAIT_DHANDLE_LOCK)
+
 /*
  * WT_WITH_HANDLE_LIST_READ_LOCK --
  *	Acquire the data handle list lock in shared mode, perform an operation,
@@ -164,17 +174,18 @@ struct __wt_import_list {
  *	discard handles, and we only expect it to be held across short
  *	operations.
  */
-#define WT_WITH_HANDLE_LIST_READ_LOCK(session, op)                            \
-    do {                                                                      \
-        if (FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST)) {  \
-            op;                                                               \
-        } else {                                                              \
-            __wt_readlock(session, &S2C(session)->dhandle_lock);              \
-            FLD_SET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_READ); \
-            op;                                                               \
-            FLD_CLR(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_READ); \
-            __wt_readunlock(session, &S2C(session)->dhandle_lock);            \
-        }                                                                     \
+#define WT_WITH_HANDLE_LIST_READ_LOCK(session, op)                                   \
+    do {                                                                             \
+        if (FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST)) {         \
+            op;                                                                      \
+        } else {                                                                     \
+            __wt_readlock_wait(                                                      \
+              session, &S2C(session)->dhandle_lock, WT_DHANDLE_WAIT_EVENT(session)); \
+            FLD_SET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_READ);        \
+            op;                                                                      \
+            FLD_CLR(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_READ);        \
+            __wt_readunlock(session, &S2C(session)->dhandle_lock);                   \
+        }                                                                            \
     } while (0)
 
 /*
@@ -190,7 +201,8 @@ struct __wt_import_list {
         } else {                                                                             \
             WT_ASSERT(                                                                       \
               session, !FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_READ)); \
-            __wt_writelock(session, &S2C(session)->dhandle_lock);                            \
+            __wt_writelock_wait(                                                             \
+              session, &S2C(session)->dhandle_lock, WT_DHANDLE_WAIT_EVENT(session));         \
             FLD_SET(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE);               \
             op;                                                                              \
             FLD_CLR(session->lock_flags, WT_SESSION_LOCKED_HANDLE_LIST_WRITE);               \
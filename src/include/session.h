@@ -94,6 +94,7 @@ struct __wt_session_impl {
 
     WT_CURSOR_LIST cursors;          /* Cursors closed with the session */
     u_int ncursors;                  /* Count of active file cursors. */
+    u_int idx_batch_cursors;         /* Count of table cursors with index updates buffered */
     uint32_t cursor_sweep_countdown; /* Countdown to cursor sweep */
     uint32_t cursor_sweep_position;  /* Position in cursor_cache for sweep */
     uint64_t last_cursor_big_sweep;  /* Last big sweep for dead cursors */
@@ -206,6 +207,23 @@ struct __wt_session_impl {
     u_int stat_bucket;          /* Statistics bucket offset */
     uint64_t cache_max_wait_us; /* Maximum time an operation waits for space in cache */
 
+/*
+ * Wait events: where the session is blocked, and how often and for how long it has blocked in each
+ * place, reported by the session_waits statistics cursor.
+ */
+#define WT_WAIT_NONE 0              /* Not waiting */
+#define WT_WAIT_CACHE_EVICTION 1    /* Application eviction for a full cache */
+#define WT_WAIT_CAPACITY 2          /* Capacity throttle */
+#define WT_WAIT_CHECKPOINT_GATHER 3 /* Checkpoint gathering handles */
+#define WT_WAIT_DHANDLE_LOCK 4      /* Data handle or handle list lock */
+#define WT_WAIT_LOG_SLOT 5          /* Log slot join */
+#define WT_WAIT_PAGE_LOCK 6         /* Page lock */
+#define WT_WAIT_EVENTS 7            /* Total wait events */
+    volatile uint32_t wait_event;        /* Current wait event */
+    volatile uint64_t wait_start;        /* Current wait start */
+    uint64_t wait_count[WT_WAIT_EVENTS]; /* Waits per event */
+    uint64_t wait_time[WT_WAIT_EVENTS];  /* Wait time per event (usecs) */
+
 #ifdef HAVE_DIAGNOSTIC
     uint8_t dump_raw; /* Configure debugging page dump */
 #endif
@@ -284,10 +302,11 @@ struct __wt_session_impl {
 /* Generations manager */
 #define WT_GEN_CHECKPOINT 0 /* Checkpoint generation */
 #define WT_GEN_COMMIT 1     /* Commit generation */
-#define WT_GEN_EVICT 2      /* Eviction generation */
-#define WT_GEN_HAZARD 3     /* Hazard pointer */
-#define WT_GEN_SPLIT 4      /* Page splits */
-#define WT_GENERATIONS 5    /* Total generation manager entries */
+#define WT_GEN_DHANDLE 2    /* Lock-free data handle lookup */
+#define WT_GEN_EVICT 3      /* Eviction generation */
+#define WT_GEN_HAZARD 4     /* Hazard pointer */
+#define WT_GEN_SPLIT 5      /* Page splits */
+#define WT_GENERATIONS 6    /* Total generation manager entries */
     volatile uint64_t generations[WT_GENERATIONS];
 
     /*
@@ -334,6 +353,23 @@ struct __wt_session_impl {
     uint64_t optrack_offset;
     WT_FH *optrack_fh;
 
+    /*
+     * Operation capture.
+     */
+    WT_CAPTURE_RECORD *capture_buf;
+    u_int capture_cnt;
+    wt_off_t capture_offset;
+    WT_FH *capture_fh;
+
+    /*
+     * Event tracing: the buffer persists past the life of the session, it may be read by threads
+     * writing trace files.
+     */
+    WT_EVENT_TRACE_RECORD *trace_buf;  /* Event buffer */
+    volatile uint64_t trace_entries;   /* Buffer records, a power of two */
+    volatile uint64_t trace_next;      /* Count of records written */
+    uint64_t trace_api_start;          /* Outermost API call start */
+
     WT_SESSION_STATS stats;
 };
 
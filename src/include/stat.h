@@ -329,6 +329,61 @@ __wt_stats_clear(void *stats_arg, int slot)
             WT_STAT_DATA_INCR(session, compress_hist_ratio_max);                                 \
     }
 
+/*
+ * Latency histograms:
+ *
+ * Operation latencies are recorded in nanoseconds into log-linear histograms: values smaller than
+ * WT_LATENCY_HIST_SUB_COUNT each have their own bucket, larger values are split into
+ * WT_LATENCY_HIST_SUB_COUNT / 2 buckets for each power of two, so a bucket's range is never more
+ * than 1/8th (12.5%) of the values it holds. Values of WT_LATENCY_HIST_MAX_BITS bits and larger
+ * (more than a minute) go into the last bucket, the exact maximum is tracked separately. That keeps
+ * a histogram just over 2KB.
+ *
+ * Connection and data handle histograms are split across WT_LATENCY_SLOTS slots, far fewer than the
+ * statistics counters use, and recorded without locking the same way as the statistics counters,
+ * then summed when the statistics are read. A slot's histograms are allocated the first time a
+ * thread using that slot records a latency. Data handles only record latencies when all statistics
+ * are configured, so a connection with many tables doesn't pay for their histograms by default.
+ */
+#define WT_LATENCY_HIST_SUB_BITS 4
+#define WT_LATENCY_HIST_SUB_COUNT (1U << WT_LATENCY_HIST_SUB_BITS)
+#define WT_LATENCY_HIST_MAX_BITS 36
+#define WT_LATENCY_HIST_POWERS (WT_LATENCY_HIST_MAX_BITS - WT_LATENCY_HIST_SUB_BITS)
+#define WT_LATENCY_HIST_BUCKETS \
+    (WT_LATENCY_HIST_SUB_COUNT + WT_LATENCY_HIST_POWERS * (WT_LATENCY_HIST_SUB_COUNT / 2))
+
+#define WT_LATENCY_SLOTS 4
+#define WT_LATENCY_SLOT_ID(session) (((session)->id) % WT_LATENCY_SLOTS)
+
+struct __wt_latency_hist {
+    uint64_t max;                              /* Largest latency recorded */
+    uint64_t buckets[WT_LATENCY_HIST_BUCKETS]; /* Counts per bucket */
+};
+
+/*
+ * Operations with latency histograms: data handles only have histograms for the operations before
+ * WT_LATENCY_DSRC_OPS, connections have histograms for all of them.
+ */
+#define WT_LATENCY_CURSOR_INSERT 0
+#define WT_LATENCY_CURSOR_REMOVE 1
+#define WT_LATENCY_CURSOR_SEARCH 2
+#define WT_LATENCY_CURSOR_UPDATE 3
+#define WT_LATENCY_EVICT_APP 4
+#define WT_LATENCY_DSRC_OPS 5
+#define WT_LATENCY_LOG_SYNC 5
+#define WT_LATENCY_TXN_COMMIT 6
+#define WT_LATENCY_CONN_OPS 7
+
+/*
+ * WT_LATENCY_RECORD --
+ *	Record an operation's latency in nanoseconds.
+ */
+#define WT_LATENCY_RECORD(session, dhandle, op, nsecs)        \
+    do {                                                      \
+        if (WT_STAT_ENABLED(session))                         \
+            __wt_latency_record(session, dhandle, op, nsecs); \
+    } while (0)
+
 /*
  * DO NOT EDIT: automatically built by dist/stat.py.
  */
@@ -377,6 +432,7 @@ struct __wt_connection_stats {
     int64_t block_read;
     int64_t block_write;
     int64_t block_byte_read;
+    int64_t block_byte_read_direct;
     int64_t block_byte_read_mmap;
     int64_t block_byte_read_syscall;
     int64_t block_byte_write;
@@ -534,12 +590,14 @@ struct __wt_connection_stats {
     int64_t fsync_all_time;
     int64_t capacity_bytes_read;
     int64_t capacity_bytes_ckpt;
+    int64_t capacity_bytes_compact;
     int64_t capacity_bytes_evict;
     int64_t capacity_bytes_log;
     int64_t capacity_bytes_written;
     int64_t capacity_threshold;
     int64_t capacity_time_total;
     int64_t capacity_time_ckpt;
+    int64_t capacity_time_compact;
     int64_t capacity_time_evict;
     int64_t capacity_time_log;
     int64_t capacity_time_read;
@@ -594,11 +652,14 @@ struct __wt_connection_stats {
     int64_t cursor_insert_error;
     int64_t cursor_insert_check_error;
     int64_t cursor_insert_bytes;
+    int64_t cursor_insert_index_build;
     int64_t cursor_largest_key_error;
     int64_t cursor_modify;
     int64_t cursor_modify_error;
     int64_t cursor_modify_bytes;
     int64_t cursor_modify_bytes_touch;
+    int64_t cursor_filter_key_skip;
+    int64_t cursor_filter_value_skip;
     int64_t cursor_next;
     int64_t cursor_next_error;
     int64_t cursor_next_hs_tombstone;
@@ -625,10 +686,15 @@ struct __wt_connection_stats {
     int64_t cursor_search_hs;
     int64_t cursor_search_near;
     int64_t cursor_search_near_error;
+    int64_t cursor_insert_index_hit;
+    int64_t cursor_insert_index_miss;
     int64_t cursor_sweep_buckets;
     int64_t cursor_sweep_closed;
     int64_t cursor_sweep_examined;
     int64_t cursor_sweep;
+    int64_t cursor_index_batch_apply;
+    int64_t cursor_index_batch_ops;
+    int64_t cursor_index_batch_cancel;
     int64_t cursor_truncate;
     int64_t cursor_truncate_keys_deleted;
     int64_t cursor_update;
@@ -637,6 +703,8 @@ struct __wt_connection_stats {
     int64_t cursor_update_bytes_changed;
     int64_t cursor_reopen;
     int64_t cursor_open_count;
+    int64_t dh_conn_lockfree_find;
+    int64_t dh_conn_lockfree_miss;
     int64_t dh_conn_handle_size;
     int64_t dh_conn_handle_count;
     int64_t dh_sweep_ref;
@@ -647,6 +715,41 @@ struct __wt_connection_stats {
     int64_t dh_sweep_skip_ckpt;
     int64_t dh_session_handles;
     int64_t dh_session_sweeps;
+    int64_t latency_evict_app_p50;
+    int64_t latency_evict_app_p90;
+    int64_t latency_evict_app_p999;
+    int64_t latency_evict_app_p99;
+    int64_t latency_evict_app_max;
+    int64_t latency_cursor_insert_p50;
+    int64_t latency_cursor_insert_p90;
+    int64_t latency_cursor_insert_p999;
+    int64_t latency_cursor_insert_p99;
+    int64_t latency_cursor_insert_max;
+    int64_t latency_cursor_remove_p50;
+    int64_t latency_cursor_remove_p90;
+    int64_t latency_cursor_remove_p999;
+    int64_t latency_cursor_remove_p99;
+    int64_t latency_cursor_remove_max;
+    int64_t latency_cursor_search_p50;
+    int64_t latency_cursor_search_p90;
+    int64_t latency_cursor_search_p999;
+    int64_t latency_cursor_search_p99;
+    int64_t latency_cursor_search_max;
+    int64_t latency_cursor_update_p50;
+    int64_t latency_cursor_update_p90;
+    int64_t latency_cursor_update_p999;
+    int64_t latency_cursor_update_p99;
+    int64_t latency_cursor_update_max;
+    int64_t latency_log_sync_p50;
+    int64_t latency_log_sync_p90;
+    int64_t latency_log_sync_p999;
+    int64_t latency_log_sync_p99;
+    int64_t latency_log_sync_max;
+    int64_t latency_txn_commit_p50;
+    int64_t latency_txn_commit_p90;
+    int64_t latency_txn_commit_p999;
+    int64_t latency_txn_commit_p99;
+    int64_t latency_txn_commit_max;
     int64_t lock_checkpoint_count;
     int64_t lock_checkpoint_wait_application;
     int64_t lock_checkpoint_wait_internal;
@@ -747,6 +850,8 @@ struct __wt_connection_stats {
     int64_t rec_vlcs_emptied_pages;
     int64_t rec_time_window_bytes_ts;
     int64_t rec_time_window_bytes_txn;
+    int64_t rec_bulk_offload_pages;
+    int64_t rec_time_to_live_bytes;
     int64_t rec_page_delete_fast;
     int64_t rec_overflow_key_leaf;
     int64_t rec_maximum_seconds;
@@ -772,6 +877,7 @@ struct __wt_connection_stats {
     int64_t rec_time_window_pages_durable_stop_ts;
     int64_t rec_time_window_pages_stop_ts;
     int64_t rec_time_window_pages_stop_txn;
+    int64_t rec_time_to_live_expired;
     int64_t rec_time_window_prepared;
     int64_t rec_time_window_durable_start_ts;
     int64_t rec_time_window_start_ts;
@@ -782,6 +888,15 @@ struct __wt_connection_stats {
     int64_t rec_split_stashed_bytes;
     int64_t rec_split_stashed_objects;
     int64_t local_objects_inuse;
+    int64_t session_background_compact_fail;
+    int64_t session_background_compact_interrupted;
+    int64_t session_background_compact_bytes_recovered;
+    int64_t session_background_compact_running;
+    int64_t session_background_compact_passes;
+    int64_t session_background_compact_skipped;
+    int64_t session_background_compact_excluded;
+    int64_t session_background_compact_success;
+    int64_t session_background_compact_yield_eviction;
     int64_t flush_tier_fail;
     int64_t flush_tier;
     int64_t flush_tier_skipped;
@@ -813,6 +928,8 @@ struct __wt_connection_stats {
     int64_t session_table_truncate_success;
     int64_t session_table_verify_fail;
     int64_t session_table_verify_success;
+    int64_t tiered_flush_parts;
+    int64_t tiered_flush_multipart;
     int64_t tiered_work_units_dequeued;
     int64_t tiered_work_units_removed;
     int64_t tiered_work_units_created;
@@ -921,9 +1038,18 @@ struct __wt_dsrc_stats {
     int64_t bloom_page_evict;
     int64_t bloom_page_read;
     int64_t bloom_count;
+    int64_t lsm_merge_bytes_read;
+    int64_t lsm_merge_bytes_flushed;
+    int64_t lsm_merge_bytes_written;
     int64_t lsm_chunk_count;
     int64_t lsm_generation_max;
+    int64_t lsm_merge_partitions;
+    int64_t lsm_merge_throughput;
+    int64_t lsm_merge_time;
+    int64_t lsm_merge_write_amplification;
+    int64_t lsm_merge_count;
     int64_t lsm_lookup_no_bloom;
+    int64_t lsm_merge_rows;
     int64_t lsm_checkpoint_throttle;
     int64_t lsm_merge_throttle;
     int64_t bloom_size;
@@ -941,6 +1067,8 @@ struct __wt_dsrc_stats {
     int64_t block_minor;
     int64_t btree_checkpoint_generation;
     int64_t btree_clean_checkpoint_timer;
+    int64_t btree_compact_bytes_rewritten;
+    int64_t btree_compact_pages_time_to_live;
     int64_t btree_compact_pages_reviewed;
     int64_t btree_compact_pages_rewritten;
     int64_t btree_compact_pages_skipped;
@@ -1095,8 +1223,11 @@ struct __wt_dsrc_stats {
     int64_t cursor_get_value_error;
     int64_t cursor_insert_error;
     int64_t cursor_insert_check_error;
+    int64_t cursor_insert_index_build;
     int64_t cursor_largest_key_error;
     int64_t cursor_modify_error;
+    int64_t cursor_filter_key_skip;
+    int64_t cursor_filter_value_skip;
     int64_t cursor_next_error;
     int64_t cursor_next_hs_tombstone;
     int64_t cursor_next_skip_lt_100;
@@ -1113,6 +1244,8 @@ struct __wt_dsrc_stats {
     int64_t cursor_reset_error;
     int64_t cursor_search_error;
     int64_t cursor_search_near_error;
+    int64_t cursor_insert_index_hit;
+    int64_t cursor_insert_index_miss;
     int64_t cursor_update_error;
     int64_t cursor_insert;
     int64_t cursor_insert_bytes;
@@ -1134,9 +1267,36 @@ struct __wt_dsrc_stats {
     int64_t cursor_update;
     int64_t cursor_update_bytes;
     int64_t cursor_update_bytes_changed;
+    int64_t latency_evict_app_p50;
+    int64_t latency_evict_app_p90;
+    int64_t latency_evict_app_p999;
+    int64_t latency_evict_app_p99;
+    int64_t latency_evict_app_max;
+    int64_t latency_cursor_insert_p50;
+    int64_t latency_cursor_insert_p90;
+    int64_t latency_cursor_insert_p999;
+    int64_t latency_cursor_insert_p99;
+    int64_t latency_cursor_insert_max;
+    int64_t latency_cursor_remove_p50;
+    int64_t latency_cursor_remove_p90;
+    int64_t latency_cursor_remove_p999;
+    int64_t latency_cursor_remove_p99;
+    int64_t latency_cursor_remove_max;
+    int64_t latency_cursor_search_p50;
+    int64_t latency_cursor_search_p90;
+    int64_t latency_cursor_search_p999;
+    int64_t latency_cursor_search_p99;
+    int64_t latency_cursor_search_max;
+    int64_t latency_cursor_update_p50;
+    int64_t latency_cursor_update_p90;
+    int64_t latency_cursor_update_p999;
+    int64_t latency_cursor_update_p99;
+    int64_t latency_cursor_update_max;
     int64_t rec_vlcs_emptied_pages;
     int64_t rec_time_window_bytes_ts;
     int64_t rec_time_window_bytes_txn;
+    int64_t rec_bulk_offload_pages;
+    int64_t rec_time_to_live_bytes;
     int64_t rec_dictionary;
     int64_t rec_page_delete_fast;
     int64_t rec_suffix_compression;
@@ -1164,6 +1324,7 @@ struct __wt_dsrc_stats {
     int64_t rec_time_window_pages_durable_stop_ts;
     int64_t rec_time_window_pages_stop_ts;
     int64_t rec_time_window_pages_stop_txn;
+    int64_t rec_time_to_live_expired;
     int64_t rec_time_window_prepared;
     int64_t rec_time_window_durable_start_ts;
     int64_t rec_time_window_start_ts;
@@ -1196,7 +1357,9 @@ struct __wt_join_stats {
     int64_t main_access;
     int64_t bloom_false_positive;
     int64_t membership_check;
+    int64_t set_result;
     int64_t bloom_insert;
+    int64_t set_insert;
     int64_t iterated;
 };
 
@@ -1215,4 +1378,29 @@ struct __wt_session_stats {
     int64_t cache_time;
 };
 
+/*
+ * Statistics entries for session wait events.
+ */
+#define WT_SESSION_WAITS_STATS_BASE 5000
+struct __wt_session_waits_stats {
+    int64_t cache_eviction_current;
+    int64_t cache_eviction_time;
+    int64_t cache_eviction_count;
+    int64_t capacity_current;
+    int64_t capacity_time;
+    int64_t capacity_count;
+    int64_t checkpoint_gather_current;
+    int64_t checkpoint_gather_time;
+    int64_t checkpoint_gather_count;
+    int64_t dhandle_lock_current;
+    int64_t dhandle_lock_time;
+    int64_t dhandle_lock_count;
+    int64_t log_slot_current;
+    int64_t log_slot_time;
+    int64_t log_slot_count;
+    int64_t page_lock_current;
+    int64_t page_lock_time;
+    int64_t page_lock_count;
+};
+
 /* Statistics section: END */
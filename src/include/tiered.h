@@ -59,6 +59,31 @@ struct __wt_tiered_work_unit {
     uint32_t flags;               /* Flags for operation */
 };
 
+/*
+ * WT_TIERED_UPLOAD --
+ *	A multipart flush in progress. The flush threads claim and copy its parts concurrently, the
+ *	thread copying the last part completes the flush and frees the flush work unit.
+ */
+struct __wt_tiered_upload {
+    TAILQ_ENTRY(__wt_tiered_upload) q; /* Multipart flush queue */
+    WT_TIERED_WORK_UNIT *entry;        /* Flush work unit */
+
+    WT_STORAGE_SOURCE *storage_source; /* Storage source and bucket */
+    WT_FILE_SYSTEM *bucket_fs;
+
+    const char *local_uri; /* Local file URI */
+    const char *obj_uri;   /* Object URI */
+    char *object;          /* Object name in the bucket */
+
+    wt_off_t size;       /* Object size */
+    uint64_t part_size;  /* Part size */
+    uint32_t parts;      /* Number of parts */
+    uint32_t next_part;  /* Next part to copy */
+    uint32_t parts_done; /* Parts copied or skipped */
+    int error;           /* First error */
+    bool dropped;        /* Table dropped, the dropping thread discards the flush */
+};
+
 /*
  * WT_TIERED_TIERS --
  *	Information we need to keep about each tier such as its data handle and name.
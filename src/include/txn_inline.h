@@ -1034,6 +1034,48 @@ __wt_txn_read_upd_list_internal(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
     return (0);
 }
 
+/*
+ * __txn_read_ttl --
+ *     Hide a visible record whose time-to-live expired at or before the reader's timestamp. Readers
+ *     without a read timestamp use the pinned timestamp, so they never see records reconciliation
+ *     may have removed.
+ */
+static inline int
+__txn_read_ttl(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt)
+{
+    WT_TXN *txn;
+    WT_UPDATE_VALUE *upd_value;
+    wt_timestamp_t expiry, read_ts;
+
+    upd_value = cbt->upd_value;
+    if (!WT_BTREE_TTL(CUR2BT(cbt)) ||
+      (upd_value->type != WT_UPDATE_STANDARD && upd_value->type != WT_UPDATE_MODIFY) ||
+      F_ISSET(&cbt->iface, WT_CURSTD_IGNORE_TOMBSTONE))
+        return (0);
+
+    txn = session->txn;
+    if (F_ISSET(txn, WT_TXN_SHARED_TS_READ))
+        read_ts = WT_READING_CHECKPOINT(session) ? txn->checkpoint_read_timestamp :
+                                                   WT_SESSION_TXN_SHARED(session)->read_timestamp;
+    else if (WT_READING_CHECKPOINT(session))
+        read_ts = txn->checkpoint_oldest_timestamp;
+    else
+        __wt_txn_pinned_timestamp(session, &read_ts);
+    if (read_ts == WT_TS_NONE)
+        return (0);
+
+    /* Modifies are only returned when the caller skips the value, which can't hold an expiry. */
+    WT_RET(__wt_ttl_expiry(session, upd_value->tw.start_ts,
+      upd_value->type == WT_UPDATE_STANDARD && !upd_value->skip_buf ? &upd_value->buf : NULL,
+      &expiry));
+    if (expiry <= read_ts) {
+        upd_value->buf.data = NULL;
+        upd_value->buf.size = 0;
+        upd_value->type = WT_UPDATE_TOMBSTONE;
+    }
+    return (0);
+}
+
 /*
  * __wt_txn_read_upd_list --
  *     Get the first visible update in a list (or NULL if none are visible).
@@ -1041,18 +1083,19 @@ __wt_txn_read_upd_list_internal(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt,
 static inline int
 __wt_txn_read_upd_list(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_UPDATE *upd)
 {
-    return (__wt_txn_read_upd_list_internal(session, cbt, upd, NULL, NULL));
+    WT_RET(__wt_txn_read_upd_list_internal(session, cbt, upd, NULL, NULL));
+    return (__txn_read_ttl(session, cbt));
 }
 
 /*
- * __wt_txn_read --
+ * __txn_read --
  *     Get the first visible update in a chain. This function will first check the update list
  *     supplied as a function argument. If there is no visible update, it will check the onpage
  *     value for the given key. Finally, if the onpage value is not visible to the reader, the
  *     function will search the history store for a visible update.
  */
 static inline int
-__wt_txn_read(
+__txn_read(
   WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *key, uint64_t recno, WT_UPDATE *upd)
 {
     WT_DECL_RET;
@@ -1186,6 +1229,18 @@ retry:
     return (0);
 }
 
+/*
+ * __wt_txn_read --
+ *     Get the first visible update in a chain, hiding records whose time-to-live has expired.
+ */
+static inline int
+__wt_txn_read(
+  WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *key, uint64_t recno, WT_UPDATE *upd)
+{
+    WT_RET(__txn_read(session, cbt, key, recno, upd));
+    return (__txn_read_ttl(session, cbt));
+}
+
 /*
  * __wt_txn_begin --
  *     Begin a transaction.
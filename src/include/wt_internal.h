@@ -103,6 +103,10 @@ struct __wt_cache_pool;
 typedef struct __wt_cache_pool WT_CACHE_POOL;
 struct __wt_capacity;
 typedef struct __wt_capacity WT_CAPACITY;
+struct __wt_capture_header;
+typedef struct __wt_capture_header WT_CAPTURE_HEADER;
+struct __wt_capture_record;
+typedef struct __wt_capture_record WT_CAPTURE_RECORD;
 struct __wt_cell;
 typedef struct __wt_cell WT_CELL;
 struct __wt_cell_unpack_addr;
@@ -147,6 +151,10 @@ struct __wt_connection_stats;
 typedef struct __wt_connection_stats WT_CONNECTION_STATS;
 struct __wt_cursor_backup;
 typedef struct __wt_cursor_backup WT_CURSOR_BACKUP;
+struct __wt_cursor_batch;
+typedef struct __wt_cursor_batch WT_CURSOR_BATCH;
+struct __wt_cursor_batch_col;
+typedef struct __wt_cursor_batch_col WT_CURSOR_BATCH_COL;
 struct __wt_cursor_bounds_state;
 typedef struct __wt_cursor_bounds_state WT_CURSOR_BOUNDS_STATE;
 struct __wt_cursor_btree;
@@ -159,6 +167,8 @@ struct __wt_cursor_data_source;
 typedef struct __wt_cursor_data_source WT_CURSOR_DATA_SOURCE;
 struct __wt_cursor_dump;
 typedef struct __wt_cursor_dump WT_CURSOR_DUMP;
+struct __wt_cursor_filter;
+typedef struct __wt_cursor_filter WT_CURSOR_FILTER;
 struct __wt_cursor_hs;
 typedef struct __wt_cursor_hs WT_CURSOR_HS;
 struct __wt_cursor_index;
@@ -171,6 +181,8 @@ struct __wt_cursor_join_entry;
 typedef struct __wt_cursor_join_entry WT_CURSOR_JOIN_ENTRY;
 struct __wt_cursor_join_iter;
 typedef struct __wt_cursor_join_iter WT_CURSOR_JOIN_ITER;
+struct __wt_cursor_join_set;
+typedef struct __wt_cursor_join_set WT_CURSOR_JOIN_SET;
 struct __wt_cursor_json;
 typedef struct __wt_cursor_json WT_CURSOR_JSON;
 struct __wt_cursor_log;
@@ -183,6 +195,10 @@ struct __wt_cursor_stat;
 typedef struct __wt_cursor_stat WT_CURSOR_STAT;
 struct __wt_cursor_table;
 typedef struct __wt_cursor_table WT_CURSOR_TABLE;
+struct __wt_cursor_table_idx_batch;
+typedef struct __wt_cursor_table_idx_batch WT_CURSOR_TABLE_IDX_BATCH;
+struct __wt_cursor_table_idx_op;
+typedef struct __wt_cursor_table_idx_op WT_CURSOR_TABLE_IDX_OP;
 struct __wt_cursor_version;
 typedef struct __wt_cursor_version WT_CURSOR_VERSION;
 struct __wt_data_handle;
@@ -195,6 +211,14 @@ struct __wt_dlh;
 typedef struct __wt_dlh WT_DLH;
 struct __wt_dsrc_stats;
 typedef struct __wt_dsrc_stats WT_DSRC_STATS;
+struct __wt_event_trace_file_record;
+typedef struct __wt_event_trace_file_record WT_EVENT_TRACE_FILE_RECORD;
+struct __wt_event_trace_header;
+typedef struct __wt_event_trace_header WT_EVENT_TRACE_HEADER;
+struct __wt_event_trace_record;
+typedef struct __wt_event_trace_record WT_EVENT_TRACE_RECORD;
+struct __wt_event_trace_session;
+typedef struct __wt_event_trace_session WT_EVENT_TRACE_SESSION;
 struct __wt_evict_entry;
 typedef struct __wt_evict_entry WT_EVICT_ENTRY;
 struct __wt_evict_queue;
@@ -229,12 +253,16 @@ struct __wt_insert;
 typedef struct __wt_insert WT_INSERT;
 struct __wt_insert_head;
 typedef struct __wt_insert_head WT_INSERT_HEAD;
+struct __wt_insert_index;
+typedef struct __wt_insert_index WT_INSERT_INDEX;
 struct __wt_join_stats;
 typedef struct __wt_join_stats WT_JOIN_STATS;
 struct __wt_join_stats_group;
 typedef struct __wt_join_stats_group WT_JOIN_STATS_GROUP;
 struct __wt_keyed_encryptor;
 typedef struct __wt_keyed_encryptor WT_KEYED_ENCRYPTOR;
+struct __wt_latency_hist;
+typedef struct __wt_latency_hist WT_LATENCY_HIST;
 struct __wt_log;
 typedef struct __wt_log WT_LOG;
 struct __wt_log_desc;
@@ -255,6 +283,8 @@ struct __wt_lsm_data_source;
 typedef struct __wt_lsm_data_source WT_LSM_DATA_SOURCE;
 struct __wt_lsm_manager;
 typedef struct __wt_lsm_manager WT_LSM_MANAGER;
+struct __wt_lsm_merge_part;
+typedef struct __wt_lsm_merge_part WT_LSM_MERGE_PART;
 struct __wt_lsm_tree;
 typedef struct __wt_lsm_tree WT_LSM_TREE;
 struct __wt_lsm_work_unit;
@@ -303,6 +333,12 @@ struct __wt_page_stat;
 typedef struct __wt_page_stat WT_PAGE_STAT;
 struct __wt_process;
 typedef struct __wt_process WT_PROCESS;
+struct __wt_rec_bulk;
+typedef struct __wt_rec_bulk WT_REC_BULK;
+struct __wt_rec_bulk_job;
+typedef struct __wt_rec_bulk_job WT_REC_BULK_JOB;
+struct __wt_rec_bulk_thread;
+typedef struct __wt_rec_bulk_thread WT_REC_BULK_THREAD;
 struct __wt_rec_chunk;
 typedef struct __wt_rec_chunk WT_REC_CHUNK;
 struct __wt_rec_dictionary;
@@ -323,6 +359,8 @@ struct __wt_row;
 typedef struct __wt_row WT_ROW;
 struct __wt_rwlock;
 typedef struct __wt_rwlock WT_RWLOCK;
+struct __wt_rwlock_reader;
+typedef struct __wt_rwlock_reader WT_RWLOCK_READER;
 struct __wt_salvage_cookie;
 typedef struct __wt_salvage_cookie WT_SALVAGE_COOKIE;
 struct __wt_save_upd;
@@ -335,6 +373,12 @@ struct __wt_session_stash;
 typedef struct __wt_session_stash WT_SESSION_STASH;
 struct __wt_session_stats;
 typedef struct __wt_session_stats WT_SESSION_STATS;
+struct __wt_session_waits_entry;
+typedef struct __wt_session_waits_entry WT_SESSION_WAITS_ENTRY;
+struct __wt_session_waits_stats;
+typedef struct __wt_session_waits_stats WT_SESSION_WAITS_STATS;
+struct __wt_session_waits_stats_group;
+typedef struct __wt_session_waits_stats_group WT_SESSION_WAITS_STATS_GROUP;
 struct __wt_size;
 typedef struct __wt_size WT_SIZE;
 struct __wt_spinlock;
@@ -355,6 +399,8 @@ struct __wt_tiered_tiers;
 typedef struct __wt_tiered_tiers WT_TIERED_TIERS;
 struct __wt_tiered_tree;
 typedef struct __wt_tiered_tree WT_TIERED_TREE;
+struct __wt_tiered_upload;
+typedef struct __wt_tiered_upload WT_TIERED_UPLOAD;
 struct __wt_tiered_work_unit;
 typedef struct __wt_tiered_work_unit WT_TIERED_WORK_UNIT;
 struct __wt_time_aggregate;
@@ -439,12 +485,14 @@ typedef uint64_t wt_timestamp_t;
 #include "btree.h"
 #include "cache.h"
 #include "capacity.h"
+#include "capture.h"
 #include "cell.h"
 #include "compact.h"
 #include "config.h"
 #include "cursor.h"
 #include "dlh.h"
 #include "error.h"
+#include "event_trace.h"
 #include "log.h"
 #include "lsm.h"
 #include "meta.h" /* required by block.h */
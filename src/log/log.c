@@ -214,7 +214,10 @@ __log_fs_write(
         WT_RET(__wt_log_force_sync(session, &slot->slot_release_lsn));
     }
     __wt_capacity_throttle(session, len, WT_THROTTLE_LOG);
-    if ((ret = __wt_write(session, slot->slot_fh, offset, len, buf)) != 0)
+    WT_EVENT_TRACE_BEGIN_OP(session, WT_EVENT_TRACE_LOG_WRITE);
+    ret = __wt_write(session, slot->slot_fh, offset, len, buf);
+    WT_EVENT_TRACE_END_OP(session, WT_EVENT_TRACE_LOG_WRITE, len);
+    if (ret != 0)
         WT_RET_PANIC(session, ret, "%s: fatal log failure", slot->slot_fh->name);
     return (ret);
 }
@@ -283,6 +286,8 @@ __log_fsync_file(WT_SESSION_IMPL *session, WT_LSN *min_lsn, const char *method,
         WT_ASSIGN_LSN(&log->sync_lsn, min_lsn);
         WT_STAT_CONN_INCR(session, log_sync);
         WT_STAT_CONN_INCRV(session, log_sync_duration, fsync_duration_usecs);
+        WT_LATENCY_RECORD(
+          session, NULL, WT_LATENCY_LOG_SYNC, WT_CLOCKDIFF_NS(time_stop, time_start));
         __wt_cond_signal(session, log->log_sync_cond);
     }
 err:
@@ -584,8 +584,10 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
             closed = true;
             ++wait_cnt;
         }
-        if (!yielded)
+        if (!yielded) {
             time_start = __wt_clock(session);
+            __wt_wait_start(session, WT_WAIT_LOG_SLOT);
+        }
         yielded = true;
         /*
          * The slot is no longer open or we lost the race to update it. Yield and try again.
@@ -603,6 +605,7 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize, uint32_t flags, WT
     if (!yielded)
         WT_STAT_CONN_INCR(session, log_slot_immediate);
     else {
+        __wt_wait_end(session, WT_WAIT_LOG_SLOT);
         WT_STAT_CONN_INCR(session, log_slot_yield);
         time_stop = __wt_clock(session);
         usecs = WT_CLOCKDIFF_US(time_stop, time_start);
@@ -8,27 +8,30 @@
 
 #include "wt_internal.h"
 
-static int __lsm_merge_span(WT_SESSION_IMPL *, WT_LSM_TREE *, u_int, u_int *, u_int *, uint64_t *);
-
 /*
  * __wt_lsm_merge_update_tree --
- *     Merge a set of chunks and populate a new one. Must be called with the LSM lock held.
+ *     Merge a set of chunks and populate one or more new ones. Must be called with the LSM lock
+ *     held.
  */
 int
 __wt_lsm_merge_update_tree(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int start_chunk,
-  u_int nchunks, WT_LSM_CHUNK *chunk)
+  u_int nchunks, WT_LSM_CHUNK **chunks, u_int nnew)
 {
     size_t chunks_after_merge;
+    u_int i;
+
+    WT_ASSERT(session, nnew > 0 && nnew <= nchunks);
 
     WT_RET(__wt_lsm_tree_retire_chunks(session, lsm_tree, start_chunk, nchunks));
 
     /* Update the current chunk list. */
     chunks_after_merge = lsm_tree->nchunks - (nchunks + start_chunk);
-    memmove(lsm_tree->chunk + start_chunk + 1, lsm_tree->chunk + start_chunk + nchunks,
+    memmove(lsm_tree->chunk + start_chunk + nnew, lsm_tree->chunk + start_chunk + nchunks,
       chunks_after_merge * sizeof(*lsm_tree->chunk));
-    lsm_tree->nchunks -= nchunks - 1;
-    memset(lsm_tree->chunk + lsm_tree->nchunks, 0, (nchunks - 1) * sizeof(*lsm_tree->chunk));
-    lsm_tree->chunk[start_chunk] = chunk;
+    lsm_tree->nchunks -= nchunks - nnew;
+    memset(lsm_tree->chunk + lsm_tree->nchunks, 0, (nchunks - nnew) * sizeof(*lsm_tree->chunk));
+    for (i = 0; i < nnew; i++)
+        lsm_tree->chunk[start_chunk + i] = chunks[i];
 
     return (0);
 }
@@ -139,13 +142,37 @@ __lsm_merge_clear(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int start,
 }
 
 /*
- * __lsm_merge_span --
- *     Figure out the best span of chunks to merge. Return an error if there is no need to do any
- *     merges. Called with the LSM tree locked.
+ * __lsm_merge_youngest --
+ *     Find the youngest chunk that can be merged: only include chunks that already have a Bloom
+ *     filter or are the result of a merge and not involved in a merge.
+ */
+static u_int
+__lsm_merge_youngest(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
+{
+    WT_LSM_CHUNK *chunk;
+    u_int end_chunk;
+
+    for (end_chunk = lsm_tree->nchunks - 1; end_chunk > 0; --end_chunk) {
+        chunk = lsm_tree->chunk[end_chunk];
+        WT_ASSERT(session, chunk != NULL);
+        if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING))
+            continue;
+        if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) || chunk->generation > 0)
+            break;
+        if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF) && F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
+            break;
+    }
+    return (end_chunk);
+}
+
+/*
+ * __lsm_merge_span_generational --
+ *     Figure out the best span of chunks of similar merge generation to merge. Return an error if
+ *     there is no need to do any merges. Called with the LSM tree locked.
  */
 static int
-__lsm_merge_span(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id, u_int *start,
-  u_int *end, uint64_t *records)
+__lsm_merge_span_generational(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id,
+  u_int *start, u_int *end, uint64_t *records)
 {
     WT_LSM_CHUNK *chunk, *youngest;
     uint64_t chunk_size, record_count;
@@ -175,20 +202,7 @@ __lsm_merge_span(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id, u_in
     if (lsm_tree->nchunks < merge_min)
         return (WT_NOTFOUND);
 
-    /*
-     * Only include chunks that already have a Bloom filter or are the result of a merge and not
-     * involved in a merge.
-     */
-    for (end_chunk = lsm_tree->nchunks - 1; end_chunk > 0; --end_chunk) {
-        chunk = lsm_tree->chunk[end_chunk];
-        WT_ASSERT(session, chunk != NULL);
-        if (F_ISSET(chunk, WT_LSM_CHUNK_MERGING))
-            continue;
-        if (F_ISSET(chunk, WT_LSM_CHUNK_BLOOM) || chunk->generation > 0)
-            break;
-        if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OFF) && F_ISSET(chunk, WT_LSM_CHUNK_ONDISK))
-            break;
-    }
+    end_chunk = __lsm_merge_youngest(session, lsm_tree);
 
     /*
      * Give up immediately if there aren't enough on disk chunks in the tree for a merge.
@@ -316,101 +330,320 @@ retry_find:
 }
 
 /*
- * __wt_lsm_merge --
- *     Merge a set of chunks of an LSM tree.
+ * __lsm_merge_available --
+ *     Return if a chunk can be included in a new merge.
  */
-int
-__wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
+static inline bool
+__lsm_merge_available(WT_LSM_CHUNK *chunk)
+{
+    return (!F_ISSET(chunk, WT_LSM_CHUNK_MERGING) && chunk->bloom_busy == 0);
+}
+
+/*
+ * __lsm_merge_span_set --
+ *     Claim a span of chunks chosen by one of the merge strategies.
+ */
+static void
+__lsm_merge_span_set(WT_LSM_TREE *lsm_tree, u_int start_chunk, u_int end_chunk, u_int *start,
+  u_int *end, uint64_t *records)
 {
-    WT_BLOOM *bloom;
-    WT_CURSOR *dest, *src;
-    WT_DECL_RET;
-    WT_ITEM key, value;
     WT_LSM_CHUNK *chunk;
-    uint64_t insert_count, record_count;
-    uint32_t generation;
-    u_int dest_id, end_chunk, i, nchunks, start_chunk, start_id, verb;
-    int tret;
-    const char *cfg[3];
-    const char *drop_cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_drop), "force", NULL};
-    bool created_chunk, create_bloom, locked, in_sync;
+    uint64_t record_count;
+    u_int i;
 
-    bloom = NULL;
-    chunk = NULL;
-    dest = src = NULL;
-    created_chunk = create_bloom = in_sync = false;
+    for (record_count = 0, i = start_chunk; i <= end_chunk; i++) {
+        chunk = lsm_tree->chunk[i];
+        F_SET(chunk, WT_LSM_CHUNK_MERGING);
+        record_count += chunk->count;
+    }
 
-    /* Fast path if it's obvious no merges could be done. */
-    if (lsm_tree->nchunks < lsm_tree->merge_min &&
-      lsm_tree->merge_aggressiveness < WT_LSM_AGGRESSIVE_THRESHOLD)
+    __lsm_merge_aggressive_clear(lsm_tree);
+    *records = record_count;
+    *start = start_chunk;
+    *end = end_chunk;
+}
+
+/*
+ * __lsm_merge_span_leveled --
+ *     Figure out the span of chunks to merge for a leveled tree: once enough chunks have been
+ *     flushed, fold them into the youngest merged chunk, unless that would take it past the maximum
+ *     chunk size, in which case the flushed chunks start a new level. Called with the LSM tree
+ *     locked.
+ */
+static int
+__lsm_merge_span_leveled(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int *start,
+  u_int *end, uint64_t *records)
+{
+    WT_LSM_CHUNK *chunk;
+    uint64_t chunk_size;
+    u_int end_chunk, merge_min, start_chunk;
+
+    merge_min =
+      lsm_tree->merge_aggressiveness > WT_LSM_AGGRESSIVE_THRESHOLD ? 2 : lsm_tree->merge_min;
+
+    end_chunk = __lsm_merge_youngest(session, lsm_tree);
+    if (end_chunk < merge_min - 1)
         return (WT_NOTFOUND);
 
-    /*
-     * Use the lsm_tree lock to read the chunks (so no switches occur), but avoid holding it while
-     * the merge is in progress: that may take a long time.
-     */
-    __wt_lsm_tree_writelock(session, lsm_tree);
-    locked = true;
+    /* Find the run of flushed, never merged chunks ending with the youngest eligible chunk. */
+    for (chunk_size = 0, start_chunk = end_chunk + 1; start_chunk > 0; --start_chunk) {
+        chunk = lsm_tree->chunk[start_chunk - 1];
+        if (!__lsm_merge_available(chunk) || chunk->generation != 0)
+            break;
+        chunk_size += chunk->size;
+    }
+    if (end_chunk + 1 - start_chunk < merge_min) {
+        __lsm_merge_aggressive_update(session, lsm_tree);
+        return (WT_NOTFOUND);
+    }
 
-    WT_ERR(__lsm_merge_span(session, lsm_tree, id, &start_chunk, &end_chunk, &record_count));
-    nchunks = (end_chunk + 1) - start_chunk;
+    /* Merge the oldest flushed chunks first, so data moves through the tree in order. */
+    while (end_chunk + 1 - start_chunk > lsm_tree->merge_max)
+        chunk_size -= lsm_tree->chunk[end_chunk--]->size;
 
-    WT_ASSERT(session, nchunks > 0);
-    start_id = lsm_tree->chunk[start_chunk]->id;
+    /* Include the youngest merged chunk if the result stays within the maximum chunk size. */
+    if (start_chunk > 0) {
+        chunk = lsm_tree->chunk[start_chunk - 1];
+        if (__lsm_merge_available(chunk) && chunk_size + chunk->size <= lsm_tree->chunk_max)
+            --start_chunk;
+    }
 
-    /* Find the merge generation. */
-    for (generation = 0, i = 0; i < nchunks; i++)
-        generation = WT_MAX(generation, lsm_tree->chunk[start_chunk + i]->generation + 1);
+    __lsm_merge_span_set(lsm_tree, start_chunk, end_chunk, start, end, records);
+    return (0);
+}
 
-    __wt_lsm_tree_writeunlock(session, lsm_tree);
-    locked = false;
+/*
+ * __lsm_merge_span_run --
+ *     Look for a run of adjacent chunks to merge, ending at or before the youngest eligible chunk.
+ *     A chunk joins the run if the "similar" function accepts it given the run so far. Called with
+ *     the LSM tree locked.
+ */
+static int
+__lsm_merge_span_run(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree,
+  bool (*similar)(WT_LSM_TREE *, WT_LSM_CHUNK *, uint64_t, u_int, WT_LSM_CHUNK *), u_int *start,
+  u_int *end, uint64_t *records)
+{
+    WT_LSM_CHUNK *chunk, *youngest;
+    uint64_t chunk_size;
+    u_int end_chunk, merge_min, nchunks, start_chunk;
 
-    /* Allocate an ID for the merge. */
-    dest_id = __wt_atomic_add32(&lsm_tree->last, 1);
+    merge_min =
+      lsm_tree->merge_aggressiveness > WT_LSM_AGGRESSIVE_THRESHOLD ? 2 : lsm_tree->merge_min;
+
+    end_chunk = __lsm_merge_youngest(session, lsm_tree);
+    if (end_chunk < merge_min - 1)
+        return (WT_NOTFOUND);
 
     /*
-     * We only want to do the chunk loop if we're running with verbose, so we wrap these statements
-     * in the conditional. Avoid the loop in the normal path.
+     * Work backwards from the youngest chunk: if the run ending at a chunk is too short, try the
+     * run ending just before it.
      */
-    if (WT_VERBOSE_LEVEL_ISSET(session, WT_VERB_LSM, WT_VERBOSE_DEBUG_2)) {
-        __wt_verbose_debug2(session, WT_VERB_LSM,
-          "Merging %s chunks %u-%u into %u (%" PRIu64 " records), generation %" PRIu32,
-          lsm_tree->name, start_chunk, end_chunk, dest_id, record_count, generation);
-        for (verb = start_chunk; verb < end_chunk + 1; verb++)
-            __wt_verbose_debug2(session, WT_VERB_LSM,
-              "Merging %s: Chunk[%u] id %" PRIu32 ", gen: %" PRIu32 ", size: %" PRIu64
-              ", records: %" PRIu64,
-              lsm_tree->name, verb, lsm_tree->chunk[verb]->id, lsm_tree->chunk[verb]->generation,
-              lsm_tree->chunk[verb]->size, lsm_tree->chunk[verb]->count);
+    for (;;) {
+        youngest = lsm_tree->chunk[end_chunk];
+        if (__lsm_merge_available(youngest) && youngest->size <= lsm_tree->chunk_max) {
+            chunk_size = youngest->size;
+            for (start_chunk = end_chunk; start_chunk > 0; --start_chunk) {
+                nchunks = end_chunk + 1 - start_chunk;
+                if (nchunks == lsm_tree->merge_max)
+                    break;
+                chunk = lsm_tree->chunk[start_chunk - 1];
+                if (!__lsm_merge_available(chunk) ||
+                  chunk_size + chunk->size > lsm_tree->chunk_max ||
+                  !similar(lsm_tree, youngest, chunk_size, nchunks, chunk))
+                    break;
+                chunk_size += chunk->size;
+            }
+            if (end_chunk + 1 - start_chunk >= merge_min) {
+                __lsm_merge_span_set(lsm_tree, start_chunk, end_chunk, start, end, records);
+                return (0);
+            }
+        } else
+            start_chunk = end_chunk;
+
+        if (start_chunk < merge_min)
+            break;
+        end_chunk = start_chunk - 1;
     }
 
-    WT_ERR(__wt_calloc_one(session, &chunk));
-    created_chunk = true;
-    chunk->id = dest_id;
-    chunk->generation = generation;
+    __lsm_merge_aggressive_update(session, lsm_tree);
+    return (WT_NOTFOUND);
+}
 
-    if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
-      (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) || start_chunk > 0) && record_count > 0)
-        create_bloom = true;
+/*
+ * __lsm_merge_similar_size --
+ *     Size-tiered merges: a chunk joins a run if its size is within half and one and a half times
+ *     the run's average chunk size. Chunks smaller than a flushed chunk are all in the same tier.
+ */
+static bool
+__lsm_merge_similar_size(WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *youngest, uint64_t chunk_size,
+  u_int nchunks, WT_LSM_CHUNK *chunk)
+{
+    uint64_t avg;
+
+    WT_UNUSED(youngest);
+
+    avg = chunk_size / nchunks;
+    if (avg <= lsm_tree->chunk_size && chunk->size <= lsm_tree->chunk_size)
+        return (true);
+    return (chunk->size >= avg / 2 && chunk->size <= avg + avg / 2);
+}
+
+/*
+ * __lsm_merge_similar_time --
+ *     Time-windowed merges: a chunk joins a run if it was created in the same time window as the
+ *     run's youngest chunk.
+ */
+static bool
+__lsm_merge_similar_time(WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *youngest, uint64_t chunk_size,
+  u_int nchunks, WT_LSM_CHUNK *chunk)
+{
+    WT_UNUSED(chunk_size);
+    WT_UNUSED(nchunks);
+
+    return (chunk->create_secs / lsm_tree->merge_time_window ==
+      youngest->create_secs / lsm_tree->merge_time_window);
+}
+
+/*
+ * __lsm_merge_span --
+ *     Figure out the best span of chunks to merge using the tree's merge strategy. Return an error
+ *     if there is no need to do any merges. Called with the LSM tree locked.
+ */
+static int
+__lsm_merge_span(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id, u_int *start,
+  u_int *end, uint64_t *records)
+{
+    *start = *end = 0;
+    *records = 0;
+
+    switch (lsm_tree->merge_strategy) {
+    case WT_LSM_MERGE_GENERATIONAL:
+        break;
+    case WT_LSM_MERGE_LEVELED:
+        return (__lsm_merge_span_leveled(session, lsm_tree, start, end, records));
+    case WT_LSM_MERGE_SIZE_TIERED:
+        return (
+          __lsm_merge_span_run(session, lsm_tree, __lsm_merge_similar_size, start, end, records));
+    case WT_LSM_MERGE_TIME_WINDOWED:
+        return (
+          __lsm_merge_span_run(session, lsm_tree, __lsm_merge_similar_time, start, end, records));
+    }
+    return (__lsm_merge_span_generational(session, lsm_tree, id, start, end, records));
+}
+
+/*
+ * __lsm_merge_split --
+ *     Choose the key ranges of a partitioned merge by sampling keys from the largest chunk being
+ *     merged. Adjust the number of partitions if there aren't enough distinct keys.
+ */
+static int
+__lsm_merge_split(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, const char *uri,
+  WT_LSM_MERGE_PART *parts, u_int *npartsp)
+{
+    WT_CURSOR *cursor;
+    WT_DECL_RET;
+    WT_ITEM key, *samples, tmp;
+    u_int i, j, nparts, nsamples;
+    int cmp;
+    const char *cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_open_cursor), "next_random=true", NULL};
+
+#define WT_LSM_MERGE_SAMPLES 16 /* Samples per partition */
+    cursor = NULL;
+    nparts = *npartsp;
+    *npartsp = 1;
+    WT_RET(__wt_calloc_def(session, nparts * WT_LSM_MERGE_SAMPLES, &samples));
+    WT_ERR(__wt_open_cursor(session, uri, NULL, cfg, &cursor));
+
+    /* Take a sorted sample of the keys. */
+    for (nsamples = 0; nsamples < nparts * WT_LSM_MERGE_SAMPLES; ++nsamples) {
+        if ((ret = cursor->next(cursor)) == WT_NOTFOUND)
+            break;
+        WT_ERR(ret);
+        WT_ERR(cursor->get_key(cursor, &key));
+        WT_ERR(__wt_buf_set(session, &samples[nsamples], key.data, key.size));
+        for (j = nsamples; j > 0; --j) {
+            WT_ERR(__wt_compare(session, lsm_tree->collator, &samples[j - 1], &samples[j], &cmp));
+            if (cmp <= 0)
+                break;
+            tmp = samples[j - 1];
+            samples[j - 1] = samples[j];
+            samples[j] = tmp;
+        }
+    }
+    ret = 0;
+
+    /* Pick evenly spaced boundaries, skipping duplicates. */
+    for (i = 1; i < nparts; i++) {
+        j = i * nsamples / nparts;
+        if (j == 0 || j >= nsamples)
+            continue;
+        if (*npartsp > 1) {
+            WT_ERR(__wt_compare(
+              session, lsm_tree->collator, &parts[*npartsp - 1].start, &samples[j], &cmp));
+            if (cmp >= 0)
+                continue;
+        }
+        WT_ERR(__wt_buf_set(session, &parts[*npartsp].start, samples[j].data, samples[j].size));
+        WT_ERR(
+          __wt_buf_set(session, &parts[*npartsp - 1].stop, samples[j].data, samples[j].size));
+        ++*npartsp;
+    }
+
+err:
+    if (cursor != NULL)
+        WT_TRET(cursor->close(cursor));
+    for (i = 0; i < nparts * WT_LSM_MERGE_SAMPLES; i++)
+        __wt_buf_free(session, &samples[i]);
+    __wt_free(session, samples);
+    return (ret);
+}
+
+/*
+ * __lsm_merge_part --
+ *     Merge one key range of a set of chunks into a new chunk.
+ */
+static int
+__lsm_merge_part(WT_SESSION_IMPL *session, WT_LSM_MERGE_PART *part)
+{
+    WT_BLOOM *bloom;
+    WT_CURSOR *dest, *src;
+    WT_DECL_RET;
+    WT_ITEM key, value;
+    WT_LSM_CHUNK *chunk;
+    WT_LSM_TREE *lsm_tree;
+    uint64_t insert_count;
+    int cmp;
+    const char *cfg[3];
+    bool in_sync;
+
+    lsm_tree = part->lsm_tree;
+    chunk = part->chunk;
+    bloom = NULL;
+    dest = src = NULL;
+    in_sync = false;
 
     /*
-     * Special setup for the merge cursor: first, reset to open the dependent cursors; then restrict
-     * the cursor to a specific number of chunks; then set MERGE so the cursor doesn't track updates
-     * to the tree.
+     * Create the new chunk first: the merge cursor leaves the session referencing a checkpoint
+     * handle, and creating the chunk updates the metadata.
      */
-    WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
-    F_SET(src, WT_CURSTD_RAW);
-    WT_ERR(__wt_clsm_init_merge(src, start_chunk, start_id, nchunks));
-
     WT_WITH_SCHEMA_LOCK(session, ret = __wt_lsm_tree_setup_chunk(session, lsm_tree, chunk));
     WT_ERR(ret);
-    if (create_bloom) {
+    if (part->create_bloom) {
         WT_ERR(__wt_lsm_tree_setup_bloom(session, lsm_tree, chunk));
 
-        WT_ERR(__wt_bloom_create(session, chunk->bloom_uri, lsm_tree->bloom_config, record_count,
-          lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count, &bloom));
+        WT_ERR(__wt_bloom_create(session, chunk->bloom_uri, lsm_tree->bloom_config,
+          part->record_count, lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count, &bloom));
     }
 
+    /*
+     * Special setup for the merge cursor: first, reset to open the dependent cursors; then restrict
+     * the cursor to a specific number of chunks; then set MERGE so the cursor doesn't track updates
+     * to the tree.
+     */
+    WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
+    F_SET(src, WT_CURSTD_RAW);
+    WT_ERR(__wt_clsm_init_merge(src, part->start_chunk, part->start_id, part->nchunks));
+
     /* Discard pages we read as soon as we're done with them. */
     F_SET(session, WT_SESSION_READ_WONT_NEED);
 
@@ -431,30 +664,45 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
         }
     }
 
+    /* Position the source at the start of the key range. */
+    if (part->start.size == 0)
+        ret = src->next(src);
+    else {
+        src->set_key(src, &part->start);
+        if ((ret = src->search_near(src, &cmp)) == 0 && cmp < 0)
+            ret = src->next(src);
+    }
+
 #define LSM_MERGE_CHECK_INTERVAL WT_THOUSAND
-    for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
+    for (insert_count = 0; ret == 0; insert_count++, ret = src->next(src)) {
         if (insert_count % LSM_MERGE_CHECK_INTERVAL == 0) {
             if (!lsm_tree->active)
                 WT_ERR(EINTR);
 
             WT_STAT_CONN_INCRV(session, lsm_rows_merged, LSM_MERGE_CHECK_INTERVAL);
-            ++lsm_tree->merge_progressing;
+            (void)__wt_atomic_add64(&lsm_tree->merge_progressing, 1);
         }
 
         WT_ERR(src->get_key(src, &key));
+        if (part->stop.size != 0) {
+            WT_ERR(__wt_compare(session, lsm_tree->collator, &key, &part->stop, &cmp));
+            if (cmp >= 0)
+                break;
+        }
         dest->set_key(dest, &key);
         WT_ERR(src->get_value(src, &value));
         dest->set_value(dest, &value);
         WT_ERR(dest->insert(dest));
-        if (create_bloom)
+        if (part->create_bloom)
             __wt_bloom_insert(bloom, &key);
     }
     WT_ERR_NOTFOUND_OK(ret, false);
 
     WT_STAT_CONN_INCRV(session, lsm_rows_merged, insert_count % LSM_MERGE_CHECK_INTERVAL);
-    ++lsm_tree->merge_progressing;
+    (void)__wt_atomic_add64(&lsm_tree->merge_progressing, 1);
     __wt_verbose(session, WT_VERB_LSM, "Bloom size for %" PRIu64 " has %" PRIu64 " items inserted",
-      record_count, insert_count);
+      part->record_count, insert_count);
+    part->insert_count = insert_count;
 
     /*
      * Closing and syncing the files can take a while. Set the merge_syncing field so that compact
@@ -479,7 +727,7 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
      */
     F_SET(session, WT_SESSION_IGNORE_CACHE_SIZE);
 
-    if (create_bloom) {
+    if (part->create_bloom) {
         if (ret == 0)
             WT_TRET(__wt_bloom_finalize(bloom));
 
@@ -506,12 +754,197 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
     WT_ERR(__wt_open_cursor(session, chunk->uri, NULL, cfg, &dest));
     WT_TRET(dest->close(dest));
     dest = NULL;
-    ++lsm_tree->merge_progressing;
+    (void)__wt_atomic_add64(&lsm_tree->merge_progressing, 1);
     (void)__wt_atomic_sub32(&lsm_tree->merge_syncing, 1);
     in_sync = false;
     WT_ERR_NOTFOUND_OK(ret, false);
 
     WT_ERR(__wt_lsm_tree_set_chunk_size(session, lsm_tree, chunk));
+
+err:
+    if (in_sync)
+        (void)__wt_atomic_sub32(&lsm_tree->merge_syncing, 1);
+    if (src != NULL)
+        WT_TRET(src->close(src));
+    if (dest != NULL)
+        WT_TRET(dest->close(dest));
+    if (bloom != NULL)
+        WT_TRET(__wt_bloom_close(bloom));
+    F_CLR(session, WT_SESSION_IGNORE_CACHE_SIZE | WT_SESSION_READ_WONT_NEED);
+    return (ret);
+}
+
+/*
+ * __lsm_merge_part_server --
+ *     Helper thread merging one key range of a partitioned merge.
+ */
+static WT_THREAD_RET
+__lsm_merge_part_server(void *arg)
+{
+    WT_LSM_MERGE_PART *part;
+
+    part = (WT_LSM_MERGE_PART *)arg;
+    part->ret = __lsm_merge_part(part->session, part);
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_lsm_merge --
+ *     Merge a set of chunks of an LSM tree.
+ */
+int
+__wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
+{
+    struct timespec start, stop;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_RET;
+    WT_LSM_CHUNK *chunk, **chunks;
+    WT_LSM_MERGE_PART *part, *parts;
+    uint64_t create_secs, input_size, largest, output_size, record_count;
+    uint32_t generation;
+    u_int end_chunk, i, max_parts, nchunks, nparts, start_chunk, start_id, verb;
+    int tret;
+    const char *drop_cfg[] = {WT_CONFIG_BASE(session, WT_SESSION_drop), "force", NULL};
+    char *sample_uri;
+    bool create_bloom, locked;
+
+    conn = S2C(session);
+    chunks = NULL;
+    parts = NULL;
+    sample_uri = NULL;
+    max_parts = nparts = 0;
+    create_bloom = false;
+
+    /* Fast path if it's obvious no merges could be done. */
+    if (lsm_tree->nchunks < lsm_tree->merge_min &&
+      lsm_tree->merge_aggressiveness < WT_LSM_AGGRESSIVE_THRESHOLD)
+        return (WT_NOTFOUND);
+
+    /*
+     * Use the lsm_tree lock to read the chunks (so no switches occur), but avoid holding it while
+     * the merge is in progress: that may take a long time.
+     */
+    __wt_lsm_tree_writelock(session, lsm_tree);
+    locked = true;
+
+    WT_ERR(__lsm_merge_span(session, lsm_tree, id, &start_chunk, &end_chunk, &record_count));
+    nchunks = (end_chunk + 1) - start_chunk;
+
+    WT_ASSERT(session, nchunks > 0);
+    start_id = lsm_tree->chunk[start_chunk]->id;
+
+    /*
+     * Find the merge generation, the creation time of the oldest data, the amount of data being
+     * merged and the largest chunk, used to split the merge into key ranges.
+     */
+    create_secs = UINT64_MAX;
+    for (generation = 0, input_size = largest = 0, i = 0; i < nchunks; i++) {
+        chunk = lsm_tree->chunk[start_chunk + i];
+        generation = WT_MAX(generation, chunk->generation + 1);
+        if (chunk->create_secs != 0)
+            create_secs = WT_MIN(create_secs, chunk->create_secs);
+        input_size += chunk->size;
+        if (chunk->size >= largest) {
+            largest = chunk->size;
+            __wt_free(session, sample_uri);
+            WT_ERR(__wt_strndup(session, chunk->uri, strlen(chunk->uri), &sample_uri));
+        }
+    }
+    if (create_secs == UINT64_MAX)
+        create_secs = 0;
+
+    __wt_lsm_tree_writeunlock(session, lsm_tree);
+    locked = false;
+
+    /*
+     * Split the merge into key ranges if configured, as long as each range has at least a chunk's
+     * worth of input. Every range combines at least two chunks, so repeated merges always shrink
+     * the tree rather than splitting the same data again. Custom data sources see the complete
+     * merge.
+     */
+    max_parts = WT_MIN(lsm_tree->merge_partitions, nchunks / 2);
+    if (lsm_tree->chunk_size != 0)
+        max_parts = (u_int)WT_MIN(max_parts, input_size / lsm_tree->chunk_size);
+    if (max_parts == 0 ||
+      (lsm_tree->custom_generation != 0 && generation >= lsm_tree->custom_generation))
+        max_parts = 1;
+    WT_ERR(__wt_calloc_def(session, max_parts, &parts));
+    WT_ERR(__wt_calloc_def(session, max_parts, &chunks));
+    nparts = max_parts;
+    if (nparts > 1)
+        WT_ERR(__lsm_merge_split(session, lsm_tree, sample_uri, parts, &nparts));
+
+    if (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_MERGED) &&
+      (FLD_ISSET(lsm_tree->bloom, WT_LSM_BLOOM_OLDEST) || start_chunk > 0) && record_count > 0)
+        create_bloom = true;
+
+    /* Allocate an ID for each of the new chunks. */
+    for (i = 0; i < nparts; i++) {
+        part = &parts[i];
+        part->lsm_tree = lsm_tree;
+        part->start_chunk = start_chunk;
+        part->nchunks = nchunks;
+        part->start_id = start_id;
+        part->create_bloom = create_bloom;
+        part->record_count = record_count / nparts + 1;
+
+        WT_ERR(__wt_calloc_one(session, &part->chunk));
+        part->chunk->id = __wt_atomic_add32(&lsm_tree->last, 1);
+        part->chunk->generation = generation;
+        part->chunk->create_secs = create_secs;
+        chunks[i] = part->chunk;
+    }
+
+    /*
+     * We only want to do the chunk loop if we're running with verbose, so we wrap these statements
+     * in the conditional. Avoid the loop in the normal path.
+     */
+    if (WT_VERBOSE_LEVEL_ISSET(session, WT_VERB_LSM, WT_VERBOSE_DEBUG_2)) {
+        __wt_verbose_debug2(session, WT_VERB_LSM,
+          "Merging %s chunks %u-%u into %u-%u (%" PRIu64 " records), generation %" PRIu32,
+          lsm_tree->name, start_chunk, end_chunk, chunks[0]->id, chunks[nparts - 1]->id,
+          record_count, generation);
+        for (verb = start_chunk; verb < end_chunk + 1; verb++)
+            __wt_verbose_debug2(session, WT_VERB_LSM,
+              "Merging %s: Chunk[%u] id %" PRIu32 ", gen: %" PRIu32 ", size: %" PRIu64
+              ", records: %" PRIu64,
+              lsm_tree->name, verb, lsm_tree->chunk[verb]->id, lsm_tree->chunk[verb]->generation,
+              lsm_tree->chunk[verb]->size, lsm_tree->chunk[verb]->count);
+    }
+
+    /*
+     * Start helper threads for all but the first key range, then merge the first range in this
+     * thread.
+     */
+    __wt_epoch(session, &start);
+    for (i = 1; i < nparts; i++) {
+        part = &parts[i];
+        WT_ERR(__wt_open_internal_session(conn, "lsm-merge", false, 0, 0, &part->session));
+        WT_ERR(__wt_thread_create(session, &part->tid, __lsm_merge_part_server, part));
+        part->tid_set = true;
+    }
+    parts[0].ret = __lsm_merge_part(session, &parts[0]);
+    for (i = 1; i < nparts; i++) {
+        part = &parts[i];
+        WT_TRET(__wt_thread_join(session, &part->tid));
+        part->tid_set = false;
+    }
+    for (i = 0; i < nparts; i++)
+        WT_TRET(parts[i].ret);
+    WT_ERR(ret);
+    __wt_epoch(session, &stop);
+
+    for (record_count = output_size = 0, i = 0; i < nparts; i++) {
+        record_count += parts[i].insert_count;
+        output_size += chunks[i]->size;
+    }
+    WT_LSM_TREE_STAT_INCR(session, lsm_tree->lsm_merge_count);
+    WT_LSM_TREE_STAT_INCRV(session, lsm_tree->lsm_merge_bytes_read, input_size);
+    WT_LSM_TREE_STAT_INCRV(session, lsm_tree->lsm_merge_bytes_written, output_size);
+    WT_LSM_TREE_STAT_INCRV(session, lsm_tree->lsm_merge_partitions, nparts);
+    WT_LSM_TREE_STAT_INCRV(session, lsm_tree->lsm_merge_rows, record_count);
+    WT_LSM_TREE_STAT_INCRV(session, lsm_tree->lsm_merge_time, WT_TIMEDIFF_MS(stop, start));
+
     __wt_lsm_tree_writelock(session, lsm_tree);
     locked = true;
 
@@ -527,12 +960,17 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
      * It is safe to error out here - since the update can only fail prior to making updates to the
      * tree.
      */
-    WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree, start_chunk, nchunks, chunk));
+    WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree, start_chunk, nchunks, chunks, nparts));
 
-    if (create_bloom)
-        F_SET(chunk, WT_LSM_CHUNK_BLOOM);
-    chunk->count = insert_count;
-    F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+    for (i = 0; i < nparts; i++) {
+        chunk = chunks[i];
+        if (create_bloom)
+            F_SET(chunk, WT_LSM_CHUNK_BLOOM);
+        chunk->count = parts[i].insert_count;
+        F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+    }
+    /* The chunks belong to the tree now. */
+    nparts = 0;
 
     /*
      * We have no current way of continuing if the metadata update fails, so we will panic in that
@@ -556,15 +994,17 @@ __wt_lsm_merge(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, u_int id)
 err:
     if (locked)
         __wt_lsm_tree_writeunlock(session, lsm_tree);
-    if (in_sync)
-        (void)__wt_atomic_sub32(&lsm_tree->merge_syncing, 1);
-    if (src != NULL)
-        WT_TRET(src->close(src));
-    if (dest != NULL)
-        WT_TRET(dest->close(dest));
-    if (bloom != NULL)
-        WT_TRET(__wt_bloom_close(bloom));
-    if (ret != 0 && created_chunk) {
+    for (i = 0; i < max_parts; i++) {
+        part = &parts[i];
+        if (part->tid_set)
+            WT_TRET(__wt_thread_join(session, &part->tid));
+        if (part->session != NULL)
+            WT_TRET(__wt_session_close_internal(part->session));
+        __wt_buf_free(session, &part->start);
+        __wt_buf_free(session, &part->stop);
+        if ((chunk = part->chunk) == NULL || i >= nparts)
+            continue;
+
         /* Drop the newly-created files on error. */
         if (chunk->uri != NULL) {
             WT_WITH_SCHEMA_LOCK(session, tret = __wt_schema_drop(session, chunk->uri, drop_cfg));
@@ -578,13 +1018,16 @@ err:
         __wt_free(session, chunk->bloom_uri);
         __wt_free(session, chunk->uri);
         __wt_free(session, chunk);
-
+    }
+    if (ret != 0 && ret != WT_NOTFOUND) {
         if (ret == EINTR)
             __wt_verbose(session, WT_VERB_LSM, "%s", "Merge aborted due to close");
         else
             __wt_verbose(
               session, WT_VERB_LSM, "Merge failed with %s", __wt_strerror(session, ret, NULL, 0));
     }
-    F_CLR(session, WT_SESSION_IGNORE_CACHE_SIZE | WT_SESSION_READ_WONT_NEED);
+    __wt_free(session, parts);
+    __wt_free(session, chunks);
+    __wt_free(session, sample_uri);
     return (ret);
 }
@@ -239,6 +239,20 @@ __lsm_meta_read_v1(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, const char *
     if (lsm_tree->merge_min > lsm_tree->merge_max)
         WT_ERR_MSG(session, EINVAL, "LSM merge_min must be less than or equal to merge_max");
 
+    WT_ERR(__wt_config_getones(session, lsmconf, "lsm.merge_partitions", &cv));
+    lsm_tree->merge_partitions = (u_int)cv.val;
+    WT_ERR(__wt_config_getones(session, lsmconf, "lsm.merge_strategy", &cv));
+    if (WT_STRING_MATCH("leveled", cv.str, cv.len))
+        lsm_tree->merge_strategy = WT_LSM_MERGE_LEVELED;
+    else if (WT_STRING_MATCH("size_tiered", cv.str, cv.len))
+        lsm_tree->merge_strategy = WT_LSM_MERGE_SIZE_TIERED;
+    else if (WT_STRING_MATCH("time_windowed", cv.str, cv.len))
+        lsm_tree->merge_strategy = WT_LSM_MERGE_TIME_WINDOWED;
+    else
+        lsm_tree->merge_strategy = WT_LSM_MERGE_GENERATIONAL;
+    WT_ERR(__wt_config_getones(session, lsmconf, "lsm.merge_time_window", &cv));
+    lsm_tree->merge_time_window = (uint64_t)cv.val;
+
     WT_ERR(__wt_config_getones(session, lsmconf, "last", &cv));
     lsm_tree->last = (u_int)cv.val;
     WT_ERR(__wt_config_getones(session, lsmconf, "chunks", &cv));
@@ -258,6 +272,8 @@ __lsm_meta_read_v1(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, const char *
             chunk->size = (uint64_t)lv.val;
         } else if (WT_STRING_MATCH("count", lk.str, lk.len)) {
             chunk->count = (uint64_t)lv.val;
+        } else if (WT_STRING_MATCH("created", lk.str, lk.len)) {
+            chunk->create_secs = (uint64_t)lv.val;
         } else if (WT_STRING_MATCH("generation", lk.str, lk.len)) {
             chunk->generation = (uint32_t)lv.val;
             /*
@@ -398,6 +414,11 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
      */
     if (lsm_tree->merge_min < 2)
         lsm_tree->merge_min = WT_MAX(2, lsm_tree->merge_max / 2);
+    /* Version 0 metadata predates partitioned and time-windowed merges. */
+    if (lsm_tree->merge_partitions == 0)
+        lsm_tree->merge_partitions = 1;
+    if (lsm_tree->merge_time_window == 0)
+        lsm_tree->merge_time_window = WT_LSM_MERGE_TIME_WINDOW_DEFAULT;
     /*
      * If needed, upgrade the configuration. We need to do this after we have fixed the merge_min
      * value.
@@ -439,6 +460,8 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, const char
             WT_ERR(__wt_buf_catfmt(session, buf, ",chunk_size=%" PRIu64, chunk->size));
         if (chunk->count != 0)
             WT_ERR(__wt_buf_catfmt(session, buf, ",count=%" PRIu64, chunk->count));
+        if (chunk->create_secs != 0)
+            WT_ERR(__wt_buf_catfmt(session, buf, ",created=%" PRIu64, chunk->create_secs));
     }
     WT_ERR(__wt_buf_catfmt(session, buf, "]"));
     WT_ERR(__wt_buf_catfmt(session, buf, ",old_chunks=["));
@@ -133,6 +133,36 @@ __curstat_lsm_init(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR_STAT *cs
     if (F_ISSET(cst, WT_STAT_CLEAR))
         lsm_tree->lsm_merge_throttle = 0;
 
+    /*
+     * Merge activity: write amplification counts the bytes written by flushes and merges for every
+     * hundred bytes flushed, throughput is the rate merges write their output.
+     */
+    WT_STAT_WRITE(session, stats, lsm_merge_bytes_flushed, lsm_tree->lsm_merge_bytes_flushed);
+    WT_STAT_WRITE(session, stats, lsm_merge_bytes_read, lsm_tree->lsm_merge_bytes_read);
+    WT_STAT_WRITE(session, stats, lsm_merge_bytes_written, lsm_tree->lsm_merge_bytes_written);
+    WT_STAT_WRITE(session, stats, lsm_merge_count, lsm_tree->lsm_merge_count);
+    WT_STAT_WRITE(session, stats, lsm_merge_partitions, lsm_tree->lsm_merge_partitions);
+    WT_STAT_WRITE(session, stats, lsm_merge_rows, lsm_tree->lsm_merge_rows);
+    WT_STAT_WRITE(session, stats, lsm_merge_time, lsm_tree->lsm_merge_time);
+    WT_STAT_WRITE(session, stats, lsm_merge_write_amplification,
+      lsm_tree->lsm_merge_bytes_flushed == 0 ?
+        0 :
+        (lsm_tree->lsm_merge_bytes_flushed + lsm_tree->lsm_merge_bytes_written) * 100 /
+          lsm_tree->lsm_merge_bytes_flushed);
+    WT_STAT_WRITE(session, stats, lsm_merge_throughput,
+      lsm_tree->lsm_merge_time == 0 ?
+        0 :
+        lsm_tree->lsm_merge_bytes_written * WT_THOUSAND / lsm_tree->lsm_merge_time);
+    if (F_ISSET(cst, WT_STAT_CLEAR)) {
+        lsm_tree->lsm_merge_bytes_flushed = 0;
+        lsm_tree->lsm_merge_bytes_read = 0;
+        lsm_tree->lsm_merge_bytes_written = 0;
+        lsm_tree->lsm_merge_count = 0;
+        lsm_tree->lsm_merge_partitions = 0;
+        lsm_tree->lsm_merge_rows = 0;
+        lsm_tree->lsm_merge_time = 0;
+    }
+
     __wt_curstat_dsrc_final(cst);
 
 err:
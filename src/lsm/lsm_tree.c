@@ -285,6 +285,9 @@ __wt_lsm_tree_setup_chunk(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LS
 {
     WT_ASSERT(session, FLD_ISSET(session->lock_flags, WT_SESSION_LOCKED_SCHEMA));
     __wt_epoch(session, &chunk->create_time);
+    /* Merges inherit the creation time of their oldest input. */
+    if (chunk->create_secs == 0)
+        chunk->create_secs = (uint64_t)chunk->create_time.tv_sec;
 
     WT_RET(__wt_spin_init(session, &chunk->timestamp_spinlock, "LSM chunk timestamp"));
     WT_RET(__wt_lsm_tree_chunk_name(session, lsm_tree, chunk->id, chunk->generation, &chunk->uri));
@@ -966,7 +969,7 @@ __wt_lsm_tree_truncate(WT_SESSION_IMPL *session, const char *name, const char *c
     WT_ERR(__wt_lsm_tree_setup_chunk(session, lsm_tree, chunk));
 
     /* Mark all chunks old. */
-    WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree, 0, lsm_tree->nchunks, chunk));
+    WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree, 0, lsm_tree->nchunks, &chunk, 1));
 
     WT_ERR(__wt_lsm_meta_write(session, lsm_tree, NULL));
 
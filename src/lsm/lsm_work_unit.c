@@ -423,6 +423,7 @@ __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LS
 
     /* Now the file is written, get the chunk size. */
     WT_ERR(__wt_lsm_tree_set_chunk_size(session, lsm_tree, chunk));
+    WT_LSM_TREE_STAT_INCRV(session, lsm_tree->lsm_merge_bytes_flushed, chunk->size);
 
     ++lsm_tree->chunks_flushed;
 
@@ -0,0 +1,199 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __capture_table_id --
+ *     Return the capture table ID of a data handle, allocating one and adding it to the capture map
+ *     file if necessary.
+ */
+static int
+__capture_table_id(
+  WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, const char *uri, uint32_t *idp)
+{
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(tmp);
+    WT_DECL_RET;
+    wt_off_t fsize;
+    uint32_t id;
+
+    conn = S2C(session);
+
+    WT_ORDERED_READ(id, dhandle->capture_id);
+    if (id != 0) {
+        *idp = id;
+        return (0);
+    }
+
+    WT_RET(__wt_scr_alloc(session, strlen(uri) + 32, &tmp));
+    __wt_spin_lock(session, &conn->capture_map_spinlock);
+    if ((id = dhandle->capture_id) == 0) {
+        id = conn->capture_table_next + 1;
+        WT_ERR(__wt_buf_fmt(session, tmp, "%" PRIu32 " %s\n", id, uri));
+        WT_ERR(__wt_filesize(session, conn->capture_map_fh, &fsize));
+        WT_ERR(__wt_write(session, conn->capture_map_fh, fsize, tmp->size, tmp->data));
+        conn->capture_table_next = id;
+        WT_PUBLISH(dhandle->capture_id, id);
+    }
+    *idp = id;
+
+err:
+    __wt_spin_unlock(session, &conn->capture_map_spinlock);
+    __wt_scr_free(session, &tmp);
+    return (ret);
+}
+
+/*
+ * __capture_open_file --
+ *     Open the session's capture file. Sessions reuse the file of an earlier session with the same
+ *     ID, appending their records; a file written by an earlier connection in this process is
+ *     overwritten.
+ */
+static int
+__capture_open_file(WT_SESSION_IMPL *session)
+{
+    WT_CAPTURE_HEADER header;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(buf);
+    WT_DECL_RET;
+    wt_off_t fsize;
+
+    conn = S2C(session);
+
+    WT_RET(__wt_scr_alloc(session, 0, &buf));
+    WT_ERR(__wt_filename_construct(
+      session, conn->capture_path, "capture", __wt_process_id(), session->id, buf));
+    WT_ERR(__wt_open(session, (const char *)buf->data, WT_FS_OPEN_FILE_TYPE_REGULAR,
+      WT_FS_OPEN_CREATE, &session->capture_fh));
+
+    WT_ERR(__wt_filesize(session, session->capture_fh, &fsize));
+    if (fsize != 0) {
+        WT_CLEAR(header);
+        if (fsize >= (wt_off_t)sizeof(header))
+            WT_ERR(__wt_read(session, session->capture_fh, 0, sizeof(header), &header));
+        if (header.epoch_nsec != conn->capture_epoch_nsec) {
+            WT_ERR(__wt_ftruncate(session, session->capture_fh, 0));
+            fsize = 0;
+        }
+    }
+    if (fsize == 0) {
+        WT_CLEAR(header);
+        header.version = WT_CAPTURE_VERSION;
+        header.session_id = session->id;
+        header.epoch_nsec = conn->capture_epoch_nsec;
+        WT_ERR(__wt_write(session, session->capture_fh, 0, sizeof(header), &header));
+        fsize = (wt_off_t)sizeof(header);
+    }
+    session->capture_offset = fsize;
+
+    if (0) {
+err:
+        WT_TRET(__wt_close(session, &session->capture_fh));
+    }
+    __wt_scr_free(session, &buf);
+    return (ret);
+}
+
+/*
+ * __capture_flush --
+ *     Append the session's buffered records to its capture file.
+ */
+static int
+__capture_flush(WT_SESSION_IMPL *session)
+{
+    size_t len;
+
+    if (session->capture_cnt == 0)
+        return (0);
+    if (session->capture_fh == NULL)
+        WT_RET(__capture_open_file(session));
+
+    len = session->capture_cnt * sizeof(WT_CAPTURE_RECORD);
+    WT_RET(__wt_write(session, session->capture_fh, session->capture_offset, len,
+      session->capture_buf));
+    session->capture_offset += (wt_off_t)len;
+    session->capture_cnt = 0;
+    return (0);
+}
+
+/*
+ * __wt_capture_begin --
+ *     Start capturing a btree cursor operation: record the start time and the key and value sizes.
+ */
+void
+__wt_capture_begin(WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_CAPTURE_RECORD *rec)
+{
+    WT_CLEAR(*rec);
+    if (WT_CURSOR_RECNO(cursor))
+        rec->key_hash = cursor->recno;
+    else if (F_ISSET(cursor, WT_CURSTD_KEY_SET)) {
+        rec->key_hash = __wt_hash_city64(cursor->key.data, cursor->key.size);
+        rec->key_size = (uint32_t)cursor->key.size;
+    }
+    if (F_ISSET(cursor, WT_CURSTD_VALUE_SET))
+        rec->value_size = (uint32_t)cursor->value.size;
+    rec->timestamp = __wt_clock(session);
+}
+
+/*
+ * __wt_capture_end --
+ *     Finish capturing a btree cursor operation and add it to the session's buffer. Capture is best
+ *     effort, records that can't be written are discarded.
+ */
+void
+__wt_capture_end(
+  WT_SESSION_IMPL *session, WT_CURSOR *cursor, WT_CAPTURE_RECORD *rec, uint8_t type, int ret)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint64_t now;
+
+    conn = S2C(session);
+
+    now = __wt_clock(session);
+    rec->duration = (uint32_t)WT_MIN(WT_CLOCKDIFF_NS(now, rec->timestamp), UINT32_MAX);
+    rec->timestamp = WT_CLOCKDIFF_NS(rec->timestamp, conn->capture_start);
+    rec->op = type;
+    rec->ret = ret;
+
+    /* Appends allocate the record number. */
+    if (ret == 0 && type == WT_CAPTURE_INSERT && WT_CURSOR_RECNO(cursor))
+        rec->key_hash = cursor->recno;
+
+    /* Searches and modifications return the value, capture its size. */
+    if (ret == 0 &&
+      (type == WT_CAPTURE_MODIFY || type == WT_CAPTURE_SEARCH || type == WT_CAPTURE_SEARCH_NEAR))
+        rec->value_size = (uint32_t)cursor->value.size;
+
+    if (__capture_table_id(session, ((WT_CURSOR_BTREE *)cursor)->dhandle, cursor->uri,
+          &rec->table) != 0)
+        return;
+
+    if (session->capture_buf == NULL &&
+      __wt_calloc_def(session, WT_CAPTURE_MAXRECS, &session->capture_buf) != 0)
+        return;
+    session->capture_buf[session->capture_cnt++] = *rec;
+    if (session->capture_cnt == WT_CAPTURE_MAXRECS && __capture_flush(session) != 0)
+        session->capture_cnt = 0;
+}
+
+/*
+ * __wt_capture_session_close --
+ *     Write the session's remaining records and release its capture resources.
+ */
+int
+__wt_capture_session_close(WT_SESSION_IMPL *session)
+{
+    WT_DECL_RET;
+
+    ret = __capture_flush(session);
+    WT_TRET(__wt_close(session, &session->capture_fh));
+    __wt_free(session, session->capture_buf);
+    session->capture_cnt = 0;
+    return (ret);
+}
@@ -0,0 +1,285 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/* Event type names, the first entries in the name table. */
+static const char *const __event_trace_types[] = {
+  "api", "checkpoint", "evict", "log-write", "page-read", "reconcile", "trigger"};
+
+/*
+ * __event_trace_alloc --
+ *     Allocate the session's event buffer.
+ */
+static int
+__event_trace_alloc(WT_SESSION_IMPL *session)
+{
+    WT_EVENT_TRACE_RECORD *buf;
+    uint64_t entries;
+
+    entries = S2C(session)->event_trace_records;
+    WT_RET(__wt_calloc_def(session, entries, &buf));
+
+    /* Threads writing trace files read the buffer and then its size. */
+    session->trace_entries = entries;
+    session->trace_next = 0;
+    WT_PUBLISH(session->trace_buf, buf);
+    return (0);
+}
+
+/*
+ * __event_trace_record --
+ *     Add a record to the session's event buffer.
+ */
+static void
+__event_trace_record(WT_SESSION_IMPL *session, uint64_t timestamp, uint16_t type, uint8_t phase,
+  const char *name, uint64_t arg)
+{
+    WT_EVENT_TRACE_RECORD *rec;
+    uint64_t next;
+
+    if (session->trace_buf == NULL && __event_trace_alloc(session) != 0)
+        return;
+
+    next = session->trace_next;
+    rec = &session->trace_buf[next & (session->trace_entries - 1)];
+    rec->timestamp = timestamp;
+    rec->name = name;
+    rec->arg = arg;
+    rec->type = type;
+    rec->phase = phase;
+
+    /* Publish the record after it's written, readers discard records that may be overwritten. */
+    WT_PUBLISH(session->trace_next, next + 1);
+}
+
+/*
+ * __wt_event_trace_record --
+ *     Record an event.
+ */
+void
+__wt_event_trace_record(
+  WT_SESSION_IMPL *session, uint16_t type, uint8_t phase, const char *name, uint64_t arg)
+{
+    __event_trace_record(session, __wt_clock(session), type, phase, name, arg);
+}
+
+/*
+ * __wt_event_trace_api_begin --
+ *     Record the start of an outermost API call.
+ */
+void
+__wt_event_trace_api_begin(WT_SESSION_IMPL *session)
+{
+    session->trace_api_start = __wt_clock(session);
+    __event_trace_record(session, session->trace_api_start, WT_EVENT_TRACE_API,
+      WT_EVENT_TRACE_BEGIN, session->name, 0);
+}
+
+/*
+ * __wt_event_trace_api_end --
+ *     Record the end of an outermost API call, and write a trace file if the call was slow.
+ */
+void
+__wt_event_trace_api_end(WT_SESSION_IMPL *session, int error)
+{
+    WT_CONNECTION_IMPL *conn;
+    uint64_t elapsed, last, now, secs, start;
+
+    conn = S2C(session);
+
+    now = __wt_clock(session);
+    __event_trace_record(session, now, WT_EVENT_TRACE_API, WT_EVENT_TRACE_END, session->name,
+      (uint64_t)(int64_t)error);
+
+    /*
+     * The start time isn't set if tracing was enabled during the call, and only application calls
+     * trigger writing a trace file.
+     */
+    start = session->trace_api_start;
+    session->trace_api_start = 0;
+    if (conn->event_trace_threshold == 0 || start == 0 || F_ISSET(session, WT_SESSION_INTERNAL))
+        return;
+    elapsed = WT_CLOCKDIFF_NS(now, start);
+    if (elapsed < conn->event_trace_threshold)
+        return;
+
+    /* Write at most one trace file a second, the thread that claims the second writes the file. */
+    __wt_seconds(session, &secs);
+    WT_ORDERED_READ(last, conn->event_trace_last_dump);
+    if (secs <= last || !__wt_atomic_cas64(&conn->event_trace_last_dump, last, secs))
+        return;
+
+    __event_trace_record(
+      session, now, WT_EVENT_TRACE_TRIGGER, WT_EVENT_TRACE_INSTANT, session->name, elapsed);
+    WT_IGNORE_RET(__wt_event_trace_dump(session));
+}
+
+/*
+ * __event_trace_name --
+ *     Return the name table index of a record's name, adding the name to the table if necessary.
+ */
+static int
+__event_trace_name(WT_SESSION_IMPL *session, WT_EVENT_TRACE_RECORD *rec, const char ***namesp,
+  size_t *names_allocp, uint32_t *namecntp, uint32_t *idxp)
+{
+    uint32_t i;
+
+    if (rec->name == NULL) {
+        *idxp = rec->type;
+        return (0);
+    }
+    for (i = 0; i < *namecntp; ++i)
+        if ((*namesp)[i] == rec->name) {
+            *idxp = i + WT_EVENT_TRACE_TYPES;
+            return (0);
+        }
+
+    WT_RET(__wt_realloc_def(session, names_allocp, *namecntp + 1, namesp));
+    (*namesp)[*namecntp] = rec->name;
+    *idxp = (*namecntp)++ + WT_EVENT_TRACE_TYPES;
+    return (0);
+}
+
+/*
+ * __event_trace_write_name --
+ *     Append a name to the name table.
+ */
+static int
+__event_trace_write_name(WT_SESSION_IMPL *session, WT_ITEM *buf, const char *name)
+{
+    uint32_t len;
+
+    len = (uint32_t)strlen(name);
+    WT_RET(__wt_buf_grow(session, buf, buf->size + sizeof(len) + len));
+    memcpy((uint8_t *)buf->mem + buf->size, &len, sizeof(len));
+    memcpy((uint8_t *)buf->mem + buf->size + sizeof(len), name, len);
+    buf->size += sizeof(len) + len;
+    return (0);
+}
+
+/*
+ * __wt_event_trace_dump --
+ *     Write the sessions' event buffers to a trace file.
+ */
+int
+__wt_event_trace_dump(WT_SESSION_IMPL *session)
+{
+    struct timespec ts;
+    WT_CONNECTION_IMPL *conn;
+    WT_DECL_ITEM(buf);
+    WT_DECL_ITEM(copy);
+    WT_DECL_ITEM(fname);
+    WT_DECL_RET;
+    WT_EVENT_TRACE_FILE_RECORD *frec;
+    WT_EVENT_TRACE_HEADER header;
+    WT_EVENT_TRACE_RECORD *rec, *tbuf;
+    WT_EVENT_TRACE_SESSION tsession;
+    WT_FH *fh;
+    WT_SESSION_IMPL *s;
+    wt_off_t offset;
+    size_t names_alloc;
+    uint64_t entries, i, next, start;
+    uint32_t idx, namecnt, session_cnt, sessions;
+    const char **names;
+
+    conn = S2C(session);
+    fh = NULL;
+    names = NULL;
+    names_alloc = 0;
+    namecnt = sessions = 0;
+
+    WT_RET(__wt_scr_alloc(session, 0, &fname));
+    WT_ERR(__wt_scr_alloc(session, 0, &buf));
+    WT_ERR(__wt_scr_alloc(session, 0, &copy));
+
+    WT_ERR(__wt_filename_construct(session, conn->event_trace_path, "event-trace",
+      __wt_process_id(), __wt_atomic_add32(&conn->event_trace_dump_id, 1), fname));
+    WT_ERR(__wt_open(session, (const char *)fname->data, WT_FS_OPEN_FILE_TYPE_REGULAR,
+      WT_FS_OPEN_CREATE, &fh));
+
+    /* The header is written last, once the counts are known. */
+    offset = (wt_off_t)sizeof(header);
+
+    WT_ORDERED_READ(session_cnt, conn->session_cnt);
+    for (s = conn->sessions; s < conn->sessions + session_cnt; ++s) {
+        /* Read the buffer before its size, the buffer is published after the size is set. */
+        WT_ORDERED_READ(tbuf, s->trace_buf);
+        if (tbuf == NULL)
+            continue;
+        entries = s->trace_entries;
+
+        /*
+         * Copy the buffer, then discard records the session may have overwritten during the copy:
+         * records are only valid if they were published before the copy and not overwritten by
+         * records published during the copy, or the one being written when the copy finished.
+         */
+        WT_ORDERED_READ(next, s->trace_next);
+        WT_ERR(__wt_buf_init(session, copy, entries * sizeof(WT_EVENT_TRACE_RECORD)));
+        memcpy(copy->mem, tbuf, entries * sizeof(WT_EVENT_TRACE_RECORD));
+        WT_READ_BARRIER();
+        start = next > entries ? next - entries : 0;
+        if (s->trace_next + 1 > start + entries)
+            start = s->trace_next + 1 - entries;
+        if (start >= next)
+            continue;
+
+        tsession.id = s->id;
+        tsession.internal = F_ISSET(s, WT_SESSION_INTERNAL) ? 1 : 0;
+        tsession.records = next - start;
+        WT_ERR(__wt_buf_init(
+          session, buf, sizeof(tsession) + tsession.records * sizeof(WT_EVENT_TRACE_FILE_RECORD)));
+        memcpy(buf->mem, &tsession, sizeof(tsession));
+        frec = (WT_EVENT_TRACE_FILE_RECORD *)((uint8_t *)buf->mem + sizeof(tsession));
+        for (i = start; i < next; ++i, ++frec) {
+            rec = (WT_EVENT_TRACE_RECORD *)copy->mem + (i & (entries - 1));
+            WT_ERR(__event_trace_name(session, rec, &names, &names_alloc, &namecnt, &idx));
+            WT_CLEAR(*frec);
+            frec->timestamp = rec->timestamp;
+            frec->arg = rec->arg;
+            frec->name = idx;
+            frec->type = rec->type;
+            frec->phase = rec->phase;
+        }
+        buf->size = sizeof(tsession) + tsession.records * sizeof(WT_EVENT_TRACE_FILE_RECORD);
+        WT_ERR(__wt_write(session, fh, offset, buf->size, buf->data));
+        offset += (wt_off_t)buf->size;
+        ++sessions;
+    }
+
+    /* Write the name table: the event types, then the API call names. */
+    buf->size = 0;
+    for (idx = 0; idx < WT_EVENT_TRACE_TYPES; ++idx)
+        WT_ERR(__event_trace_write_name(session, buf, __event_trace_types[idx]));
+    for (idx = 0; idx < namecnt; ++idx)
+        WT_ERR(__event_trace_write_name(session, buf, names[idx]));
+    WT_ERR(__wt_write(session, fh, offset, buf->size, buf->data));
+
+    /* Record the clock so the reader can convert clock ticks to wall clock times. */
+    WT_CLEAR(header);
+    header.version = WT_EVENT_TRACE_VERSION;
+    header.tsc_nsec_ratio = (uint32_t)(__wt_process.tsc_nsec_ratio * WT_THOUSAND);
+    __wt_epoch(session, &ts);
+    header.epoch_ticks = __wt_clock(session);
+    header.epoch_nsec = (uint64_t)ts.tv_sec * WT_BILLION + (uint64_t)ts.tv_nsec;
+    header.names_offset = (uint64_t)offset;
+    header.names = namecnt + WT_EVENT_TRACE_TYPES;
+    header.sessions = sessions;
+    WT_ERR(__wt_write(session, fh, 0, sizeof(header), &header));
+
+    __wt_verbose(session, WT_VERB_DEFAULT, "wrote event trace file %s: %" PRIu32 " sessions",
+      (const char *)fname->data, sessions);
+
+err:
+    WT_TRET(__wt_close(session, &fh));
+    __wt_free(session, names);
+    __wt_scr_free(session, &copy);
+    __wt_scr_free(session, &buf);
+    __wt_scr_free(session, &fname);
+    return (ret);
+}
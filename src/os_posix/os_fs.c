@@ -28,6 +28,11 @@
 
 #include "wt_internal.h"
 
+#if defined(__linux__)
+#include <linux/magic.h>
+#include <sys/vfs.h>
+#endif
+
 /*
  * __posix_sync --
  *     Underlying support function to flush a file descriptor. Fsync calls (or fsync-style calls,
@@ -334,6 +339,38 @@ __posix_file_advise(
 }
 #endif
 
+#if defined(O_DIRECT) && defined(__linux__)
+/*
+ * __posix_direct_read_check --
+ *     Check a file is on a filesystem where direct I/O reads can be mixed with buffered writes.
+ */
+static int
+__posix_direct_read_check(WT_SESSION_IMPL *session, int fd, const char *name)
+{
+    struct statfs sb;
+    WT_DECL_RET;
+
+    WT_SYSCALL(fstatfs(fd, &sb), ret);
+    if (ret != 0)
+        WT_RET_MSG(session, ret, "%s: handle-open: fstatfs", name);
+
+    /*
+     * A direct I/O read of a range with dirty pages in the system buffer cache is only guaranteed
+     * to see the buffered writes if the filesystem writes the range back first. The ext2/3/4 and
+     * XFS filesystems do, other filesystems may return stale data.
+     */
+    switch (sb.f_type) {
+    case EXT4_SUPER_MAGIC:
+    case XFS_SUPER_MAGIC:
+        return (0);
+    default:
+        break;
+    }
+    WT_RET_MSG(session, ENOTSUP,
+      "%s: handle-open: direct I/O reads are only supported on ext4 and XFS filesystems", name);
+}
+#endif
+
 /*
  * __posix_file_close --
  *     ANSI C close.
@@ -344,6 +381,7 @@ __posix_file_close(WT_FILE_HANDLE *file_handle, WT_SESSION *wt_session)
     WT_DECL_RET;
     WT_FILE_HANDLE_POSIX *pfh;
     WT_SESSION_IMPL *session;
+    int tret;
 
     session = (WT_SESSION_IMPL *)wt_session;
     pfh = (WT_FILE_HANDLE_POSIX *)file_handle;
@@ -353,12 +391,19 @@ __posix_file_close(WT_FILE_HANDLE *file_handle, WT_SESSION *wt_session)
     if (pfh->mmap_file_mappable && pfh->mmap_buf != NULL)
         __wt_unmap_file(file_handle, wt_session);
 
-    /* Close the file handle. */
+    /* Close the file handles. */
     if (pfh->fd != -1) {
         WT_SYSCALL(close(pfh->fd), ret);
         if (ret != 0)
             __wt_err(session, ret, "%s: handle-close: close", file_handle->name);
     }
+    if (pfh->fd_direct != -1) {
+        WT_SYSCALL(close(pfh->fd_direct), tret);
+        if (tret != 0) {
+            __wt_err(session, tret, "%s: handle-close: close", file_handle->name);
+            WT_TRET(tret);
+        }
+    }
 
     __wt_free(session, file_handle->name);
     __wt_free(session, pfh);
@@ -409,15 +454,30 @@ __posix_file_read(
     WT_DECL_RET;
     WT_FILE_HANDLE_POSIX *pfh;
     WT_SESSION_IMPL *session;
-    size_t chunk;
+    size_t align, chunk, direct_len;
     ssize_t nr;
     uint8_t *addr;
+    int fd;
 
     session = (WT_SESSION_IMPL *)wt_session;
     pfh = (WT_FILE_HANDLE_POSIX *)file_handle;
+    direct_len = 0;
+
+    /*
+     * If data file reads are configured for direct I/O, aligned reads bypass the system buffer
+     * cache and land directly in the caller's buffer. Anything else is read through the system
+     * buffer cache.
+     */
+    fd = pfh->fd;
+    align = S2C(session)->buffer_alignment;
+    if (pfh->fd_direct != -1 && align != 0 && !((uintptr_t)buf & (uintptr_t)(align - 1)) &&
+      offset % (wt_off_t)align == 0 && len % align == 0) {
+        fd = pfh->fd_direct;
+        direct_len = len;
+    }
 
     __wt_verbose_debug2(session, WT_VERB_READ,
-      "read: %s, fd=%d, offset=%" PRId64 ", len=%" WT_SIZET_FMT, file_handle->name, pfh->fd, offset,
+      "read: %s, fd=%d, offset=%" PRId64 ", len=%" WT_SIZET_FMT, file_handle->name, fd, offset,
       len);
 
     /* Assert direct I/O is aligned and a multiple of the alignment. */
@@ -434,12 +494,13 @@ __posix_file_read(
          * The WT_SYSCALL_RETRY macro expects 0 for success. pread returns > 0 when successful,
          * adjust the return value.
          */
-        WT_SYSCALL_RETRY((nr = pread(pfh->fd, addr, chunk, offset)) <= 0 ? -1 : 0, ret);
+        WT_SYSCALL_RETRY((nr = pread(fd, addr, chunk, offset)) <= 0 ? -1 : 0, ret);
         if (ret != 0)
             WT_RET_MSG(session, nr == 0 ? WT_ERROR : ret,
               "%s: handle-read: pread: failed to read %" WT_SIZET_FMT " bytes at offset %" PRIuMAX,
               file_handle->name, chunk, (uintmax_t)offset);
     }
+    WT_STAT_CONN_INCRV(session, block_byte_read_direct, direct_len);
     WT_STAT_CONN_INCRV(session, block_byte_read_syscall, len);
     return (0);
 }
@@ -747,7 +808,7 @@ __posix_open_file(WT_FILE_SYSTEM *file_system, WT_SESSION *wt_session, const cha
     WT_RET(__wt_calloc_one(session, &pfh));
 
     /* Set up error handling. */
-    pfh->fd = -1;
+    pfh->fd = pfh->fd_direct = -1;
 
     if (file_type == WT_FS_OPEN_FILE_TYPE_DIRECTORY) {
         f = O_RDONLY;
@@ -831,6 +892,28 @@ __posix_open_file(WT_FILE_SYSTEM *file_system, WT_SESSION *wt_session, const cha
 
     WT_ERR(__posix_open_file_cloexec(session, pfh->fd, name));
 
+#ifdef O_DIRECT
+    /*
+     * If data file reads are configured for direct I/O, open a second, read-only handle with
+     * O_DIRECT for reads, writes continue to go through the system buffer cache. There's no access
+     * pattern hint for the handle, the kernel cache isn't interesting.
+     */
+    if (!pfh->direct_io && file_type == WT_FS_OPEN_FILE_TYPE_DATA &&
+      FLD_ISSET(conn->direct_io, WT_DIRECT_IO_READ)) {
+#ifdef __linux__
+        WT_ERR(__posix_direct_read_check(session, pfh->fd, name));
+#endif
+        f = (f & ~(O_ACCMODE | O_CREAT | O_EXCL)) | O_RDONLY | O_DIRECT;
+        WT_SYSCALL_RETRY(((pfh->fd_direct = open(name, f, 0)) == -1 ? -1 : 0), ret);
+        if (ret != 0)
+            WT_ERR_MSG(session, ret,
+              "%s: handle-open: open: failed with direct I/O configured for reads, some filesystem "
+              "types do not support direct I/O",
+              name);
+        WT_ERR(__posix_open_file_cloexec(session, pfh->fd_direct, name));
+    }
+#endif
+
 #if defined(HAVE_POSIX_FADVISE)
     /*
      * If the user set an access pattern hint, call fadvise now. Ignore fadvise when doing direct
@@ -31,7 +31,7 @@ __wt_posix_map(WT_FILE_HANDLE *fh, WT_SESSION *wt_session, void **mapped_regionp
      * Mapping isn't possible if direct I/O configured for the file, the Linux open(2) documentation
      * says applications should avoid mixing mmap(2) of files with direct I/O to the same files.
      */
-    if (pfh->direct_io)
+    if (pfh->direct_io || pfh->fd_direct != -1)
         return (__wt_set_return(session, ENOTSUP));
 
     /*
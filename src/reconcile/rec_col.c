@@ -56,14 +56,18 @@ __wt_bulk_insert_fix(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk, bool delet
     WT_CURSOR *cursor;
     WT_RECONCILE *r;
     WT_TIME_WINDOW tw;
+    uint64_t v;
 
     r = cbulk->reconcile;
     btree = S2BT(session);
     cursor = &cbulk->cbt.iface;
 
+    v = 0;
+    if (!deleted)
+        WT_RET(__col_fix_value_unpack(session, btree, cursor->value.data, cursor->value.size, &v));
+
     WT_RET(__rec_col_fix_bulk_insert_split_check(cbulk));
-    __bit_setv(
-      r->first_free, cbulk->entry, btree->bitcnt, deleted ? 0 : ((uint8_t *)cursor->value.data)[0]);
+    __bit_setv(r->first_free, cbulk->entry, btree->bitcnt, v);
     ++cbulk->entry;
     ++r->recno;
 
@@ -97,7 +101,16 @@ __wt_bulk_insert_fix_bitmap(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
 
     if (((r->recno - 1) * btree->bitcnt) & 0x7)
         WT_RET_MSG(session, EINVAL, "Bulk bitmap load not aligned on a byte boundary");
-    for (data = cursor->value.data, entries = (uint32_t)cursor->value.size; entries > 0;
+
+    /* Bitmaps of 32 and 64-bit values are arrays of little-endian integers. */
+    entries = (uint32_t)cursor->value.size;
+    if (btree->bitcnt > 8) {
+        if (cursor->value.size % (btree->bitcnt / 8) != 0)
+            WT_RET_MSG(session, EINVAL,
+              "Bulk bitmap load not a whole number of %" PRIu8 "-bit values", btree->bitcnt);
+        entries /= btree->bitcnt / 8;
+    }
+    for (data = cursor->value.data; entries > 0;
          entries -= page_entries, data += page_size) {
         WT_RET(__rec_col_fix_bulk_insert_split_check(cbulk));
 
@@ -470,9 +483,9 @@ __wt_rec_col_fix(
     WT_PAGE *page;
     WT_UPDATE *upd;
     WT_UPDATE_SELECT upd_select;
-    uint64_t curstartrecno, i, rawbitmapsize, origstartrecno, recno;
+    uint64_t curstartrecno, i, rawbitmapsize, origstartrecno, recno, val;
     uint32_t auxspace, bitmapsize, entry, maxrecs, nrecs, numtws, tw;
-    uint8_t val;
+    uint8_t valbuf[WT_INTPACK64_MAXSIZE];
 
     btree = S2BT(session);
     /*
@@ -749,8 +762,8 @@ __wt_rec_col_fix(
          */
         WT_ASSERT(session, page->dsk != NULL && origstartrecno != WT_RECNO_OOB);
         val = __bit_getv(page->pg_fix_bitf, recno - origstartrecno, btree->bitcnt);
-        unpack.data = &val;
-        unpack.size = 1;
+        unpack.size = (uint32_t)__col_fix_value_pack(btree, val, valbuf);
+        unpack.data = valbuf;
 
         WT_ERR(__wt_rec_upd_select(session, r, ins, NULL, &unpack, &upd_select));
         upd = upd_select.upd;
@@ -773,7 +786,7 @@ __wt_rec_col_fix(
         } else {
             /* MODIFY is not allowed in FLCS. */
             WT_ASSERT(session, upd->type == WT_UPDATE_STANDARD);
-            val = *upd->data;
+            WT_ERR(__col_fix_value_unpack(session, btree, upd->data, upd->size, &val));
 
             /* Write the time window. */
             if (!WT_TIME_WINDOW_IS_EMPTY(&upd_select.tw)) {
@@ -915,7 +928,7 @@ __wt_rec_col_fix(
                 else {
                     /* MODIFY is not allowed in FLCS, so the update must be an ordinary value. */
                     WT_ASSERT(session, upd->type == WT_UPDATE_STANDARD);
-                    val = *upd->data;
+                    WT_ERR(__col_fix_value_unpack(session, btree, upd->data, upd->size, &val));
 
                     if (!WT_TIME_WINDOW_IS_EMPTY(&upd_select.tw))
                         WT_ERR(__wt_rec_col_fix_addtw(session, r, entry, &upd_select.tw));
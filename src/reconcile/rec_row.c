@@ -488,6 +488,56 @@ __rec_row_zero_len(WT_SESSION_IMPL *session, WT_TIME_WINDOW *tw)
         __wt_txn_tw_start_visible_all(session, tw)));
 }
 
+/*
+ * __rec_row_ttl_expired --
+ *     Return if a row-store value's time-to-live expired before every reader's timestamp, in which
+ *     case the key is removed from the page.
+ */
+static int
+__rec_row_ttl_expired(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_UPDATE_SELECT *upd_select,
+  WT_UPDATE *upd, WT_CELL_UNPACK_KV *vpack, size_t key_size, bool *expiredp)
+{
+    WT_BTREE *btree;
+    WT_ITEM value, *valuep;
+    WT_TIME_WINDOW *tw;
+    wt_timestamp_t expiry;
+
+    btree = S2BT(session);
+    tw = upd == NULL ? &vpack->tw : &upd_select->tw;
+    *expiredp = false;
+
+    /*
+     * Only values visible to every reader and without a stop time point can expire. Keys with saved
+     * updates have newer or older versions that must be kept with the key.
+     */
+    if (upd_select->upd_saved || tw->prepare || WT_TIME_WINDOW_HAS_STOP(tw) ||
+      !WT_REC_TW_START_VISIBLE_ALL(r, tw))
+        return (0);
+
+    /* The expiry value field is only decoded from complete, on-page values. */
+    WT_CLEAR(value);
+    valuep = NULL;
+    if (upd != NULL) {
+        value.data = upd->data;
+        value.size = upd->size;
+        if (upd->type == WT_UPDATE_STANDARD)
+            valuep = &value;
+    } else {
+        value.data = vpack->data;
+        value.size = vpack->size;
+        if (!F_ISSET(vpack, WT_CELL_UNPACK_OVERFLOW) && btree->huffman_value == NULL)
+            valuep = &value;
+    }
+    WT_RET(__wt_ttl_expiry(session, tw->start_ts, valuep, &expiry));
+    if (expiry > r->rec_start_pinned_ts)
+        return (0);
+
+    *expiredp = true;
+    WT_STAT_CONN_DATA_INCR(session, rec_time_to_live_expired);
+    WT_STAT_CONN_DATA_INCRV(session, rec_time_to_live_bytes, key_size + value.size);
+    return (0);
+}
+
 /*
  * __rec_row_leaf_insert --
  *     Walk an insert chain, writing K/V pairs.
@@ -503,7 +553,7 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_INSERT *ins)
     WT_TIME_WINDOW tw;
     WT_UPDATE *upd;
     WT_UPDATE_SELECT upd_select;
-    bool ovfl_key;
+    bool expired, ovfl_key;
 
     btree = S2BT(session);
 
@@ -554,6 +604,14 @@ __rec_row_leaf_insert(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_INSERT *ins)
           F_ISSET(upd, WT_UPDATE_DS) || !F_ISSET(r, WT_REC_HS) ||
             __wt_txn_tw_start_visible_all(session, &upd_select.tw));
 
+        /* Skip keys whose time-to-live expired before every reader's timestamp. */
+        if (WT_BTREE_TTL(btree) && upd->type != WT_UPDATE_TOMBSTONE) {
+            WT_ERR(__rec_row_ttl_expired(
+              session, r, &upd_select, upd, NULL, WT_INSERT_KEY_SIZE(ins), &expired));
+            if (expired)
+                continue;
+        }
+
         WT_TIME_WINDOW_COPY(&tw, &upd_select.tw);
 
         switch (upd->type) {
@@ -695,7 +753,7 @@ __wt_rec_row_leaf(
     uint64_t slvg_skip;
     uint32_t i;
     uint8_t key_prefix;
-    bool dictionary, key_onpage_ovfl, ovfl_key;
+    bool dictionary, expired, key_onpage_ovfl, ovfl_key;
     void *copy;
     const void *key_data;
 
@@ -781,6 +839,13 @@ __wt_rec_row_leaf(
         if (upd == NULL && __wt_txn_tw_stop_visible_all(session, twp))
             upd = &upd_tombstone;
 
+        /* Skip keys whose time-to-live expired before every reader's timestamp. */
+        if (WT_BTREE_TTL(btree) && (upd == NULL || upd->type != WT_UPDATE_TOMBSTONE)) {
+            WT_ERR(__rec_row_ttl_expired(session, r, &upd_select, upd, vpack, key_size, &expired));
+            if (expired)
+                upd = &upd_tombstone;
+        }
+
         /* Build value cell. */
         if (upd == NULL) {
             /* Clear the on-disk cell time window if it is obsolete. */
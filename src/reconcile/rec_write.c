@@ -40,6 +40,7 @@ __wt_reconcile(WT_SESSION_IMPL *session, WT_REF *ref, WT_SALVAGE_COOKIE *salvage
     page = ref->page;
 
     session->reconcile_timeline.reconcile_start = __wt_clock(session);
+    WT_EVENT_TRACE_BEGIN_OP(session, WT_EVENT_TRACE_RECONCILE);
 
     __wt_verbose(session, WT_VERB_RECONCILE, "%p reconcile %s (%s%s)", (void *)ref,
       __wt_page_type_string(page->type), LF_ISSET(WT_REC_EVICT) ? "evict" : "checkpoint",
@@ -127,6 +128,7 @@ err:
         conn->rec_maximum_seconds = WT_CLOCKDIFF_SEC(session->reconcile_timeline.reconcile_finish,
           session->reconcile_timeline.reconcile_start);
 
+    WT_EVENT_TRACE_END_OP(session, WT_EVENT_TRACE_RECONCILE, ret);
     return (ret);
 }
 
@@ -1412,6 +1414,36 @@ __rec_split_fix_shrink(WT_SESSION_IMPL *session, WT_RECONCILE *r)
 /* The minimum number of entries before we'll split a row-store internal page. */
 #define WT_PAGE_INTL_MINIMUM_ENTRIES 20
 
+/*
+ * __rec_split_bulk_resize --
+ *     Reset a bulk load's page and split sizes to the tree's current pre-compression page size.
+ */
+static int
+__rec_split_bulk_resize(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+    WT_BM *bm;
+    WT_BTREE *btree;
+    size_t corrected_page_size;
+    uint64_t page_size;
+
+    btree = S2BT(session);
+    bm = btree->bm;
+
+    WT_ORDERED_READ(page_size, btree->maxleafpage_precomp);
+    if (page_size == r->page_size)
+        return (0);
+
+    r->page_size = (uint32_t)page_size;
+    r->split_size = __wt_split_page_size(btree->split_pct, r->page_size, btree->allocsize);
+    r->min_split_size =
+      __wt_split_page_size(WT_BTREE_MIN_SPLIT_PCT, r->page_size, btree->allocsize);
+
+    corrected_page_size = r->page_size;
+    WT_RET(bm->write_size(bm, session, &corrected_page_size));
+    r->disk_img_buf_size = WT_ALIGN(WT_MAX(corrected_page_size, r->split_size), btree->allocsize);
+    return (0);
+}
+
 /*
  * __wt_rec_split --
  *     Handle the page reconciliation bookkeeping. (Did you know "bookkeeper" has 3 doubled letters
@@ -1491,6 +1523,13 @@ __wt_rec_split(WT_SESSION_IMPL *session, WT_RECONCILE *r, size_t next_len)
         r->cur_ptr = tmp;
     }
 
+    /*
+     * A bulk load is a single reconciliation of the whole tree, pick up any change the pages
+     * written so far made to the pre-compression page size before starting the next chunk.
+     */
+    if (r->is_bulk_load && r->page->type != WT_PAGE_COL_FIX && btree->leafpage_compadjust)
+        WT_RET(__rec_split_bulk_resize(session, r));
+
     /* Initialize the next chunk, including the key. */
     WT_RET(__rec_split_chunk_init(session, r, r->cur_ptr));
     r->cur_ptr->recno = r->recno;
@@ -2080,6 +2119,70 @@ __rec_compression_adjust(WT_SESSION_IMPL *session, uint32_t max, size_t compress
     *adjustp = new;
 }
 
+/*
+ * __rec_bulk_queue --
+ *     Queue a bulk-load page image for a write offload thread to write. The queue takes the image's
+ *     buffer, the caller gets the buffer of an already written image, or an empty buffer, back.
+ */
+static int
+__rec_bulk_queue(
+  WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_ITEM *image, uint32_t multi_slot, bool last_block)
+{
+    WT_DECL_RET;
+    WT_REC_BULK *bulk;
+    WT_REC_BULK_JOB *job;
+
+    bulk = r->bulk;
+
+    /*
+     * Limit the number of page images waiting to be written, the application thread can build pages
+     * faster than they can be compressed and written and we don't want to buffer the whole load.
+     */
+    for (;;) {
+        __wt_spin_lock(session, &bulk->lock);
+        if (bulk->ret != 0 || bulk->jobs_cnt - bulk->jobs_done < 2 * bulk->nthreads)
+            break;
+        __wt_spin_unlock(session, &bulk->lock);
+        __wt_cond_wait(session, bulk->done_cond, WT_THOUSAND, NULL);
+    }
+    if ((ret = bulk->ret) != 0) {
+        __wt_spin_unlock(session, &bulk->lock);
+        return (ret);
+    }
+    __wt_spin_unlock(session, &bulk->lock);
+
+    WT_RET(__wt_calloc_one(session, &job));
+    job->multi_slot = multi_slot;
+    job->checkpoint_io = F_ISSET(r, WT_REC_CHECKPOINT);
+    job->last_block = last_block;
+
+    __wt_spin_lock(session, &bulk->lock);
+    ret = __wt_realloc_def(session, &bulk->jobs_allocated, bulk->jobs_cnt + 1, &bulk->jobs);
+    if (ret == 0) {
+        /*
+         * Swap the image's buffer for a spare. The reconciliation code initializes the buffer
+         * before building the next page in it, growing it if needed.
+         */
+        job->image = *image;
+        if (bulk->spares_cnt != 0)
+            *image = bulk->spares[--bulk->spares_cnt];
+        else {
+            WT_CLEAR(*image);
+            if (F_ISSET(&job->image, WT_ITEM_ALIGNED))
+                F_SET(image, WT_ITEM_ALIGNED);
+        }
+        bulk->jobs[bulk->jobs_cnt++] = job;
+    }
+    __wt_spin_unlock(session, &bulk->lock);
+    if (ret != 0) {
+        __wt_free(session, job);
+        return (ret);
+    }
+
+    __wt_cond_signal(session, bulk->work_cond);
+    return (0);
+}
+
 /*
  * __rec_split_write --
  *     Write a disk block out for the split helper functions.
@@ -2209,6 +2312,20 @@ __rec_split_write(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_REC_CHUNK *chunk
           compressed_image == NULL ? &chunk->image : compressed_image, last_block))
         goto copy_image;
 
+    /*
+     * If bulk-loading with write offload threads, queue the image to be written, the block address
+     * is filled in when the bulk load completes. The queue takes the image, the offload thread's
+     * write verifies it.
+     */
+    if (r->bulk != NULL && compressed_image == NULL) {
+        WT_RET(__rec_bulk_queue(session, r, &chunk->image, r->multi_next - 1, last_block));
+#ifdef HAVE_DIAGNOSTIC
+        verify_image = false;
+#endif
+        __rec_page_time_stats(session, r);
+        goto copy_image;
+    }
+
     /* Write the disk image and get an address. */
     WT_RET(__rec_write(session, compressed_image == NULL ? &chunk->image : compressed_image, addr,
       &addr_size, &compressed_size, false, F_ISSET(r, WT_REC_CHECKPOINT),
@@ -2254,6 +2371,199 @@ copy_image:
     return (0);
 }
 
+/*
+ * __rec_bulk_write --
+ *     Write a queued bulk-load page image.
+ */
+static int
+__rec_bulk_write(WT_SESSION_IMPL *session, WT_REC_BULK_JOB *job)
+{
+    WT_BTREE *btree;
+
+    btree = S2BT(session);
+
+    WT_RET(__rec_write(session, &job->image, job->addr, &job->addr_size, &job->compressed_size,
+      false, job->checkpoint_io, false));
+    WT_STAT_CONN_DATA_INCR(session, rec_bulk_offload_pages);
+
+    /*
+     * Adjust the pre-compression page size based on compression results as soon as the page is
+     * written, the bulk-load thread picks it up at its next split.
+     */
+    if (job->compressed_size != 0 && btree->leafpage_compadjust)
+        __rec_compression_adjust(session, btree->maxleafpage, job->compressed_size,
+          job->last_block, &btree->maxleafpage_precomp);
+    return (0);
+}
+
+/*
+ * __rec_bulk_server --
+ *     Bulk-load write offload thread: write queued page images.
+ */
+static WT_THREAD_RET
+__rec_bulk_server(void *arg)
+{
+    WT_DECL_RET;
+    WT_REC_BULK *bulk;
+    WT_REC_BULK_JOB *job;
+    WT_REC_BULK_THREAD *thread;
+    WT_SESSION_IMPL *session;
+
+    thread = arg;
+    bulk = thread->bulk;
+    session = thread->session;
+
+    while (bulk->running) {
+        job = NULL;
+        __wt_spin_lock(session, &bulk->lock);
+        if (bulk->jobs_next < bulk->jobs_cnt)
+            job = bulk->jobs[bulk->jobs_next++];
+        __wt_spin_unlock(session, &bulk->lock);
+
+        if (job == NULL) {
+            __wt_cond_wait(session, bulk->work_cond, 10 * WT_THOUSAND, NULL);
+            continue;
+        }
+
+        WT_WITH_DHANDLE(session, bulk->dhandle, ret = __rec_bulk_write(session, job));
+
+        /* Keep the image's buffer for the bulk-load thread to build another page in. */
+        __wt_spin_lock(session, &bulk->lock);
+        if (bulk->spares_cnt < bulk->spares_max) {
+            bulk->spares[bulk->spares_cnt++] = job->image;
+            WT_CLEAR(job->image);
+        }
+        if (ret != 0 && bulk->ret == 0)
+            bulk->ret = ret;
+        ++bulk->jobs_done;
+        __wt_spin_unlock(session, &bulk->lock);
+        __wt_buf_free(session, &job->image);
+        __wt_cond_signal(session, bulk->done_cond);
+        ret = 0;
+    }
+
+    return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __rec_bulk_destroy --
+ *     Stop the bulk-load write offload threads and discard the queue.
+ */
+static int
+__rec_bulk_destroy(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+    WT_DECL_RET;
+    WT_REC_BULK *bulk;
+    WT_REC_BULK_JOB *job;
+    u_int i;
+
+    if ((bulk = r->bulk) == NULL)
+        return (0);
+    r->bulk = NULL;
+
+    bulk->running = false;
+    if (bulk->threads != NULL)
+        for (i = 0; i < bulk->nthreads; ++i) {
+            __wt_cond_signal(session, bulk->work_cond);
+            WT_TRET(__wt_thread_join(session, &bulk->threads[i].tid));
+            if (bulk->threads[i].session != NULL)
+                WT_TRET(__wt_session_close_internal(bulk->threads[i].session));
+        }
+    __wt_free(session, bulk->threads);
+
+    for (i = 0; i < bulk->jobs_cnt; ++i) {
+        job = bulk->jobs[i];
+        __wt_buf_free(session, &job->image);
+        __wt_free(session, job);
+    }
+    __wt_free(session, bulk->jobs);
+    for (i = 0; i < bulk->spares_cnt; ++i)
+        __wt_buf_free(session, &bulk->spares[i]);
+    __wt_free(session, bulk->spares);
+
+    __wt_cond_destroy(session, &bulk->work_cond);
+    __wt_cond_destroy(session, &bulk->done_cond);
+    __wt_spin_destroy(session, &bulk->lock);
+    __wt_free(session, bulk);
+    return (ret);
+}
+
+/*
+ * __rec_bulk_create --
+ *     Start the bulk-load write offload threads.
+ */
+static int
+__rec_bulk_create(WT_SESSION_IMPL *session, WT_RECONCILE *r, u_int nthreads)
+{
+    WT_DECL_RET;
+    WT_REC_BULK *bulk;
+    WT_REC_BULK_THREAD *thread;
+    u_int i;
+
+    WT_RET(__wt_calloc_one(session, &r->bulk));
+    bulk = r->bulk;
+    bulk->dhandle = session->dhandle;
+    bulk->running = true;
+
+    WT_ERR(__wt_spin_init(session, &bulk->lock, "bulk-load queue"));
+    WT_ERR(__wt_cond_alloc(session, "bulk-load work", &bulk->work_cond));
+    WT_ERR(__wt_cond_alloc(session, "bulk-load done", &bulk->done_cond));
+
+    /* There are never more than twice as many images queued as there are offload threads. */
+    bulk->spares_max = 2 * nthreads;
+    WT_ERR(__wt_calloc_def(session, bulk->spares_max, &bulk->spares));
+
+    WT_ERR(__wt_calloc_def(session, nthreads, &bulk->threads));
+    for (i = 0; i < nthreads; ++i) {
+        thread = &bulk->threads[i];
+        thread->bulk = bulk;
+        WT_ERR(__wt_open_internal_session(S2C(session), "bulk-load", false,
+          WT_SESSION_CAN_WAIT | WT_SESSION_IGNORE_CACHE_SIZE, 0, &thread->session));
+        bulk->nthreads = i + 1;
+        WT_ERR(__wt_thread_create(session, &thread->tid, __rec_bulk_server, thread));
+    }
+    return (0);
+
+err:
+    WT_TRET(__rec_bulk_destroy(session, r));
+    return (ret);
+}
+
+/*
+ * __rec_bulk_drain --
+ *     Wait for the bulk-load write offload threads to write all queued pages and fill in the
+ *     written block addresses.
+ */
+static int
+__rec_bulk_drain(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+    WT_MULTI *multi;
+    WT_REC_BULK *bulk;
+    WT_REC_BULK_JOB *job;
+    uint32_t i;
+
+    bulk = r->bulk;
+
+    for (;;) {
+        __wt_spin_lock(session, &bulk->lock);
+        if (bulk->jobs_done == bulk->jobs_cnt) {
+            __wt_spin_unlock(session, &bulk->lock);
+            break;
+        }
+        __wt_spin_unlock(session, &bulk->lock);
+        __wt_cond_wait(session, bulk->done_cond, WT_THOUSAND, NULL);
+    }
+    WT_RET(bulk->ret);
+
+    for (i = 0; i < bulk->jobs_cnt; ++i) {
+        job = bulk->jobs[i];
+        multi = &r->multi[job->multi_slot];
+        WT_RET(__wt_memdup(session, job->addr, job->addr_size, &multi->addr.addr));
+        multi->addr.size = (uint8_t)job->addr_size;
+    }
+    return (0);
+}
+
 /*
  * __wt_bulk_init --
  *     Bulk insert initialization.
@@ -2287,6 +2597,10 @@ __wt_bulk_init(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
     r = cbulk->reconcile;
     r->is_bulk_load = true;
 
+    /* Optionally start threads to offload writing completed pages. */
+    if (cbulk->nthreads != 0)
+        WT_RET(__rec_bulk_create(session, r, cbulk->nthreads));
+
     recno = btree->type == BTREE_ROW ? WT_RECNO_OOB : 1;
 
     return (__wt_rec_split_init(session, r, cbulk->leaf, recno, btree->maxleafpage_precomp, 0));
@@ -2326,6 +2640,8 @@ __wt_bulk_wrapup(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
     }
 
     WT_ERR(__wt_rec_split_finish(session, r));
+    if (r->bulk != NULL)
+        WT_ERR(__rec_bulk_drain(session, r));
     WT_ERR(__rec_write_wrapup(session, r, r->page));
     __rec_write_page_status(session, r);
 
@@ -2335,6 +2651,7 @@ __wt_bulk_wrapup(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
     __wt_page_modify_set(session, parent);
 
 err:
+    WT_TRET(__rec_bulk_destroy(session, r));
     WT_TRET(__rec_cleanup(session, r));
     WT_TRET(__rec_destroy(session, &cbulk->reconcile));
 
@@ -901,7 +901,7 @@ __rts_btree_abort_col_fix_one(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t tw
     WT_CELL *cell;
     WT_CELL_UNPACK_KV unpack;
     WT_PAGE *page;
-    uint8_t value;
+    uint8_t value[WT_INTPACK64_MAXSIZE];
 
     btree = S2BT(session);
     page = ref->page;
@@ -911,9 +911,9 @@ __rts_btree_abort_col_fix_one(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t tw
     __wt_cell_unpack_kv(session, page->dsk, cell, &unpack);
 
     /* Fake up the value (which is not physically in the cell) in case it's wanted. */
-    value = __bit_getv(page->pg_fix_bitf, recno_offset, btree->bitcnt);
-    unpack.data = &value;
-    unpack.size = 1;
+    unpack.size = (uint32_t)__col_fix_value_pack(
+      btree, __bit_getv(page->pg_fix_bitf, recno_offset, btree->bitcnt), value);
+    unpack.data = value;
 
     return (__rts_btree_abort_ondisk_kv(session, ref, NULL, page->dsk->recno + recno_offset, NULL,
       &unpack, rollback_timestamp, NULL));
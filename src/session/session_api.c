@@ -381,6 +381,10 @@ __wt_session_close_internal(WT_SESSION_IMPL *session)
         __wt_free(session, session->optrack_buf);
     }
 
+    /* Write any captured operations, capture may have been turned off since they were captured. */
+    if (session->capture_buf != NULL)
+        WT_TRET(__wt_capture_session_close(session));
+
     /* Release common session resources. */
     WT_TRET(__wt_session_release_resources(session));
 
@@ -1265,7 +1269,7 @@ __session_join(
     WT_INDEX *idx;
     WT_SESSION_IMPL *session;
     WT_TABLE *table;
-    uint64_t count;
+    uint64_t count, set_max;
     uint32_t bloom_bit_count, bloom_hash_count;
     uint8_t flags, range;
     bool nested;
@@ -1330,6 +1334,8 @@ __session_join(
     if (cval.len != 0) {
         if (WT_STRING_MATCH("bloom", cval.str, cval.len))
             LF_SET(WT_CURJOIN_ENTRY_BLOOM);
+        else if (WT_STRING_MATCH("set", cval.str, cval.len))
+            LF_SET(WT_CURJOIN_ENTRY_SET);
         else if (!WT_STRING_MATCH("default", cval.str, cval.len))
             WT_ERR_MSG(session, EINVAL, "strategy=%.*s not supported", (int)cval.len, cval.str);
     }
@@ -1351,13 +1357,18 @@ __session_join(
     if (cval.len != 0 && WT_STRING_MATCH("or", cval.str, cval.len))
         LF_SET(WT_CURJOIN_ENTRY_DISJUNCTION);
 
-    if (nested && (count != 0 || range != WT_CURJOIN_END_EQ || LF_ISSET(WT_CURJOIN_ENTRY_BLOOM)))
+    WT_ERR(__wt_config_gets(session, cfg, "set_max", &cval));
+    set_max = (uint64_t)cval.val;
+
+    if (nested &&
+      (count != 0 || range != WT_CURJOIN_END_EQ ||
+        LF_ISSET(WT_CURJOIN_ENTRY_BLOOM | WT_CURJOIN_ENTRY_SET)))
         WT_ERR_MSG(session, EINVAL,
           "joining a nested join cursor is incompatible with setting \"strategy\", \"compare\" or "
           "\"count\"");
 
-    WT_ERR(__wt_curjoin_join(
-      session, cjoin, idx, ref_cursor, flags, range, count, bloom_bit_count, bloom_hash_count));
+    WT_ERR(__wt_curjoin_join(session, cjoin, idx, ref_cursor, flags, range, count, bloom_bit_count,
+      bloom_hash_count, set_max));
     /*
      * There's an implied ownership ordering that isn't known when the cursors are created: the join
      * cursor must be closed before any of the indices. Enforce that here by reordering.
@@ -1467,6 +1478,26 @@ err:
     API_END_RET(session, ret);
 }
 
+/*
+ * __session_range_truncate_filter --
+ *     Swap a truncate cursor's iteration filter with a saved one. Iteration filters don't apply to
+ *     truncate, the range includes every key between the start and stop cursors.
+ */
+static void
+__session_range_truncate_filter(WT_CURSOR *cursor, WT_CURSOR_FILTER **filterp)
+{
+    WT_CURSOR_BTREE *cbt;
+    WT_CURSOR_FILTER *filter;
+
+    if (cursor == NULL || !WT_BTREE_PREFIX(cursor->internal_uri))
+        return;
+
+    cbt = (WT_CURSOR_BTREE *)cursor;
+    filter = cbt->filter;
+    cbt->filter = *filterp;
+    *filterp = filter;
+}
+
 /*
  * __wt_session_range_truncate --
  *     Session handling of a range truncate.
@@ -1475,6 +1506,7 @@ int
 __wt_session_range_truncate(
   WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *start, WT_CURSOR *stop)
 {
+    WT_CURSOR_FILTER *start_filter, *stop_filter;
     WT_DECL_ITEM(orig_start_key);
     WT_DECL_ITEM(orig_stop_key);
     WT_DECL_RET;
@@ -1482,6 +1514,7 @@ __wt_session_range_truncate(
     int cmp;
     bool local_start;
 
+    start_filter = stop_filter = NULL;
     orig_start_key = orig_stop_key = NULL;
     local_start = false;
     if (uri != NULL) {
@@ -1510,6 +1543,13 @@ __wt_session_range_truncate(
     if (stop != NULL && stop->compare == NULL)
         WT_ERR(__wt_bad_object_type(session, stop->uri));
 
+    /*
+     * Suspend the cursors' iteration filters until the truncate completes, positioning the cursors
+     * and walking the range must see every key.
+     */
+    __session_range_truncate_filter(start, &start_filter);
+    __session_range_truncate_filter(stop, &stop_filter);
+
     /*
      * If both cursors are set, check they're correctly ordered with respect to each other. We have
      * to test this before any search, the search can change the initial cursor position.
@@ -1595,6 +1635,12 @@ __wt_session_range_truncate(
 
 done:
 err:
+    /* Restore any suspended iteration filters. */
+    if (start_filter != NULL)
+        __session_range_truncate_filter(start, &start_filter);
+    if (stop_filter != NULL)
+        __session_range_truncate_filter(stop, &stop_filter);
+
     /*
      * Close any locally-opened start cursor.
      *
@@ -1859,6 +1905,7 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
     WT_TXN *txn;
+    uint64_t time_start;
 
     session = (WT_SESSION_IMPL *)wt_session;
     txn = session->txn;
@@ -1878,6 +1925,9 @@ __session_commit_transaction(WT_SESSION *wt_session, const char *config)
           F_ISSET(txn, WT_TXN_PREPARE) ? "prepared " : "", txn->rollback_reason == NULL ? "" : ": ",
           txn->rollback_reason == NULL ? "" : txn->rollback_reason);
 
+    /* Index updates buffered by table cursors are part of the transaction. */
+    WT_ERR(__wt_curtable_idx_batch_resolve(session, true));
+
 err:
     /*
      * We might have failed because an illegal configuration was specified or because there wasn't a
@@ -1886,12 +1936,16 @@ err:
      */
     if (ret == 0) {
         F_SET(session, WT_SESSION_RESOLVING_TXN);
+        time_start = __wt_clock(session);
         ret = __wt_txn_commit(session, cfg);
+        WT_LATENCY_RECORD(
+          session, NULL, WT_LATENCY_TXN_COMMIT, WT_CLOCKDIFF_NS(__wt_clock(session), time_start));
         F_CLR(session, WT_SESSION_RESOLVING_TXN);
     } else if (F_ISSET(txn, WT_TXN_RUNNING)) {
         if (F_ISSET(txn, WT_TXN_PREPARE))
             WT_RET_PANIC(session, ret, "failed to commit prepared transaction, failing the system");
 
+        WT_TRET(__wt_curtable_idx_batch_resolve(session, false));
         WT_TRET(__wt_session_reset_cursors(session, false));
         F_SET(session, WT_SESSION_RESOLVING_TXN);
         WT_TRET(__wt_txn_rollback(session, cfg));
@@ -1939,6 +1993,9 @@ __session_prepare_transaction(WT_SESSION *wt_session, const char *config)
 
     WT_ERR(__wt_txn_context_check(session, true));
 
+    /* Index updates buffered by table cursors are part of the transaction. */
+    WT_ERR(__wt_curtable_idx_batch_resolve(session, true));
+
     F_SET(session, WT_SESSION_RESOLVING_TXN);
     WT_ERR(__wt_txn_prepare(session, cfg));
     F_CLR(session, WT_SESSION_RESOLVING_TXN);
@@ -1993,6 +2050,7 @@ __session_rollback_transaction(WT_SESSION *wt_session, const char *config)
 
     WT_ERR(__wt_txn_context_check(session, true));
 
+    WT_TRET(__wt_curtable_idx_batch_resolve(session, false));
     WT_TRET(__wt_session_reset_cursors(session, false));
 
     F_SET(session, WT_SESSION_RESOLVING_TXN);
@@ -125,6 +125,35 @@ __compact_end(WT_SESSION_IMPL *session)
     return (bm->compact_end(bm, session));
 }
 
+/*
+ * __compact_skip --
+ *     Return if compaction of an object will shrink the file.
+ */
+static int
+__compact_skip(WT_SESSION_IMPL *session, bool *skipp)
+{
+    WT_BM *bm;
+
+    bm = S2BT(session)->bm;
+    return (bm->compact_skip(bm, session, skipp));
+}
+
+/*
+ * __compact_size --
+ *     Return the size of an object's file.
+ */
+static int
+__compact_size(WT_SESSION_IMPL *session, uint64_t *sizep)
+{
+    WT_BM *bm;
+    wt_off_t size;
+
+    bm = S2BT(session)->bm;
+    WT_RET(bm->size(bm, session, &size));
+    *sizep = (uint64_t)size;
+    return (0);
+}
+
 /*
  * __compact_uri_analyze --
  *     Extract information relevant to deciding what work compact needs to do from a URI that is
@@ -185,6 +214,13 @@ __wt_session_compact_check_timeout(WT_SESSION_IMPL *session)
     struct timespec end;
     WT_DECL_RET;
 
+    /* The background server stops as soon as it's shut down or reconfigured. */
+    if (session->compact->background &&
+      !FLD_ISSET(S2C(session)->server_flags, WT_CONN_SERVER_COMPACT)) {
+        WT_STAT_CONN_INCR(session, session_background_compact_interrupted);
+        return (ECANCELED);
+    }
+
     if (session->compact->max_time == 0)
         return (0);
 
@@ -230,8 +266,11 @@ static int
 __compact_worker(WT_SESSION_IMPL *session)
 {
     WT_DECL_RET;
+    uint64_t size, size_after, size_before;
     u_int i, loop;
-    bool another_pass;
+    bool another_pass, skip;
+
+    size_after = size_before = 0;
 
     /*
      * Reset the handles' compaction skip flag (we don't bother setting or resetting it when we
@@ -240,6 +279,29 @@ __compact_worker(WT_SESSION_IMPL *session)
     for (i = 0; i < session->op_handle_next; ++i)
         session->op_handle[i]->compact_skip = false;
 
+    /*
+     * The background server visits every object in the database on each pass: check up front if any
+     * of the files has enough space to recover before paying for the checkpoints compaction
+     * requires.
+     */
+    if (session->compact->background) {
+        for (another_pass = false, i = 0; i < session->op_handle_next; ++i) {
+            WT_WITH_DHANDLE(session, session->op_handle[i], ret = __compact_skip(session, &skip));
+            WT_ERR(ret);
+            if (skip)
+                session->op_handle[i]->compact_skip = true;
+            else
+                another_pass = true;
+            WT_WITH_DHANDLE(session, session->op_handle[i], ret = __compact_size(session, &size));
+            WT_ERR(ret);
+            size_before += size;
+        }
+        if (!another_pass) {
+            WT_STAT_CONN_INCR(session, session_background_compact_skipped);
+            goto err;
+        }
+    }
+
     /*
      * Perform an initial checkpoint (see this file's leading comment for details).
      */
@@ -304,6 +366,17 @@ __compact_worker(WT_SESSION_IMPL *session)
         WT_ERR(__compact_checkpoint(session));
     }
 
+    if (session->compact->background) {
+        for (i = 0; i < session->op_handle_next; ++i) {
+            WT_WITH_DHANDLE(session, session->op_handle[i], ret = __compact_size(session, &size));
+            WT_ERR(ret);
+            size_after += size;
+        }
+        if (size_before > size_after)
+            WT_STAT_CONN_INCRV(
+              session, session_background_compact_bytes_recovered, size_before - size_after);
+    }
+
 err:
     session->compact_state = WT_COMPACT_NONE;
 
@@ -323,14 +396,21 @@ __wt_session_compact(WT_SESSION *wt_session, const char *uri, const char *config
     WT_DECL_RET;
     WT_SESSION_IMPL *session;
     u_int i;
-    bool ignore_cache_size_set;
+    bool background, ignore_cache_size_set;
 
     ignore_cache_size_set = false;
 
     session = (WT_SESSION_IMPL *)wt_session;
+
+    /* The background compaction server calls through the API with its own session. */
+    background = session == S2C(session)->compact_session;
+
     SESSION_API_CALL(session, compact, config, cfg);
 
-    WT_STAT_CONN_SET(session, session_table_compact_running, 1);
+    if (background)
+        WT_STAT_CONN_SET(session, session_background_compact_running, 1);
+    else
+        WT_STAT_CONN_SET(session, session_table_compact_running, 1);
 
     /*
      * The compaction thread should not block when the cache is full: it is holding locks blocking
@@ -379,6 +459,10 @@ __wt_session_compact(WT_SESSION *wt_session, const char *uri, const char *config
     session->compact->max_time = (uint64_t)cval.val;
     __wt_epoch(session, &session->compact->begin);
 
+    WT_ERR(__wt_config_gets(session, cfg, "free_space_target", &cval));
+    session->compact->free_space_target = (uint64_t)cval.val;
+    session->compact->background = background;
+
     /*
      * Find the types of data sources being compacted. This could involve opening indexes for a
      * table, so acquire the table lock in write mode.
@@ -415,11 +499,19 @@ err:
     if (ignore_cache_size_set)
         F_CLR(session, WT_SESSION_IGNORE_CACHE_SIZE);
 
-    if (ret != 0)
-        WT_STAT_CONN_INCR(session, session_table_compact_fail);
-    else
-        WT_STAT_CONN_INCR(session, session_table_compact_success);
-    WT_STAT_CONN_SET(session, session_table_compact_running, 0);
+    if (background) {
+        if (ret != 0)
+            WT_STAT_CONN_INCR(session, session_background_compact_fail);
+        else
+            WT_STAT_CONN_INCR(session, session_background_compact_success);
+        WT_STAT_CONN_SET(session, session_background_compact_running, 0);
+    } else {
+        if (ret != 0)
+            WT_STAT_CONN_INCR(session, session_table_compact_fail);
+        else
+            WT_STAT_CONN_INCR(session, session_table_compact_success);
+        WT_STAT_CONN_SET(session, session_table_compact_running, 0);
+    }
 
     /* Map prepare-conflict to rollback. */
     if (ret == WT_PREPARE_CONFLICT)
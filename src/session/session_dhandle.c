@@ -705,14 +705,19 @@ __wt_session_dhandle_sweep(WT_SESSION_IMPL *session)
 
 /*
  * __session_find_shared_dhandle --
- *     Search for a data handle in the connection and add it to a session's cache. We must increment
- *     the handle's reference count while holding the handle list lock.
+ *     Search for a data handle in the connection and add it to a session's cache. The handle's
+ *     reference count must be incremented either while holding the handle list lock or by the
+ *     lock-free lookup, which refuses handles that are being removed.
  */
 static int
 __session_find_shared_dhandle(WT_SESSION_IMPL *session, const char *uri, const char *checkpoint)
 {
     WT_DECL_RET;
 
+    /* Try the lock-free lookup first, the common case is the handle is already open. */
+    if ((ret = __wt_conn_dhandle_find_lockfree(session, uri, checkpoint)) != WT_NOTFOUND)
+        return (ret);
+
     WT_WITH_HANDLE_LIST_READ_LOCK(session,
       if ((ret = __wt_conn_dhandle_find(session, uri, checkpoint)) == 0)
         WT_DHANDLE_ACQUIRE(session->dhandle));
@@ -772,7 +777,7 @@ void
 __wt_session_dhandle_readlock(WT_SESSION_IMPL *session)
 {
     WT_ASSERT(session, session->dhandle != NULL);
-    __wt_readlock(session, &session->dhandle->rwlock);
+    __wt_readlock_wait(session, &session->dhandle->rwlock, WT_DHANDLE_WAIT_EVENT(session));
 }
 
 /*
@@ -28,6 +28,8 @@ __gen_name(int which)
         return ("checkpoint");
     case WT_GEN_COMMIT:
         return ("commit");
+    case WT_GEN_DHANDLE:
+        return ("dhandle");
     case WT_GEN_EVICT:
         return ("evict");
     case WT_GEN_HAZARD:
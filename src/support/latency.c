@@ -0,0 +1,276 @@
+/*-
+ * Copyright (c) 2014-present MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/* Percentiles reported for each histogram, in tenths of a percent. */
+static const uint64_t __latency_pct[] = {500, 900, 990, 999};
+#define WT_LATENCY_PCT_COUNT WT_ELEMENTS(__latency_pct)
+
+/*
+ * A summary of one or more histograms.
+ */
+typedef struct {
+    uint64_t pct[WT_LATENCY_PCT_COUNT]; /* Percentile values */
+    uint64_t max;                       /* Largest value */
+} WT_LATENCY_SUMMARY;
+
+/*
+ * __latency_bucket --
+ *     Return the histogram bucket for a latency.
+ */
+static inline u_int
+__latency_bucket(uint64_t nsecs)
+{
+    u_int msb;
+
+    if (nsecs < WT_LATENCY_HIST_SUB_COUNT)
+        return ((u_int)nsecs);
+    if (nsecs >= (uint64_t)1 << WT_LATENCY_HIST_MAX_BITS)
+        return (WT_LATENCY_HIST_BUCKETS - 1);
+
+    for (msb = WT_LATENCY_HIST_SUB_BITS; (nsecs >> (msb + 1)) != 0; ++msb)
+        ;
+
+    /*
+     * The most significant bits select the power of two, the next (WT_LATENCY_HIST_SUB_BITS - 1)
+     * bits select the bucket within it.
+     */
+    return (WT_LATENCY_HIST_SUB_COUNT +
+      (msb - WT_LATENCY_HIST_SUB_BITS) * (WT_LATENCY_HIST_SUB_COUNT / 2) +
+      (u_int)(nsecs >> (msb - (WT_LATENCY_HIST_SUB_BITS - 1))) - WT_LATENCY_HIST_SUB_COUNT / 2);
+}
+
+/*
+ * __latency_bucket_value --
+ *     Return the largest latency a histogram bucket holds.
+ */
+static inline uint64_t
+__latency_bucket_value(u_int bucket)
+{
+    u_int shift, sub;
+
+    if (bucket < WT_LATENCY_HIST_SUB_COUNT)
+        return (bucket);
+
+    bucket -= WT_LATENCY_HIST_SUB_COUNT;
+    shift = bucket / (WT_LATENCY_HIST_SUB_COUNT / 2) + 1;
+    sub = bucket % (WT_LATENCY_HIST_SUB_COUNT / 2) + WT_LATENCY_HIST_SUB_COUNT / 2;
+    return (((uint64_t)(sub + 1) << shift) - 1);
+}
+
+/*
+ * __latency_hist_alloc --
+ *     Allocate a set of histograms, racing other threads to install it.
+ */
+static WT_LATENCY_HIST *
+__latency_hist_alloc(WT_SESSION_IMPL *session, WT_LATENCY_HIST **histp, u_int count)
+{
+    WT_LATENCY_HIST *hist;
+
+    /*
+     * Statistics are best effort, if we can't allocate memory, don't record the latency. If we lose
+     * the race to install the histograms, use the winner's.
+     */
+    if (__wt_calloc_def(session, count, &hist) != 0)
+        return (NULL);
+    if (!__wt_atomic_cas_ptr(histp, NULL, hist)) {
+        __wt_free(session, hist);
+        hist = *histp;
+    }
+    return (hist);
+}
+
+/*
+ * __latency_hist_record --
+ *     Record a latency in one of a set of per-slot histograms.
+ */
+static inline void
+__latency_hist_record(WT_SESSION_IMPL *session, WT_LATENCY_HIST **slots, u_int count, u_int op,
+  u_int bucket, uint64_t nsecs)
+{
+    WT_LATENCY_HIST *hist, **histp;
+
+    /* Histograms are split across a few slots, updates race like the statistics counters do. */
+    histp = &slots[WT_LATENCY_SLOT_ID(session)];
+    if ((hist = *histp) != NULL || (hist = __latency_hist_alloc(session, histp, count)) != NULL) {
+        hist += op;
+        ++hist->buckets[bucket];
+        if (nsecs > hist->max)
+            hist->max = nsecs;
+    }
+}
+
+/*
+ * __wt_latency_record --
+ *     Record an operation's latency in the connection's and the data handle's histograms.
+ */
+void
+__wt_latency_record(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, u_int op, uint64_t nsecs)
+{
+    u_int bucket;
+
+    bucket = __latency_bucket(nsecs);
+
+    __latency_hist_record(
+      session, S2C(session)->latency_hist, WT_LATENCY_CONN_OPS, op, bucket, nsecs);
+    if (dhandle != NULL && op < WT_LATENCY_DSRC_OPS &&
+      FLD_ISSET(S2C(session)->stat_flags, WT_STAT_TYPE_ALL))
+        __latency_hist_record(
+          session, dhandle->latency_hist, WT_LATENCY_DSRC_OPS, op, bucket, nsecs);
+}
+
+/*
+ * __latency_summary --
+ *     Summarize an operation's histograms, either a data handle's or the connection's.
+ */
+static void
+__latency_summary(
+  WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle, u_int op, WT_LATENCY_SUMMARY *summary)
+{
+    WT_LATENCY_HIST *hist[WT_LATENCY_SLOTS], **slots;
+    uint64_t count, total, target;
+    u_int bucket, i, nhist, pct;
+
+    memset(summary, 0, sizeof(*summary));
+
+    /* Gather the histograms from the slots. */
+    slots = dhandle == NULL ? S2C(session)->latency_hist : dhandle->latency_hist;
+    for (nhist = i = 0; i < WT_LATENCY_SLOTS; ++i)
+        if (slots[i] != NULL)
+            hist[nhist++] = slots[i] + op;
+
+    /*
+     * The histograms are read without locking and counts can change underneath us: percentiles not
+     * reached by the last bucket are set to the maximum.
+     */
+    total = 0;
+    for (i = 0; i < nhist; ++i) {
+        for (bucket = 0; bucket < WT_LATENCY_HIST_BUCKETS; ++bucket)
+            total += hist[i]->buckets[bucket];
+        summary->max = WT_MAX(summary->max, hist[i]->max);
+    }
+    if (total == 0)
+        return;
+
+    for (count = 0, bucket = 0, pct = 0; bucket < WT_LATENCY_HIST_BUCKETS; ++bucket) {
+        if (pct == WT_LATENCY_PCT_COUNT)
+            break;
+        for (i = 0; i < nhist; ++i)
+            count += hist[i]->buckets[bucket];
+        for (; pct < WT_LATENCY_PCT_COUNT; ++pct) {
+            target = (total * __latency_pct[pct] + 999) / 1000;
+            if (count < target)
+                break;
+            summary->pct[pct] = WT_MIN(__latency_bucket_value(bucket), summary->max);
+        }
+    }
+    for (; pct < WT_LATENCY_PCT_COUNT; ++pct)
+        summary->pct[pct] = summary->max;
+}
+
+#define WT_LATENCY_STAT_SET(session, stats, name, summary)        \
+    do {                                                          \
+        WT_STAT_SET(session, stats, name##_p50, (summary).pct[0]);  \
+        WT_STAT_SET(session, stats, name##_p90, (summary).pct[1]);  \
+        WT_STAT_SET(session, stats, name##_p99, (summary).pct[2]);  \
+        WT_STAT_SET(session, stats, name##_p999, (summary).pct[3]); \
+        WT_STAT_SET(session, stats, name##_max, (summary).max);     \
+    } while (0)
+
+/*
+ * __wt_latency_stats_update --
+ *     Update the connection's latency percentile statistics.
+ */
+void
+__wt_latency_stats_update(WT_SESSION_IMPL *session)
+{
+    WT_CONNECTION_STATS **stats;
+    WT_LATENCY_SUMMARY summary;
+
+    stats = S2C(session)->stats;
+
+    __latency_summary(session, NULL, WT_LATENCY_CURSOR_INSERT, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_insert, summary);
+    __latency_summary(session, NULL, WT_LATENCY_CURSOR_REMOVE, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_remove, summary);
+    __latency_summary(session, NULL, WT_LATENCY_CURSOR_SEARCH, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_search, summary);
+    __latency_summary(session, NULL, WT_LATENCY_CURSOR_UPDATE, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_update, summary);
+    __latency_summary(session, NULL, WT_LATENCY_EVICT_APP, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_evict_app, summary);
+    __latency_summary(session, NULL, WT_LATENCY_LOG_SYNC, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_log_sync, summary);
+    __latency_summary(session, NULL, WT_LATENCY_TXN_COMMIT, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_txn_commit, summary);
+}
+
+/*
+ * __wt_latency_stats_dsrc_update --
+ *     Update a data handle's latency percentile statistics.
+ */
+void
+__wt_latency_stats_dsrc_update(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle)
+{
+    WT_DSRC_STATS **stats;
+    WT_LATENCY_SUMMARY summary;
+
+    stats = dhandle->stats;
+
+    __latency_summary(session, dhandle, WT_LATENCY_CURSOR_INSERT, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_insert, summary);
+    __latency_summary(session, dhandle, WT_LATENCY_CURSOR_REMOVE, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_remove, summary);
+    __latency_summary(session, dhandle, WT_LATENCY_CURSOR_SEARCH, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_search, summary);
+    __latency_summary(session, dhandle, WT_LATENCY_CURSOR_UPDATE, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_cursor_update, summary);
+    __latency_summary(session, dhandle, WT_LATENCY_EVICT_APP, &summary);
+    WT_LATENCY_STAT_SET(session, stats, latency_evict_app, summary);
+}
+
+/*
+ * __wt_latency_clear --
+ *     Clear the connection's or a data handle's latency histograms.
+ */
+void
+__wt_latency_clear(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle)
+{
+    WT_LATENCY_HIST **slots;
+    size_t size;
+    u_int i;
+
+    if (dhandle == NULL) {
+        slots = S2C(session)->latency_hist;
+        size = WT_LATENCY_CONN_OPS * sizeof(WT_LATENCY_HIST);
+    } else {
+        slots = dhandle->latency_hist;
+        size = WT_LATENCY_DSRC_OPS * sizeof(WT_LATENCY_HIST);
+    }
+
+    /* Clearing races with threads recording latencies, the same as clearing statistics. */
+    for (i = 0; i < WT_LATENCY_SLOTS; ++i)
+        if (slots[i] != NULL)
+            memset(slots[i], 0, size);
+}
+
+/*
+ * __wt_latency_discard --
+ *     Discard the connection's or a data handle's latency histograms.
+ */
+void
+__wt_latency_discard(WT_SESSION_IMPL *session, WT_DATA_HANDLE *dhandle)
+{
+    WT_LATENCY_HIST **slots;
+    u_int i;
+
+    slots = dhandle == NULL ? S2C(session)->latency_hist : dhandle->latency_hist;
+    for (i = 0; i < WT_LATENCY_SLOTS; ++i)
+        __wt_free(session, slots[i]);
+}
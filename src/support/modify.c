@@ -457,6 +457,7 @@ __wt_modify_reconstruct_from_upd_list(
     cursor = &cbt->iface;
     /* While we have a pointer to our original modify, grab this information. */
     upd_value->tw.durable_start_ts = modify->durable_ts;
+    upd_value->tw.start_ts = modify->start_ts;
     upd_value->tw.start_txn = modify->txnid;
     onpage_retry = true;
 
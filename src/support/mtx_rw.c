@@ -84,6 +84,23 @@
  * after 256 requests. If a thread's write lock request would cause the 'next'
  * field to catch up with 'current', instead it waits to avoid the same ticket
  * being allocated to multiple threads.
+ *
+ * Reader-scalable locks:
+ *
+ * Every read lock acquisition above updates the same 64-bit word, so on large
+ * machines the lock's cache line bounces between cores even when there are no
+ * writers. A lock can optionally be switched to a "big reader" mode where each
+ * reader increments a counter in a cache-line padded slot chosen by its session
+ * ID, then checks the lock's 'writer_active' flag. Writers first acquire the
+ * ticket lock exclusively (serializing writers), set 'writer_active', then wait
+ * for every slot to drain. A reader finding 'writer_active' set backs out of
+ * its slot and queues on the ticket lock behind the writer; once granted, it
+ * re-enters its slot and releases the ticket lock, so a read lock is always
+ * held through the reader's slot. Readers and writers each publish their own
+ * state before checking the other's, with full barriers in between, so one of
+ * them always sees the other. Read lock acquisition doesn't write any shared
+ * cache line unless a writer is active, and writers can't be starved because
+ * new readers back off as soon as 'writer_active' is set.
  */
 
 #include "wt_internal.h"
@@ -98,6 +115,8 @@ __wt_rwlock_init(WT_SESSION_IMPL *session, WT_RWLOCK *l)
     l->u.v = 0;
     l->stat_read_count_off = l->stat_write_count_off = -1;
     l->stat_app_usecs_off = l->stat_int_usecs_off = -1;
+    l->reader_slots = NULL;
+    l->writer_active = false;
 
     WT_RET(__wt_cond_alloc(session, "rwlock wait", &l->cond_readers));
     WT_RET(__wt_cond_alloc(session, "rwlock wait", &l->cond_writers));
@@ -115,6 +134,67 @@ __wt_rwlock_destroy(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 
     __wt_cond_destroy(session, &l->cond_readers);
     __wt_cond_destroy(session, &l->cond_writers);
+    __wt_free(session, l->reader_slots);
+}
+
+/*
+ * __wt_rwlock_scalable --
+ *     Switch an initialized, unlocked read/write lock to reader-scalable mode.
+ */
+int
+__wt_rwlock_scalable(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    WT_ASSERT(session, !__wt_rwlock_islocked(session, l));
+
+    if (l->reader_slots != NULL)
+        return (0);
+    return (__wt_calloc_def(session, WT_RWLOCK_READER_SLOTS, &l->reader_slots));
+}
+
+/*
+ * __rwlock_reader_slot --
+ *     Return a session's reader indicator for a reader-scalable lock.
+ */
+static inline WT_RWLOCK_READER *
+__rwlock_reader_slot(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    /* Locks may be used without a session in standalone tests, share the first slot. */
+    return (&l->reader_slots[session == NULL ? 0 : session->id % WT_RWLOCK_READER_SLOTS]);
+}
+
+/*
+ * __rwlock_readers_drained --
+ *     Return if there are no active readers in any reader-scalable lock slot.
+ */
+static bool
+__rwlock_readers_drained(WT_RWLOCK *l)
+{
+    u_int i;
+
+    for (i = 0; i < WT_RWLOCK_READER_SLOTS; ++i)
+        if (l->reader_slots[i].readers != 0)
+            return (false);
+    return (true);
+}
+
+/*
+ * __rwlock_scalable_try_readlock --
+ *     Try to enter a reader-scalable lock's reader slot, fail if a writer is active.
+ */
+static inline bool
+__rwlock_scalable_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    WT_RWLOCK_READER *slot;
+
+    slot = __rwlock_reader_slot(session, l);
+
+    /* The atomic increment is a full barrier, ordering it before the check for writers. */
+    (void)__wt_atomic_addv32(&slot->readers, 1);
+    if (!l->writer_active)
+        return (true);
+    if (__wt_atomic_subv32(&slot->readers, 1) == 0)
+        __wt_cond_signal(session, l->cond_writers);
+    return (false);
 }
 
 /*
@@ -133,6 +213,9 @@ __wt_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
         stats[session->stat_bucket][l->stat_read_count_off]++;
     }
 
+    if (l->reader_slots != NULL)
+        return (__rwlock_scalable_try_readlock(session, l) ? 0 : EBUSY);
+
     old.u.v = l->u.v;
 
     /* This read lock can only be granted if there are no active writers. */
@@ -151,6 +234,44 @@ __wt_try_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
     return (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v) ? 0 : EBUSY);
 }
 
+/*
+ * __readunlock_ticket --
+ *     Release a shared ticket lock.
+ */
+static void
+__readunlock_ticket(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    WT_RWLOCK new, old;
+
+    do {
+        old.u.v = l->u.v;
+        WT_ASSERT(session, old.u.s.readers_active > 0);
+
+        /*
+         * Decrement the active reader count (other readers are doing the same, make sure we don't
+         * race).
+         */
+        new.u.v = old.u.v;
+        --new.u.s.readers_active;
+    } while (!__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v));
+
+    if (new.u.s.readers_active == 0 && new.u.s.current != new.u.s.next)
+        __wt_cond_signal(session, l->cond_writers);
+}
+
+/*
+ * __rwlock_scalable_enter_slot --
+ *     Move a reader holding a reader-scalable lock's ticket lock shared into its reader slot. No
+ *     writer can hold the lock while we hold the ticket lock shared; a writer acquiring the ticket
+ *     lock after us will wait for the slot to drain.
+ */
+static inline void
+__rwlock_scalable_enter_slot(WT_SESSION_IMPL *session, WT_RWLOCK *l)
+{
+    (void)__wt_atomic_addv32(&__rwlock_reader_slot(session, l)->readers, 1);
+    __readunlock_ticket(session, l);
+}
+
 /*
  * __read_blocked --
  *     Check whether the current read lock request should keep waiting.
@@ -179,6 +300,10 @@ __wt_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 
     WT_DIAGNOSTIC_YIELD;
 
+    /* Reader-scalable locks only use the ticket lock to queue behind an active writer. */
+    if (l->reader_slots != NULL && __rwlock_scalable_try_readlock(session, l))
+        return;
+
     for (;;) {
         /*
          * Fast path: if there is no active writer, join the current group.
@@ -191,8 +316,11 @@ __wt_readlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
              */
             if (++new.u.s.readers_active == 0)
                 goto stall;
-            if (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v))
+            if (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v)) {
+                if (l->reader_slots != NULL)
+                    __rwlock_scalable_enter_slot(session, l);
                 return;
+            }
             WT_PAUSE();
         }
 
@@ -271,6 +399,10 @@ stall:
 
     /* Sanity check that we (still) have the lock. */
     WT_ASSERT(session, ticket == l->u.s.current && l->u.s.readers_active > 0);
+
+    /* Reader-scalable locks: the read lock is held through our reader slot. */
+    if (l->reader_slots != NULL)
+        __rwlock_scalable_enter_slot(session, l);
 }
 
 /*
@@ -280,22 +412,14 @@ stall:
 void
 __wt_readunlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 {
-    WT_RWLOCK new, old;
-
-    do {
-        old.u.v = l->u.v;
-        WT_ASSERT(session, old.u.s.readers_active > 0);
-
-        /*
-         * Decrement the active reader count (other readers are doing the same, make sure we don't
-         * race).
-         */
-        new.u.v = old.u.v;
-        --new.u.s.readers_active;
-    } while (!__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v));
+    if (l->reader_slots != NULL) {
+        if (__wt_atomic_subv32(&__rwlock_reader_slot(session, l)->readers, 1) == 0 &&
+          l->writer_active)
+            __wt_cond_signal(session, l->cond_writers);
+        return;
+    }
 
-    if (new.u.s.readers_active == 0 && new.u.s.current != new.u.s.next)
-        __wt_cond_signal(session, l->cond_writers);
+    __readunlock_ticket(session, l);
 }
 
 /*
@@ -336,7 +460,22 @@ __wt_try_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
      */
     new.u.v = old.u.v;
     new.u.s.next++;
-    return (__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v) ? 0 : EBUSY);
+    if (!__wt_atomic_casv64(&l->u.v, old.u.v, new.u.v))
+        return (EBUSY);
+
+    /*
+     * Reader-scalable locks: announce the writer, then check for readers that entered their slots
+     * without the ticket lock.
+     */
+    if (l->reader_slots != NULL) {
+        l->writer_active = true;
+        WT_FULL_BARRIER();
+        if (!__rwlock_readers_drained(l)) {
+            __wt_writeunlock(session, l);
+            return (EBUSY);
+        }
+    }
+    return (0);
 }
 
 /*
@@ -352,6 +491,16 @@ __write_blocked(WT_SESSION_IMPL *session)
     return (session->current_rwticket != l->u.s.current || l->u.s.readers_active != 0);
 }
 
+/*
+ * __write_blocked_scalable --
+ *     Check whether a reader-scalable write lock request should keep waiting for readers.
+ */
+static bool
+__write_blocked_scalable(WT_SESSION_IMPL *session)
+{
+    return (!__rwlock_readers_drained(session->current_rwlock));
+}
+
 /*
  * __wt_writelock --
  *     Wait to get an exclusive lock.
@@ -407,6 +556,26 @@ __wt_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
             __wt_cond_wait(session, l->cond_writers, 10 * WT_THOUSAND, __write_blocked);
         }
     }
+
+    /*
+     * Reader-scalable locks: we hold the ticket lock exclusively, announce the writer so new
+     * readers queue on the ticket lock, then wait for readers in their slots to drain.
+     */
+    if (l->reader_slots != NULL) {
+        l->writer_active = true;
+        WT_FULL_BARRIER();
+        for (pause_cnt = 0; !__rwlock_readers_drained(l); pause_cnt++) {
+            if (pause_cnt < WT_THOUSAND)
+                WT_PAUSE();
+            else if (pause_cnt < 1200)
+                __wt_yield();
+            else {
+                session->current_rwlock = l;
+                __wt_cond_wait(
+                  session, l->cond_writers, 10 * WT_THOUSAND, __write_blocked_scalable);
+            }
+        }
+    }
     if (time_start != 0) {
         time_stop = __wt_clock(session);
         time_diff = WT_CLOCKDIFF_US(time_stop, time_start);
@@ -447,6 +616,10 @@ __wt_writeunlock(WT_SESSION_IMPL *session, WT_RWLOCK *l)
 {
     WT_RWLOCK new, old;
 
+    /* Reader-scalable locks: let readers back into their slots, ordered after our updates. */
+    if (l->reader_slots != NULL)
+        WT_PUBLISH(l->writer_active, false);
+
     do {
         old.u.v = l->u.v;
 
@@ -488,5 +661,6 @@ __wt_rwlock_islocked(WT_SESSION_IMPL *session, WT_RWLOCK *l)
     WT_UNUSED(session);
 
     old.u.v = l->u.v;
-    return (old.u.s.current != old.u.s.next || old.u.s.readers_active != 0);
+    return (old.u.s.current != old.u.s.next || old.u.s.readers_active != 0 ||
+      (l->reader_slots != NULL && !__rwlock_readers_drained(l)));
 }
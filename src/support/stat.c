@@ -9,9 +9,18 @@ static const char *const __stats_dsrc_desc[] = {
   "LSM: bloom filter pages evicted from cache",
   "LSM: bloom filter pages read into cache",
   "LSM: bloom filters in the LSM tree",
+  "LSM: bytes read by merges",
+  "LSM: bytes written by chunk flushes",
+  "LSM: bytes written by merges",
   "LSM: chunks in the LSM tree",
   "LSM: highest merge generation in the LSM tree",
+  "LSM: merge partitions written",
+  "LSM: merge throughput in bytes per second",
+  "LSM: merge time (msecs)",
+  "LSM: merge write amplification (bytes written per 100 bytes flushed)",
+  "LSM: merges completed",
   "LSM: queries that could have benefited from a Bloom filter that did not exist",
+  "LSM: rows written by merges",
   "LSM: sleep for LSM checkpoint throttle",
   "LSM: sleep for LSM merge throttle",
   "LSM: total size of bloom filters",
@@ -29,6 +38,8 @@ static const char *const __stats_dsrc_desc[] = {
   "block-manager: minor version number",
   "btree: btree checkpoint generation",
   "btree: btree clean tree checkpoint expiration time",
+  "btree: btree compact bytes rewritten",
+  "btree: btree compact pages marked for rewrite to remove expired records",
   "btree: btree compact pages reviewed",
   "btree: btree compact pages rewritten",
   "btree: btree compact pages skipped",
@@ -196,8 +207,11 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: cursor get value calls that return an error",
   "cursor: cursor insert calls that return an error",
   "cursor: cursor insert check calls that return an error",
+  "cursor: cursor insert list search indexes built",
   "cursor: cursor largest key calls that return an error",
   "cursor: cursor modify calls that return an error",
+  "cursor: cursor next and prev entries skipped by the key filter",
+  "cursor: cursor next and prev entries skipped by the value filter",
   "cursor: cursor next calls that return an error",
   "cursor: cursor next calls that skip due to a globally visible history store tombstone",
   "cursor: cursor next calls that skip greater than 1 and fewer than 100 entries",
@@ -214,6 +228,8 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: cursor reset calls that return an error",
   "cursor: cursor search calls that return an error",
   "cursor: cursor search near calls that return an error",
+  "cursor: cursor searches found in an insert list search index",
+  "cursor: cursor searches not found in an insert list search index",
   "cursor: cursor update calls that return an error",
   "cursor: insert calls",
   "cursor: insert key and value bytes",
@@ -235,9 +251,36 @@ static const char *const __stats_dsrc_desc[] = {
   "cursor: update calls",
   "cursor: update key and value bytes",
   "cursor: update value size change",
+  "latency: application thread page eviction 50th percentile (nsecs)",
+  "latency: application thread page eviction 90th percentile (nsecs)",
+  "latency: application thread page eviction 99.9th percentile (nsecs)",
+  "latency: application thread page eviction 99th percentile (nsecs)",
+  "latency: application thread page eviction maximum (nsecs)",
+  "latency: cursor insert 50th percentile (nsecs)",
+  "latency: cursor insert 90th percentile (nsecs)",
+  "latency: cursor insert 99.9th percentile (nsecs)",
+  "latency: cursor insert 99th percentile (nsecs)",
+  "latency: cursor insert maximum (nsecs)",
+  "latency: cursor remove 50th percentile (nsecs)",
+  "latency: cursor remove 90th percentile (nsecs)",
+  "latency: cursor remove 99.9th percentile (nsecs)",
+  "latency: cursor remove 99th percentile (nsecs)",
+  "latency: cursor remove maximum (nsecs)",
+  "latency: cursor search 50th percentile (nsecs)",
+  "latency: cursor search 90th percentile (nsecs)",
+  "latency: cursor search 99.9th percentile (nsecs)",
+  "latency: cursor search 99th percentile (nsecs)",
+  "latency: cursor search maximum (nsecs)",
+  "latency: cursor update 50th percentile (nsecs)",
+  "latency: cursor update 90th percentile (nsecs)",
+  "latency: cursor update 99.9th percentile (nsecs)",
+  "latency: cursor update 99th percentile (nsecs)",
+  "latency: cursor update maximum (nsecs)",
   "reconciliation: VLCS pages explicitly reconciled as empty",
   "reconciliation: approximate byte size of timestamps in pages written",
   "reconciliation: approximate byte size of transaction IDs in pages written",
+  "reconciliation: bulk-load pages written by write offload threads",
+  "reconciliation: bytes reclaimed from records removed after their time-to-live expired",
   "reconciliation: dictionary matches",
   "reconciliation: fast-path pages deleted",
   "reconciliation: internal page key bytes discarded using suffix compression",
@@ -265,6 +308,7 @@ static const char *const __stats_dsrc_desc[] = {
   "reconciliation: pages written including at least one stop durable timestamp",
   "reconciliation: pages written including at least one stop timestamp",
   "reconciliation: pages written including at least one stop transaction ID",
+  "reconciliation: records removed after their time-to-live expired",
   "reconciliation: records written including a prepare",
   "reconciliation: records written including a start durable timestamp",
   "reconciliation: records written including a start timestamp",
@@ -334,9 +378,18 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->bloom_page_evict = 0;
     stats->bloom_page_read = 0;
     stats->bloom_count = 0;
+    stats->lsm_merge_bytes_read = 0;
+    stats->lsm_merge_bytes_flushed = 0;
+    stats->lsm_merge_bytes_written = 0;
     stats->lsm_chunk_count = 0;
     stats->lsm_generation_max = 0;
+    stats->lsm_merge_partitions = 0;
+    /* not clearing lsm_merge_throughput */
+    stats->lsm_merge_time = 0;
+    /* not clearing lsm_merge_write_amplification */
+    stats->lsm_merge_count = 0;
     stats->lsm_lookup_no_bloom = 0;
+    stats->lsm_merge_rows = 0;
     stats->lsm_checkpoint_throttle = 0;
     stats->lsm_merge_throttle = 0;
     stats->bloom_size = 0;
@@ -354,6 +407,8 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->block_minor = 0;
     /* not clearing btree_checkpoint_generation */
     /* not clearing btree_clean_checkpoint_timer */
+    /* not clearing btree_compact_bytes_rewritten */
+    /* not clearing btree_compact_pages_time_to_live */
     /* not clearing btree_compact_pages_reviewed */
     /* not clearing btree_compact_pages_rewritten */
     /* not clearing btree_compact_pages_skipped */
@@ -508,8 +563,11 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_get_value_error = 0;
     stats->cursor_insert_error = 0;
     stats->cursor_insert_check_error = 0;
+    stats->cursor_insert_index_build = 0;
     stats->cursor_largest_key_error = 0;
     stats->cursor_modify_error = 0;
+    stats->cursor_filter_key_skip = 0;
+    stats->cursor_filter_value_skip = 0;
     stats->cursor_next_error = 0;
     stats->cursor_next_hs_tombstone = 0;
     stats->cursor_next_skip_lt_100 = 0;
@@ -526,6 +584,8 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_reset_error = 0;
     stats->cursor_search_error = 0;
     stats->cursor_search_near_error = 0;
+    stats->cursor_insert_index_hit = 0;
+    stats->cursor_insert_index_miss = 0;
     stats->cursor_update_error = 0;
     stats->cursor_insert = 0;
     stats->cursor_insert_bytes = 0;
@@ -547,9 +607,36 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->cursor_update = 0;
     stats->cursor_update_bytes = 0;
     stats->cursor_update_bytes_changed = 0;
+    /* not clearing latency_evict_app_p50 */
+    /* not clearing latency_evict_app_p90 */
+    /* not clearing latency_evict_app_p999 */
+    /* not clearing latency_evict_app_p99 */
+    /* not clearing latency_evict_app_max */
+    /* not clearing latency_cursor_insert_p50 */
+    /* not clearing latency_cursor_insert_p90 */
+    /* not clearing latency_cursor_insert_p999 */
+    /* not clearing latency_cursor_insert_p99 */
+    /* not clearing latency_cursor_insert_max */
+    /* not clearing latency_cursor_remove_p50 */
+    /* not clearing latency_cursor_remove_p90 */
+    /* not clearing latency_cursor_remove_p999 */
+    /* not clearing latency_cursor_remove_p99 */
+    /* not clearing latency_cursor_remove_max */
+    /* not clearing latency_cursor_search_p50 */
+    /* not clearing latency_cursor_search_p90 */
+    /* not clearing latency_cursor_search_p999 */
+    /* not clearing latency_cursor_search_p99 */
+    /* not clearing latency_cursor_search_max */
+    /* not clearing latency_cursor_update_p50 */
+    /* not clearing latency_cursor_update_p90 */
+    /* not clearing latency_cursor_update_p999 */
+    /* not clearing latency_cursor_update_p99 */
+    /* not clearing latency_cursor_update_max */
     stats->rec_vlcs_emptied_pages = 0;
     stats->rec_time_window_bytes_ts = 0;
     stats->rec_time_window_bytes_txn = 0;
+    stats->rec_bulk_offload_pages = 0;
+    stats->rec_time_to_live_bytes = 0;
     stats->rec_dictionary = 0;
     stats->rec_page_delete_fast = 0;
     stats->rec_suffix_compression = 0;
@@ -577,6 +664,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
     stats->rec_time_window_pages_durable_stop_ts = 0;
     stats->rec_time_window_pages_stop_ts = 0;
     stats->rec_time_window_pages_stop_txn = 0;
+    stats->rec_time_to_live_expired = 0;
     stats->rec_time_window_prepared = 0;
     stats->rec_time_window_durable_start_ts = 0;
     stats->rec_time_window_start_ts = 0;
@@ -619,10 +707,19 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->bloom_page_evict += from->bloom_page_evict;
     to->bloom_page_read += from->bloom_page_read;
     to->bloom_count += from->bloom_count;
+    to->lsm_merge_bytes_read += from->lsm_merge_bytes_read;
+    to->lsm_merge_bytes_flushed += from->lsm_merge_bytes_flushed;
+    to->lsm_merge_bytes_written += from->lsm_merge_bytes_written;
     to->lsm_chunk_count += from->lsm_chunk_count;
     if (from->lsm_generation_max > to->lsm_generation_max)
         to->lsm_generation_max = from->lsm_generation_max;
+    to->lsm_merge_partitions += from->lsm_merge_partitions;
+    to->lsm_merge_throughput += from->lsm_merge_throughput;
+    to->lsm_merge_time += from->lsm_merge_time;
+    to->lsm_merge_write_amplification += from->lsm_merge_write_amplification;
+    to->lsm_merge_count += from->lsm_merge_count;
     to->lsm_lookup_no_bloom += from->lsm_lookup_no_bloom;
+    to->lsm_merge_rows += from->lsm_merge_rows;
     to->lsm_checkpoint_throttle += from->lsm_checkpoint_throttle;
     to->lsm_merge_throttle += from->lsm_merge_throttle;
     to->bloom_size += from->bloom_size;
@@ -644,6 +741,8 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
         to->block_minor = from->block_minor;
     to->btree_checkpoint_generation += from->btree_checkpoint_generation;
     to->btree_clean_checkpoint_timer += from->btree_clean_checkpoint_timer;
+    to->btree_compact_bytes_rewritten += from->btree_compact_bytes_rewritten;
+    to->btree_compact_pages_time_to_live += from->btree_compact_pages_time_to_live;
     to->btree_compact_pages_reviewed += from->btree_compact_pages_reviewed;
     to->btree_compact_pages_rewritten += from->btree_compact_pages_rewritten;
     to->btree_compact_pages_skipped += from->btree_compact_pages_skipped;
@@ -812,8 +911,11 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_get_value_error += from->cursor_get_value_error;
     to->cursor_insert_error += from->cursor_insert_error;
     to->cursor_insert_check_error += from->cursor_insert_check_error;
+    to->cursor_insert_index_build += from->cursor_insert_index_build;
     to->cursor_largest_key_error += from->cursor_largest_key_error;
     to->cursor_modify_error += from->cursor_modify_error;
+    to->cursor_filter_key_skip += from->cursor_filter_key_skip;
+    to->cursor_filter_value_skip += from->cursor_filter_value_skip;
     to->cursor_next_error += from->cursor_next_error;
     to->cursor_next_hs_tombstone += from->cursor_next_hs_tombstone;
     to->cursor_next_skip_lt_100 += from->cursor_next_skip_lt_100;
@@ -830,6 +932,8 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_reset_error += from->cursor_reset_error;
     to->cursor_search_error += from->cursor_search_error;
     to->cursor_search_near_error += from->cursor_search_near_error;
+    to->cursor_insert_index_hit += from->cursor_insert_index_hit;
+    to->cursor_insert_index_miss += from->cursor_insert_index_miss;
     to->cursor_update_error += from->cursor_update_error;
     to->cursor_insert += from->cursor_insert;
     to->cursor_insert_bytes += from->cursor_insert_bytes;
@@ -851,9 +955,61 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->cursor_update += from->cursor_update;
     to->cursor_update_bytes += from->cursor_update_bytes;
     to->cursor_update_bytes_changed += from->cursor_update_bytes_changed;
+    if (from->latency_evict_app_p50 > to->latency_evict_app_p50)
+        to->latency_evict_app_p50 = from->latency_evict_app_p50;
+    if (from->latency_evict_app_p90 > to->latency_evict_app_p90)
+        to->latency_evict_app_p90 = from->latency_evict_app_p90;
+    if (from->latency_evict_app_p999 > to->latency_evict_app_p999)
+        to->latency_evict_app_p999 = from->latency_evict_app_p999;
+    if (from->latency_evict_app_p99 > to->latency_evict_app_p99)
+        to->latency_evict_app_p99 = from->latency_evict_app_p99;
+    if (from->latency_evict_app_max > to->latency_evict_app_max)
+        to->latency_evict_app_max = from->latency_evict_app_max;
+    if (from->latency_cursor_insert_p50 > to->latency_cursor_insert_p50)
+        to->latency_cursor_insert_p50 = from->latency_cursor_insert_p50;
+    if (from->latency_cursor_insert_p90 > to->latency_cursor_insert_p90)
+        to->latency_cursor_insert_p90 = from->latency_cursor_insert_p90;
+    if (from->latency_cursor_insert_p999 > to->latency_cursor_insert_p999)
+        to->latency_cursor_insert_p999 = from->latency_cursor_insert_p999;
+    if (from->latency_cursor_insert_p99 > to->latency_cursor_insert_p99)
+        to->latency_cursor_insert_p99 = from->latency_cursor_insert_p99;
+    if (from->latency_cursor_insert_max > to->latency_cursor_insert_max)
+        to->latency_cursor_insert_max = from->latency_cursor_insert_max;
+    if (from->latency_cursor_remove_p50 > to->latency_cursor_remove_p50)
+        to->latency_cursor_remove_p50 = from->latency_cursor_remove_p50;
+    if (from->latency_cursor_remove_p90 > to->latency_cursor_remove_p90)
+        to->latency_cursor_remove_p90 = from->latency_cursor_remove_p90;
+    if (from->latency_cursor_remove_p999 > to->latency_cursor_remove_p999)
+        to->latency_cursor_remove_p999 = from->latency_cursor_remove_p999;
+    if (from->latency_cursor_remove_p99 > to->latency_cursor_remove_p99)
+        to->latency_cursor_remove_p99 = from->latency_cursor_remove_p99;
+    if (from->latency_cursor_remove_max > to->latency_cursor_remove_max)
+        to->latency_cursor_remove_max = from->latency_cursor_remove_max;
+    if (from->latency_cursor_search_p50 > to->latency_cursor_search_p50)
+        to->latency_cursor_search_p50 = from->latency_cursor_search_p50;
+    if (from->latency_cursor_search_p90 > to->latency_cursor_search_p90)
+        to->latency_cursor_search_p90 = from->latency_cursor_search_p90;
+    if (from->latency_cursor_search_p999 > to->latency_cursor_search_p999)
+        to->latency_cursor_search_p999 = from->latency_cursor_search_p999;
+    if (from->latency_cursor_search_p99 > to->latency_cursor_search_p99)
+        to->latency_cursor_search_p99 = from->latency_cursor_search_p99;
+    if (from->latency_cursor_search_max > to->latency_cursor_search_max)
+        to->latency_cursor_search_max = from->latency_cursor_search_max;
+    if (from->latency_cursor_update_p50 > to->latency_cursor_update_p50)
+        to->latency_cursor_update_p50 = from->latency_cursor_update_p50;
+    if (from->latency_cursor_update_p90 > to->latency_cursor_update_p90)
+        to->latency_cursor_update_p90 = from->latency_cursor_update_p90;
+    if (from->latency_cursor_update_p999 > to->latency_cursor_update_p999)
+        to->latency_cursor_update_p999 = from->latency_cursor_update_p999;
+    if (from->latency_cursor_update_p99 > to->latency_cursor_update_p99)
+        to->latency_cursor_update_p99 = from->latency_cursor_update_p99;
+    if (from->latency_cursor_update_max > to->latency_cursor_update_max)
+        to->latency_cursor_update_max = from->latency_cursor_update_max;
     to->rec_vlcs_emptied_pages += from->rec_vlcs_emptied_pages;
     to->rec_time_window_bytes_ts += from->rec_time_window_bytes_ts;
     to->rec_time_window_bytes_txn += from->rec_time_window_bytes_txn;
+    to->rec_bulk_offload_pages += from->rec_bulk_offload_pages;
+    to->rec_time_to_live_bytes += from->rec_time_to_live_bytes;
     to->rec_dictionary += from->rec_dictionary;
     to->rec_page_delete_fast += from->rec_page_delete_fast;
     to->rec_suffix_compression += from->rec_suffix_compression;
@@ -882,6 +1038,7 @@ __wt_stat_dsrc_aggregate_single(WT_DSRC_STATS *from, WT_DSRC_STATS *to)
     to->rec_time_window_pages_durable_stop_ts += from->rec_time_window_pages_durable_stop_ts;
     to->rec_time_window_pages_stop_ts += from->rec_time_window_pages_stop_ts;
     to->rec_time_window_pages_stop_txn += from->rec_time_window_pages_stop_txn;
+    to->rec_time_to_live_expired += from->rec_time_to_live_expired;
     to->rec_time_window_prepared += from->rec_time_window_prepared;
     to->rec_time_window_durable_start_ts += from->rec_time_window_durable_start_ts;
     to->rec_time_window_start_ts += from->rec_time_window_start_ts;
@@ -917,10 +1074,19 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->bloom_page_evict += WT_STAT_READ(from, bloom_page_evict);
     to->bloom_page_read += WT_STAT_READ(from, bloom_page_read);
     to->bloom_count += WT_STAT_READ(from, bloom_count);
+    to->lsm_merge_bytes_read += WT_STAT_READ(from, lsm_merge_bytes_read);
+    to->lsm_merge_bytes_flushed += WT_STAT_READ(from, lsm_merge_bytes_flushed);
+    to->lsm_merge_bytes_written += WT_STAT_READ(from, lsm_merge_bytes_written);
     to->lsm_chunk_count += WT_STAT_READ(from, lsm_chunk_count);
     if ((v = WT_STAT_READ(from, lsm_generation_max)) > to->lsm_generation_max)
         to->lsm_generation_max = v;
+    to->lsm_merge_partitions += WT_STAT_READ(from, lsm_merge_partitions);
+    to->lsm_merge_throughput += WT_STAT_READ(from, lsm_merge_throughput);
+    to->lsm_merge_time += WT_STAT_READ(from, lsm_merge_time);
+    to->lsm_merge_write_amplification += WT_STAT_READ(from, lsm_merge_write_amplification);
+    to->lsm_merge_count += WT_STAT_READ(from, lsm_merge_count);
     to->lsm_lookup_no_bloom += WT_STAT_READ(from, lsm_lookup_no_bloom);
+    to->lsm_merge_rows += WT_STAT_READ(from, lsm_merge_rows);
     to->lsm_checkpoint_throttle += WT_STAT_READ(from, lsm_checkpoint_throttle);
     to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
     to->bloom_size += WT_STAT_READ(from, bloom_size);
@@ -942,6 +1108,8 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
         to->block_minor = v;
     to->btree_checkpoint_generation += WT_STAT_READ(from, btree_checkpoint_generation);
     to->btree_clean_checkpoint_timer += WT_STAT_READ(from, btree_clean_checkpoint_timer);
+    to->btree_compact_bytes_rewritten += WT_STAT_READ(from, btree_compact_bytes_rewritten);
+    to->btree_compact_pages_time_to_live += WT_STAT_READ(from, btree_compact_pages_time_to_live);
     to->btree_compact_pages_reviewed += WT_STAT_READ(from, btree_compact_pages_reviewed);
     to->btree_compact_pages_rewritten += WT_STAT_READ(from, btree_compact_pages_rewritten);
     to->btree_compact_pages_skipped += WT_STAT_READ(from, btree_compact_pages_skipped);
@@ -1122,8 +1290,11 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cursor_get_value_error += WT_STAT_READ(from, cursor_get_value_error);
     to->cursor_insert_error += WT_STAT_READ(from, cursor_insert_error);
     to->cursor_insert_check_error += WT_STAT_READ(from, cursor_insert_check_error);
+    to->cursor_insert_index_build += WT_STAT_READ(from, cursor_insert_index_build);
     to->cursor_largest_key_error += WT_STAT_READ(from, cursor_largest_key_error);
     to->cursor_modify_error += WT_STAT_READ(from, cursor_modify_error);
+    to->cursor_filter_key_skip += WT_STAT_READ(from, cursor_filter_key_skip);
+    to->cursor_filter_value_skip += WT_STAT_READ(from, cursor_filter_value_skip);
     to->cursor_next_error += WT_STAT_READ(from, cursor_next_error);
     to->cursor_next_hs_tombstone += WT_STAT_READ(from, cursor_next_hs_tombstone);
     to->cursor_next_skip_lt_100 += WT_STAT_READ(from, cursor_next_skip_lt_100);
@@ -1140,6 +1311,8 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cursor_reset_error += WT_STAT_READ(from, cursor_reset_error);
     to->cursor_search_error += WT_STAT_READ(from, cursor_search_error);
     to->cursor_search_near_error += WT_STAT_READ(from, cursor_search_near_error);
+    to->cursor_insert_index_hit += WT_STAT_READ(from, cursor_insert_index_hit);
+    to->cursor_insert_index_miss += WT_STAT_READ(from, cursor_insert_index_miss);
     to->cursor_update_error += WT_STAT_READ(from, cursor_update_error);
     to->cursor_insert += WT_STAT_READ(from, cursor_insert);
     to->cursor_insert_bytes += WT_STAT_READ(from, cursor_insert_bytes);
@@ -1161,9 +1334,61 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
     to->cursor_update += WT_STAT_READ(from, cursor_update);
     to->cursor_update_bytes += WT_STAT_READ(from, cursor_update_bytes);
     to->cursor_update_bytes_changed += WT_STAT_READ(from, cursor_update_bytes_changed);
+    if ((v = WT_STAT_READ(from, latency_evict_app_p50)) > to->latency_evict_app_p50)
+        to->latency_evict_app_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_p90)) > to->latency_evict_app_p90)
+        to->latency_evict_app_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_p999)) > to->latency_evict_app_p999)
+        to->latency_evict_app_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_p99)) > to->latency_evict_app_p99)
+        to->latency_evict_app_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_max)) > to->latency_evict_app_max)
+        to->latency_evict_app_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p50)) > to->latency_cursor_insert_p50)
+        to->latency_cursor_insert_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p90)) > to->latency_cursor_insert_p90)
+        to->latency_cursor_insert_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p999)) > to->latency_cursor_insert_p999)
+        to->latency_cursor_insert_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p99)) > to->latency_cursor_insert_p99)
+        to->latency_cursor_insert_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_max)) > to->latency_cursor_insert_max)
+        to->latency_cursor_insert_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p50)) > to->latency_cursor_remove_p50)
+        to->latency_cursor_remove_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p90)) > to->latency_cursor_remove_p90)
+        to->latency_cursor_remove_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p999)) > to->latency_cursor_remove_p999)
+        to->latency_cursor_remove_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p99)) > to->latency_cursor_remove_p99)
+        to->latency_cursor_remove_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_max)) > to->latency_cursor_remove_max)
+        to->latency_cursor_remove_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p50)) > to->latency_cursor_search_p50)
+        to->latency_cursor_search_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p90)) > to->latency_cursor_search_p90)
+        to->latency_cursor_search_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p999)) > to->latency_cursor_search_p999)
+        to->latency_cursor_search_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p99)) > to->latency_cursor_search_p99)
+        to->latency_cursor_search_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_max)) > to->latency_cursor_search_max)
+        to->latency_cursor_search_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p50)) > to->latency_cursor_update_p50)
+        to->latency_cursor_update_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p90)) > to->latency_cursor_update_p90)
+        to->latency_cursor_update_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p999)) > to->latency_cursor_update_p999)
+        to->latency_cursor_update_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p99)) > to->latency_cursor_update_p99)
+        to->latency_cursor_update_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_max)) > to->latency_cursor_update_max)
+        to->latency_cursor_update_max = v;
     to->rec_vlcs_emptied_pages += WT_STAT_READ(from, rec_vlcs_emptied_pages);
     to->rec_time_window_bytes_ts += WT_STAT_READ(from, rec_time_window_bytes_ts);
     to->rec_time_window_bytes_txn += WT_STAT_READ(from, rec_time_window_bytes_txn);
+    to->rec_bulk_offload_pages += WT_STAT_READ(from, rec_bulk_offload_pages);
+    to->rec_time_to_live_bytes += WT_STAT_READ(from, rec_time_to_live_bytes);
     to->rec_dictionary += WT_STAT_READ(from, rec_dictionary);
     to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
     to->rec_suffix_compression += WT_STAT_READ(from, rec_suffix_compression);
@@ -1196,6 +1421,7 @@ __wt_stat_dsrc_aggregate(WT_DSRC_STATS **from, WT_DSRC_STATS *to)
       WT_STAT_READ(from, rec_time_window_pages_durable_stop_ts);
     to->rec_time_window_pages_stop_ts += WT_STAT_READ(from, rec_time_window_pages_stop_ts);
     to->rec_time_window_pages_stop_txn += WT_STAT_READ(from, rec_time_window_pages_stop_txn);
+    to->rec_time_to_live_expired += WT_STAT_READ(from, rec_time_to_live_expired);
     to->rec_time_window_prepared += WT_STAT_READ(from, rec_time_window_prepared);
     to->rec_time_window_durable_start_ts += WT_STAT_READ(from, rec_time_window_durable_start_ts);
     to->rec_time_window_start_ts += WT_STAT_READ(from, rec_time_window_start_ts);
@@ -1260,6 +1486,7 @@ static const char *const __stats_connection_desc[] = {
   "block-manager: blocks read",
   "block-manager: blocks written",
   "block-manager: bytes read",
+  "block-manager: bytes read via direct I/O",
   "block-manager: bytes read via memory map API",
   "block-manager: bytes read via system call API",
   "block-manager: bytes written",
@@ -1432,12 +1659,14 @@ static const char *const __stats_connection_desc[] = {
   "capacity: background fsync time (msecs)",
   "capacity: bytes read",
   "capacity: bytes written for checkpoint",
+  "capacity: bytes written for compaction",
   "capacity: bytes written for eviction",
   "capacity: bytes written for log",
   "capacity: bytes written total",
   "capacity: threshold to call fsync",
   "capacity: time waiting due to total capacity (usecs)",
   "capacity: time waiting during checkpoint (usecs)",
+  "capacity: time waiting during compaction (usecs)",
   "capacity: time waiting during eviction (usecs)",
   "capacity: time waiting during logging (usecs)",
   "capacity: time waiting during read (usecs)",
@@ -1494,11 +1723,14 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor insert calls that return an error",
   "cursor: cursor insert check calls that return an error",
   "cursor: cursor insert key and value bytes",
+  "cursor: cursor insert list search indexes built",
   "cursor: cursor largest key calls that return an error",
   "cursor: cursor modify calls",
   "cursor: cursor modify calls that return an error",
   "cursor: cursor modify key and value bytes affected",
   "cursor: cursor modify value bytes modified",
+  "cursor: cursor next and prev entries skipped by the key filter",
+  "cursor: cursor next and prev entries skipped by the value filter",
   "cursor: cursor next calls",
   "cursor: cursor next calls that return an error",
   "cursor: cursor next calls that skip due to a globally visible history store tombstone",
@@ -1525,10 +1757,15 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor search history store calls",
   "cursor: cursor search near calls",
   "cursor: cursor search near calls that return an error",
+  "cursor: cursor searches found in an insert list search index",
+  "cursor: cursor searches not found in an insert list search index",
   "cursor: cursor sweep buckets",
   "cursor: cursor sweep cursors closed",
   "cursor: cursor sweep cursors examined",
   "cursor: cursor sweeps",
+  "cursor: cursor table index update batches applied",
+  "cursor: cursor table index updates batched",
+  "cursor: cursor table index updates cancelled in a batch",
   "cursor: cursor truncate calls",
   "cursor: cursor truncates performed on individual keys",
   "cursor: cursor update calls",
@@ -1537,6 +1774,8 @@ static const char *const __stats_connection_desc[] = {
   "cursor: cursor update value size change",
   "cursor: cursors reused from cache",
   "cursor: open cursor count",
+  "data-handle: connection data handle lock-free lookups",
+  "data-handle: connection data handle lock-free lookups that fell back to the handle list lock",
   "data-handle: connection data handle size",
   "data-handle: connection data handles currently active",
   "data-handle: connection sweep candidate became referenced",
@@ -1547,6 +1786,41 @@ static const char *const __stats_connection_desc[] = {
   "data-handle: connection sweeps skipped due to checkpoint gathering handles",
   "data-handle: session dhandles swept",
   "data-handle: session sweep attempts",
+  "latency: application thread page eviction 50th percentile (nsecs)",
+  "latency: application thread page eviction 90th percentile (nsecs)",
+  "latency: application thread page eviction 99.9th percentile (nsecs)",
+  "latency: application thread page eviction 99th percentile (nsecs)",
+  "latency: application thread page eviction maximum (nsecs)",
+  "latency: cursor insert 50th percentile (nsecs)",
+  "latency: cursor insert 90th percentile (nsecs)",
+  "latency: cursor insert 99.9th percentile (nsecs)",
+  "latency: cursor insert 99th percentile (nsecs)",
+  "latency: cursor insert maximum (nsecs)",
+  "latency: cursor remove 50th percentile (nsecs)",
+  "latency: cursor remove 90th percentile (nsecs)",
+  "latency: cursor remove 99.9th percentile (nsecs)",
+  "latency: cursor remove 99th percentile (nsecs)",
+  "latency: cursor remove maximum (nsecs)",
+  "latency: cursor search 50th percentile (nsecs)",
+  "latency: cursor search 90th percentile (nsecs)",
+  "latency: cursor search 99.9th percentile (nsecs)",
+  "latency: cursor search 99th percentile (nsecs)",
+  "latency: cursor search maximum (nsecs)",
+  "latency: cursor update 50th percentile (nsecs)",
+  "latency: cursor update 90th percentile (nsecs)",
+  "latency: cursor update 99.9th percentile (nsecs)",
+  "latency: cursor update 99th percentile (nsecs)",
+  "latency: cursor update maximum (nsecs)",
+  "latency: log sync 50th percentile (nsecs)",
+  "latency: log sync 90th percentile (nsecs)",
+  "latency: log sync 99.9th percentile (nsecs)",
+  "latency: log sync 99th percentile (nsecs)",
+  "latency: log sync maximum (nsecs)",
+  "latency: transaction commit 50th percentile (nsecs)",
+  "latency: transaction commit 90th percentile (nsecs)",
+  "latency: transaction commit 99.9th percentile (nsecs)",
+  "latency: transaction commit 99th percentile (nsecs)",
+  "latency: transaction commit maximum (nsecs)",
   "lock: checkpoint lock acquisitions",
   "lock: checkpoint lock application thread wait time (usecs)",
   "lock: checkpoint lock internal thread wait time (usecs)",
@@ -1647,6 +1921,8 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: VLCS pages explicitly reconciled as empty",
   "reconciliation: approximate byte size of timestamps in pages written",
   "reconciliation: approximate byte size of transaction IDs in pages written",
+  "reconciliation: bulk-load pages written by write offload threads",
+  "reconciliation: bytes reclaimed from records removed after their time-to-live expired",
   "reconciliation: fast-path pages deleted",
   "reconciliation: leaf-page overflow keys",
   "reconciliation: maximum seconds spent in a reconciliation call",
@@ -1674,6 +1950,7 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: pages written including at least one stop durable timestamp",
   "reconciliation: pages written including at least one stop timestamp",
   "reconciliation: pages written including at least one stop transaction ID",
+  "reconciliation: records removed after their time-to-live expired",
   "reconciliation: records written including a prepare state",
   "reconciliation: records written including a start durable timestamp",
   "reconciliation: records written including a start timestamp",
@@ -1684,6 +1961,15 @@ static const char *const __stats_connection_desc[] = {
   "reconciliation: split bytes currently awaiting free",
   "reconciliation: split objects currently awaiting free",
   "session: attempts to remove a local object and the object is in use",
+  "session: background compact failed calls",
+  "session: background compact interrupted by shutdown or reconfiguration",
+  "session: background compact recovered bytes",
+  "session: background compact running",
+  "session: background compact server passes",
+  "session: background compact skipped as process would not reduce file size",
+  "session: background compact skipped excluded objects",
+  "session: background compact successful calls",
+  "session: background compact yielded to eviction",
   "session: flush_tier failed calls",
   "session: flush_tier operation calls",
   "session: flush_tier tables skipped due to no checkpoint",
@@ -1715,6 +2001,8 @@ static const char *const __stats_connection_desc[] = {
   "session: table truncate successful calls",
   "session: table verify failed calls",
   "session: table verify successful calls",
+  "session: tiered multipart flush parts copied",
+  "session: tiered multipart flushes started",
   "session: tiered operations dequeued and processed",
   "session: tiered operations removed without processing",
   "session: tiered operations scheduled",
@@ -1890,6 +2178,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->block_read = 0;
     stats->block_write = 0;
     stats->block_byte_read = 0;
+    stats->block_byte_read_direct = 0;
     stats->block_byte_read_mmap = 0;
     stats->block_byte_read_syscall = 0;
     stats->block_byte_write = 0;
@@ -2047,12 +2336,14 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing fsync_all_time */
     stats->capacity_bytes_read = 0;
     stats->capacity_bytes_ckpt = 0;
+    stats->capacity_bytes_compact = 0;
     stats->capacity_bytes_evict = 0;
     stats->capacity_bytes_log = 0;
     stats->capacity_bytes_written = 0;
     stats->capacity_threshold = 0;
     stats->capacity_time_total = 0;
     stats->capacity_time_ckpt = 0;
+    stats->capacity_time_compact = 0;
     stats->capacity_time_evict = 0;
     stats->capacity_time_log = 0;
     stats->capacity_time_read = 0;
@@ -2107,11 +2398,14 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_insert_error = 0;
     stats->cursor_insert_check_error = 0;
     stats->cursor_insert_bytes = 0;
+    stats->cursor_insert_index_build = 0;
     stats->cursor_largest_key_error = 0;
     stats->cursor_modify = 0;
     stats->cursor_modify_error = 0;
     stats->cursor_modify_bytes = 0;
     stats->cursor_modify_bytes_touch = 0;
+    stats->cursor_filter_key_skip = 0;
+    stats->cursor_filter_value_skip = 0;
     stats->cursor_next = 0;
     stats->cursor_next_error = 0;
     stats->cursor_next_hs_tombstone = 0;
@@ -2138,10 +2432,15 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_search_hs = 0;
     stats->cursor_search_near = 0;
     stats->cursor_search_near_error = 0;
+    stats->cursor_insert_index_hit = 0;
+    stats->cursor_insert_index_miss = 0;
     stats->cursor_sweep_buckets = 0;
     stats->cursor_sweep_closed = 0;
     stats->cursor_sweep_examined = 0;
     stats->cursor_sweep = 0;
+    stats->cursor_index_batch_apply = 0;
+    stats->cursor_index_batch_ops = 0;
+    stats->cursor_index_batch_cancel = 0;
     stats->cursor_truncate = 0;
     stats->cursor_truncate_keys_deleted = 0;
     stats->cursor_update = 0;
@@ -2150,6 +2449,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->cursor_update_bytes_changed = 0;
     stats->cursor_reopen = 0;
     /* not clearing cursor_open_count */
+    stats->dh_conn_lockfree_find = 0;
+    stats->dh_conn_lockfree_miss = 0;
     /* not clearing dh_conn_handle_size */
     /* not clearing dh_conn_handle_count */
     stats->dh_sweep_ref = 0;
@@ -2160,6 +2461,41 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->dh_sweep_skip_ckpt = 0;
     stats->dh_session_handles = 0;
     stats->dh_session_sweeps = 0;
+    /* not clearing latency_evict_app_p50 */
+    /* not clearing latency_evict_app_p90 */
+    /* not clearing latency_evict_app_p999 */
+    /* not clearing latency_evict_app_p99 */
+    /* not clearing latency_evict_app_max */
+    /* not clearing latency_cursor_insert_p50 */
+    /* not clearing latency_cursor_insert_p90 */
+    /* not clearing latency_cursor_insert_p999 */
+    /* not clearing latency_cursor_insert_p99 */
+    /* not clearing latency_cursor_insert_max */
+    /* not clearing latency_cursor_remove_p50 */
+    /* not clearing latency_cursor_remove_p90 */
+    /* not clearing latency_cursor_remove_p999 */
+    /* not clearing latency_cursor_remove_p99 */
+    /* not clearing latency_cursor_remove_max */
+    /* not clearing latency_cursor_search_p50 */
+    /* not clearing latency_cursor_search_p90 */
+    /* not clearing latency_cursor_search_p999 */
+    /* not clearing latency_cursor_search_p99 */
+    /* not clearing latency_cursor_search_max */
+    /* not clearing latency_cursor_update_p50 */
+    /* not clearing latency_cursor_update_p90 */
+    /* not clearing latency_cursor_update_p999 */
+    /* not clearing latency_cursor_update_p99 */
+    /* not clearing latency_cursor_update_max */
+    /* not clearing latency_log_sync_p50 */
+    /* not clearing latency_log_sync_p90 */
+    /* not clearing latency_log_sync_p999 */
+    /* not clearing latency_log_sync_p99 */
+    /* not clearing latency_log_sync_max */
+    /* not clearing latency_txn_commit_p50 */
+    /* not clearing latency_txn_commit_p90 */
+    /* not clearing latency_txn_commit_p999 */
+    /* not clearing latency_txn_commit_p99 */
+    /* not clearing latency_txn_commit_max */
     stats->lock_checkpoint_count = 0;
     stats->lock_checkpoint_wait_application = 0;
     stats->lock_checkpoint_wait_internal = 0;
@@ -2260,6 +2596,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->rec_vlcs_emptied_pages = 0;
     stats->rec_time_window_bytes_ts = 0;
     stats->rec_time_window_bytes_txn = 0;
+    stats->rec_bulk_offload_pages = 0;
+    stats->rec_time_to_live_bytes = 0;
     stats->rec_page_delete_fast = 0;
     stats->rec_overflow_key_leaf = 0;
     /* not clearing rec_maximum_seconds */
@@ -2285,6 +2623,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     stats->rec_time_window_pages_durable_stop_ts = 0;
     stats->rec_time_window_pages_stop_ts = 0;
     stats->rec_time_window_pages_stop_txn = 0;
+    stats->rec_time_to_live_expired = 0;
     stats->rec_time_window_prepared = 0;
     stats->rec_time_window_durable_start_ts = 0;
     stats->rec_time_window_start_ts = 0;
@@ -2295,6 +2634,15 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing rec_split_stashed_bytes */
     /* not clearing rec_split_stashed_objects */
     stats->local_objects_inuse = 0;
+    /* not clearing session_background_compact_fail */
+    /* not clearing session_background_compact_interrupted */
+    stats->session_background_compact_bytes_recovered = 0;
+    /* not clearing session_background_compact_running */
+    stats->session_background_compact_passes = 0;
+    /* not clearing session_background_compact_skipped */
+    stats->session_background_compact_excluded = 0;
+    /* not clearing session_background_compact_success */
+    stats->session_background_compact_yield_eviction = 0;
     stats->flush_tier_fail = 0;
     stats->flush_tier = 0;
     stats->flush_tier_skipped = 0;
@@ -2326,6 +2674,8 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
     /* not clearing session_table_truncate_success */
     /* not clearing session_table_verify_fail */
     /* not clearing session_table_verify_success */
+    stats->tiered_flush_parts = 0;
+    stats->tiered_flush_multipart = 0;
     stats->tiered_work_units_dequeued = 0;
     stats->tiered_work_units_removed = 0;
     stats->tiered_work_units_created = 0;
@@ -2476,6 +2826,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->block_read += WT_STAT_READ(from, block_read);
     to->block_write += WT_STAT_READ(from, block_write);
     to->block_byte_read += WT_STAT_READ(from, block_byte_read);
+    to->block_byte_read_direct += WT_STAT_READ(from, block_byte_read_direct);
     to->block_byte_read_mmap += WT_STAT_READ(from, block_byte_read_mmap);
     to->block_byte_read_syscall += WT_STAT_READ(from, block_byte_read_syscall);
     to->block_byte_write += WT_STAT_READ(from, block_byte_write);
@@ -2667,12 +3018,14 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->fsync_all_time += WT_STAT_READ(from, fsync_all_time);
     to->capacity_bytes_read += WT_STAT_READ(from, capacity_bytes_read);
     to->capacity_bytes_ckpt += WT_STAT_READ(from, capacity_bytes_ckpt);
+    to->capacity_bytes_compact += WT_STAT_READ(from, capacity_bytes_compact);
     to->capacity_bytes_evict += WT_STAT_READ(from, capacity_bytes_evict);
     to->capacity_bytes_log += WT_STAT_READ(from, capacity_bytes_log);
     to->capacity_bytes_written += WT_STAT_READ(from, capacity_bytes_written);
     to->capacity_threshold += WT_STAT_READ(from, capacity_threshold);
     to->capacity_time_total += WT_STAT_READ(from, capacity_time_total);
     to->capacity_time_ckpt += WT_STAT_READ(from, capacity_time_ckpt);
+    to->capacity_time_compact += WT_STAT_READ(from, capacity_time_compact);
     to->capacity_time_evict += WT_STAT_READ(from, capacity_time_evict);
     to->capacity_time_log += WT_STAT_READ(from, capacity_time_log);
     to->capacity_time_read += WT_STAT_READ(from, capacity_time_read);
@@ -2729,11 +3082,14 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cursor_insert_error += WT_STAT_READ(from, cursor_insert_error);
     to->cursor_insert_check_error += WT_STAT_READ(from, cursor_insert_check_error);
     to->cursor_insert_bytes += WT_STAT_READ(from, cursor_insert_bytes);
+    to->cursor_insert_index_build += WT_STAT_READ(from, cursor_insert_index_build);
     to->cursor_largest_key_error += WT_STAT_READ(from, cursor_largest_key_error);
     to->cursor_modify += WT_STAT_READ(from, cursor_modify);
     to->cursor_modify_error += WT_STAT_READ(from, cursor_modify_error);
     to->cursor_modify_bytes += WT_STAT_READ(from, cursor_modify_bytes);
     to->cursor_modify_bytes_touch += WT_STAT_READ(from, cursor_modify_bytes_touch);
+    to->cursor_filter_key_skip += WT_STAT_READ(from, cursor_filter_key_skip);
+    to->cursor_filter_value_skip += WT_STAT_READ(from, cursor_filter_value_skip);
     to->cursor_next += WT_STAT_READ(from, cursor_next);
     to->cursor_next_error += WT_STAT_READ(from, cursor_next_error);
     to->cursor_next_hs_tombstone += WT_STAT_READ(from, cursor_next_hs_tombstone);
@@ -2760,10 +3116,15 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cursor_search_hs += WT_STAT_READ(from, cursor_search_hs);
     to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
     to->cursor_search_near_error += WT_STAT_READ(from, cursor_search_near_error);
+    to->cursor_insert_index_hit += WT_STAT_READ(from, cursor_insert_index_hit);
+    to->cursor_insert_index_miss += WT_STAT_READ(from, cursor_insert_index_miss);
     to->cursor_sweep_buckets += WT_STAT_READ(from, cursor_sweep_buckets);
     to->cursor_sweep_closed += WT_STAT_READ(from, cursor_sweep_closed);
     to->cursor_sweep_examined += WT_STAT_READ(from, cursor_sweep_examined);
     to->cursor_sweep += WT_STAT_READ(from, cursor_sweep);
+    to->cursor_index_batch_apply += WT_STAT_READ(from, cursor_index_batch_apply);
+    to->cursor_index_batch_ops += WT_STAT_READ(from, cursor_index_batch_ops);
+    to->cursor_index_batch_cancel += WT_STAT_READ(from, cursor_index_batch_cancel);
     to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
     to->cursor_truncate_keys_deleted += WT_STAT_READ(from, cursor_truncate_keys_deleted);
     to->cursor_update += WT_STAT_READ(from, cursor_update);
@@ -2772,6 +3133,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->cursor_update_bytes_changed += WT_STAT_READ(from, cursor_update_bytes_changed);
     to->cursor_reopen += WT_STAT_READ(from, cursor_reopen);
     to->cursor_open_count += WT_STAT_READ(from, cursor_open_count);
+    to->dh_conn_lockfree_find += WT_STAT_READ(from, dh_conn_lockfree_find);
+    to->dh_conn_lockfree_miss += WT_STAT_READ(from, dh_conn_lockfree_miss);
     to->dh_conn_handle_size += WT_STAT_READ(from, dh_conn_handle_size);
     to->dh_conn_handle_count += WT_STAT_READ(from, dh_conn_handle_count);
     to->dh_sweep_ref += WT_STAT_READ(from, dh_sweep_ref);
@@ -2782,6 +3145,66 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->dh_sweep_skip_ckpt += WT_STAT_READ(from, dh_sweep_skip_ckpt);
     to->dh_session_handles += WT_STAT_READ(from, dh_session_handles);
     to->dh_session_sweeps += WT_STAT_READ(from, dh_session_sweeps);
+    if ((v = WT_STAT_READ(from, latency_evict_app_p50)) > to->latency_evict_app_p50)
+        to->latency_evict_app_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_p90)) > to->latency_evict_app_p90)
+        to->latency_evict_app_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_p999)) > to->latency_evict_app_p999)
+        to->latency_evict_app_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_p99)) > to->latency_evict_app_p99)
+        to->latency_evict_app_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_evict_app_max)) > to->latency_evict_app_max)
+        to->latency_evict_app_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p50)) > to->latency_cursor_insert_p50)
+        to->latency_cursor_insert_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p90)) > to->latency_cursor_insert_p90)
+        to->latency_cursor_insert_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p999)) > to->latency_cursor_insert_p999)
+        to->latency_cursor_insert_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_p99)) > to->latency_cursor_insert_p99)
+        to->latency_cursor_insert_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_insert_max)) > to->latency_cursor_insert_max)
+        to->latency_cursor_insert_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p50)) > to->latency_cursor_remove_p50)
+        to->latency_cursor_remove_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p90)) > to->latency_cursor_remove_p90)
+        to->latency_cursor_remove_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p999)) > to->latency_cursor_remove_p999)
+        to->latency_cursor_remove_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_p99)) > to->latency_cursor_remove_p99)
+        to->latency_cursor_remove_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_remove_max)) > to->latency_cursor_remove_max)
+        to->latency_cursor_remove_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p50)) > to->latency_cursor_search_p50)
+        to->latency_cursor_search_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p90)) > to->latency_cursor_search_p90)
+        to->latency_cursor_search_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p999)) > to->latency_cursor_search_p999)
+        to->latency_cursor_search_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_p99)) > to->latency_cursor_search_p99)
+        to->latency_cursor_search_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_search_max)) > to->latency_cursor_search_max)
+        to->latency_cursor_search_max = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p50)) > to->latency_cursor_update_p50)
+        to->latency_cursor_update_p50 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p90)) > to->latency_cursor_update_p90)
+        to->latency_cursor_update_p90 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p999)) > to->latency_cursor_update_p999)
+        to->latency_cursor_update_p999 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_p99)) > to->latency_cursor_update_p99)
+        to->latency_cursor_update_p99 = v;
+    if ((v = WT_STAT_READ(from, latency_cursor_update_max)) > to->latency_cursor_update_max)
+        to->latency_cursor_update_max = v;
+    to->latency_log_sync_p50 += WT_STAT_READ(from, latency_log_sync_p50);
+    to->latency_log_sync_p90 += WT_STAT_READ(from, latency_log_sync_p90);
+    to->latency_log_sync_p999 += WT_STAT_READ(from, latency_log_sync_p999);
+    to->latency_log_sync_p99 += WT_STAT_READ(from, latency_log_sync_p99);
+    to->latency_log_sync_max += WT_STAT_READ(from, latency_log_sync_max);
+    to->latency_txn_commit_p50 += WT_STAT_READ(from, latency_txn_commit_p50);
+    to->latency_txn_commit_p90 += WT_STAT_READ(from, latency_txn_commit_p90);
+    to->latency_txn_commit_p999 += WT_STAT_READ(from, latency_txn_commit_p999);
+    to->latency_txn_commit_p99 += WT_STAT_READ(from, latency_txn_commit_p99);
+    to->latency_txn_commit_max += WT_STAT_READ(from, latency_txn_commit_max);
     to->lock_checkpoint_count += WT_STAT_READ(from, lock_checkpoint_count);
     to->lock_checkpoint_wait_application += WT_STAT_READ(from, lock_checkpoint_wait_application);
     to->lock_checkpoint_wait_internal += WT_STAT_READ(from, lock_checkpoint_wait_internal);
@@ -2886,6 +3309,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->rec_vlcs_emptied_pages += WT_STAT_READ(from, rec_vlcs_emptied_pages);
     to->rec_time_window_bytes_ts += WT_STAT_READ(from, rec_time_window_bytes_ts);
     to->rec_time_window_bytes_txn += WT_STAT_READ(from, rec_time_window_bytes_txn);
+    to->rec_bulk_offload_pages += WT_STAT_READ(from, rec_bulk_offload_pages);
+    to->rec_time_to_live_bytes += WT_STAT_READ(from, rec_time_to_live_bytes);
     to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
     to->rec_overflow_key_leaf += WT_STAT_READ(from, rec_overflow_key_leaf);
     to->rec_maximum_seconds += WT_STAT_READ(from, rec_maximum_seconds);
@@ -2915,6 +3340,7 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
       WT_STAT_READ(from, rec_time_window_pages_durable_stop_ts);
     to->rec_time_window_pages_stop_ts += WT_STAT_READ(from, rec_time_window_pages_stop_ts);
     to->rec_time_window_pages_stop_txn += WT_STAT_READ(from, rec_time_window_pages_stop_txn);
+    to->rec_time_to_live_expired += WT_STAT_READ(from, rec_time_to_live_expired);
     to->rec_time_window_prepared += WT_STAT_READ(from, rec_time_window_prepared);
     to->rec_time_window_durable_start_ts += WT_STAT_READ(from, rec_time_window_durable_start_ts);
     to->rec_time_window_start_ts += WT_STAT_READ(from, rec_time_window_start_ts);
@@ -2925,6 +3351,22 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->rec_split_stashed_bytes += WT_STAT_READ(from, rec_split_stashed_bytes);
     to->rec_split_stashed_objects += WT_STAT_READ(from, rec_split_stashed_objects);
     to->local_objects_inuse += WT_STAT_READ(from, local_objects_inuse);
+    to->session_background_compact_fail += WT_STAT_READ(from, session_background_compact_fail);
+    to->session_background_compact_interrupted +=
+      WT_STAT_READ(from, session_background_compact_interrupted);
+    to->session_background_compact_bytes_recovered +=
+      WT_STAT_READ(from, session_background_compact_bytes_recovered);
+    to->session_background_compact_running +=
+      WT_STAT_READ(from, session_background_compact_running);
+    to->session_background_compact_passes += WT_STAT_READ(from, session_background_compact_passes);
+    to->session_background_compact_skipped +=
+      WT_STAT_READ(from, session_background_compact_skipped);
+    to->session_background_compact_excluded +=
+      WT_STAT_READ(from, session_background_compact_excluded);
+    to->session_background_compact_success +=
+      WT_STAT_READ(from, session_background_compact_success);
+    to->session_background_compact_yield_eviction +=
+      WT_STAT_READ(from, session_background_compact_yield_eviction);
     to->flush_tier_fail += WT_STAT_READ(from, flush_tier_fail);
     to->flush_tier += WT_STAT_READ(from, flush_tier);
     to->flush_tier_skipped += WT_STAT_READ(from, flush_tier_skipped);
@@ -2959,6 +3401,8 @@ __wt_stat_connection_aggregate(WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *
     to->session_table_truncate_success += WT_STAT_READ(from, session_table_truncate_success);
     to->session_table_verify_fail += WT_STAT_READ(from, session_table_verify_fail);
     to->session_table_verify_success += WT_STAT_READ(from, session_table_verify_success);
+    to->tiered_flush_parts += WT_STAT_READ(from, tiered_flush_parts);
+    to->tiered_flush_multipart += WT_STAT_READ(from, tiered_flush_multipart);
     to->tiered_work_units_dequeued += WT_STAT_READ(from, tiered_work_units_dequeued);
     to->tiered_work_units_removed += WT_STAT_READ(from, tiered_work_units_removed);
     to->tiered_work_units_created += WT_STAT_READ(from, tiered_work_units_created);
@@ -3064,7 +3508,9 @@ static const char *const __stats_join_desc[] = {
   "join: accesses to the main table",
   "join: bloom filter false positives",
   "join: checks that conditions of membership are satisfied",
+  "join: items in the set after combining with previous joins",
   "join: items inserted into a bloom filter",
+  "join: items inserted into a set",
   "join: items iterated",
 };
 
@@ -3088,7 +3534,9 @@ __wt_stat_join_clear_single(WT_JOIN_STATS *stats)
     stats->main_access = 0;
     stats->bloom_false_positive = 0;
     stats->membership_check = 0;
+    stats->set_result = 0;
     stats->bloom_insert = 0;
+    stats->set_insert = 0;
     stats->iterated = 0;
 }
 
@@ -3107,7 +3555,9 @@ __wt_stat_join_aggregate(WT_JOIN_STATS **from, WT_JOIN_STATS *to)
     to->main_access += WT_STAT_READ(from, main_access);
     to->bloom_false_positive += WT_STAT_READ(from, bloom_false_positive);
     to->membership_check += WT_STAT_READ(from, membership_check);
+    to->set_result += WT_STAT_READ(from, set_result);
     to->bloom_insert += WT_STAT_READ(from, bloom_insert);
+    to->set_insert += WT_STAT_READ(from, set_insert);
     to->iterated += WT_STAT_READ(from, iterated);
 }
 
@@ -3148,3 +3598,61 @@ __wt_stat_session_clear_single(WT_SESSION_STATS *stats)
     stats->lock_schema_wait = 0;
     stats->cache_time = 0;
 }
+
+static const char * const __stats_session_waits_desc[] = {
+  "session-wait: cache eviction current wait time (usecs)",
+  "session-wait: cache eviction wait time (usecs)",
+  "session-wait: cache eviction waits",
+  "session-wait: capacity throttle current wait time (usecs)",
+  "session-wait: capacity throttle wait time (usecs)",
+  "session-wait: capacity throttle waits",
+  "session-wait: checkpoint handle gathering current wait time (usecs)",
+  "session-wait: checkpoint handle gathering wait time (usecs)",
+  "session-wait: checkpoint handle gathering waits",
+  "session-wait: data handle lock current wait time (usecs)",
+  "session-wait: data handle lock wait time (usecs)",
+  "session-wait: data handle lock waits",
+  "session-wait: log slot join current wait time (usecs)",
+  "session-wait: log slot join wait time (usecs)",
+  "session-wait: log slot join waits",
+  "session-wait: page lock current wait time (usecs)",
+  "session-wait: page lock wait time (usecs)",
+  "session-wait: page lock waits",
+};
+
+int
+__wt_stat_session_waits_desc(WT_CURSOR_STAT *cst, int slot, const char **p)
+{
+    WT_UNUSED(cst);
+    *p = __stats_session_waits_desc[slot];
+    return (0);
+}
+
+void
+__wt_stat_session_waits_init_single(WT_SESSION_WAITS_STATS *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+}
+
+void
+__wt_stat_session_waits_clear_single(WT_SESSION_WAITS_STATS *stats)
+{
+    /* not clearing cache_eviction_current */
+    stats->cache_eviction_time = 0;
+    stats->cache_eviction_count = 0;
+    /* not clearing capacity_current */
+    stats->capacity_time = 0;
+    stats->capacity_count = 0;
+    /* not clearing checkpoint_gather_current */
+    stats->checkpoint_gather_time = 0;
+    stats->checkpoint_gather_count = 0;
+    /* not clearing dhandle_lock_current */
+    stats->dhandle_lock_time = 0;
+    stats->dhandle_lock_count = 0;
+    /* not clearing log_slot_current */
+    stats->log_slot_time = 0;
+    stats->log_slot_count = 0;
+    /* not clearing page_lock_current */
+    stats->page_lock_time = 0;
+    stats->page_lock_count = 0;
+}
@@ -60,7 +60,7 @@ __wt_tiered_bucket_config(
   WT_SESSION_IMPL *session, const char *cfg[], WT_BUCKET_STORAGE **bstoragep)
 {
     WT_BUCKET_STORAGE *bstorage, *new;
-    WT_CONFIG_ITEM auth, bucket, cachedir, name, prefix, shared;
+    WT_CONFIG_ITEM auth, bucket, cachedir, cval, name, prefix, shared;
     WT_CONNECTION_IMPL *conn;
     WT_DECL_ITEM(buf);
     WT_DECL_RET;
@@ -127,9 +127,21 @@ __wt_tiered_bucket_config(
     WT_ERR(__wt_strndup(session, prefix.str, prefix.len, &new->bucket_prefix));
     WT_ERR(__wt_strndup(session, cachedir.str, cachedir.len, &new->cache_directory));
 
+    /* Caching objects on demand is only configured for the connection. */
+    if ((ret = __wt_config_gets(session, cfg, "tiered_storage.cache_chunk_size", &cval)) == 0)
+        new->cache_chunk_size = (uint64_t)cval.val;
+    WT_ERR_NOTFOUND_OK(ret, false);
+    if ((ret = __wt_config_gets(session, cfg, "tiered_storage.cache_prefetch", &cval)) == 0)
+        new->cache_prefetch = (uint64_t)cval.val;
+    WT_ERR_NOTFOUND_OK(ret, false);
+
     storage = nstorage->storage_source;
     if (cachedir.len != 0)
         WT_ERR(__wt_buf_fmt(session, buf, "cache_directory=%s", new->cache_directory));
+    if (new->cache_chunk_size != 0)
+        WT_ERR(__wt_buf_catfmt(session, buf,
+          "%scache_chunk_size=%" PRIu64 ",cache_prefetch=%" PRIu64, buf->size == 0 ? "" : ",",
+          new->cache_chunk_size, new->cache_prefetch));
     WT_ERR(storage->ss_customize_file_system(
       storage, &session->iface, new->bucket, new->auth_token, buf->data, &new->file_system));
     new->storage_source = storage;
@@ -184,6 +196,10 @@ __wt_tiered_conn_config(WT_SESSION_IMPL *session, const char **cfg, bool reconfi
 
     WT_ERR(__wt_config_gets(session, cfg, "tiered_storage.interval", &cval));
     conn->tiered_interval = (uint64_t)cval.val;
+    WT_ERR(__wt_config_gets(session, cfg, "tiered_storage.flush_part_size", &cval));
+    conn->tiered_part_size = (uint64_t)cval.val;
+    WT_ERR(__wt_config_gets(session, cfg, "tiered_storage.flush_threads", &cval));
+    conn->tiered_flush_workers = (uint32_t)cval.val;
 
     WT_ASSERT(session, conn->bstorage != NULL);
     WT_STAT_CONN_SET(session, tiered_retention, conn->bstorage->retain_secs);
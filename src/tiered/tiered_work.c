@@ -51,9 +51,13 @@ void
 __wt_tiered_remove_work(WT_SESSION_IMPL *session, WT_TIERED *tiered, bool locked)
 {
     WT_CONNECTION_IMPL *conn;
+    WT_TIERED_UPLOAD *upload, *upload_tmp;
     WT_TIERED_WORK_UNIT *entry, *entry_tmp;
+    TAILQ_HEAD(__wt_tiered_dropped_qh, __wt_tiered_upload) droppedqh;
+    bool busy;
 
     conn = S2C(session);
+    TAILQ_INIT(&droppedqh);
     if (!locked)
         __wt_spin_lock(session, &conn->tiered_lock);
     TAILQ_FOREACH_SAFE(entry, &conn->tieredqh, q, entry_tmp)
@@ -65,8 +69,41 @@ __wt_tiered_remove_work(WT_SESSION_IMPL *session, WT_TIERED *tiered, bool locked
             __wt_tiered_work_free(session, entry);
         }
     }
+
+    /*
+     * Take multipart flushes in progress off the queue so no more of their parts are copied, and
+     * wait for the parts being copied: the flush threads copy them through the table's bucket and
+     * read the local file the drop is about to remove. The flush threads leave a dropped flush to
+     * us once their part is done.
+     */
+    TAILQ_FOREACH_SAFE(upload, &conn->tiered_uploadqh, q, upload_tmp)
+        if (upload->entry->tiered == tiered) {
+            TAILQ_REMOVE(&conn->tiered_uploadqh, upload, q);
+            TAILQ_INSERT_TAIL(&droppedqh, upload, q);
+            upload->dropped = true;
+            if (upload->error == 0)
+                upload->error = ENOENT;
+        }
+    for (;;) {
+        busy = false;
+        TAILQ_FOREACH (upload, &droppedqh, q)
+            if (upload->parts_done < upload->next_part)
+                busy = true;
+        if (!busy)
+            break;
+        __wt_spin_unlock(session, &conn->tiered_lock);
+        __wt_sleep(0, 10 * WT_THOUSAND);
+        __wt_spin_lock(session, &conn->tiered_lock);
+    }
     if (!locked)
         __wt_spin_unlock(session, &conn->tiered_lock);
+
+    /* Discard the parts copied so far. Failing to do so only leaves them in the bucket. */
+    while ((upload = TAILQ_FIRST(&droppedqh)) != NULL) {
+        TAILQ_REMOVE(&droppedqh, upload, q);
+        WT_STAT_CONN_INCR(session, tiered_work_units_removed);
+        WT_IGNORE_RET(__wt_tiered_upload_discard(session, upload));
+    }
     return;
 }
 
@@ -149,6 +186,9 @@ __wt_tiered_flush_work_wait(WT_SESSION_IMPL *session, uint32_t timeout)
                 found = true;
                 break;
             }
+        /* Multipart flushes in progress have been removed from the queue but aren't done. */
+        if (!TAILQ_EMPTY(&conn->tiered_uploadqh))
+            found = true;
 
         __wt_spin_unlock(session, &conn->tiered_lock);
         if (found) {
@@ -266,8 +306,8 @@ __wt_tiered_put_remove_shared(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint3
 
 /*
  * __wt_tiered_put_flush --
- *     Add a flush work unit to the queue. We're single threaded so the tiered structure's id
- *     information cannot change between our caller and here.
+ *     Add a flush work unit to the queue. The flush_tier call is single threaded so the tiered
+ *     structure's id information cannot change between our caller and here.
  */
 int
 __wt_tiered_put_flush(WT_SESSION_IMPL *session, WT_TIERED *tiered, uint32_t id)
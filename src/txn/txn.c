@@ -2329,6 +2329,8 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
       txn_global->oldest_id = WT_TXN_FIRST;
 
     WT_RWLOCK_INIT_TRACKED(session, &txn_global->rwlock, txn_global);
+    if (FLD_ISSET(conn->rwlock_scalable, WT_RWLOCK_SCALABLE_TXN_GLOBAL))
+        WT_RET(__wt_rwlock_scalable(session, &txn_global->rwlock));
     WT_RET(__wt_rwlock_init(session, &txn_global->visibility_rwlock));
 
     WT_RET(__wt_calloc_def(session, conn->session_size, &txn_global->txn_shared_list));
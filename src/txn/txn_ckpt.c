@@ -1394,7 +1394,9 @@ __txn_checkpoint_wrapper(WT_SESSION_IMPL *session, const char *cfg[])
     WT_STAT_CONN_SET(session, txn_checkpoint_running, 1);
     txn_global->checkpoint_running = true;
 
+    WT_EVENT_TRACE_BEGIN_OP(session, WT_EVENT_TRACE_CHECKPOINT);
     ret = __txn_checkpoint(session, cfg);
+    WT_EVENT_TRACE_END_OP(session, WT_EVENT_TRACE_CHECKPOINT, ret);
 
     WT_STAT_CONN_SET(session, txn_checkpoint_running, 0);
     txn_global->checkpoint_running = false;
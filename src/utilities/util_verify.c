@@ -18,14 +18,15 @@ usage(void)
     static const char *options[] = {"-a", "abort on error during verification of all tables", "-c",
       "continue to the next page after encountering error during verification", "-d config",
       "display underlying information during verification", "-s",
-      "verify against the specified timestamp", "-t", "do not clear txn ids during verification",
-      "-u",
+      "verify against the specified timestamp", "-T threads",
+      "number of threads used to verify each file", "-t",
+      "do not clear txn ids during verification", "-u",
       "display the application data when dumping with configuration dump_blocks or dump_pages",
       "-?", "show this message", NULL, NULL};
 
     util_usage(
       "verify [-acstu] [-d dump_address | dump_blocks | dump_layout | dump_offsets=#,# "
-      "| dump_pages] [uri]",
+      "| dump_pages] [-T threads] [uri]",
       "options:", options);
 
     return (1);
@@ -60,14 +61,14 @@ util_verify(WT_SESSION *session, int argc, char *argv[])
     WT_DECL_RET;
     size_t size;
     int ch;
-    char *config, *dump_offsets, *key, *uri;
+    char *config, *dump_offsets, *key, *threads, *uri;
     bool abort_on_error, do_not_clear_txn_id, dump_address, dump_app_data, dump_blocks, dump_layout,
       dump_pages, read_corrupt, stable_timestamp;
 
     abort_on_error = do_not_clear_txn_id = dump_address = dump_app_data = dump_blocks =
       dump_layout = dump_pages = read_corrupt = stable_timestamp = false;
-    config = dump_offsets = uri = NULL;
-    while ((ch = __wt_getopt(progname, argc, argv, "acd:stu?")) != EOF)
+    config = dump_offsets = threads = uri = NULL;
+    while ((ch = __wt_getopt(progname, argc, argv, "acd:sT:tu?")) != EOF)
         switch (ch) {
         case 'a':
             abort_on_error = true;
@@ -100,6 +101,9 @@ util_verify(WT_SESSION *session, int argc, char *argv[])
         case 'u':
             dump_app_data = true;
             break;
+        case 'T':
+            threads = __wt_optarg;
+            break;
         case 't':
             do_not_clear_txn_id = true;
             break;
@@ -113,24 +117,26 @@ util_verify(WT_SESSION *session, int argc, char *argv[])
     argv += __wt_optind;
 
     if (do_not_clear_txn_id || dump_address || dump_app_data || dump_blocks || dump_layout ||
-      dump_offsets != NULL || dump_pages || read_corrupt || stable_timestamp) {
+      dump_offsets != NULL || dump_pages || read_corrupt || stable_timestamp || threads != NULL) {
         size = strlen("do_not_clear_txn_id,") + strlen("dump_address,") +
           +strlen("dump_app_data,") + strlen("dump_blocks,") + strlen("dump_layout,") +
           strlen("dump_pages,") + strlen("dump_offsets[],") +
           (dump_offsets == NULL ? 0 : strlen(dump_offsets)) + strlen("history_store") +
-          +strlen("read_corrupt,") + strlen("stable_timestamp,") + 20;
+          +strlen("read_corrupt,") + strlen("stable_timestamp,") + strlen("threads=,") +
+          (threads == NULL ? 0 : strlen(threads)) + 20;
         if ((config = malloc(size)) == NULL) {
             ret = util_err(session, errno, NULL);
             goto err;
         }
-        if ((ret = __wt_snprintf(config, size, "%s%s%s%s%s%s%s%s%s%s%s",
+        if ((ret = __wt_snprintf(config, size, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
                do_not_clear_txn_id ? "do_not_clear_txn_id," : "",
                dump_address ? "dump_address," : "", dump_app_data ? "dump_app_data," : "",
                dump_blocks ? "dump_blocks," : "", dump_layout ? "dump_layout," : "",
                dump_offsets != NULL ? "dump_offsets=[" : "",
                dump_offsets != NULL ? dump_offsets : "", dump_offsets != NULL ? "]," : "",
                dump_pages ? "dump_pages," : "", read_corrupt ? "read_corrupt," : "",
-               stable_timestamp ? "stable_timestamp," : "")) != 0) {
+               stable_timestamp ? "stable_timestamp," : "", threads != NULL ? "threads=" : "",
+               threads != NULL ? threads : "", threads != NULL ? "," : "")) != 0) {
             (void)util_err(session, ret, NULL);
             goto err;
         }
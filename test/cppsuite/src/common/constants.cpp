@@ -34,10 +34,12 @@ namespace test_harness {
 /* Component names. */
 const std::string OPERATION_TRACKER = "operation_tracker";
 const std::string METRICS_MONITOR = "metrics_monitor";
+const std::string PERF_MONITOR = "perf_monitor";
 const std::string TIMESTAMP_MANAGER = "timestamp_manager";
 const std::string WORKLOAD_MANAGER = "workload_manager";
 
 /* Configuration API consts. */
+const std::string BASELINE = "baseline";
 const std::string CACHE_HS_INSERT = "cache_hs_insert";
 const std::string CACHE_MAX_WAIT_MS = "cache_max_wait_ms";
 const std::string CACHE_SIZE_MB = "cache_size_mb";
@@ -49,6 +51,7 @@ const std::string CUSTOM_OP_CONFIG = "custom_config";
 const std::string DURATION_SECONDS = "duration_seconds";
 const std::string ENABLED = "enabled";
 const std::string ENABLE_LOGGING = "enable_logging";
+const std::string ENFORCE = "enforce";
 const std::string INSERT_OP_CONFIG = "insert_config";
 const std::string KEY_COUNT_PER_COLLECTION = "key_count_per_collection";
 const std::string KEY_SIZE = "key_size";
@@ -57,6 +60,7 @@ const std::string MAX = "max";
 const std::string MIN = "min";
 const std::string OLDEST_LAG = "oldest_lag";
 const std::string OP_RATE = "op_rate";
+const std::string OPS_PER_SEC = "ops_per_sec";
 const std::string OPS_PER_TRANSACTION = "ops_per_transaction";
 const std::string POPULATE_CONFIG = "populate_config";
 const std::string POSTRUN_STATISTICS = "postrun";
@@ -70,6 +74,7 @@ const std::string STAT_CACHE_SIZE = "stat_cache_size";
 const std::string STAT_DB_SIZE = "stat_db_size";
 const std::string STATISTICS_CONFIG = "statistics_config";
 const std::string THREAD_COUNT = "thread_count";
+const std::string TOLERANCE = "tolerance";
 const std::string TRACKING_KEY_FORMAT = "tracking_key_format";
 const std::string TRACKING_VALUE_FORMAT = "tracking_value_format";
 const std::string TYPE = "type";
@@ -37,10 +37,12 @@ namespace test_harness {
 /* Component names. */
 extern const std::string OPERATION_TRACKER;
 extern const std::string METRICS_MONITOR;
+extern const std::string PERF_MONITOR;
 extern const std::string TIMESTAMP_MANAGER;
 extern const std::string WORKLOAD_MANAGER;
 
 /* Configuration API consts. */
+extern const std::string BASELINE;
 extern const std::string CACHE_HS_INSERT;
 extern const std::string CACHE_MAX_WAIT_MS;
 extern const std::string CACHE_SIZE_MB;
@@ -52,6 +54,7 @@ extern const std::string CUSTOM_OP_CONFIG;
 extern const std::string DURATION_SECONDS;
 extern const std::string ENABLED;
 extern const std::string ENABLE_LOGGING;
+extern const std::string ENFORCE;
 extern const std::string INSERT_OP_CONFIG;
 extern const std::string KEY_COUNT_PER_COLLECTION;
 extern const std::string KEY_SIZE;
@@ -60,6 +63,7 @@ extern const std::string MAX;
 extern const std::string MIN;
 extern const std::string OLDEST_LAG;
 extern const std::string OP_RATE;
+extern const std::string OPS_PER_SEC;
 extern const std::string OPS_PER_TRANSACTION;
 extern const std::string POPULATE_CONFIG;
 extern const std::string POSTRUN_STATISTICS;
@@ -73,6 +77,7 @@ extern const std::string STAT_CACHE_SIZE;
 extern const std::string STAT_DB_SIZE;
 extern const std::string STATISTICS_CONFIG;
 extern const std::string THREAD_COUNT;
+extern const std::string TOLERANCE;
 extern const std::string TRACKING_KEY_FORMAT;
 extern const std::string TRACKING_VALUE_FORMAT;
 extern const std::string TYPE;
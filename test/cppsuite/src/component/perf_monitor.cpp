@@ -0,0 +1,233 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "perf_monitor.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "metrics_writer.h"
+#include "src/common/constants.h"
+#include "src/common/logger.h"
+
+extern "C" {
+#include "test_util.h"
+}
+
+namespace test_harness {
+/* The latency percentiles reported for each operation. */
+static const std::vector<uint64_t> PERCENTILES = {50, 90, 99};
+
+void
+operation_perf::merge(const operation_perf &other)
+{
+    if (other.latencies.count() == 0)
+        return;
+    if (latencies.count() == 0) {
+        first = other.first;
+        last = other.last;
+    } else {
+        first = std::min(first, other.first);
+        last = std::max(last, other.last);
+    }
+    latencies.merge(other.latencies);
+}
+
+const std::map<std::string, operation_perf> &
+perf_tracker::get_operations() const
+{
+    return (_operations);
+}
+
+perf_monitor::perf_monitor(const std::string &test_name, configuration *config)
+    : component(PERF_MONITOR, config), _test_name(test_name)
+{
+}
+
+void
+perf_monitor::load()
+{
+    /* Load the general component things. */
+    component::load();
+
+    if (_enabled) {
+        _baseline = _config->get_string(BASELINE);
+        _enforce = _config->get_bool(ENFORCE);
+        _tolerance = _config->get_int(TOLERANCE);
+    }
+}
+
+std::shared_ptr<perf_tracker>
+perf_monitor::create_tracker()
+{
+    std::lock_guard<std::mutex> lg(_trackers_mutex);
+    _trackers.push_back(std::make_shared<perf_tracker>());
+    return (_trackers.back());
+}
+
+void
+perf_monitor::finish()
+{
+    component::finish();
+
+    if (!_enabled)
+        return;
+
+    /* Merge the results of the workload threads, they have all been joined. */
+    std::map<std::string, operation_perf> operations;
+    for (const auto &tracker : _trackers)
+        for (const auto &it : tracker->get_operations())
+            operations[it.first].merge(it.second);
+
+    /*
+     * Write the results in the baseline format, so a run's results can be checked in as a new
+     * baseline.
+     */
+    std::map<std::string, std::map<std::string, uint64_t>> results;
+    std::ofstream results_file(_test_name + "_perf.txt");
+    results_file << "# " << _test_name << " performance results." << std::endl;
+    std::string separator;
+    for (const auto &it : operations) {
+        const std::string &op_name = it.first;
+        const latency_histogram &latencies = it.second.latencies;
+        std::map<std::string, uint64_t> &result = results[op_name];
+
+        double seconds = std::chrono::duration<double>(it.second.last - it.second.first).count();
+        result[OPS_PER_SEC] =
+          seconds > 0 ? static_cast<uint64_t>(latencies.count() / seconds) : latencies.count();
+        for (const auto pct : PERCENTILES)
+            result["p" + std::to_string(pct) + "_ns"] = latencies.percentile(pct);
+
+        logger::log_msg(LOG_INFO,
+          "perf_monitor: " + op_name + ": " + std::to_string(latencies.count()) +
+            " operations, mean latency " + std::to_string(latencies.mean()) +
+            "ns, max latency " + std::to_string(latencies.max()) + "ns");
+
+        results_file << separator << op_name << "=(";
+        separator = ",\n";
+        std::string metric_separator;
+        for (const auto &metric : result) {
+            const std::string name = op_name + "_" + metric.first;
+            metrics_writer::instance().add_stat(
+              "{\"name\":\"" + name + "\",\"value\":" + std::to_string(metric.second) + "}");
+            logger::log_msg(
+              LOG_INFO, "perf_monitor: " + name + " is: " + std::to_string(metric.second));
+            results_file << metric_separator << metric.first << "=" << metric.second;
+            metric_separator = ",";
+        }
+        results_file << ")";
+    }
+    results_file << std::endl;
+    results_file.close();
+
+    /*
+     * Baselines depend on the machine they were recorded on, unless configured to enforce them,
+     * regressions are only reported.
+     */
+    if (!_baseline.empty() && !compare_baseline(results)) {
+        if (_enforce)
+            testutil_die(-1,
+              "perf_monitor: One or more results were worse than the baseline by more than the "
+              "tolerance.");
+        logger::log_msg(LOG_WARN,
+          "perf_monitor: One or more results were worse than the baseline by more than the "
+          "tolerance, the baseline is not enforced.");
+    }
+}
+
+/*
+ * Compare the results against the baseline, returning false if any result regressed. Throughput
+ * regresses if it drops, latencies regress if they rise, results without a baseline aren't
+ * compared.
+ */
+bool
+perf_monitor::compare_baseline(
+  const std::map<std::string, std::map<std::string, uint64_t>> &results)
+{
+    WT_CONFIG_ITEM k, v, metric_k, metric_v;
+    WT_CONFIG_PARSER *metric_parser, *parser;
+    std::string baseline, line;
+    bool success = true;
+    int ret;
+
+    /* Read the baseline, ignoring whitespace and comments. */
+    std::ifstream baseline_file(_baseline);
+    if (!baseline_file.is_open())
+        testutil_die(EINVAL, "perf_monitor: couldn't open baseline %s", _baseline.c_str());
+    while (getline(baseline_file, line)) {
+        line.erase(std::remove_if(line.begin(), line.end(), isspace), line.end());
+        if (line.empty() || line[0] == '#')
+            continue;
+        baseline += line;
+    }
+
+    testutil_check(
+      wiredtiger_config_parser_open(nullptr, baseline.c_str(), baseline.size(), &parser));
+    while ((ret = parser->next(parser, &k, &v)) == 0) {
+        const std::string op_name(k.str, k.len);
+        auto result = results.find(op_name);
+        if (result == results.end()) {
+            logger::log_msg(
+              LOG_WARN, "perf_monitor: No results for baseline operation \"" + op_name + "\"");
+            continue;
+        }
+        testutil_assert(v.type == WT_CONFIG_ITEM::WT_CONFIG_ITEM_STRUCT);
+
+        testutil_check(wiredtiger_config_parser_open(nullptr, v.str, v.len, &metric_parser));
+        while ((ret = metric_parser->next(metric_parser, &metric_k, &metric_v)) == 0) {
+            const std::string metric(metric_k.str, metric_k.len);
+            const std::string name = op_name + "_" + metric;
+            auto actual = result->second.find(metric);
+            if (actual == result->second.end()) {
+                logger::log_msg(LOG_WARN, "perf_monitor: Unknown baseline result \"" + name + "\"");
+                continue;
+            }
+
+            double expected = static_cast<double>(metric_v.val);
+            bool regressed = metric == OPS_PER_SEC ?
+              actual->second < expected * (100 - _tolerance) / 100 :
+              actual->second > expected * (100 + _tolerance) / 100;
+            const std::string comparison = "perf_monitor: Result \"" + name +
+              "\" Baseline=" + std::to_string(metric_v.val) +
+              " Actual=" + std::to_string(actual->second) +
+              " Tolerance=" + std::to_string(_tolerance) + "%";
+            if (regressed) {
+                logger::log_msg(_enforce ? LOG_ERROR : LOG_WARN, comparison);
+                success = false;
+            } else
+                logger::log_msg(LOG_INFO, comparison);
+        }
+        testutil_assert(ret == WT_NOTFOUND);
+        testutil_check(metric_parser->close(metric_parser));
+    }
+    testutil_assert(ret == WT_NOTFOUND);
+    testutil_check(parser->close(parser));
+
+    return (success);
+}
+} // namespace test_harness
@@ -0,0 +1,116 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PERF_MONITOR_H
+#define PERF_MONITOR_H
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "component.h"
+#include "src/util/latency_histogram.h"
+
+namespace test_harness {
+/* The latencies of an operation and the period over which it was performed. */
+struct operation_perf {
+    void merge(const operation_perf &other);
+
+    latency_histogram latencies;
+    std::chrono::steady_clock::time_point first;
+    std::chrono::steady_clock::time_point last;
+};
+
+/*
+ * The operations performed by a single thread, grouped by name. Only the owning thread updates a
+ * tracker, trackers are read once the workload threads have been joined.
+ */
+class perf_tracker {
+    public:
+    /* Run an operation and record its latency. */
+    template <typename T>
+    int
+    track(const std::string &operation, T lambda)
+    {
+        auto start = std::chrono::steady_clock::now();
+        int ret = lambda();
+        auto end = std::chrono::steady_clock::now();
+
+        operation_perf &perf = _operations[operation];
+        if (perf.latencies.count() == 0)
+            perf.first = start;
+        perf.last = end;
+        perf.latencies.record(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+        return (ret);
+    }
+
+    const std::map<std::string, operation_perf> &get_operations() const;
+
+    private:
+    std::map<std::string, operation_perf> _operations;
+};
+
+/*
+ * The perf monitor collects the throughput and latency percentiles of the operations performed by
+ * the workload threads. At the end of the test the results are added to the metrics written by the
+ * metrics_writer, written to a file in the baseline format and optionally compared against a
+ * baseline: the test fails if any result is worse than its baseline by more than the tolerance.
+ */
+class perf_monitor : public component {
+    public:
+    perf_monitor(const std::string &test_name, configuration *config);
+    virtual ~perf_monitor() = default;
+
+    /* Delete the copy constructor and the assignment operator. */
+    perf_monitor(const perf_monitor &) = delete;
+    perf_monitor &operator=(const perf_monitor &) = delete;
+
+    /* Create a tracker for a workload thread. */
+    std::shared_ptr<perf_tracker> create_tracker();
+
+    void load() override final;
+    void finish() override final;
+
+    private:
+    bool compare_baseline(const std::map<std::string, std::map<std::string, uint64_t>> &results);
+
+    private:
+    std::string _baseline;
+    bool _enforce = false;
+    int64_t _tolerance = 0;
+    const std::string _test_name;
+    std::mutex _trackers_mutex;
+    std::vector<std::shared_ptr<perf_tracker>> _trackers;
+};
+} // namespace test_harness
+
+#endif
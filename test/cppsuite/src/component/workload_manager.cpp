@@ -37,9 +37,10 @@
 
 namespace test_harness {
 workload_manager::workload_manager(configuration *configuration, database_operation *db_operation,
-  timestamp_manager *timestamp_manager, database &database)
+  timestamp_manager *timestamp_manager, perf_monitor *perf_monitor, database &database)
     : component(WORKLOAD_MANAGER, configuration), _database(database),
-      _database_operation(db_operation), _timestamp_manager(timestamp_manager)
+      _database_operation(db_operation), _timestamp_manager(timestamp_manager),
+      _perf_monitor(perf_monitor)
 {
 }
 
@@ -96,6 +97,8 @@ workload_manager::run()
             thread_worker *tc = new thread_worker(thread_id++, it.type, it.config,
               connection_manager::instance().create_session(), _timestamp_manager,
               _operation_tracker, _database, barrier_ptr);
+            if (_perf_monitor->enabled())
+                tc->perf = _perf_monitor->create_tracker();
             _workers.push_back(tc);
             _thread_manager.add_thread(it.get_func(_database_operation), tc);
         }
@@ -43,7 +43,7 @@ namespace test_harness {
 class workload_manager : public component {
     public:
     workload_manager(configuration *configuration, database_operation *db_operation,
-      timestamp_manager *timestamp_manager, database &database);
+      timestamp_manager *timestamp_manager, perf_monitor *perf_monitor, database &database);
 
     ~workload_manager();
 
@@ -67,6 +67,7 @@ class workload_manager : public component {
     thread_manager _thread_manager;
     timestamp_manager *_timestamp_manager = nullptr;
     operation_tracker *_operation_tracker = nullptr;
+    perf_monitor *_perf_monitor = nullptr;
     std::vector<thread_worker *> _workers;
     bool _db_populated = false;
 };
@@ -243,7 +243,7 @@ database_operation::read_operation(thread_worker *tc)
 
         tc->txn.begin();
         while (tc->txn.active() && tc->running()) {
-            auto ret = cursor->next(cursor.get());
+            auto ret = tc->track("next", [&] { return (cursor->next(cursor.get())); });
             if (ret != 0) {
                 if (ret == WT_NOTFOUND) {
                     testutil_check(cursor->reset(cursor.get()));
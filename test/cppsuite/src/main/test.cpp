@@ -38,9 +38,10 @@ test::test(const test_args &args) : _args(args)
     _config = new configuration(args.test_name, args.test_config);
     _metrics_monitor =
       new metrics_monitor(args.test_name, _config->get_subconfig(METRICS_MONITOR), _database);
+    _perf_monitor = new perf_monitor(args.test_name, _config->get_subconfig(PERF_MONITOR));
     _timestamp_manager = new timestamp_manager(_config->get_subconfig(TIMESTAMP_MANAGER));
-    _workload_manager = new workload_manager(
-      _config->get_subconfig(WORKLOAD_MANAGER), this, _timestamp_manager, _database);
+    _workload_manager = new workload_manager(_config->get_subconfig(WORKLOAD_MANAGER), this,
+      _timestamp_manager, _perf_monitor, _database);
     _thread_manager = new thread_manager();
 
     _database.set_timestamp_manager(_timestamp_manager);
@@ -49,9 +50,10 @@ test::test(const test_args &args) : _args(args)
 
     /*
      * Ordering is not important here, any dependencies between components should be resolved
-     * internally by the components.
+     * internally by the components. The perf monitor's finish stage reads the results of the
+     * workload threads, so it must follow the workload manager's.
      */
-    _components = {_workload_manager, _timestamp_manager, _metrics_monitor};
+    _components = {_workload_manager, _timestamp_manager, _metrics_monitor, _perf_monitor};
 }
 
 void
@@ -73,12 +75,14 @@ test::~test()
 {
     delete _config;
     delete _metrics_monitor;
+    delete _perf_monitor;
     delete _timestamp_manager;
     delete _thread_manager;
     delete _workload_manager;
     delete _operation_tracker;
     _config = nullptr;
     _metrics_monitor = nullptr;
+    _perf_monitor = nullptr;
     _timestamp_manager = nullptr;
     _thread_manager = nullptr;
     _workload_manager = nullptr;
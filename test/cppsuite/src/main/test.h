@@ -33,6 +33,7 @@
 
 #include "database_operation.h"
 #include "src/component/metrics_monitor.h"
+#include "src/component/perf_monitor.h"
 #include "src/component/workload_manager.h"
 #include "src/storage/connection_manager.h"
 
@@ -73,6 +74,7 @@ class test : public database_operation {
     private:
     std::vector<component *> _components;
     metrics_monitor *_metrics_monitor = nullptr;
+    perf_monitor *_perf_monitor = nullptr;
     thread_manager *_thread_manager = nullptr;
     workload_manager *_workload_manager = nullptr;
     database _database;
@@ -117,7 +117,7 @@ thread_worker::update(
 
     cursor->set_key(cursor.get(), key.c_str());
     cursor->set_value(cursor.get(), value.c_str());
-    ret = cursor->update(cursor.get());
+    ret = track("update", [&] { return (cursor->update(cursor.get())); });
 
     if (ret != 0) {
         if (ret == WT_ROLLBACK) {
@@ -158,7 +158,7 @@ thread_worker::insert(
 
     cursor->set_key(cursor.get(), key.c_str());
     cursor->set_value(cursor.get(), value.c_str());
-    ret = cursor->insert(cursor.get());
+    ret = track("insert", [&] { return (cursor->insert(cursor.get())); });
 
     if (ret != 0) {
         if (ret == WT_ROLLBACK) {
@@ -196,7 +196,7 @@ thread_worker::remove(scoped_cursor &cursor, uint64_t collection_id, const std::
     }
 
     cursor->set_key(cursor.get(), key.c_str());
-    ret = cursor->remove(cursor.get());
+    ret = track("remove", [&] { return (cursor->remove(cursor.get())); });
     if (ret != 0) {
         if (ret == WT_ROLLBACK) {
             txn.set_needs_rollback(true);
@@ -247,9 +247,12 @@ thread_worker::truncate(uint64_t collection_id, std::optional<std::string> start
     if (stop_key)
         stop_cursor->set_key(stop_cursor.get(), stop_key.value().c_str());
 
-    ret = session->truncate(session.get(), (start_key || stop_key) ? nullptr : coll_name.c_str(),
-      start_key ? start_cursor.get() : nullptr, stop_key ? stop_cursor.get() : nullptr,
-      config.empty() ? nullptr : config.c_str());
+    ret = track("truncate", [&] {
+        return (session->truncate(session.get(),
+          (start_key || stop_key) ? nullptr : coll_name.c_str(),
+          start_key ? start_cursor.get() : nullptr, stop_key ? stop_cursor.get() : nullptr,
+          config.empty() ? nullptr : config.c_str()));
+    });
 
     if (ret != 0) {
         if (ret == WT_ROLLBACK) {
@@ -35,6 +35,7 @@
 
 #include "database.h"
 #include "src/component/operation_tracker.h"
+#include "src/component/perf_monitor.h"
 #include "src/component/timestamp_manager.h"
 #include "src/main/configuration.h"
 #include "src/storage/scoped_cursor.h"
@@ -99,6 +100,15 @@ class thread_worker {
      */
     bool truncate(uint64_t collection_id, std::optional<std::string> start_key,
       std::optional<std::string> stop_key, const std::string &config);
+
+    /* Run an operation, recording its latency if the perf monitor is enabled. */
+    template <typename T>
+    int
+    track(const std::string &operation, T lambda)
+    {
+        return (perf == nullptr ? lambda() : perf->track(operation, lambda));
+    }
+
     void sleep();
     bool running() const;
     void sync();
@@ -118,6 +128,7 @@ class thread_worker {
     timestamp_manager *tsm;
     transaction txn;
     operation_tracker *op_tracker;
+    std::shared_ptr<perf_tracker> perf = nullptr;
 
     private:
     std::shared_ptr<barrier> _barrier = nullptr;
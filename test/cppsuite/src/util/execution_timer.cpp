@@ -44,19 +44,6 @@ execution_timer::append_stats()
     metrics_writer::instance().add_stat(stat);
 }
 
-template <typename T>
-auto
-execution_timer::track(T lambda)
-{
-    auto _start_time = std::chrono::steady_clock::now();
-    int ret = lambda();
-    auto _end_time = std::chrono::steady_clock::now();
-    _total_time_taken += (_end_time - _start_time).count();
-    _it_count += 1;
-
-    return ret;
-}
-
 execution_timer::~execution_timer()
 {
     if (_it_count != 0)
@@ -29,6 +29,7 @@
 #ifndef EXECUTION_TIMER_H
 #define EXECUTION_TIMER_H
 
+#include <chrono>
 #include <string>
 
 namespace test_harness {
@@ -49,7 +50,18 @@ class execution_timer {
      * Does timing for a given operation and keeps track of how many operations have been executed
      * as well as total time taken.
      */
-    template <typename T> auto track(T lambda);
+    template <typename T>
+    auto
+    track(T lambda)
+    {
+        auto _start_time = std::chrono::steady_clock::now();
+        int ret = lambda();
+        auto _end_time = std::chrono::steady_clock::now();
+        _total_time_taken += (_end_time - _start_time).count();
+        _it_count += 1;
+
+        return ret;
+    }
 
     private:
     std::string _id;
@@ -0,0 +1,120 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "latency_histogram.h"
+
+#include <algorithm>
+
+namespace test_harness {
+latency_histogram::latency_histogram()
+{
+    _buckets.fill(0);
+}
+
+/*
+ * Values smaller than the number of sub-buckets have a bucket each, larger values are bucketed by
+ * their most significant bit and the bits that follow it.
+ */
+int
+latency_histogram::bucket(uint64_t latency_ns)
+{
+    if (latency_ns < SUB_BUCKETS)
+        return (static_cast<int>(latency_ns));
+
+    int msb = 63 - __builtin_clzll(latency_ns);
+    int shift = msb - SUB_BUCKET_BITS;
+    return (SUB_BUCKETS + shift * SUB_BUCKETS +
+      static_cast<int>((latency_ns >> shift) & (SUB_BUCKETS - 1)));
+}
+
+/* Return the midpoint of a bucket's range. */
+uint64_t
+latency_histogram::bucket_value(int bucket)
+{
+    if (bucket < SUB_BUCKETS)
+        return (static_cast<uint64_t>(bucket));
+
+    int shift = (bucket - SUB_BUCKETS) / SUB_BUCKETS;
+    uint64_t low = static_cast<uint64_t>(SUB_BUCKETS + (bucket % SUB_BUCKETS)) << shift;
+    return (low + ((uint64_t(1) << shift) >> 1));
+}
+
+void
+latency_histogram::record(uint64_t latency_ns)
+{
+    ++_buckets[bucket(latency_ns)];
+    ++_count;
+    _max = std::max(_max, latency_ns);
+    _total += latency_ns;
+}
+
+void
+latency_histogram::merge(const latency_histogram &other)
+{
+    for (int i = 0; i < BUCKETS; ++i)
+        _buckets[i] += other._buckets[i];
+    _count += other._count;
+    _max = std::max(_max, other._max);
+    _total += other._total;
+}
+
+uint64_t
+latency_histogram::count() const
+{
+    return (_count);
+}
+
+uint64_t
+latency_histogram::max() const
+{
+    return (_max);
+}
+
+uint64_t
+latency_histogram::mean() const
+{
+    return (_count == 0 ? 0 : _total / _count);
+}
+
+uint64_t
+latency_histogram::percentile(double pct) const
+{
+    if (_count == 0)
+        return (0);
+
+    /* The rank of the operation at the percentile, counting from 1. */
+    uint64_t rank = std::max(uint64_t(1), static_cast<uint64_t>(_count * pct / 100.0 + 0.5));
+    uint64_t seen = 0;
+    for (int i = 0; i < BUCKETS; ++i) {
+        seen += _buckets[i];
+        if (seen >= rank)
+            return (std::min(bucket_value(i), _max));
+    }
+    return (_max);
+}
+} // namespace test_harness
@@ -0,0 +1,68 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <array>
+#include <cstdint>
+
+namespace test_harness {
+/*
+ * A log-linear histogram of operation latencies in nanoseconds. Each power of two range is split
+ * into 16 buckets, percentiles are accurate to within about 6%.
+ */
+class latency_histogram {
+    public:
+    latency_histogram();
+
+    void record(uint64_t latency_ns);
+    void merge(const latency_histogram &other);
+
+    uint64_t count() const;
+    uint64_t max() const;
+    uint64_t mean() const;
+    /* Return the latency below which the given percentage of the operations completed. */
+    uint64_t percentile(double pct) const;
+
+    private:
+    static const int SUB_BUCKET_BITS = 4;
+    static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+    static const int BUCKETS = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    static int bucket(uint64_t latency_ns);
+    static uint64_t bucket_value(int bucket);
+
+    std::array<uint64_t, BUCKETS> _buckets;
+    uint64_t _count = 0;
+    uint64_t _max = 0;
+    uint64_t _total = 0;
+};
+} // namespace test_harness
+
+#endif
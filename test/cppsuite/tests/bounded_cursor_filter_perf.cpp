@@ -0,0 +1,151 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "src/common/constants.h"
+#include "src/common/logger.h"
+#include "src/main/test.h"
+#include "src/util/execution_timer.h"
+
+using namespace test_harness;
+
+/*
+ * This test compares two ways of filtering a bounded cursor scan: returning every key to the
+ * application and discarding the ones that don't match, and pushing the predicate down into the
+ * btree page iteration with the cursor's filter configuration. The keys in the collection are
+ * contiguous zero-padded numbers, so a key suffix of N digits selects 1 in 10^N keys; the test
+ * sweeps the selectivity from all keys down to 0.1% of them, and the average time taken to scan
+ * the collection at each selectivity is added to the perf file.
+ */
+class bounded_cursor_filter_perf : public test {
+    /* The number of key suffix digits for each selectivity of the sweep. */
+    static constexpr int SUFFIX_DIGITS_MAX = 3;
+
+    public:
+    bounded_cursor_filter_perf(const test_args &args) : test(args)
+    {
+        init_operation_tracker();
+    }
+
+    static void
+    set_bounds(scoped_cursor &cursor)
+    {
+        testutil_check(cursor->reset(cursor.get()));
+        std::string lower_bound(1, ('0' - 1));
+        cursor->set_key(cursor.get(), lower_bound.c_str());
+        testutil_check(cursor->bound(cursor.get(), "bound=lower"));
+        std::string upper_bound(1, ('9' + 1));
+        cursor->set_key(cursor.get(), upper_bound.c_str());
+        testutil_check(cursor->bound(cursor.get(), "bound=upper"));
+    }
+
+    /* Scan a bounded cursor, counting the keys that end with the suffix. */
+    static int
+    scan_application_filter(scoped_cursor &cursor, const std::string &suffix, uint64_t &count)
+    {
+        const char *key;
+        size_t key_len;
+        int ret;
+
+        count = 0;
+        set_bounds(cursor);
+        while ((ret = cursor->next(cursor.get())) == 0) {
+            testutil_check(cursor->get_key(cursor.get(), &key));
+            key_len = strlen(key);
+            if (key_len >= suffix.size() &&
+              suffix.compare(0, suffix.size(), key + key_len - suffix.size()) == 0)
+                ++count;
+        }
+        return (ret == WT_NOTFOUND ? 0 : ret);
+    }
+
+    /* Scan a bounded cursor configured with a key filter, counting the keys returned. */
+    static int
+    scan_pushdown_filter(scoped_cursor &cursor, uint64_t &count)
+    {
+        int ret;
+
+        count = 0;
+        set_bounds(cursor);
+        while ((ret = cursor->next(cursor.get())) == 0)
+            ++count;
+        return (ret == WT_NOTFOUND ? 0 : ret);
+    }
+
+    void
+    read_operation(thread_worker *tc) override final
+    {
+        /* This test will only work with one read thread. */
+        testutil_assert(tc->thread_count == 1);
+
+        /* Get the collection to work on. */
+        testutil_assert(tc->collection_count == 1);
+        collection &coll = tc->db.get_collection(0);
+
+        /*
+         * Each selectivity has a timer and a filtered cursor. Reserve the timers, they append their
+         * results when destroyed.
+         */
+        std::vector<execution_timer> application_timers, pushdown_timers;
+        std::vector<scoped_cursor> pushdown_cursors;
+        std::vector<std::string> suffixes;
+        application_timers.reserve(SUFFIX_DIGITS_MAX + 1);
+        pushdown_timers.reserve(SUFFIX_DIGITS_MAX + 1);
+        for (int digits = 0, selectivity = 1; digits <= SUFFIX_DIGITS_MAX;
+             ++digits, selectivity *= 10) {
+            const std::string suffix = std::string(digits, '7');
+            const std::string name = "selectivity_1_in_" + std::to_string(selectivity);
+
+            suffixes.push_back(suffix);
+            application_timers.emplace_back("application_filter_" + name, test::_args.test_name);
+            pushdown_timers.emplace_back("pushdown_filter_" + name, test::_args.test_name);
+            pushdown_cursors.push_back(tc->session.open_scoped_cursor(
+              coll.name, digits == 0 ? "" : "filter=(key_suffix=\"" + suffix + "\")"));
+        }
+        scoped_cursor cursor = tc->session.open_scoped_cursor(coll.name);
+
+        while (tc->running()) {
+            for (int i = 0; i <= SUFFIX_DIGITS_MAX && tc->running(); ++i) {
+                uint64_t application_count, pushdown_count;
+
+                testutil_check(application_timers[i].track([&]() -> int {
+                    return scan_application_filter(cursor, suffixes[i], application_count);
+                }));
+                testutil_check(pushdown_timers[i].track([&]() -> int {
+                    return scan_pushdown_filter(pushdown_cursors[i], pushdown_count);
+                }));
+
+                /* Both scans must see the same keys. */
+                testutil_assert(application_count == pushdown_count);
+                logger::log_msg(LOG_TRACE,
+                  "bounded_cursor_filter_perf: suffix \"" + suffixes[i] + "\" matched " +
+                    std::to_string(pushdown_count) + " keys");
+            }
+            tc->sleep();
+        }
+    }
+};
@@ -26,8 +26,8 @@
  * OTHER DEALINGS IN THE SOFTWARE.
  */
 
-#include "src/util/execution_timer.cpp"
 #include "src/main/test.h"
+#include "src/util/execution_timer.h"
 
 using namespace test_harness;
 
@@ -0,0 +1,86 @@
+/*-
+ * Public Domain 2014-present MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "src/common/logger.h"
+#include "src/common/random_generator.h"
+#include "src/main/test.h"
+
+using namespace test_harness;
+
+/*
+ * A read-heavy performance test: reader threads search for random keys that exist while a few
+ * threads update them. The perf monitor records the search and update latencies.
+ */
+class perf_point_read : public test {
+    public:
+    perf_point_read(const test_args &args) : test(args)
+    {
+        init_operation_tracker();
+    }
+
+    void
+    read_operation(thread_worker *tc) override final
+    {
+        logger::log_msg(
+          LOG_INFO, type_string(tc->type) + " thread {" + std::to_string(tc->id) + "} commencing.");
+
+        std::map<uint64_t, scoped_cursor> cursors;
+        while (tc->running()) {
+            /* Get a random collection to work on. */
+            collection &coll = tc->db.get_random_collection();
+
+            /* Find a cached cursor or create one if none exists. */
+            if (cursors.find(coll.id) == cursors.end())
+                cursors.emplace(coll.id, std::move(tc->session.open_scoped_cursor(coll.name)));
+            auto &cursor = cursors[coll.id];
+
+            tc->txn.begin();
+            while (tc->txn.active() && tc->running()) {
+                auto key_id = random_generator::instance().generate_integer<uint64_t>(
+                  0, coll.get_key_count() - 1);
+                auto key = tc->pad_string(std::to_string(key_id), tc->key_size);
+                cursor->set_key(cursor.get(), key.c_str());
+                auto ret = tc->track("search", [&] { return (cursor->search(cursor.get())); });
+                if (ret == WT_ROLLBACK) {
+                    tc->txn.rollback();
+                    tc->sleep();
+                    continue;
+                }
+                /* Keys are never removed in this test. */
+                testutil_check(ret);
+                tc->txn.add_op();
+                tc->txn.try_rollback();
+                tc->sleep();
+            }
+            /* Reset our cursor to avoid pinning content. */
+            testutil_check(cursor->reset(cursor.get()));
+        }
+        /* Make sure the last transaction is rolled back now the work is finished. */
+        tc->txn.try_rollback();
+    }
+};
@@ -27,12 +27,14 @@
  */
 
 #include <algorithm>
+#include <fstream>
 #include <iostream>
 #include <string>
 
 #include "src/common/logger.h"
 #include "src/main/test.h"
 
+#include "bounded_cursor_filter_perf.cpp"
 #include "bounded_cursor_perf.cpp"
 #include "bounded_cursor_prefix_indices.cpp"
 #include "bounded_cursor_prefix_search_near.cpp"
@@ -42,6 +44,10 @@
 #include "cache_resize.cpp"
 #include "hs_cleanup.cpp"
 #include "operations_test.cpp"
+#include "perf_many_tables.cpp"
+#include "perf_point_read.cpp"
+#include "perf_scan.cpp"
+#include "perf_update_history.cpp"
 #include "reverse_split.cpp"
 #include "test_template.cpp"
 
@@ -135,7 +141,9 @@ run_test(const std::string &test_name, const std::string &config, const std::str
       .wt_open_config = wt_open_config,
       .home = home};
 
-    if (test_name == "bounded_cursor_perf")
+    if (test_name == "bounded_cursor_filter_perf")
+        bounded_cursor_filter_perf(args).run();
+    else if (test_name == "bounded_cursor_perf")
         bounded_cursor_perf(args).run();
     else if (test_name == "bounded_cursor_prefix_indices")
         bounded_cursor_prefix_indices(args).run();
@@ -153,6 +161,14 @@ run_test(const std::string &test_name, const std::string &config, const std::str
         hs_cleanup(args).run();
     else if (test_name == "operations_test")
         operations_test(args).run();
+    else if (test_name == "perf_many_tables")
+        perf_many_tables(args).run();
+    else if (test_name == "perf_point_read")
+        perf_point_read(args).run();
+    else if (test_name == "perf_scan")
+        perf_scan(args).run();
+    else if (test_name == "perf_update_history")
+        perf_update_history(args).run();
     else if (test_name == "reverse_split")
         reverse_split(args).run();
     else if (test_name == "test_template")
@@ -180,10 +196,11 @@ main(int argc, char *argv[])
     std::string cfg, config_filename, current_cfg, current_test_name, home, test_name,
       wt_open_config;
     int64_t error_code = 0;
-    const std::vector<std::string> all_tests = {"reverse_split", "bounded_cursor_perf",
-      "bounded_cursor_prefix_indices", "bounded_cursor_prefix_search_near",
+    const std::vector<std::string> all_tests = {"reverse_split", "bounded_cursor_filter_perf",
+      "bounded_cursor_perf", "bounded_cursor_prefix_indices", "bounded_cursor_prefix_search_near",
       "bounded_cursor_prefix_stat", "bounded_cursor_stress", "burst_inserts", "cache_resize",
-      "hs_cleanup", "operations_test", "test_template"};
+      "hs_cleanup", "operations_test", "perf_many_tables", "perf_point_read", "perf_scan",
+      "perf_update_history", "test_template"};
 
     /* Set the program name for error messages. */
     (void)testutil_set_progname(argv);
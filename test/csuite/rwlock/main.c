@@ -35,6 +35,16 @@
 
 #define CHECK_CORRECTNESS 1
 
+/*
+ * The reader-scalable variant switches the test's lock to reader-scalable mode, and configures the
+ * connection's data handle, table and global transaction locks the same way.
+ */
+#ifdef USE_SCALABLE
+#define CONN_CONFIG_RWLOCK ",rwlock_scalable=[dhandle,table,txn_global]"
+#else
+#define CONN_CONFIG_RWLOCK ""
+#endif
+
 static WT_RWLOCK rwlock;
 static pthread_rwlock_t p_rwlock;
 static bool running;
@@ -64,10 +74,14 @@ main(int argc, char *argv[])
 
     testutil_make_work_dir(opts->home);
     testutil_check(wiredtiger_open(opts->home, NULL,
-      "create,session_max=1000,statistics=(all),statistics_log=(json,on_close,wait=1)",
+      "create,session_max=1000,statistics=(all),statistics_log=(json,on_close,wait=1)"
+      CONN_CONFIG_RWLOCK,
       &opts->conn));
 
     testutil_check(__wt_rwlock_init(NULL, &rwlock));
+#ifdef USE_SCALABLE
+    testutil_check(__wt_rwlock_scalable(NULL, &rwlock));
+#endif
     testutil_check(pthread_rwlock_init(&p_rwlock, NULL));
 
     testutil_check(pthread_create(&dump_id, NULL, thread_dump, opts));
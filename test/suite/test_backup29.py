@@ -0,0 +1,211 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, wiredtiger, wttest
+from wtbackup import backup_base
+
+# test_backup29.py
+# Test parallel block-based incremental backup cursors, consolidation with a maximum range size
+# and returning the range data from the cursor.
+class test_backup29(backup_base):
+    dir = 'backup.dir'                  # Backup directory name
+    dir_full = 'backup.full'            # Full backup to compare against
+    gran = "4K"
+    granval = 4 * 1024
+    consolidate_max = 16 * 1024
+    uri = "table:test"
+    uri2 = "table:test2"
+
+    conn_config = 'cache_size=1G'
+
+    bigkey = 'Key' * 100
+    bigval = 'Value' * 100
+    nops = 1000
+
+    # Copy a work unit returned by a parallel cursor into the backup directory.
+    def copy_unit(self, c, units):
+        (newfile, offset, size, curtype) = c.get_keys()
+        data = c.get_value()
+        units.append((newfile, offset, size, curtype))
+        if curtype == wiredtiger.WT_BACKUP_FILE:
+            self.assertEqual(len(data), 0)
+            self.copy_file(newfile, self.dir)
+        else:
+            self.assertEqual(curtype, wiredtiger.WT_BACKUP_RANGE)
+            self.assertLessEqual(size, self.consolidate_max)
+            self.assertLessEqual(len(data), size)
+            with open(self.dir + '/' + newfile, 'r+b') as f:
+                f.seek(offset)
+                f.write(data)
+
+    def test_backup29(self):
+        self.session.create(self.uri, "key_format=S,value_format=S")
+        self.session.create(self.uri2, "key_format=S,value_format=S")
+        self.add_data(self.uri, self.bigkey, self.bigval, True)
+        self.mult = 0
+        self.add_data(self.uri2, self.bigkey, self.bigval, True)
+
+        os.mkdir(self.dir)
+        config = 'incremental=(enabled,granularity=%s,this_id="ID1")' % self.gran
+        bkup_c = self.session.open_cursor('backup:', None, config)
+        self.take_full_backup(self.dir, bkup_c)
+        bkup_c.close()
+
+        self.mult = 1
+        self.add_data(self.uri, self.bigkey, self.bigval, True)
+        self.add_data(self.uri2, self.bigkey, self.bigval, True)
+
+        # Take the incremental backup with two parallel cursors in different sessions, taking
+        # turns to return work units.
+        config = 'incremental=(src_id="ID1",this_id="ID2",consolidate_max=%d)' % \
+            self.consolidate_max
+        bkup_c = self.session.open_cursor('backup:', None, config)
+        session2 = self.conn.open_session()
+        config = 'incremental=(parallel=true,return_data=true)'
+        cursors = [self.session.open_cursor(None, bkup_c, config),
+            session2.open_cursor(None, bkup_c, config)]
+        units = [[], []]
+        done = [False, False]
+        while not all(done):
+            for i in range(2):
+                if done[i]:
+                    continue
+                ret = cursors[i].next()
+                if ret == wiredtiger.WT_NOTFOUND:
+                    done[i] = True
+                else:
+                    self.assertEqual(ret, 0)
+                    self.copy_unit(cursors[i], units[i])
+        for c in cursors:
+            c.close()
+        session2.close()
+
+        # Both cursors did work, and no unit was returned twice.
+        self.assertGreater(len(units[0]), 0)
+        self.assertGreater(len(units[1]), 0)
+        self.assertEqual(len(set(units[0] + units[1])), len(units[0]) + len(units[1]))
+
+        # Ranges were consolidated, but not beyond the maximum.
+        sizes = [u[2] for u in units[0] + units[1] if u[3] == wiredtiger.WT_BACKUP_RANGE]
+        self.assertTrue(any(s > self.granval for s in sizes))
+        self.assertLessEqual(max(sizes), self.consolidate_max)
+
+        # Compare the incremental backup against a full backup.
+        os.mkdir(self.dir_full)
+        self.take_full_backup(self.dir_full, bkup_c)
+        bkup_c.close()
+        self.compare_backups(self.uri, self.dir_full, self.dir)
+        self.compare_backups(self.uri2, self.dir_full, self.dir)
+
+    def test_backup29_pin(self):
+        self.session.create(self.uri, "key_format=S,value_format=S")
+        self.add_data(self.uri, self.bigkey, self.bigval, True)
+        config = 'incremental=(enabled,granularity=%s,this_id="ID1")' % self.gran
+        bkup_c = self.session.open_cursor('backup:', None, config)
+        bkup_c.close()
+        self.mult = 1
+        self.add_data(self.uri, self.bigkey, self.bigval, True)
+
+        # A parallel cursor holds the file it's returning ranges from open, the same as a file
+        # duplicate cursor: the table can't be altered until the cursor has moved past it.
+        bkup_c = self.session.open_cursor('backup:', None,
+            'incremental=(src_id="ID1",this_id="ID2")')
+        session2 = self.conn.open_session()
+        c = session2.open_cursor(None, bkup_c, 'incremental=(parallel=true)')
+        while c.next() == 0:
+            if c.get_keys()[0] == 'test.wt':
+                break
+        self.assertEqual(c.get_keys()[0], 'test.wt')
+        self.assertTrue(self.raisesBusy(
+            lambda: self.session.alter(self.uri, 'app_metadata=backup')))
+        c.close()
+        session2.close()
+        bkup_c.close()
+
+    def test_backup29_read_max(self):
+        # Granularity chunks larger than the read limit are returned in pieces when the cursor
+        # returns the range data.
+        read_max = 16 * 1024 * 1024
+        self.consolidate_max = read_max
+        self.session.create(self.uri, "key_format=S,value_format=S")
+        self.add_data(self.uri, self.bigkey, self.bigval, True)
+        config = 'incremental=(enabled,granularity=64MB,this_id="ID1")'
+        os.mkdir(self.dir)
+        bkup_c = self.session.open_cursor('backup:', None, config)
+        self.take_full_backup(self.dir, bkup_c)
+        bkup_c.close()
+
+        self.nops = 80000
+        self.add_data(self.uri, self.bigkey, self.bigval, True)
+
+        bkup_c = self.session.open_cursor('backup:', None,
+            'incremental=(src_id="ID1",this_id="ID2")')
+        c = self.session.open_cursor(None, bkup_c, 'incremental=(parallel=true,return_data=true)')
+        units = []
+        while c.next() == 0:
+            self.copy_unit(c, units)
+        c.close()
+        sizes = [u[2] for u in units if u[0] == 'test.wt' and u[3] == wiredtiger.WT_BACKUP_RANGE]
+        self.assertGreater(len(sizes), 1)
+        self.assertEqual(max(sizes), read_max)
+
+        os.mkdir(self.dir_full)
+        self.take_full_backup(self.dir_full, bkup_c)
+        bkup_c.close()
+        self.compare_backups(self.uri, self.dir_full, self.dir)
+
+    def test_backup29_config(self):
+        self.session.create(self.uri, "key_format=S,value_format=S")
+        self.add_data(self.uri, self.bigkey, self.bigval, True)
+        config = 'incremental=(enabled,granularity=%s,this_id="ID1")' % self.gran
+        bkup_c = self.session.open_cursor('backup:', None, config)
+        bkup_c.close()
+
+        # Parallel cursors and returning data are only for duplicate cursors.
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor('backup:', None,
+            'incremental=(src_id="ID1",this_id="ID2",parallel=true)'),
+            '/can only be opened as duplicate backup cursors/')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor('backup:', None,
+            'incremental=(src_id="ID1",this_id="ID2",return_data=true)'),
+            '/can only be returned by a file or parallel duplicate/')
+
+        bkup_c = self.session.open_cursor('backup:', None,
+            'incremental=(src_id="ID1",this_id="ID2")')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(None, bkup_c,
+            'incremental=(file=test.wt,parallel=true)'),
+            '/cannot be configured with a file name/')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(None, bkup_c, 'incremental=(consolidate_max=1MB)'),
+            '/can only be specified on a primary backup cursor/')
+        bkup_c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_bulk03.py
+#       Bulk-load with page writes offloaded to other threads.
+
+import os, random, wiredtiger, wttest
+from wiredtiger import stat
+from wtdataset import simple_key, simple_value
+from wtscenario import make_scenarios
+
+# test_bulkload_threads
+#       Bulk-load enough records for many pages with write offload threads configured, then check
+# the object verifies and reads back correctly.
+class test_bulkload_threads(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    nentries = 50000
+    configs = [
+        ('fix', dict(keyfmt='r', valfmt='8t')),
+        ('var', dict(keyfmt='r', valfmt='S')),
+        ('row', dict(keyfmt='S', valfmt='S')),
+    ]
+    threads = [
+        ('threads-1', dict(nthreads=1)),
+        ('threads-4', dict(nthreads=4)),
+    ]
+    scenarios = make_scenarios(configs, threads)
+
+    def test_bulkload_threads(self):
+        uri = 'table:bulk03'
+        self.session.create(uri,
+            'key_format={},value_format={},leaf_page_max=4KB'.format(self.keyfmt, self.valfmt))
+        cursor = self.session.open_cursor(uri, None, 'bulk,bulk_write_threads={}'.format(self.nthreads))
+        for i in range(1, self.nentries + 1):
+            cursor[simple_key(cursor, i)] = simple_value(cursor, i)
+        cursor.close()
+
+        # The offload threads wrote the leaf pages.
+        stat_cursor = self.session.open_cursor('statistics:')
+        self.assertGreater(stat_cursor[stat.conn.rec_bulk_offload_pages][2], 1)
+        stat_cursor.close()
+
+        self.reopen_conn()
+        self.session.verify(uri)
+
+        cursor = self.session.open_cursor(uri)
+        i = 0
+        for key, value in cursor:
+            i += 1
+            self.assertEqual(key, simple_key(cursor, i))
+            self.assertEqual(value, simple_value(cursor, i))
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    # Offload thread counts are bounded.
+    def test_bulkload_threads_config(self):
+        uri = 'table:bulk03'
+        self.session.create(uri, 'key_format=S,value_format=S')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(uri, None, 'bulk,bulk_write_threads=33'),
+            '/Value too large/')
+
+# test_bulkload_threads_compress
+#       Bulk-load incompressible records into a compressed object: the pre-compression page size
+# starts at the maximum in-memory page image and is adjusted as pages are written, the pages that
+# follow must be built to the adjusted size.
+class test_bulkload_threads_compress(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    nentries = 100000
+    leaf_page_max = 32 * 1024
+    scenarios = make_scenarios([
+        ('threads-0', dict(nthreads=0)),
+        ('threads-2', dict(nthreads=2)),
+    ])
+
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('compressors', 'zlib')
+
+    def test_bulkload_threads_compress(self):
+        uri = 'table:bulk03'
+        self.session.create(uri, 'key_format=Q,value_format=u,block_compressor=zlib,' +
+            'leaf_page_max={}'.format(self.leaf_page_max))
+        cursor = self.session.open_cursor(uri, None,
+            'bulk,bulk_write_threads={}'.format(self.nthreads))
+        r = random.Random(1)
+        for i in range(1, self.nentries + 1):
+            cursor[i] = bytes(r.getrandbits(8) for _ in range(100))
+        cursor.close()
+        self.reopen_conn()
+        self.session.verify(uri)
+
+        # Without the adjustment every page would be built to three quarters of the maximum
+        # in-memory page image, four times the maximum leaf page size.
+        stat_cursor = self.session.open_cursor('statistics:' + uri)
+        leaf_pages = stat_cursor[stat.dsrc.btree_row_leaf][2]
+        stat_cursor.close()
+        self.assertLess(os.path.getsize('bulk03.wt') // leaf_pages, 2 * self.leaf_page_max)
+
+if __name__ == '__main__':
+    wttest.run()
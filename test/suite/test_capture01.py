@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import glob, os, struct
+import wttest
+import wiredtiger
+
+# test_capture01.py
+#    Test operation capture: application cursor operations are written to per-session capture
+#    files, with a capture map naming the tables.
+class test_capture01(wttest.WiredTigerTestCase):
+    conn_config = 'operation_capture=(enabled=true)'
+    uri = 'table:test_capture01'
+
+    # These formats must match the structures in src/include/capture.h.
+    header = struct.Struct('<IIQ')
+    record = struct.Struct('<QQIIIIiB3x')
+
+    # Operation codes.
+    INSERT = 1
+    REMOVE = 3
+    SEARCH = 4
+    UPDATE = 6
+
+    def read_capture(self):
+        maps = glob.glob(os.path.join(self.home, 'capture-map.*'))
+        self.assertEqual(len(maps), 1)
+        with open(maps[0]) as f:
+            tables = dict((int(id), uri) for id, uri in (line.split() for line in f))
+
+        ops = []
+        for name in glob.glob(os.path.join(self.home, 'capture.*')):
+            with open(name, 'rb') as f:
+                data = f.read()
+            version, sid, epoch_nsec = self.header.unpack_from(data, 0)
+            self.assertEqual(version, 1)
+            self.assertEqual((len(data) - self.header.size) % self.record.size, 0)
+            for offset in range(self.header.size, len(data), self.record.size):
+                ts, key_hash, duration, key_size, value_size, table, ret, op = \
+                    self.record.unpack_from(data, offset)
+                ops.append((ts, tables[table], op, key_size, value_size, ret))
+        return sorted(ops)
+
+    def test_capture(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        for i in range(2000):
+            c['key' + str(i).zfill(5)] = 'v' * 100
+        c.set_key('key00010')
+        self.assertEqual(c.search(), 0)
+        c.set_key('nokey')
+        self.assertEqual(c.search(), wiredtiger.WT_NOTFOUND)
+        c.set_key('key00010')
+        c.set_value('v' * 50)
+        self.assertEqual(c.update(), 0)
+        c.set_key('key00010')
+        self.assertEqual(c.remove(), 0)
+        c.close()
+
+        # Records are written when the session closes.
+        self.reopen_conn()
+
+        ops = self.read_capture()
+        self.assertEqual(len(ops), 2004)
+        for op in ops:
+            self.assertEqual(op[1], self.uri)
+        inserts = [op for op in ops if op[2] == self.INSERT]
+        self.assertEqual(len(inserts), 2000)
+        self.assertTrue(all(op[3] == 9 and op[4] == 101 and op[5] == 0 for op in inserts))
+
+        # Searches capture the size of the value found and the return value.
+        self.assertEqual(ops[2000][2:], (self.SEARCH, 9, 101, 0))
+        self.assertEqual(ops[2001][2:], (self.SEARCH, 6, 0, wiredtiger.WT_NOTFOUND))
+        self.assertEqual(ops[2002][2:], (self.UPDATE, 9, 51, 0))
+        self.assertEqual(ops[2003][2:], (self.REMOVE, 9, 0, 0))
+
+    def test_capture_disable(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        self.conn.reconfigure('operation_capture=(enabled=false)')
+        c = self.session.open_cursor(self.uri)
+        c['key'] = 'value'
+        c.close()
+        self.reopen_conn()
+        self.assertEqual(glob.glob(os.path.join(self.home, 'capture.*')), [])
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_compact04.py
+#   Test the background compaction server.
+#
+
+import time, wiredtiger, wttest
+from wiredtiger import stat
+
+class test_compact04(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=100MB,statistics=(all)'
+
+    uri = 'table:test_compact04'
+    uri_excluded = 'table:test_compact04_excluded'
+
+    nrecords = 22000
+    bigvalue = "abcdefghi" * 1074          # 9*1074 == 9666
+    smallvalue = "ihgfedcba" * 303         # 9*303 == 2727
+
+    fullsize = nrecords // 2 * len(bigvalue) + nrecords // 2 * len(smallvalue)
+
+    # Return the size of the file
+    def getSize(self, uri):
+        cstat = self.session.open_cursor('statistics:' + uri, None, 'statistics=(all)')
+        sz = cstat[stat.dsrc.block_size][2]
+        cstat.close()
+        return sz
+
+    def getConnStat(self, key):
+        cstat = self.session.open_cursor('statistics:', None, 'statistics=(all)')
+        val = cstat[key][2]
+        cstat.close()
+        return val
+
+    # Create a table with big and small values, then remove the big ones so compaction has
+    # space to recover.
+    def populate(self, uri):
+        self.session.create(uri, 'key_format=i,value_format=S,leaf_value_max=10MB')
+        c = self.session.open_cursor(uri, None)
+        for i in range(self.nrecords):
+            if i % 2 == 0:
+                c[i] = str(i) + self.bigvalue
+            else:
+                c[i] = str(i) + self.smallvalue
+        c.close()
+        self.session.checkpoint()
+        self.assertGreater(self.getSize(uri), self.fullsize)
+
+        c = self.session.open_cursor(uri, None)
+        for i in range(0, self.nrecords, 2):
+            c.set_key(i)
+            c.remove()
+        c.close()
+        self.session.checkpoint()
+
+    def test_compact04(self):
+        self.populate(self.uri)
+        self.populate(self.uri_excluded)
+
+        self.conn.reconfigure('compact_server=(enabled=true,wait=1,free_space_target=1MB,' +
+            'exclude=["%s"])' % self.uri_excluded)
+
+        # Wait for the server to shrink the table.
+        for i in range(0, 120):
+            if self.getSize(self.uri) < self.fullsize // 2:
+                break
+            time.sleep(1)
+        self.assertLess(self.getSize(self.uri), self.fullsize // 2)
+
+        # Stop the server, the excluded table hasn't been compacted.
+        self.conn.reconfigure('compact_server=(enabled=false)')
+        self.assertGreater(self.getSize(self.uri_excluded), self.fullsize // 2)
+
+        self.assertGreater(self.getConnStat(stat.conn.session_background_compact_passes), 0)
+        self.assertGreater(self.getConnStat(stat.conn.session_background_compact_success), 0)
+        self.assertGreater(self.getConnStat(stat.conn.session_background_compact_excluded), 0)
+        self.assertGreater(
+            self.getConnStat(stat.conn.session_background_compact_bytes_recovered), 0)
+
+        cstat = self.session.open_cursor('statistics:' + self.uri, None, 'statistics=(all)')
+        self.assertGreater(cstat[stat.dsrc.btree_compact_pages_rewritten][2], 0)
+        self.assertGreater(cstat[stat.dsrc.btree_compact_bytes_rewritten][2], 0)
+        cstat.close()
+
+    def test_compact04_config(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure(
+            'compact_server=(enabled=true,exclude=["file:test_compact04.wt"])'),
+            '/only supports objects of type "table"/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,178 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cursor24.py
+#   Test batch cursors.
+
+import struct, wiredtiger, wttest
+from wtscenario import make_scenarios
+
+class test_cursor24(wttest.WiredTigerTestCase):
+    uri = 'table:test_cursor24'
+    nrows = 1000
+
+    scenarios = make_scenarios([
+        ('row', dict(keyfmt='i')),
+        ('var', dict(keyfmt='r')),
+    ])
+
+    def key(self, i):
+        return i + 1 if self.keyfmt == 'r' else i
+
+    # Unpack an array of 64-bit fixed-width column values.
+    def unpack_fixed(self, item, signed=True):
+        return list(struct.unpack('<%d%s' % (len(item) // 8, 'q' if signed else 'Q'), item))
+
+    # Unpack the offsets and data of a variable-length column.
+    def unpack_var(self, offsets, data):
+        off = self.unpack_fixed(offsets, False)
+        return [data[off[i]:off[i + 1]].decode() for i in range(len(off) - 1)]
+
+    def populate(self):
+        self.session.create(self.uri,
+            'key_format=' + self.keyfmt + ',value_format=qSH,columns=(k,a,b,c)')
+        c = self.session.open_cursor(self.uri)
+        for i in range(self.nrows):
+            c[self.key(i)] = (i - self.nrows // 2, 'v' + str(i), i % 7)
+        c.close()
+
+    # Read all of the batches from a cursor, return the batch sizes and the rows.
+    def scan(self, cursor):
+        sizes = []
+        rows = []
+        while cursor.next() == 0:
+            n, keys = cursor.get_key()
+            value = cursor.get_value()
+            keys = self.unpack_fixed(keys, self.keyfmt != 'r')
+            self.assertEqual(len(keys), n)
+            sizes.append(n)
+            rows += list(zip(keys, *self.columns(value)))
+        return sizes, rows
+
+    def test_batch_projection(self):
+        self.populate()
+        self.columns = lambda v: [self.unpack_var(v[0], v[1]), self.unpack_fixed(v[2])]
+        c = self.session.open_cursor(self.uri + '(b,a)', None, 'batch=(size=300)')
+        self.assertEqual(c.key_format, 'Qu')
+        self.assertEqual(c.value_format, 'uuu')
+        sizes, rows = self.scan(c)
+        self.assertEqual(sizes, [300, 300, 300, 100])
+        self.assertEqual(rows,
+            [(self.key(i), 'v' + str(i), i - self.nrows // 2) for i in range(self.nrows)])
+
+        # Reset restarts the scan.
+        c.reset()
+        self.assertEqual(self.scan(c)[0], [300, 300, 300, 100])
+        c.close()
+
+    def test_batch_filter(self):
+        self.populate()
+        self.columns = lambda v: [self.unpack_fixed(v[0]), self.unpack_var(v[1], v[2])]
+
+        # Signed filter, only the lower limit.
+        c = self.session.open_cursor(self.uri + '(a,b)', None,
+            'batch=(size=128,filter=a,filter_min=400)')
+        sizes, rows = self.scan(c)
+        self.assertEqual([r[1] for r in rows], list(range(400, self.nrows // 2)))
+        self.assertNotIn(0, sizes)
+        c.close()
+
+        # Unsigned filter on a column outside the projection order.
+        c = self.session.open_cursor(self.uri + '(c,b)', None,
+            'batch=(size=128,filter=c,filter_min=3,filter_max=3)')
+        sizes, rows = self.scan(c)
+        self.assertEqual([r[0] for r in rows],
+            [self.key(i) for i in range(self.nrows) if i % 7 == 3])
+        self.assertTrue(all(r[1] == 3 for r in rows))
+        c.close()
+
+        # Nothing matches.
+        c = self.session.open_cursor(self.uri, None,
+            'batch=(size=128,filter=a,filter_min=10000)')
+        self.assertEqual(c.next(), wiredtiger.WT_NOTFOUND)
+        c.close()
+
+    # Batch cursors on tables without named columns read the file directly, check they return
+    # what a plain cursor does.
+    def test_batch_simple(self):
+        uri = 'table:test_cursor24_simple'
+        self.session.create(uri, 'key_format=' + self.keyfmt + ',value_format=qS')
+        c = self.session.open_cursor(uri)
+        for i in range(self.nrows):
+            c[self.key(i)] = (i, 'v' + str(i))
+        c.close()
+        self.session.checkpoint()
+        self.reopen_conn()
+
+        # Update and remove rows in the page's update and insert lists, some of them uncommitted.
+        c = self.session.open_cursor(uri)
+        for i in range(0, self.nrows, 5):
+            c[self.key(i)] = (-i, 'u' + str(i))
+        for i in range(1, self.nrows, 9):
+            c.set_key(self.key(i))
+            c.remove()
+        c[self.key(self.nrows)] = (self.nrows, 'new')
+        c.close()
+        session2 = self.conn.open_session()
+        session2.begin_transaction()
+        c = session2.open_cursor(uri)
+        for i in range(2, self.nrows, 3):
+            c[self.key(i)] = (0, 'uncommitted')
+        c.close()
+
+        c = self.session.open_cursor(uri)
+        expect = [(k, a, b) for k, (a, b) in c]
+        c.close()
+        self.columns = lambda v: [self.unpack_fixed(v[0]), self.unpack_var(v[1], v[2])]
+        c = self.session.open_cursor(uri, None, 'batch=(size=64)')
+        self.assertEqual(self.scan(c)[1], expect)
+        c.close()
+        session2.rollback_transaction()
+
+    def test_batch_config(self):
+        self.populate()
+        msg = '/Invalid argument/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'batch=(size=10,filter=b)'),
+            '/not a fixed-width column/')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'batch=(size=10,filter=nope)'),
+            '/not found/')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'batch=(size=10),next_random'), msg)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'batch=(size=10),dump=hex'), msg)
+
+        c = self.session.open_cursor(self.uri, None, 'batch=(size=10)')
+        c.next()
+        self.assertRaises(wiredtiger.WiredTigerError, lambda: c.search())
+        self.assertRaises(wiredtiger.WiredTigerError, lambda: c.prev())
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_cursor25.py
+#   Test cursor iteration filters.
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+class test_cursor25(wttest.WiredTigerTestCase):
+    nrows = 1000
+
+    scenarios = make_scenarios([
+        ('file', dict(uri='file:test_cursor25')),
+        ('table', dict(uri='table:test_cursor25')),
+    ])
+
+    def key(self, i):
+        return 'key%04d' % i
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=S,value_format=Sq')
+        c = self.session.open_cursor(self.uri)
+        for i in range(self.nrows):
+            c[self.key(i)] = ('v' + str(i), i - self.nrows // 2)
+        c.close()
+
+    # Return the keys a cursor visits in the given direction.
+    def scan(self, cursor, forward=True):
+        keys = []
+        while (cursor.next() if forward else cursor.prev()) == 0:
+            keys.append(cursor.get_key())
+        cursor.reset()
+        return keys
+
+    def check(self, config, expect):
+        c = self.session.open_cursor(self.uri, None, 'filter=(' + config + ')')
+        self.assertEqual(self.scan(c), expect)
+        self.assertEqual(self.scan(c, False), list(reversed(expect)))
+        c.close()
+
+    def test_filter(self):
+        self.populate()
+        keys = [self.key(i) for i in range(self.nrows)]
+
+        # Key patterns.
+        self.check('key_prefix=key01', [k for k in keys if k.startswith('key01')])
+        self.check('key_suffix=7', [k for k in keys if k.endswith('7')])
+        self.check('key_prefix=key0,key_suffix=13', [k for k in keys if k.endswith('13')])
+
+        # Value ranges, signed and combined with a key pattern.
+        self.check('value_field=1,value_min=-10,value_max=10',
+            [self.key(i) for i in range(self.nrows // 2 - 10, self.nrows // 2 + 11)])
+        self.check('value_field=1,value_min=490,key_suffix=5',
+            [self.key(i) for i in range(990, self.nrows) if i % 10 == 5])
+
+        # Filters are applied on top of cursor bounds.
+        c = self.session.open_cursor(self.uri, None, 'filter=(key_suffix=3)')
+        c.set_key(self.key(100))
+        c.bound('action=set,bound=lower')
+        c.set_key(self.key(199))
+        c.bound('action=set,bound=upper')
+        self.assertEqual(self.scan(c), [self.key(i) for i in range(103, 200, 10)])
+        c.close()
+
+        # Searches aren't filtered.
+        c = self.session.open_cursor(self.uri, None, 'filter=(key_suffix=3)')
+        c.set_key(self.key(4))
+        self.assertEqual(c.search(), 0)
+        c.close()
+
+    def test_filter_uncommitted(self):
+        self.populate()
+
+        # Entries in the insert lists are filtered, and deleted entries are skipped.
+        self.session.begin_transaction()
+        c = self.session.open_cursor(self.uri)
+        c['key0005x'] = ('new', 0)
+        c.set_key(self.key(15))
+        c.remove()
+        c.close()
+        self.check('key_suffix=5',
+            [self.key(i) for i in range(self.nrows) if i % 10 == 5 and i != 15])
+        self.check('key_suffix=5x', ['key0005x'])
+        self.session.rollback_transaction()
+
+    def test_filter_truncate(self):
+        self.populate()
+        keys = [self.key(i) for i in range(self.nrows)]
+
+        # Truncate removes the whole range even if the start and stop keys don't match the
+        # cursors' filters, and the filters apply again afterward.
+        start = self.session.open_cursor(self.uri, None, 'filter=(key_suffix=3)')
+        stop = self.session.open_cursor(self.uri, None, 'filter=(key_suffix=3)')
+        start.set_key(self.key(100))
+        stop.set_key(self.key(199))
+        self.session.truncate(None, start, stop, None)
+        keys = [k for k in keys if not self.key(100) <= k <= self.key(199)]
+
+        # The start key doesn't exist and the keys following it don't match the filter.
+        start.set_key(self.key(300) + 'x')
+        stop.set_key(self.key(399))
+        self.session.truncate(None, start, stop, None)
+        keys = [k for k in keys if not self.key(300) < k <= self.key(399)]
+
+        self.assertEqual(self.scan(start), [k for k in keys if k.endswith('3')])
+        start.close()
+        stop.close()
+
+        c = self.session.open_cursor(self.uri)
+        self.assertEqual(self.scan(c), keys)
+        c.close()
+
+    def test_filter_config(self):
+        self.populate()
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'filter=(value_field=0)'),
+            '/not an integer field/')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'filter=(value_field=2)'),
+            '/not in value format/')
+
+        uri = self.uri + 'r'
+        self.session.create(uri, 'key_format=r,value_format=q')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(uri, None, 'filter=(value_field=0)'),
+            '/not supported/')
+
+        uri = self.uri + 'i'
+        self.session.create(uri, 'key_format=i,value_format=q')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(uri, None, 'filter=(key_prefix=a)'),
+            '/key_format of S or u/')
+
+if __name__ == '__main__':
+    wttest.run()
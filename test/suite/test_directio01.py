@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_directio01.py
+#   Test reading data files with direct I/O while writing them through the system buffer cache.
+
+import os
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtdataset import SimpleDataSet
+from wtscenario import make_scenarios
+
+class test_directio01(wttest.WiredTigerTestCase):
+    format_values = [
+        ('fix', dict(key_format='r', value_format='8t')),
+        ('row', dict(key_format='S', value_format='S')),
+        ('var', dict(key_format='r', value_format='S')),
+    ]
+    # Reads are only done with direct I/O if they're aligned, match the allocation size to the
+    # buffer alignment.
+    align_values = [
+        ('default', dict(align='-1', table_config='')),
+        ('8K', dict(align='8K', table_config='allocation_size=8K,internal_page_max=8K')),
+    ]
+    scenarios = make_scenarios(format_values, align_values)
+
+    nitems = 50000 # Enough items to create multiple pages.
+    uri = 'table:directio01'
+
+    def conn_config(self):
+        # This is a smoke test of direct I/O reads, don't try it on systems that aren't vanilla
+        # POSIX.
+        if os.name != 'posix':
+            self.skipTest('skipping direct I/O test on non-POSIX system')
+        return 'buffer_alignment={},direct_io=[read],statistics=(all)'.format(self.align)
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def test_directio(self):
+        ds = SimpleDataSet(self, self.uri, self.nitems,
+            key_format=self.key_format, value_format=self.value_format, config=self.table_config)
+        ds.populate()
+
+        # Reopen the connection so the pages are read back from the data file. Blocks are aligned,
+        # so they're read with direct I/O.
+        self.reopen_conn()
+        direct_bytes = self.get_stat(stat.conn.block_byte_read_direct)
+        ds.check()
+        self.assertGreater(self.get_stat(stat.conn.block_byte_read_direct), direct_bytes)
+
+        # Updates are written through the system buffer cache, and read back with direct I/O.
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nitems, 100):
+            c[ds.key(i)] = ds.value(i + 1) if self.value_format != '8t' else 7
+        c.close()
+        self.reopen_conn()
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nitems, 100):
+            self.assertEqual(c[ds.key(i)], ds.value(i + 1) if self.value_format != '8t' else 7)
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import glob, os, struct
+import wttest
+
+# test_event_trace01.py
+#    Test event tracing: trace files written on demand contain the most recent events of each
+#    session.
+class test_event_trace01(wttest.WiredTigerTestCase):
+    # 4KB buffers hold 128 events.
+    conn_config = 'event_tracing=(enabled=true,buffer_size=4KB)'
+    uri = 'table:test_event_trace01'
+
+    # These formats must match the structures in src/include/event_trace.h.
+    header = struct.Struct('<IIQQQII')
+    session = struct.Struct('<IIQ')
+    record = struct.Struct('<QQIHBx')
+
+    def read_trace(self, name):
+        with open(name, 'rb') as f:
+            data = f.read()
+        version, ratio, epoch_nsec, epoch_ticks, names_offset, name_count, session_count = \
+            self.header.unpack_from(data, 0)
+        self.assertEqual(version, 1)
+
+        names = []
+        offset = names_offset
+        for i in range(name_count):
+            (length,) = struct.unpack_from('<I', data, offset)
+            names.append(data[offset + 4:offset + 4 + length].decode())
+            offset += 4 + length
+        self.assertEqual(offset, len(data))
+
+        sessions = {}
+        offset = self.header.size
+        for i in range(session_count):
+            sid, internal, count = self.session.unpack_from(data, offset)
+            offset += self.session.size
+            records = []
+            for j in range(count):
+                ticks, arg, name, etype, phase = self.record.unpack_from(data, offset)
+                offset += self.record.size
+                records.append((ticks, names[name], chr(phase)))
+            sessions[sid] = records
+        self.assertEqual(offset, names_offset)
+        return sessions
+
+    # Return the records of the session inserting rows.
+    def app_records(self, sessions):
+        found = [r for r in sessions.values() if any(e[1] == 'WT_CURSOR.insert' for e in r)]
+        self.assertEqual(len(found), 1)
+        return found[0]
+
+    def test_event_trace(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        for i in range(1000):
+            c[i] = 'value' + str(i)
+        c.close()
+        self.conn.debug_info('trace')
+
+        files = glob.glob(os.path.join(self.home, 'event-trace.*'))
+        self.assertEqual(len(files), 1)
+        sessions = self.read_trace(files[0])
+
+        # The application session's buffer wrapped: it holds the most recent events, in order.
+        records = self.app_records(sessions)
+        self.assertEqual(len(records), 128)
+        self.assertEqual(records, sorted(records, key=lambda r: r[0]))
+        names = set(r[1] for r in records)
+        self.assertTrue('WT_CURSOR.insert' in names)
+        self.assertTrue('WT_CURSOR.close' in names)
+
+        # With tracing disabled, no new events are recorded.
+        self.conn.reconfigure('event_tracing=(enabled=false)')
+        c = self.session.open_cursor(self.uri)
+        c[1000] = 'value'
+        c.close()
+        self.conn.debug_info('trace')
+        files = sorted(glob.glob(os.path.join(self.home, 'event-trace.*')))
+        self.assertEqual(len(files), 2)
+        self.assertEqual(self.app_records(self.read_trace(files[1])), records)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,134 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_flcs07.py
+#
+# Test fixed-length column stores of 32 and 64-bit integers (the fixed_width configuration),
+# including value ranges, deleted records, checkpoints and iteration filters.
+class test_flcs07(wttest.WiredTigerTestCase):
+    conn_config = 'in_memory=false'
+    nrows = 5000
+
+    scenarios = make_scenarios([
+        ('i', dict(value_format='i', lo=-2**31, hi=2**31 - 1)),
+        ('I', dict(value_format='I', lo=0, hi=2**32 - 1)),
+        ('q', dict(value_format='q', lo=-2**63, hi=2**63 - 1)),
+        ('Q', dict(value_format='Q', lo=0, hi=2**64 - 1)),
+    ], [
+        ('file', dict(uri='file:test_flcs07')),
+        ('table', dict(uri='table:test_flcs07')),
+    ])
+
+    def value(self, i):
+        v = (i * 7919) % 1000
+        return v - 500 if self.lo < 0 else v
+
+    def populate(self):
+        self.session.create(self.uri,
+            'key_format=r,value_format={},fixed_width=true,leaf_page_max=4KB'.format(
+            self.value_format))
+        c = self.session.open_cursor(self.uri)
+        for i in range(1, self.nrows + 1):
+            c[i] = self.value(i)
+        c[1] = self.lo
+        c[2] = self.hi
+        c.set_key(3)
+        self.assertEqual(c.remove(), 0)
+        c.close()
+
+    def expected(self, i):
+        return {1: self.lo, 2: self.hi, 3: 0}.get(i, self.value(i))
+
+    def check(self):
+        c = self.session.open_cursor(self.uri)
+        i = 0
+        for k, v in c:
+            i += 1
+            self.assertEqual(k, i)
+            self.assertEqual(v, self.expected(i))
+        self.assertEqual(i, self.nrows)
+        c.close()
+
+    def test_fixed_width(self):
+        self.populate()
+        self.check()
+        self.session.checkpoint()
+        self.reopen_conn()
+        self.check()
+        self.assertEqual(self.session.verify(self.uri, None), 0)
+
+        # Values that don't fit the field are rejected.
+        c = self.session.open_cursor(self.uri)
+        if self.value_format in 'iI':
+            c.set_key(10)
+            c.set_value(self.hi + 1)
+            self.assertRaises(wiredtiger.WiredTigerError, lambda: c.update())
+        c.close()
+
+    def test_fixed_width_filter(self):
+        self.populate()
+        self.session.checkpoint()
+        self.reopen_conn()
+
+        # Updates and appends are filtered along with the on-page values.
+        c = self.session.open_cursor(self.uri)
+        c[20] = 100
+        c[self.nrows + 10] = 100
+        c.close()
+        values = dict((i, self.expected(i)) for i in range(1, self.nrows + 11))
+        values[20] = 100
+        for i in range(self.nrows + 1, self.nrows + 10):
+            values[i] = 0
+        values[self.nrows + 10] = 100
+
+        for lo, hi in [(100, 110), (0, 0), (self.lo, self.lo), (self.hi, self.hi), (5, 1)]:
+            expect = [k for k in sorted(values) if lo <= values[k] <= hi]
+            c = self.session.open_cursor(self.uri, None,
+                'filter=(value_field=0,value_min={},value_max={})'.format(lo, hi)
+                if hi < 2**63 else 'filter=(value_field=0,value_min={})'.format(lo))
+            self.assertEqual([k for k, v in c], expect)
+            c.reset()
+            keys = []
+            while c.prev() == 0:
+                keys.append(c.get_key())
+            self.assertEqual(keys, list(reversed(expect)))
+            c.close()
+
+    def test_fixed_width_config(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=S,value_format=q,fixed_width=true'),
+            '/fixed_width requires/')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri, 'key_format=r,value_format=S,fixed_width=true'),
+            '/fixed_width requires/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_index04.py
+# Test buffering index updates in explicit transactions with the index_batch cursor configuration.
+class test_index04(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'table:test_index04'
+    nentries = 1000
+
+    def getConnStat(self, key):
+        cstat = self.session.open_cursor('statistics:', None, None)
+        val = cstat[key][2]
+        cstat.close()
+        return val
+
+    def value(self, i, gen):
+        return ((i * 7 + gen) % 100, 'v%d' % ((i + gen) % 37))
+
+    # Check every index holds exactly one entry for each record in the table.
+    def check_indices(self):
+        expect_a = []
+        expect_b = []
+        c = self.session.open_cursor(self.uri, None)
+        for k, a, b in c:
+            expect_a.append((a, k))
+            expect_b.append((b, a, k))
+        c.close()
+
+        c = self.session.open_cursor('index:test_index04:a(k)', None)
+        self.assertEqual([(a, k) for a, k in
+            [(c.get_key(), c.get_value()) for _ in c]], sorted(expect_a))
+        c.close()
+        c = self.session.open_cursor('index:test_index04:b(k)', None)
+        self.assertEqual([tuple(c.get_key()) + (c.get_value(),) for _ in c], sorted(expect_b))
+        c.close()
+
+    def test_index_batch(self):
+        self.session.create(self.uri, 'key_format=i,value_format=iS,columns=(k,a,b)')
+        self.session.create('index:test_index04:a', 'columns=(a)')
+        self.session.create('index:test_index04:b', 'columns=(b,a)')
+
+        c = self.session.open_cursor(self.uri, None, 'index_batch=50')
+
+        # Load the table in a single transaction, the batch is applied as it fills.
+        self.session.begin_transaction()
+        for i in range(self.nentries):
+            c[i] = self.value(i, 0)
+        self.session.commit_transaction()
+        self.check_indices()
+        self.assertGreater(self.getConnStat(stat.conn.cursor_index_batch_apply), 0)
+
+        # Overwrite and remove records, the replaced index entries are removed from the batch.
+        self.session.begin_transaction()
+        for i in range(0, self.nentries, 2):
+            c[i] = self.value(i, 1)
+        for i in range(0, self.nentries, 3):
+            c.set_key(i)
+            self.assertEqual(c.remove(), 0)
+        self.session.commit_transaction()
+        self.check_indices()
+        self.assertGreater(self.getConnStat(stat.conn.cursor_index_batch_ops), 0)
+
+        # Buffered updates are discarded on rollback.
+        self.session.begin_transaction()
+        for i in range(self.nentries):
+            c[i] = self.value(i, 2)
+        self.session.rollback_transaction()
+        self.check_indices()
+
+        # Auto-commit operations aren't buffered.
+        for i in range(self.nentries, self.nentries + 10):
+            c[i] = self.value(i, 3)
+        self.check_indices()
+        c.close()
+
+    def test_index_batch_config(self):
+        self.session.create(self.uri, 'key_format=i,value_format=iS,columns=(k,a,b)')
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(self.uri, None, 'index_batch=-1'),
+            '/Value too small for key/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+#
+# test_insert_index01.py
+#       Updates, searches and traversal of large in-memory insert lists, which are searched using a
+#       hash index once they grow large enough.
+
+import random, wiredtiger, wttest
+from wtscenario import make_scenarios
+
+class test_insert_index01(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'table:test_insert_index01'
+    nentries = 5000
+
+    order_values = [
+        ('append', dict(shuffle=False)),
+        ('random', dict(shuffle=True)),
+    ]
+    scenarios = make_scenarios(order_values)
+
+    def key(self, i):
+        return 'key%06d' % i
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:' + self.uri)
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def check(self, suffix):
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nentries):
+            self.assertEqual(cursor[self.key(i)], 'value%d%s' % (i, suffix))
+
+        # Traversal order must be unchanged, in both directions.
+        i = 0
+        for k, v in cursor:
+            self.assertEqual(k, self.key(i))
+            i += 1
+        self.assertEqual(i, self.nentries)
+        while cursor.prev() == 0:
+            i -= 1
+            self.assertEqual(cursor.get_key(), self.key(i))
+        self.assertEqual(i, 0)
+        cursor.close()
+
+    def test_insert_index(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+
+        # All keys go on insert lists, the table has never been written.
+        keys = list(range(self.nentries))
+        if self.shuffle:
+            random.shuffle(keys)
+        cursor = self.session.open_cursor(self.uri)
+        for i in keys:
+            cursor[self.key(i)] = 'value%d' % i
+        cursor.close()
+        self.check('')
+        self.assertGreater(self.get_stat(wiredtiger.stat.dsrc.cursor_insert_index_build), 0)
+
+        # Update every key in a different order, updates find existing insert list items in the
+        # index.
+        hits = self.get_stat(wiredtiger.stat.dsrc.cursor_insert_index_hit)
+        random.shuffle(keys)
+        cursor = self.session.open_cursor(self.uri)
+        for i in keys:
+            cursor[self.key(i)] = 'value%d-updated' % i
+        cursor.close()
+        self.assertGreater(self.get_stat(wiredtiger.stat.dsrc.cursor_insert_index_hit), hits)
+        self.check('-updated')
+
+        # Searches for keys that don't exist miss in the index, fall through to the skiplist and
+        # fail.
+        misses = self.get_stat(wiredtiger.stat.dsrc.cursor_insert_index_miss)
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(self.nentries, self.nentries + 100):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        for i in range(0, 100):
+            cursor.set_key(self.key(i) + 'x')
+            self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.close()
+        self.assertGreater(self.get_stat(wiredtiger.stat.dsrc.cursor_insert_index_miss), misses)
+
+if __name__ == '__main__':
+    wttest.run()
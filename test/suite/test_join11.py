@@ -0,0 +1,177 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_join11.py
+#    Joins evaluated as sets of primary keys.
+class test_join11(wttest.WiredTigerTestCase):
+    # We need statistics for these tests.
+    conn_config = 'statistics=(all)'
+    nentries = 1000
+
+    keyfmt = [
+        ('string', dict(keyfmt='S')),
+        ('recno', dict(keyfmt='r')),
+    ]
+    operation = [
+        ('and', dict(operation='and')),
+        ('or', dict(operation='or')),
+    ]
+    scenarios = make_scenarios(keyfmt, operation)
+
+    def gen_key(self, i):
+        return str(i).zfill(5) if self.keyfmt == 'S' else i
+
+    def gen_values(self, i):
+        return [(self.nentries - i) % 300, i % 7]
+
+    def populate(self):
+        self.session.create('table:join11',
+            'key_format=' + self.keyfmt + ',value_format=ii,columns=(k,a,b)')
+        self.session.create('index:join11:a', 'columns=(a)')
+        self.session.create('index:join11:b', 'columns=(b)')
+        c = self.session.open_cursor('table:join11', None, None)
+        for i in range(1, self.nentries + 1):
+            c[self.gen_key(i)] = self.gen_values(i)
+        c.close()
+
+    def join(self, jc, uri, key, compare, strategy, extra=''):
+        c = self.session.open_cursor(uri, None, None)
+        c.set_key(key)
+        self.assertEqual(0, c.search())
+        self.session.join(jc, c,
+            'compare=' + compare + ',operation=' + self.operation + ',strategy=' + strategy +
+            extra)
+        return c
+
+    def check_stats(self, jc, expect):
+        statcursor = self.session.open_cursor('statistics:join', jc, None)
+        for id, desc, valstr, val in statcursor:
+            if desc in expect:
+                self.assertEqual(val, expect.pop(desc))
+        statcursor.close()
+        self.assertTrue(len(expect) == 0, 'missing expected values in stats: ' + str(expect))
+
+    def test_join_set(self):
+        self.populate()
+
+        # a >= 100 joined with b == 3, both collected into sets.
+        jc = self.session.open_cursor('join:table:join11', None, None)
+        c0 = self.join(jc, 'index:join11:a', 100, 'ge', 'set')
+        c1 = self.join(jc, 'index:join11:b', 3, 'eq', 'set')
+
+        ina = [i for i in range(1, self.nentries + 1) if self.gen_values(i)[0] >= 100]
+        inb = [i for i in range(1, self.nentries + 1) if self.gen_values(i)[1] == 3]
+        if self.operation == 'and':
+            expect = sorted(set(ina) & set(inb))
+        else:
+            expect = sorted(set(ina) | set(inb))
+
+        # Keys are returned once each, in primary key order. Iterating again after the end
+        # restarts the iteration, as does a reset.
+        for i in range(0, 2):
+            got = []
+            while jc.next() == 0:
+                [a, b] = jc.get_values()
+                self.assertEqual([a, b], self.gen_values(int(jc.get_keys()[0])))
+                got.append(int(jc.get_keys()[0]))
+            self.assertEqual(got, expect)
+        self.assertEqual(jc.next(), 0)
+        jc.reset()
+        self.assertEqual(jc.next(), 0)
+        self.assertEqual(int(jc.get_keys()[0]), expect[0])
+
+        self.check_stats(jc, {
+            'join: index:join11:a: items inserted into a set': len(ina),
+            'join: index:join11:a: items in the set after combining with previous joins':
+                len(ina),
+            'join: index:join11:b: items inserted into a set': len(inb),
+            'join: index:join11:b: items in the set after combining with previous joins':
+                len(expect)})
+        jc.close()
+        c0.close()
+        c1.close()
+
+    def test_join_set_fallback(self):
+        self.populate()
+
+        # The sets for a >= 100 don't fit in 8KB: the join falls back to iterating the first
+        # joined cursor and returns the same keys, in the first joined index's order.
+        jc = self.session.open_cursor('join:table:join11', None, None)
+        c0 = self.join(jc, 'index:join11:a', 100, 'ge', 'set', ',set_max=8KB')
+        c1 = self.join(jc, 'index:join11:b', 3, 'eq', 'set')
+
+        ina = [i for i in range(1, self.nentries + 1) if self.gen_values(i)[0] >= 100]
+        inb = [i for i in range(1, self.nentries + 1) if self.gen_values(i)[1] == 3]
+        if self.operation == 'and':
+            expect = sorted(set(ina) & set(inb))
+        else:
+            expect = sorted(set(ina) | set(inb))
+        got = []
+        while jc.next() == 0:
+            got.append(int(jc.get_keys()[0]))
+        # Without sets, a disjunction returns keys matching more than one join more than once.
+        self.assertEqual(sorted(set(got)), expect)
+        if self.operation == 'and':
+            self.assertEqual(len(got), len(expect))
+
+        self.check_stats(jc, {
+            'join: index:join11:a: items inserted into a set': 0,
+            'join: index:join11:b: items inserted into a set': 0})
+        jc.close()
+        c0.close()
+        c1.close()
+
+    def test_join_set_config(self):
+        self.populate()
+        jc = self.session.open_cursor('join:table:join11', None, None)
+        c0 = self.join(jc, 'index:join11:a', 100, 'ge', 'set')
+
+        # Every joined cursor must use sets.
+        c1 = self.session.open_cursor('index:join11:b', None, None)
+        c1.set_key(3)
+        self.assertEqual(0, c1.search())
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.join(jc, c1, 'compare=eq,operation=' + self.operation),
+            '/strategy=set must be used for all cursors joined/')
+
+        # Sets cannot be used with nested joins.
+        jc2 = self.session.open_cursor('join:table:join11', None, None)
+        self.session.join(jc2, c1, 'compare=eq,operation=' + self.operation)
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.join(jc, jc2, 'operation=' + self.operation),
+            '/strategy=set cannot be used with subjoins/')
+        jc.close()
+        jc2.close()
+        c0.close()
+        c1.close()
+
+if __name__ == '__main__':
+    wttest.run()
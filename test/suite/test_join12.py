@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wttest
+from wtscenario import make_scenarios
+
+# test_join12.py
+#    Joins evaluated as sets of primary keys on a table with a custom collator.
+class test_join12(wttest.WiredTigerTestCase):
+    nentries = 1000
+
+    operation = [
+        ('and', dict(operation='and')),
+        ('or', dict(operation='or')),
+    ]
+    scenarios = make_scenarios(operation)
+
+    def conn_extensions(self, extlist):
+        extlist.skip_if_missing = True
+        extlist.extension('collators', 'reverse')
+
+    def gen_values(self, i):
+        return [(self.nentries - i) % 300, i % 7]
+
+    def test_join_set_collator(self):
+        # The reverse collator orders the primary keys from largest to smallest.
+        self.session.create('table:join12',
+            'key_format=S,value_format=ii,columns=(k,a,b),collator=reverse')
+        self.session.create('index:join12:a', 'columns=(a)')
+        self.session.create('index:join12:b', 'columns=(b)')
+        c = self.session.open_cursor('table:join12', None, None)
+        for i in range(1, self.nentries + 1):
+            c[str(i).zfill(5)] = self.gen_values(i)
+        c.close()
+
+        jc = self.session.open_cursor('join:table:join12', None, None)
+        cursors = []
+        for (uri, key, compare) in [
+          ('index:join12:a', 100, 'ge'), ('index:join12:b', 3, 'eq')]:
+            c = self.session.open_cursor(uri, None, None)
+            c.set_key(key)
+            self.assertEqual(0, c.search())
+            self.session.join(jc, c,
+                'compare=' + compare + ',operation=' + self.operation + ',strategy=set')
+            cursors.append(c)
+
+        ina = [i for i in range(1, self.nentries + 1) if self.gen_values(i)[0] >= 100]
+        inb = [i for i in range(1, self.nentries + 1) if self.gen_values(i)[1] == 3]
+        if self.operation == 'and':
+            expect = sorted(set(ina) & set(inb), reverse=True)
+        else:
+            expect = sorted(set(ina) | set(inb), reverse=True)
+
+        # Keys are returned once each, in the order of the table's collator.
+        got = []
+        while jc.next() == 0:
+            got.append(int(jc.get_keys()[0]))
+        self.assertEqual(got, expect)
+        jc.close()
+        for c in cursors:
+            c.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,116 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import make_scenarios
+
+# test_lsm05.py
+#    Test LSM merge strategies and partitioned merges.
+class test_lsm05(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    uri = 'lsm:test_lsm05'
+    nrecs = 100000
+
+    strategies = [
+        ('generational', dict(strategy='generational')),
+        ('leveled', dict(strategy='leveled')),
+        ('size_tiered', dict(strategy='size_tiered')),
+        ('time_windowed', dict(strategy='time_windowed')),
+    ]
+    partitions = [
+        ('serial', dict(partitions=1)),
+        ('partitioned', dict(partitions=4)),
+    ]
+    scenarios = make_scenarios(strategies, partitions)
+
+    def key(self, i):
+        return 'key%010d' % i
+
+    def value(self, i):
+        return 'value%010d' % i + 'x' * 100
+
+    def get_stat(self, key):
+        cstat = self.session.open_cursor('statistics:' + self.uri, None, None)
+        val = cstat[key][2]
+        cstat.close()
+        return val
+
+    def test_lsm_merge(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'lsm=(chunk_size=512K,merge_min=2,merge_strategy=%s,merge_partitions=%d)' %
+            (self.strategy, self.partitions))
+
+        # Insert the keys out of order so every chunk spans the key space, then remove some so
+        # merges see tombstones.
+        c = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nrecs):
+            j = (i * 7919) % self.nrecs
+            c[self.key(j)] = self.value(j)
+        for i in range(0, self.nrecs, 3):
+            c.set_key(self.key(i))
+            self.assertEqual(c.remove(), 0)
+        c.close()
+
+        # Compact forces merges of everything in the tree.
+        self.session.compact(self.uri, None)
+
+        self.assertGreater(self.get_stat(stat.dsrc.lsm_merge_count), 0)
+        self.assertGreater(self.get_stat(stat.dsrc.lsm_merge_bytes_written), 0)
+        self.assertGreater(self.get_stat(stat.dsrc.lsm_merge_write_amplification), 100)
+        self.assertGreaterEqual(self.get_stat(stat.dsrc.lsm_merge_partitions),
+            self.get_stat(stat.dsrc.lsm_merge_count))
+
+        # Check the contents, in both directions.
+        expected = [i for i in range(self.nrecs) if i % 3 != 0]
+        c = self.session.open_cursor(self.uri, None, None)
+        found = []
+        for k, v in c:
+            self.assertEqual(v, self.value(int(k[3:])))
+            found.append(int(k[3:]))
+        self.assertEqual(found, expected)
+        found = []
+        while c.prev() == 0:
+            found.append(int(c.get_key()[3:]))
+        self.assertEqual(found, expected[::-1])
+        c.close()
+
+        # Reopen, the chunk list and merge configuration are read back from the metadata.
+        self.reopen_conn()
+        c = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nrecs):
+            c.set_key(self.key(i))
+            if i % 3 == 0:
+                self.assertEqual(c.search(), wiredtiger.WT_NOTFOUND)
+            else:
+                self.assertEqual(c.search(), 0)
+                self.assertEqual(c.get_value(), self.value(i))
+        c.close()
+
+if __name__ == '__main__':
+    wttest.run()
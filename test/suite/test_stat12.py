@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger
+import wttest
+
+# test_stat12.py
+#    Check the latency percentile statistics.
+class test_stat12(wttest.WiredTigerTestCase):
+    uri = 'table:test_stat12'
+    conn_config = 'statistics=(all)'
+    pct = ['p50', 'p90', 'p99', 'p999', 'max']
+
+    def get_stats(self, source, stat_type, name, config=None):
+        stat_cursor = self.session.open_cursor('statistics:' + source, None, config)
+        values = [stat_cursor[getattr(stat_type, 'latency_' + name + '_' + p)][2]
+            for p in self.pct]
+        stat_cursor.close()
+        return values
+
+    def check_ordered(self, values):
+        self.assertGreater(values[0], 0)
+        for i in range(1, len(values)):
+            self.assertLessEqual(values[i - 1], values[i])
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, 1000):
+            self.session.begin_transaction()
+            cursor[i] = 'value' + str(i)
+            self.session.commit_transaction()
+        for i in range(1, 1000):
+            cursor.set_key(i)
+            self.assertEqual(cursor.search(), 0)
+        for i in range(1, 100):
+            cursor.set_key(i)
+            cursor.set_value('updated' + str(i))
+            self.assertEqual(cursor.update(), 0)
+            cursor.set_key(i)
+            self.assertEqual(cursor.remove(), 0)
+        cursor.close()
+
+    def test_latency(self):
+        self.populate()
+
+        # The connection and the table have percentiles for the cursor operations.
+        for op in ['cursor_insert', 'cursor_remove', 'cursor_search', 'cursor_update']:
+            self.check_ordered(self.get_stats('', wiredtiger.stat.conn, op))
+            self.check_ordered(self.get_stats(self.uri, wiredtiger.stat.dsrc, op))
+        self.check_ordered(self.get_stats('', wiredtiger.stat.conn, 'txn_commit'))
+
+        # Clearing the statistics resets the histograms.
+        self.get_stats(self.uri, wiredtiger.stat.dsrc, 'cursor_search', 'statistics=(all,clear)')
+        self.assertEqual(
+            self.get_stats(self.uri, wiredtiger.stat.dsrc, 'cursor_search'), [0, 0, 0, 0, 0])
+        self.check_ordered(self.get_stats('', wiredtiger.stat.conn, 'cursor_search'))
+        self.get_stats('', wiredtiger.stat.conn, 'cursor_search', 'statistics=(all,clear)')
+        self.assertEqual(
+            self.get_stats('', wiredtiger.stat.conn, 'cursor_search'), [0, 0, 0, 0, 0])
+
+    def test_latency_fast(self):
+        # Data handles only record latencies when all statistics are configured.
+        self.conn.reconfigure('statistics=(fast)')
+        self.populate()
+        self.check_ordered(self.get_stats('', wiredtiger.stat.conn, 'cursor_insert'))
+        self.assertEqual(
+            self.get_stats(self.uri, wiredtiger.stat.dsrc, 'cursor_insert'), [0, 0, 0, 0, 0])
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,85 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import re
+import wiredtiger
+import wttest
+
+# test_stat13.py
+#    Check the session wait event statistics.
+class test_stat13(wttest.WiredTigerTestCase):
+    uri = 'table:test_stat13'
+    conn_config = 'statistics=(all),log=(enabled),io_capacity=(total=1M)'
+
+    # Return the wait event statistics of each session, keyed by the session's ID.
+    def get_waits(self, config=None):
+        stat_cursor = self.session.open_cursor('statistics:session_waits', None, config)
+        waits = {}
+        for key, desc, pvalue, value in stat_cursor:
+            m = re.match(r'session-wait: session (\d+): ', desc)
+            self.assertIsNotNone(m)
+            waits.setdefault(int(m.group(1)), {})[key] = value
+        stat_cursor.close()
+        return waits
+
+    def total(self, waits, key):
+        return sum(stats[key] for stats in waits.values())
+
+    def test_session_waits(self):
+        # Every active session returns a complete set of statistics, including this one.
+        waits = self.get_waits()
+        self.assertGreater(len(waits), 0)
+        nstats = len(list(waits.values())[0])
+        self.assertEqual(nstats % 3, 0)
+        for stats in waits.values():
+            self.assertEqual(len(stats), nstats)
+
+        # Write enough log records to be throttled by the capacity configuration.
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri)
+        value = 'x' * 10000
+        for i in range(1, 100):
+            self.session.begin_transaction()
+            cursor[i] = value
+            self.session.commit_transaction()
+        cursor.close()
+        self.session.log_flush('sync=on')
+
+        waits = self.get_waits()
+        count = self.total(waits, wiredtiger.stat.session_waits.capacity_count)
+        self.assertGreater(count, 0)
+        self.assertGreater(self.total(waits, wiredtiger.stat.session_waits.capacity_time), 0)
+
+        # Clearing the statistics resets the counts.
+        self.get_waits('statistics=(all,clear)')
+        waits = self.get_waits()
+        self.assertLess(self.total(waits, wiredtiger.stat.session_waits.capacity_count), count)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,92 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_sweep06.py
+#    Look up data handles without the handle list lock while the sweep server discards them.
+
+import threading, time
+import wiredtiger, wttest
+
+class test_sweep06(wttest.WiredTigerTestCase):
+    conn_config = 'file_manager=(close_handle_minimum=0,close_idle_time=1,close_scan_interval=1),' \
+        'statistics=(fast)'
+    uri = 'table:test_sweep06_%d'
+    ntables = 20
+    nthreads = 4
+    runtime = 12
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    # Switch between the two halves of the tables every few seconds, so the idle half is swept while
+    # the other half is looked up. Each pass uses a new session: a session's cached handles keep
+    # them from being swept, and the lookups have to go to the connection's handles.
+    def lookup(self, start, errors):
+        try:
+            while time.time() - start < self.runtime:
+                half = int((time.time() - start) / 3) % 2
+                session = self.conn.open_session()
+                for i in range(half * self.ntables // 2, (half + 1) * self.ntables // 2):
+                    cursor = session.open_cursor(self.uri % i)
+                    self.assertEqual(cursor[1], i)
+                    cursor.close()
+                session.close()
+        except Exception as e:
+            errors.append(e)
+
+    def test_sweep06(self):
+        for i in range(self.ntables):
+            self.session.create(self.uri % i, 'key_format=i,value_format=i')
+            cursor = self.session.open_cursor(self.uri % i)
+            cursor[1] = i
+            cursor.close()
+
+        # Release this session's references to the handles.
+        self.session.close()
+        self.session = self.conn.open_session()
+
+        errors = []
+        start = time.time()
+        threads = [threading.Thread(target=self.lookup, args=(start, errors))
+            for i in range(self.nthreads)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        self.assertEqual(errors, [])
+
+        # Lookups found shared handles without the lock, swept handles fell back to the locked path.
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.dh_sweep_remove), 0)
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.dh_conn_lockfree_find), 0)
+        self.assertGreater(self.get_stat(wiredtiger.stat.conn.dh_conn_lockfree_miss), 0)
+
+if __name__ == '__main__':
+    wttest.run()
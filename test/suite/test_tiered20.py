@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import filecmp, os, wiredtiger, wttest
+from helper_tiered import TieredConfigMixin, gen_tiered_storage_sources, get_conn_config
+from wtscenario import make_scenarios
+from wiredtiger import stat
+
+# test_tiered20.py
+#    Test flushing objects in parts, with one or several flush threads.
+class test_tiered20(wttest.WiredTigerTestCase, TieredConfigMixin):
+    # Multipart flushes are only supported by the dir_store storage source.
+    storage_sources = gen_tiered_storage_sources(wttest.getss_random_prefix(), 'test_tiered20', tiered_only=True)
+    flush_threads = [
+        ('single', dict(flush_threads=1)),
+        ('multiple', dict(flush_threads=4)),
+    ]
+    scenarios = make_scenarios(storage_sources[:1], flush_threads)
+
+    base = 'test_tiered20-000000000'
+    obj1file = base + '1.wtobj'
+    uri = "table:test_tiered20"
+    nentries = 2000
+
+    def conn_config(self):
+        return get_conn_config(self) + \
+            'flush_part_size=4KB,flush_threads=%d)' % self.flush_threads
+
+    # Load the storage store extension, copying objects into the cache in parallel ranges.
+    def conn_extensions(self, extlist):
+        # Windows doesn't support dynamically loaded extension libraries.
+        if os.name == 'nt':
+            extlist.skip_if_missing = True
+        extlist.extension('storage_sources',
+            self.ss_name + '=(config=\"(transfer_part_size=8192,transfer_threads=4)\")')
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def check(self):
+        c = self.session.open_cursor(self.uri)
+        n = 0
+        for k, v in c:
+            self.assertEqual(v, str(k) * 50)
+            n += 1
+        self.assertEqual(n, self.nentries)
+        c.close()
+
+    def test_tiered(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        for i in range(self.nentries):
+            c[i] = str(i) * 50
+        c.close()
+        self.session.checkpoint()
+        self.session.checkpoint('flush_tier=(enabled,sync=true)')
+
+        # The object is several parts and was flushed in parts. The object in the bucket is the same
+        # as the local object.
+        self.assertEqual(self.get_stat(stat.conn.tiered_flush_multipart), 1)
+        obj_size = os.path.getsize(self.obj1file)
+        self.assertGreater(obj_size, 4096)
+        self.assertEqual(self.get_stat(stat.conn.tiered_flush_parts), (obj_size + 4095) // 4096)
+        bucket_obj = os.path.join(self.bucket, self.bucket_prefix + self.obj1file)
+        self.assertTrue(filecmp.cmp(self.obj1file, bucket_obj, shallow=False))
+        self.assertFalse(os.path.exists(bucket_obj + '.PART'))
+        self.check()
+
+        # Remove the cached copy of the object, reading it copies it from the bucket to the cache
+        # again, in ranges.
+        self.close_conn()
+        cache_obj = os.path.join('cache-' + self.bucket, self.bucket_prefix + self.obj1file)
+        if os.path.exists(cache_obj):
+            os.remove(cache_obj)
+        self.reopen_conn()
+        self.check()
+
+    # Drop the table while its object is being flushed in parts. The drop waits for the parts being
+    # copied and discards the flush, no part is left in the bucket.
+    def test_tiered_drop(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        for i in range(self.nentries * 10):
+            c[i] = str(i) * 50
+        c.close()
+        self.session.checkpoint()
+        self.session.checkpoint('flush_tier=(enabled,sync=false)')
+        self.session.drop(self.uri)
+
+        bucket_obj = os.path.join(self.bucket, self.bucket_prefix + self.obj1file)
+        self.assertFalse(os.path.exists(bucket_obj + '.PART'))
+        self.reopen_conn()
+        self.assertFalse(os.path.exists(bucket_obj + '.PART'))
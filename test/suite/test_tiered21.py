@@ -0,0 +1,130 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import os, wiredtiger, wttest
+from helper_tiered import TieredConfigMixin, gen_tiered_storage_sources, get_conn_config
+from wtscenario import make_scenarios
+
+# test_tiered21.py
+#    Test caching objects on demand, reading the chunks of an object from the bucket as they're
+#    first read, with and without reading ahead.
+class test_tiered21(wttest.WiredTigerTestCase, TieredConfigMixin):
+    # Caching on demand is only supported by the dir_store storage source.
+    storage_sources = gen_tiered_storage_sources(wttest.getss_random_prefix(), 'test_tiered21', tiered_only=True)
+    prefetch = [
+        ('no_prefetch', dict(prefetch=0)),
+        ('prefetch', dict(prefetch=8)),
+    ]
+    scenarios = make_scenarios(storage_sources[:1], prefetch)
+
+    base = 'test_tiered21-000000000'
+    obj1file = base + '1.wtobj'
+    uri = "table:test_tiered21"
+    nentries = 20000
+
+    # Cache objects in 4KB chunks.
+    chunk_size = 4096
+    def conn_config(self):
+        return get_conn_config(self) + 'cache_chunk_size=%d,cache_prefetch=%d)' % (
+            self.chunk_size, self.prefetch)
+
+    # Load the storage store extension, delaying every read from the bucket.
+    def conn_extensions(self, extlist):
+        # Windows doesn't support dynamically loaded extension libraries.
+        if os.name == 'nt':
+            extlist.skip_if_missing = True
+        extlist.extension('storage_sources',
+            self.ss_name + '=(config=\"(delay_ms=5,force_delay=1)\")')
+
+    def value(self, i):
+        return str(i) * 20
+
+    def check(self):
+        c = self.session.open_cursor(self.uri)
+        n = 0
+        for k, v in c:
+            self.assertEqual(v, self.value(k))
+            n += 1
+        self.assertEqual(n, self.nentries)
+        c.close()
+
+    # Every chunk the map records as cached must hold the object's data: the cache file is flushed
+    # before the map is written.
+    def check_map(self, cache_obj, cache_map, bucket_obj):
+        with open(cache_map, 'rb') as f:
+            chunk_map = f.read()
+        with open(cache_obj, 'rb') as f:
+            cached = f.read()
+        with open(bucket_obj, 'rb') as f:
+            data = f.read()
+        self.assertEqual(len(chunk_map), (len(data) + self.chunk_size - 1) // self.chunk_size)
+        self.assertIn(1, chunk_map)
+        for i, present in enumerate(chunk_map):
+            if present:
+                chunk = slice(i * self.chunk_size, (i + 1) * self.chunk_size)
+                self.assertEqual(cached[chunk], data[chunk])
+
+    def test_tiered(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        c = self.session.open_cursor(self.uri)
+        for i in range(self.nentries):
+            c[i] = self.value(i)
+        c.close()
+        self.session.checkpoint()
+        self.session.checkpoint('flush_tier=(enabled,sync=true)')
+
+        # Remove the local and cached copies of the object, so it must be read from the bucket.
+        self.close_conn()
+        bucket_obj = os.path.join(self.bucket, self.bucket_prefix + self.obj1file)
+        cache_obj = os.path.join('cache-' + self.bucket, self.bucket_prefix + self.obj1file)
+        cache_map = cache_obj + '.MAP'
+        for f in (self.obj1file, cache_obj):
+            if os.path.exists(f):
+                os.remove(f)
+        self.reopen_conn()
+
+        # Reading a single key caches only the chunks read, the cache file is sparse and has a map.
+        c = self.session.open_cursor(self.uri)
+        self.assertEqual(c[self.nentries // 2], self.value(self.nentries // 2))
+        c.close()
+        obj_size = os.path.getsize(bucket_obj)
+        self.assertEqual(os.path.getsize(cache_obj), obj_size)
+        self.assertTrue(os.path.exists(cache_map))
+        self.assertLess(os.stat(cache_obj).st_blocks * 512, obj_size // 2)
+        self.check_map(cache_obj, cache_map, bucket_obj)
+        self.close_conn()
+        self.check_map(cache_obj, cache_map, bucket_obj)
+
+        # A later connection picks up the partially cached object, reading everything from it
+        # returns the same data.
+        self.reopen_conn()
+        self.check()
+        self.assertGreater(os.stat(cache_obj).st_blocks * 512, obj_size // 2)
+        self.reopen_conn()
+        self.check()
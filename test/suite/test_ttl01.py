@@ -0,0 +1,179 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_ttl01.py
+#
+# Test tables with a record time-to-live: expired records are hidden from readers at or after their
+# expiry, and removed by reconciliation once every reader's timestamp is past their expiry.
+class test_ttl01(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(all)'
+    nrows = 1000
+
+    def get_stat(self, stat):
+        stat_cursor = self.session.open_cursor('statistics:')
+        val = stat_cursor[stat][2]
+        stat_cursor.close()
+        return val
+
+    def count(self, uri, read_ts=None):
+        if read_ts is not None:
+            self.session.begin_transaction('read_timestamp=' + self.timestamp_str(read_ts))
+        cursor = self.session.open_cursor(uri)
+        n = 0
+        for k, v in cursor:
+            n += 1
+        cursor.close()
+        if read_ts is not None:
+            self.session.rollback_transaction()
+        return n
+
+    def load(self, uri, start, stop, commit_ts, expiry=None):
+        cursor = self.session.open_cursor(uri)
+        for i in range(start, stop):
+            self.session.begin_transaction()
+            if expiry is None:
+                cursor['key%06d' % i] = 'value%06d' % i
+            else:
+                cursor['key%06d' % i] = ('value%06d' % i, expiry)
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(commit_ts))
+        cursor.close()
+
+    def test_ttl_config(self):
+        msg = '/not supported for column-stores/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create('table:ttl01_col',
+            'key_format=r,value_format=S,time_to_live=(duration=10)'), msg)
+        msg = '/is not an integer field/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create('table:ttl01_str',
+            'key_format=S,value_format=Si,time_to_live=(value_field=0)'), msg)
+        msg = '/not in value format/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create('table:ttl01_missing',
+            'key_format=S,value_format=Si,time_to_live=(value_field=2)'), msg)
+
+    def test_ttl_duration(self):
+        uri = 'table:ttl01_duration'
+        self.session.create(uri, 'key_format=S,value_format=S,time_to_live=(duration=100)')
+        self.load(uri, 0, self.nrows, 10)
+        self.load(uri, self.nrows, 2 * self.nrows, 200)
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1) +
+            ',stable_timestamp=' + self.timestamp_str(300))
+
+        # Records expire a duration after their commit timestamp.
+        self.assertEqual(self.count(uri, 50), self.nrows)
+        self.assertEqual(self.count(uri, 110), 0)
+        self.assertEqual(self.count(uri, 250), self.nrows)
+        self.assertEqual(self.count(uri, 300), 0)
+
+        # Readers without a read timestamp see records that haven't expired at the oldest timestamp.
+        self.assertEqual(self.count(uri), 2 * self.nrows)
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(150))
+        self.assertEqual(self.count(uri), self.nrows)
+
+        # Reconciliation removes records expired before the oldest timestamp.
+        self.session.checkpoint()
+        self.assertEqual(self.get_stat(stat.conn.rec_time_to_live_expired), self.nrows)
+        self.assertGreater(self.get_stat(stat.conn.rec_time_to_live_bytes), 0)
+
+        # Expiry is based on the commit timestamp kept on disk across restarts.
+        self.reopen_conn()
+        self.assertEqual(self.count(uri, 250), self.nrows)
+        self.assertEqual(self.count(uri, 300), 0)
+
+    def test_ttl_value_field(self):
+        uri = 'table:ttl01_value_field'
+        self.session.create(uri, 'key_format=S,value_format=Sq,time_to_live=(value_field=1)')
+        self.load(uri, 0, self.nrows, 10, 0)
+        self.load(uri, self.nrows, 2 * self.nrows, 10, 50)
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1) +
+            ',stable_timestamp=' + self.timestamp_str(100))
+
+        # Records with an expiry of zero never expire.
+        self.assertEqual(self.count(uri, 20), 2 * self.nrows)
+        self.assertEqual(self.count(uri, 50), self.nrows)
+
+        # Expired keys don't exist for searches and inserts.
+        self.session.begin_transaction('read_timestamp=' + self.timestamp_str(60))
+        cursor = self.session.open_cursor(uri, None, 'overwrite=false')
+        cursor.set_key('key%06d' % (self.nrows + 1))
+        self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        cursor.set_value('value', 0)
+        self.assertEqual(cursor.insert(), 0)
+        cursor.set_key('key%06d' % 1)
+        cursor.set_value('value', 0)
+        self.assertRaisesException(wiredtiger.WiredTigerError,
+            lambda: cursor.insert(), '/WT_DUPLICATE_KEY/')
+        cursor.close()
+        self.session.rollback_transaction()
+
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(60))
+        self.session.checkpoint()
+        self.assertEqual(self.get_stat(stat.conn.rec_time_to_live_expired), self.nrows)
+        self.assertEqual(self.count(uri), self.nrows)
+
+    def test_ttl_compact(self):
+        uri = 'table:ttl01_compact'
+        self.session.create(uri, 'key_format=S,value_format=S,time_to_live=(duration=100)')
+
+        # Mix expired and live records on every page: at a pinned timestamp of 150 the records
+        # committed at 10 have expired, the records committed at 60 haven't.
+        cursor = self.session.open_cursor(uri)
+        for i in range(0, 20000):
+            self.session.begin_transaction()
+            cursor['key%06d' % i] = 'x' * 150
+            ts = 10 if i % 2 == 0 else 60
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(ts))
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(1) +
+            ',stable_timestamp=' + self.timestamp_str(64))
+        self.session.checkpoint()
+
+        # Free the first half of the file so compaction has space to recover.
+        for i in range(0, 10000):
+            self.session.begin_transaction()
+            cursor.set_key('key%06d' % i)
+            self.assertEqual(cursor.remove(), 0)
+            self.session.commit_transaction('commit_timestamp=' + self.timestamp_str(70))
+        cursor.close()
+        self.conn.set_timestamp('oldest_timestamp=' + self.timestamp_str(150) +
+            ',stable_timestamp=' + self.timestamp_str(150))
+        self.session.checkpoint()
+
+        # Compaction reviews the on-disk leaf pages where most records have expired, and marks them
+        # for rewrite.
+        self.reopen_conn()
+        self.session.compact(uri)
+        stat_cursor = self.session.open_cursor('statistics:' + uri, None, 'statistics=(all)')
+        self.assertGreater(stat_cursor[stat.dsrc.btree_compact_pages_time_to_live][2], 0)
+        stat_cursor.close()
+        self.assertEqual(self.count(uri), 5000)
+
+if __name__ == '__main__':
+    wttest.run()
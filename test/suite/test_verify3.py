@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_verify3.py
+#       Verify and salvage with helper threads.
+
+import os
+import wiredtiger, wttest
+from wtdataset import simple_key, simple_value
+from wtscenario import make_scenarios
+
+class test_verify3(wttest.WiredTigerTestCase):
+    uri = 'file:test_verify3.wt'
+    nentries = 20000
+
+    formats = [
+        ('fix', dict(keyfmt='r', valfmt='8t')),
+        ('var', dict(keyfmt='r', valfmt='S')),
+        ('row', dict(keyfmt='S', valfmt='S')),
+    ]
+    threads = [
+        ('threads-2', dict(nthreads=2)),
+        ('threads-8', dict(nthreads=8)),
+    ]
+    scenarios = make_scenarios(formats, threads)
+
+    def populate(self):
+        self.session.create(self.uri,
+            'key_format={},value_format={},leaf_page_max=4KB'.format(self.keyfmt, self.valfmt))
+        cursor = self.session.open_cursor(self.uri)
+        for i in range(1, self.nentries + 1):
+            cursor[simple_key(cursor, i)] = simple_value(cursor, i)
+            if i % 5000 == 0:
+                self.session.checkpoint()
+        cursor.close()
+        self.session.checkpoint()
+
+    def contents(self):
+        cursor = self.session.open_cursor(self.uri)
+        result = [(key, value) for key, value in cursor]
+        cursor.close()
+        return result
+
+    # Threaded verify of a correct file succeeds.
+    def test_verify_threads(self):
+        self.populate()
+        self.session.verify(self.uri, 'threads={}'.format(self.nthreads))
+
+    # Threaded salvage of a correct file loses nothing.
+    def test_salvage_threads(self):
+        self.populate()
+        self.session.salvage(self.uri, 'threads={}'.format(self.nthreads))
+        cursor = self.session.open_cursor(self.uri)
+        expected = [(simple_key(cursor, i), simple_value(cursor, i))
+            for i in range(1, self.nentries + 1)]
+        cursor.close()
+        self.assertEqual(self.contents(), expected)
+        self.session.verify(self.uri, 'threads={}'.format(self.nthreads))
+
+    # Threaded salvage of a damaged file recovers the same records as single-threaded salvage.
+    def test_salvage_threads_damaged(self):
+        self.populate()
+        self.close_conn()
+
+        path = os.path.join(self.home, 'test_verify3.wt')
+        with open(path, 'r+b') as f:
+            size = os.path.getsize(path)
+            for offset in range(size // 5, size, size // 5):
+                f.seek(offset)
+                f.write(b'\xff' * 100)
+        with open(path, 'rb') as f:
+            damaged = f.read()
+
+        self.open_conn()
+        self.session.salvage(self.uri, None)
+        expected = self.contents()
+        self.close_conn()
+
+        with open(path, 'wb') as f:
+            f.write(damaged)
+        self.open_conn()
+        self.session.salvage(self.uri, 'threads={}'.format(self.nthreads))
+        self.assertEqual(self.contents(), expected)
+        self.session.verify(self.uri, 'threads={}'.format(self.nthreads))
+
+if __name__ == '__main__':
+    wttest.run()
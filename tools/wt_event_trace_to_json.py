@@ -0,0 +1,134 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-present MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# Convert WiredTiger event trace files into the Chrome trace event format, readable by
+# chrome://tracing and Perfetto. See the event_tracing page of the documentation for how trace
+# files are written.
+#
+#   $ python .../tools/wt_event_trace_to_json.py [-o output.json] event-trace.*
+
+import argparse, json, os, struct, sys
+
+# This version must be the same as WT_EVENT_TRACE_VERSION in ../src/include/event_trace.h.
+TRACE_VERSION = 1
+
+# These formats must match the structures in ../src/include/event_trace.h.
+HEADER = struct.Struct('<IIQQQII')
+SESSION = struct.Struct('<IIQ')
+RECORD = struct.Struct('<QQIHBx')
+
+# Event type names in WT_EVENT_TRACE_* order, the first entries in every name table.
+TYPES = ['api', 'checkpoint', 'evict', 'log-write', 'page-read', 'reconcile', 'trigger']
+
+def signed(v):
+    return v - (1 << 64) if v >= (1 << 63) else v
+
+def event_args(type_name, phase, arg):
+    if phase == 'B':
+        return None
+    if type_name in ('log-write', 'page-read'):
+        return {'bytes': arg}
+    if type_name == 'trigger':
+        return {'elapsed_ns': arg}
+    return {'ret': signed(arg)}
+
+def read_names(data, offset, count):
+    names = []
+    for _ in range(count):
+        (length,) = struct.unpack_from('<I', data, offset)
+        offset += 4
+        names.append(data[offset:offset + length].decode('utf-8', 'replace'))
+        offset += length
+    return names
+
+def convert(path, pid, events):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit('{}: truncated event trace file'.format(path))
+    version, ratio, epoch_nsec, epoch_ticks, names_offset, name_count, session_count = \
+        HEADER.unpack_from(data, 0)
+    if version != TRACE_VERSION:
+        sys.exit('{}: unsupported event trace version {}'.format(path, version))
+    names = read_names(data, names_offset, name_count)
+
+    # Convert clock ticks to wall clock microseconds, using the clock reading in the header.
+    ticks_per_nsec = ratio / 1000.0 if ratio != 0 else 1.0
+    def usecs(ticks):
+        return (epoch_nsec - (epoch_ticks - ticks) / ticks_per_nsec) / 1000.0
+
+    events.append({'ph': 'M', 'name': 'process_name', 'pid': pid, 'tid': 0,
+        'args': {'name': os.path.basename(path)}})
+    offset = HEADER.size
+    for _ in range(session_count):
+        sid, internal, records = SESSION.unpack_from(data, offset)
+        offset += SESSION.size
+        events.append({'ph': 'M', 'name': 'thread_name', 'pid': pid, 'tid': sid,
+            'args': {'name': 'session {}{}'.format(sid, ' (internal)' if internal else '')}})
+
+        # The oldest records may have lost the start of an operation, skip unmatched ends.
+        depth = 0
+        for _ in range(records):
+            ticks, arg, name, etype, phase = RECORD.unpack_from(data, offset)
+            offset += RECORD.size
+            phase = chr(phase)
+            if phase == 'B':
+                depth += 1
+            elif phase == 'E':
+                if depth == 0:
+                    continue
+                depth -= 1
+            type_name = TYPES[etype] if etype < len(TYPES) else str(etype)
+            event = {'name': names[name], 'cat': type_name, 'ph': phase, 'ts': usecs(ticks),
+                'pid': pid, 'tid': sid}
+            if phase == 'i':
+                event['s'] = 't'
+            args = event_args(type_name, phase, arg)
+            if args is not None:
+                event['args'] = args
+            events.append(event)
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Convert WiredTiger event trace files to Chrome trace event JSON.')
+    parser.add_argument('-o', '--output', help='output file (default stdout)')
+    parser.add_argument('files', nargs='+', help='event trace files')
+    args = parser.parse_args()
+
+    events = []
+    for pid, path in enumerate(args.files, start=1):
+        convert(path, pid, events)
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, out)
+    out.write('\n')
+    if args.output:
+        out.close()
+
+if __name__ == '__main__':
+    main()